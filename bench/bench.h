@@ -0,0 +1,36 @@
+#ifndef BENCH_H
+#define BENCH_H
+
+#include <stdint.h>
+
+// Host benchmark registry. Each suite registers itself at static init and
+// is run by benchMain.cpp, either all of them or the ones named on the
+// command line. Results are printed one case per line as key=value pairs.
+
+typedef void (*BenchFn)(uint32_t iterations);
+
+struct BenchSuite {
+  BenchSuite(const char *name, BenchFn fn, uint32_t defaultIterations);
+
+  const char *name;
+  BenchFn fn;
+  uint32_t defaultIterations;
+  BenchSuite *next;
+};
+
+#define BENCH_SUITE(name, defaultIterations)                           \
+  static void name##Bench(uint32_t);                                   \
+  static BenchSuite name##Suite(#name, name##Bench, defaultIterations); \
+  static void name##Bench(uint32_t iterations)
+
+// Monotonic host time in nanoseconds
+uint64_t benchNowNs();
+
+// Print a result line: "<suite>.<case> key=value ..."
+void benchBegin(const char *suite, const char *caseName);
+void benchField(const char *key, uint64_t value);
+void benchFieldF(const char *key, double value);
+void benchFieldS(const char *key, const char *value);
+void benchEnd();
+
+#endif // BENCH_H
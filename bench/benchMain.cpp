@@ -0,0 +1,83 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include <chrono>
+
+#include "bench.h"
+
+namespace {
+
+BenchSuite *suites = nullptr;
+
+void usage(const char *argv0) {
+  printf("usage: %s [-n iterations] [suite...]\n", argv0);
+  printf("suites:");
+  for (BenchSuite *s = suites; s; s = s->next) printf(" %s", s->name);
+  printf("\n");
+}
+
+} // namespace
+
+BenchSuite::BenchSuite(const char *name, BenchFn fn, uint32_t defaultIterations)
+    : name(name), fn(fn), defaultIterations(defaultIterations), next(nullptr) {
+  // Keep registration order stable regardless of link order
+  BenchSuite **tail = &suites;
+  while (*tail && strcmp((*tail)->name, name) < 0) tail = &(*tail)->next;
+  next = *tail;
+  *tail = this;
+}
+
+uint64_t benchNowNs() {
+  return (uint64_t)std::chrono::duration_cast<std::chrono::nanoseconds>(
+             std::chrono::steady_clock::now().time_since_epoch())
+      .count();
+}
+
+void benchBegin(const char *suite, const char *caseName) {
+  printf("%s.%s", suite, caseName);
+}
+
+void benchField(const char *key, uint64_t value) {
+  printf(" %s=%llu", key, (unsigned long long)value);
+}
+
+void benchFieldF(const char *key, double value) { printf(" %s=%.3f", key, value); }
+
+void benchFieldS(const char *key, const char *value) { printf(" %s=%s", key, value); }
+
+void benchEnd() {
+  printf("\n");
+  fflush(stdout);
+}
+
+int main(int argc, char **argv) {
+  uint32_t iterations = 0;
+  int first = 1;
+
+  if (argc > 2 && strcmp(argv[1], "-n") == 0) {
+    iterations = (uint32_t)strtoul(argv[2], nullptr, 10);
+    first = 3;
+  } else if (argc > 1 && (strcmp(argv[1], "-h") == 0 || strcmp(argv[1], "--help") == 0)) {
+    usage(argv[0]);
+    return 0;
+  }
+
+  int ran = 0;
+  for (BenchSuite *s = suites; s; s = s->next) {
+    bool selected = first >= argc;
+    for (int i = first; i < argc; i++) {
+      if (strcmp(argv[i], s->name) == 0) selected = true;
+    }
+    if (!selected) continue;
+
+    s->fn(iterations ? iterations : s->defaultIterations);
+    ran++;
+  }
+
+  if (ran == 0) {
+    usage(argv[0]);
+    return 1;
+  }
+  return 0;
+}
@@ -0,0 +1,54 @@
+#include "DisplayMemory.h"
+#include "bench.h"
+#include "displayFunctions.h"
+
+// One tick per second on the time screen: the full repaint displayTime()
+// against the in-place updateTime(). Both end on the same second, so the
+// final framebuffers must match.
+
+namespace {
+
+const time_t kStart = 1750064400; // 08:00:00
+
+void runTicks(const char *suite, const char *name, void (*tick)(time_t), uint32_t iterations) {
+  displayTime(kStart - 1);
+  displayBus.resetStats();
+  uint64_t start = benchNowNs();
+  for (uint32_t i = 0; i < iterations; i++) {
+    tick(kStart + i);
+  }
+  uint64_t elapsed = benchNowNs() - start;
+
+  const BusStats &stats = displayBus.stats();
+  benchBegin(suite, name);
+  benchField("ticks", iterations);
+  benchField("pixels", stats.pixels / iterations);
+  benchField("windows", stats.addressWindows / iterations);
+  benchField("wire_bytes", ((uint64_t)stats.commandBytes + stats.dataBytes) / iterations);
+  benchFieldF("host_us", elapsed / 1000.0 / iterations);
+  benchField("protocol_errors", stats.protocolErrors);
+  benchField("checksum", displayBus.checksum());
+  benchEnd();
+}
+
+void runClock(const char *suite, bool useFrameBuffer, uint32_t iterations,
+              uint8_t indexedBits = COMPOSITOR_INDEXED_BITS) {
+  tft.begin();
+  tft.setRotation(3);
+  compositor.begin(useFrameBuffer, COMPOSITOR_BAND_HEIGHT, indexedBits);
+  enableSlideTransitions = false;
+
+  runTicks(suite, "repaint", displayTime, iterations);
+  runTicks(suite, "incremental", updateTime, iterations);
+}
+
+} // namespace
+
+BENCH_SUITE(clock, 600) {
+  runClock("clock", true, iterations);
+  runClock("clock_direct", false, iterations);
+  displaySetPsramAvailable(false);
+  runClock("clock_indexed", true, iterations);
+  runClock("clock_banded", true, iterations, 0);
+  displaySetPsramAvailable(true);
+}
@@ -0,0 +1,33 @@
+#if defined(ESP32)
+
+#include <Arduino.h>
+
+#include "GraphicsBench.h"
+#include "displayFunctions.h"
+
+// Firmware for env:graphics_bench: the graphics test on the real panel,
+// printed over serial in the same format as the native `graphics` suite.
+// Capture it and check it with tools/bench_compare.py.
+
+#ifndef GRAPHICS_BENCH_RUNS
+#define GRAPHICS_BENCH_RUNS 9
+#endif
+
+void setup() {
+  Serial.begin(115200);
+  tft.begin();
+  tft.setRotation(3); // Landscape, as the application runs it
+
+  GraphicsTarget target = {tft, &displayBus};
+  Serial.println("graphics.begin");
+  for (size_t i = 0; i < graphicsCaseCount; i++) {
+    GraphicsResult result = runGraphicsCase(graphicsCases[i], target, GRAPHICS_BENCH_RUNS);
+    printGraphicsResult(Serial, graphicsCases[i].name, result);
+    Serial.println();
+  }
+  Serial.println("graphics.end");
+}
+
+void loop() { delay(1000); }
+
+#endif // ESP32
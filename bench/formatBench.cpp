@@ -0,0 +1,136 @@
+#include <Arduino.h>
+#include <stdio.h>
+#include <string.h>
+
+#include "NumberFormat.h"
+#include "bench.h"
+
+// NumberFormat against what the screens used before it: formatLargeNumber
+// growing a String, snprintf("%.1f") and the sprintf clock readout. Each
+// pair must produce the same text.
+
+namespace {
+
+volatile uint32_t sink;
+
+// formatLargeNumber as it was
+String legacyFormatLargeNumber(unsigned long number) {
+  String result = "";
+  String numStr = String(number);
+
+  int len = numStr.length();
+  int commaPos = len % 3;
+  if (commaPos == 0) commaPos = 3;
+
+  for (int i = 0; i < len; i++) {
+    result += numStr[i];
+    if ((i + 1) == commaPos && (i + 1) < len) {
+      result += ",";
+      commaPos += 3;
+    }
+  }
+
+  return result;
+}
+
+uint32_t textSum(const char *text) {
+  uint32_t sum = 0;
+  while (*text) sum = sum * 31 + (uint8_t)*text++;
+  return sum;
+}
+
+void report(const char *name, uint32_t calls, uint64_t elapsed, uint32_t sum, uint32_t mismatches) {
+  sink = sum;
+  benchBegin("format", name);
+  benchField("calls", calls);
+  benchFieldF("ns_per_call", (double)elapsed / calls);
+  benchField("mismatches", mismatches);
+  benchEnd();
+}
+
+// Population counts as the screen steps through them
+unsigned long population(uint32_t i) { return 2860000000UL + (i % 105) * 10000000UL + i; }
+
+// One decimal readings from -40.0 to 159.9 plus the odd fraction
+float reading(uint32_t i) { return (int32_t)(i % 2000 - 400) / 10.0f + (i % 7) * 0.013f; }
+
+} // namespace
+
+BENCH_SUITE(format, 200) {
+  const uint32_t calls = iterations * 100;
+  char text[32];
+
+  // Grouping
+  uint32_t mismatches = 0;
+  for (uint32_t i = 0; i < 10000; i++) {
+    formatGrouped(text, sizeof(text), population(i * 997));
+    if (legacyFormatLargeNumber(population(i * 997)) != text) mismatches++;
+  }
+  uint64_t start = benchNowNs();
+  uint32_t sum = 0;
+  for (uint32_t i = 0; i < calls; i++) sum += textSum(legacyFormatLargeNumber(population(i)).c_str());
+  report("grouped_string", calls, benchNowNs() - start, sum, 0);
+
+  start = benchNowNs();
+  sum = 0;
+  for (uint32_t i = 0; i < calls; i++) {
+    formatGrouped(text, sizeof(text), population(i));
+    sum += textSum(text);
+  }
+  report("grouped_fixed", calls, benchNowNs() - start, sum, mismatches);
+
+  // One decimal place
+  mismatches = 0;
+  for (uint32_t i = 0; i < 10000; i++) {
+    char printed[32];
+    snprintf(printed, sizeof(printed), "%.1f", reading(i));
+    formatDecimal(text, sizeof(text), reading(i), 1);
+    // snprintf shows readings that round to zero from below as "-0.0"
+    const char *expected = strcmp(printed, "-0.0") == 0 ? "0.0" : printed;
+    if (strcmp(expected, text) != 0) mismatches++;
+  }
+  start = benchNowNs();
+  sum = 0;
+  for (uint32_t i = 0; i < calls; i++) {
+    snprintf(text, sizeof(text), "%.1f", reading(i));
+    sum += textSum(text);
+  }
+  report("decimal_snprintf", calls, benchNowNs() - start, sum, 0);
+
+  start = benchNowNs();
+  sum = 0;
+  for (uint32_t i = 0; i < calls; i++) {
+    formatDecimal(text, sizeof(text), reading(i), 1);
+    sum += textSum(text);
+  }
+  report("decimal_fixed", calls, benchNowNs() - start, sum, mismatches);
+
+  // Clock readout "hh:mm" and "MM/DD/YYYY"
+  mismatches = 0;
+  start = benchNowNs();
+  sum = 0;
+  for (uint32_t i = 0; i < calls; i++) {
+    sprintf(text, "%2d:%02d", (int)(i % 12 + 1), (int)(i % 60));
+    sum += textSum(text);
+    sprintf(text, "%02d/%02d/%04d", (int)(i % 12 + 1), (int)(i % 28 + 1), (int)(2000 + i % 50));
+    sum += textSum(text);
+  }
+  report("clock_sprintf", calls, benchNowNs() - start, sum, 0);
+  uint32_t expected = sum;
+
+  start = benchNowNs();
+  sum = 0;
+  for (uint32_t i = 0; i < calls; i++) {
+    size_t n = formatUnsigned(text, sizeof(text), i % 12 + 1, 2, ' ');
+    n += formatText(text + n, sizeof(text) - n, ":");
+    formatUnsigned(text + n, sizeof(text) - n, i % 60, 2);
+    sum += textSum(text);
+    n = formatUnsigned(text, sizeof(text), i % 12 + 1, 2);
+    n += formatText(text + n, sizeof(text) - n, "/");
+    n += formatUnsigned(text + n, sizeof(text) - n, i % 28 + 1, 2);
+    n += formatText(text + n, sizeof(text) - n, "/");
+    formatUnsigned(text + n, sizeof(text) - n, 2000 + i % 50, 4);
+    sum += textSum(text);
+  }
+  report("clock_fixed", calls, benchNowNs() - start, sum, sum != expected);
+}
@@ -0,0 +1,150 @@
+#include <stdio.h>
+
+#include "DisplayMemory.h"
+#include "bench.h"
+#include "displayFunctions.h"
+
+// Frame cost of each production screen on the recording bus. On-device
+// time is estimated from the traffic that would cross the bus, for the
+// old bit-banged transport and for the 40 MHz DMA backend. `frame` runs
+// the compositor double buffered, `direct` without the frame buffers,
+// `nopsram` and `indexed` on internal SRAM index planes, `bands` in
+// internal SRAM bands.
+
+namespace {
+
+// Bit-banged Adafruit soft SPI on the ESP32 clocks out roughly 3 Mbit/s
+const double kSoftSpiBitsPerUs = 3.0;
+
+// Esp32SpiBus: 40 MHz clock plus driver setup for every DC run
+const double kDmaSpiBitsPerUs = 40.0;
+const double kDmaSegmentUs = 3.0;
+
+typedef void (*RenderFn)(uint32_t i);
+
+void renderWeather(uint32_t i) {
+  static const WeatherCondition conditions[] = {WEATHER_SUNNY, WEATHER_CLOUDY, WEATHER_RAIN, WEATHER_SUNNY};
+  WeatherData weather = {15.0f + (i % 10), 60.0f + (i % 30), conditions[i % 4], i % 4 == 3};
+  displayWeather(weather);
+}
+
+void renderTime(uint32_t i) { displayTime((time_t)1750064400 + i * 61); }
+
+void renderPopulation(uint32_t i) { displayPopulation(2860000000UL + i * 10000000UL); }
+
+void renderSpeed(uint32_t i) {
+  static const float speeds[] = {60.0f, 85.0f, 120.0f};
+  displaySpeed(speeds[i % 3]);
+}
+
+void renderCycle(uint32_t i) {
+  // Mode rotation as loop() does it
+  switch (i % 4) {
+  case 0: renderWeather(i / 4); break;
+  case 1: renderTime(i / 4); break;
+  case 2: renderPopulation(i / 4); break;
+  case 3: renderSpeed(i / 4); break;
+  }
+}
+
+void runScreen(const char *suite, const char *name, RenderFn render, uint32_t iterations) {
+  // Settle the compositor on this screen before measuring
+  render(iterations);
+  displayBus.resetStats();
+  compositor.resetStats();
+  uint64_t start = benchNowNs();
+  for (uint32_t i = 0; i < iterations; i++) {
+    render(i);
+  }
+  uint64_t elapsed = benchNowNs() - start;
+
+  const BusStats &stats = displayBus.stats();
+  uint64_t wireBytes = (uint64_t)stats.commandBytes + stats.dataBytes;
+  double dmaUs = wireBytes * 8.0 / kDmaSpiBitsPerUs + stats.segments * kDmaSegmentUs;
+
+  benchBegin(suite, name);
+  benchField("iterations", iterations);
+  benchField("pixels", stats.pixels / iterations);
+  benchField("windows", stats.addressWindows / iterations);
+  benchField("wire_bytes", wireBytes / iterations);
+  benchField("segments", stats.segments / iterations);
+  benchField("cleared_px", compositor.stats().pixelsCleared / iterations);
+  benchField("flushed_px", compositor.stats().pixelsFlushed / iterations);
+  benchField("saved_px", compositor.stats().pixelsSaved / iterations);
+  benchFieldF("est_soft_us", wireBytes * 8.0 / kSoftSpiBitsPerUs / iterations);
+  benchFieldF("est_dma_us", dmaUs / iterations);
+  benchFieldF("host_us", elapsed / 1000.0 / iterations);
+  benchField("protocol_errors", stats.protocolErrors);
+  benchField("checksum", displayBus.checksum());
+  benchEnd();
+}
+
+const char *const modeNames[] = {"direct", "banded", "frame_buffer", "indexed"};
+
+void runAllScreens(const char *suite, bool useFrameBuffer, uint32_t iterations,
+                   int16_t bandHeight = COMPOSITOR_BAND_HEIGHT, uint8_t indexedBits = COMPOSITOR_INDEXED_BITS) {
+  tft.begin();
+  tft.setRotation(3);
+  bool buffered = compositor.begin(useFrameBuffer, bandHeight, indexedBits);
+  // Snap the needle and cut between screens; the needle and scroll
+  // suites cover the animations
+  enableSmoothAnimations = false;
+  enableSlideTransitions = false;
+
+  benchBegin(suite, "setup");
+  benchField("frame_buffer", buffered);
+  benchFieldS("mode", modeNames[compositor.mode()]);
+  benchField("band_rows", compositor.isBanded() ? bandHeight : 0);
+  benchField("band_bytes", compositor.bandBytes());
+  benchField("indexed_bits", compositor.isIndexed() ? indexedBits : 0);
+  benchField("indexed_bytes", compositor.indexedBytes());
+  benchEnd();
+
+  runScreen(suite, "weather", renderWeather, iterations);
+  runScreen(suite, "time", renderTime, iterations);
+  runScreen(suite, "population", renderPopulation, iterations);
+  runScreen(suite, "speed", renderSpeed, iterations);
+  runScreen(suite, "cycle", renderCycle, iterations);
+
+  if (compositor.isIndexed()) {
+    benchBegin(suite, "palette");
+    benchField("colors", compositor.palette().size());
+    benchField("capacity", compositor.palette().capacity());
+    benchField("misses", compositor.palette().misses());
+    benchField("resets", compositor.stats().paletteResets);
+    benchEnd();
+  }
+}
+
+} // namespace
+
+BENCH_SUITE(frame, 2000) { runAllScreens("frame", true, iterations); }
+
+BENCH_SUITE(direct, 2000) { runAllScreens("direct", false, iterations); }
+
+// A board without PSRAM must come up indexed, on the same pixels
+BENCH_SUITE(nopsram, 20) {
+  displaySetPsramAvailable(false);
+  runAllScreens("nopsram", true, iterations);
+  displaySetPsramAvailable(true);
+}
+
+// Band height against internal SRAM and full-frame time
+BENCH_SUITE(bands, 20) {
+  static const int16_t heights[] = {8, 16, 30, 60};
+  displaySetPsramAvailable(false);
+  for (int16_t height : heights) {
+    char suite[16];
+    snprintf(suite, sizeof(suite), "bands_%d", height);
+    runAllScreens(suite, true, iterations, height, 0);
+  }
+  displaySetPsramAvailable(true);
+}
+
+// Both index depths against the same pixels; the screens fit in 16 colors
+BENCH_SUITE(indexed, 200) {
+  displaySetPsramAvailable(false);
+  runAllScreens("indexed_8", true, iterations, COMPOSITOR_BAND_HEIGHT, 8);
+  runAllScreens("indexed_4", true, iterations, COMPOSITOR_BAND_HEIGHT, 4);
+  displaySetPsramAvailable(true);
+}
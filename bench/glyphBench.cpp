@@ -0,0 +1,109 @@
+#include "GlyphAtlas.h"
+#include "bench.h"
+#include "displayFunctions.h"
+
+// Large text through Adafruit_GFX (a fillRect per lit font pixel) and
+// through the glyph atlas (one blit per character), drawn on the panel
+// and into a frame buffer. Both paths must leave the same pixels.
+
+namespace {
+
+const double kDmaSpiBitsPerUs = 40.0;
+const double kDmaSegmentUs = 3.0;
+
+struct Line {
+  const char *text;
+  uint8_t size;
+  int16_t x, y;
+};
+
+const Line kLines[] = {
+    {"120.0", 5, 60, 10},
+    {"12:45", 4, 180, 60},
+    {"3,900,000,000", 3, 43, 110},
+    {"km/h", 3, 220, 150},
+};
+
+uint32_t drawAll(Surface &target, GlyphAtlas *atlas) {
+  uint32_t chars = 0;
+  for (const Line &line : kLines) {
+    if (atlas) {
+      atlas->drawText(target, line.x, line.y, line.text, line.size, TEXT_COLOR, BACKGROUND_COLOR);
+    } else {
+      target.setTextSize(line.size);
+      target.setTextColor(TEXT_COLOR);
+      target.setCursor(line.x, line.y);
+      target.print(line.text);
+    }
+    chars += strlen(line.text);
+  }
+  return chars;
+}
+
+void runPanel(const char *name, GlyphAtlas *atlas, uint32_t iterations) {
+  tft.fillScreen(BACKGROUND_COLOR);
+  displayBus.resetStats();
+  uint32_t chars = 0;
+  uint64_t start = benchNowNs();
+  for (uint32_t i = 0; i < iterations; i++) {
+    chars += drawAll(tft, atlas);
+  }
+  uint64_t elapsed = benchNowNs() - start;
+
+  const BusStats &stats = displayBus.stats();
+  uint64_t wireBytes = (uint64_t)stats.commandBytes + stats.dataBytes;
+  double dmaUs = wireBytes * 8.0 / kDmaSpiBitsPerUs + stats.segments * kDmaSegmentUs;
+
+  benchBegin("glyphs", name);
+  benchField("chars", chars);
+  benchFieldF("windows_per_char", (double)stats.addressWindows / chars);
+  benchFieldF("wire_bytes_per_char", (double)wireBytes / chars);
+  benchFieldF("est_dma_chars_per_s", chars * 1e6 / dmaUs);
+  benchFieldF("host_chars_per_s", chars * 1e9 / elapsed);
+  benchField("checksum", displayBus.checksum());
+  benchEnd();
+}
+
+void runFrameBuffer(const char *name, FrameBuffer &fb, GlyphAtlas *atlas, uint32_t iterations) {
+  fb.fillScreen(BACKGROUND_COLOR);
+  uint32_t chars = 0;
+  uint64_t start = benchNowNs();
+  for (uint32_t i = 0; i < iterations; i++) {
+    chars += drawAll(fb, atlas);
+  }
+  uint64_t elapsed = benchNowNs() - start;
+
+  uint32_t checksum = 0;
+  for (int32_t i = 0; i < (int32_t)fb.width() * fb.height(); i++) {
+    checksum = checksum * 31 + fb.pixels()[i];
+  }
+
+  benchBegin("glyphs", name);
+  benchField("chars", chars);
+  benchFieldF("host_chars_per_s", chars * 1e9 / elapsed);
+  benchField("checksum", checksum);
+  benchEnd();
+}
+
+} // namespace
+
+BENCH_SUITE(glyphs, 2000) {
+  tft.begin();
+  tft.setRotation(3);
+  compositor.begin(false);
+
+  GlyphAtlas atlas(64 * 1024, DISPLAY_MEMORY_ANY);
+  runPanel("panel_gfx", nullptr, iterations);
+  runPanel("panel_atlas", &atlas, iterations);
+
+  static uint16_t pixels[320 * 240];
+  FrameBuffer fb(320, 240, pixels);
+  runFrameBuffer("fb_gfx", fb, nullptr, iterations);
+  runFrameBuffer("fb_atlas", fb, &atlas, iterations);
+
+  benchBegin("glyphs", "atlas");
+  benchField("bytes", atlas.bytesUsed());
+  benchField("misses", atlas.stats().misses);
+  benchField("hits", atlas.stats().hits);
+  benchEnd();
+}
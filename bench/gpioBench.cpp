@@ -0,0 +1,131 @@
+#include <stdio.h>
+
+#include "Intersection.h"
+#include "RecordingGpioPort.h"
+#include "bench.h"
+
+// Every state the traffic light pins pass through, register write by
+// register write, while an intersection runs for `iterations` simulated
+// seconds. A state is a glitch if a head is blank or two conflicting
+// heads show green or yellow. `batched` gives Intersection the port, so
+// each change is one set and one clear; `per_head` writes head by head;
+// `per_pin` replays the old setLight(), three digitalWrite()s low and one
+// high, pin by pin.
+
+namespace {
+
+const uint8_t kGroups = 4;
+
+struct Glitches {
+  uint32_t states;
+  uint32_t blank;
+  uint32_t conflicting;
+};
+
+// Head h is on pins 3h (red), 3h + 1 (yellow) and 3h + 2 (green)
+void checkStates(RecordingGpioPort &port, uint8_t headCount, const uint32_t *conflicts, Glitches &glitches) {
+  for (uint16_t i = 0; i < port.historySize(); i++) {
+    uint32_t levels = port.history(i);
+    uint32_t shown = 0;
+    bool blank = false;
+    for (uint8_t h = 0; h < headCount; h++) {
+      uint32_t lamps = (levels >> (h * 3)) & 7;
+      if (!lamps) blank = true;
+      if (lamps & 6) shown |= 1UL << h;
+    }
+    bool conflicting = false;
+    for (uint8_t h = 0; h < headCount; h++) {
+      if ((shown >> h & 1) && (conflicts[h] & shown)) conflicting = true;
+    }
+    glitches.states++;
+    glitches.blank += blank;
+    glitches.conflicting += conflicting;
+  }
+  port.clearHistory();
+}
+
+enum Writes { BATCHED, PER_HEAD, PER_PIN };
+
+void runWrites(uint8_t headCount, Writes writes, uint32_t seconds) {
+  RecordingGpioPort port;
+  RecordingGpioPort legacy;
+  TrafficLight *heads[INTERSECTION_MAX_HEADS];
+  uint32_t conflicts[INTERSECTION_MAX_HEADS];
+  IntersectionPhase phases[kGroups];
+  LightState shown[INTERSECTION_MAX_HEADS];
+
+  // Head h runs in phase h % 4 and conflicts with every other group
+  for (uint8_t p = 0; p < kGroups; p++) phases[p] = {0, 5000, 2000, 1000};
+  for (uint8_t h = 0; h < headCount; h++) {
+    heads[h] = new TrafficLight(h * 3, h * 3 + 1, h * 3 + 2, &port);
+    phases[h % kGroups].green |= 1UL << h;
+    conflicts[h] = 0;
+    shown[h] = RED;
+    legacy.write(heads[h]->pinMask(), heads[h]->lampMask(RED));
+  }
+  for (uint8_t h = 0; h < headCount; h++) {
+    for (uint8_t g = 0; g < headCount; g++) {
+      if (h % kGroups != g % kGroups) conflicts[h] |= 1UL << g;
+    }
+  }
+
+  Intersection intersection(heads, headCount, phases, kGroups, conflicts, writes == BATCHED ? &port : nullptr);
+  intersection.begin(0);
+  port.clearHistory();
+  port.resetStats();
+  legacy.clearHistory();
+  legacy.resetStats();
+
+  Glitches glitches = Glitches();
+  uint32_t transitions = 0, pinWrites = 0;
+  uint64_t writeNs = 0;
+  for (uint32_t ms = 1; ms <= seconds * 1000; ms++) {
+    uint64_t start = benchNowNs();
+    if (!intersection.tick(ms)) continue;
+    writeNs += benchNowNs() - start;
+    transitions++;
+
+    if (writes == PER_PIN) {
+      for (uint8_t h = 0; h < headCount; h++) {
+        LightState state = intersection.headState(h);
+        if (state == shown[h]) continue;
+        uint32_t pins = heads[h]->pinMask();
+        for (uint32_t rest = pins; rest; rest &= rest - 1) legacy.write(rest & -rest, 0);
+        legacy.write(heads[h]->lampMask(state), pins);
+        shown[h] = state;
+        pinWrites += 4;
+      }
+      checkStates(legacy, headCount, conflicts, glitches);
+    } else {
+      checkStates(port, headCount, conflicts, glitches);
+    }
+  }
+
+  static const char *const names[] = {"batched", "per_head", "per_pin"};
+  char name[24];
+  snprintf(name, sizeof(name), "%s_%u", names[writes], headCount);
+  uint32_t registerWrites = writes == PER_PIN ? pinWrites : port.registerWrites();
+  benchBegin("gpio", name);
+  benchField("transitions", transitions);
+  benchField("register_writes", registerWrites);
+  benchFieldF("writes_per_transition", transitions ? (double)registerWrites / transitions : 0.0);
+  benchField("states", glitches.states);
+  benchField("blank", glitches.blank);
+  benchField("conflicting", glitches.conflicting);
+  if (writes != PER_PIN) benchFieldF("ns_per_transition", transitions ? (double)writeNs / transitions : 0.0);
+  benchEnd();
+
+  for (uint8_t h = 0; h < headCount; h++) delete heads[h];
+}
+
+} // namespace
+
+BENCH_SUITE(gpio, 600) {
+  // Three pins a head on a 32 pin port
+  static const uint8_t sizes[] = {2, 4, 10};
+  for (uint8_t heads : sizes) {
+    runWrites(heads, BATCHED, iterations);
+    runWrites(heads, PER_HEAD, iterations);
+    runWrites(heads, PER_PIN, iterations);
+  }
+}
@@ -0,0 +1,82 @@
+#include <stdlib.h>
+
+#include "GraphicsBench.h"
+#include "bench.h"
+#include "displayFunctions.h"
+
+// The Adafruit graphics test (lib/GraphicsBench) on the host: every case on
+// the panel over the recording bus, and again into a memory FrameBuffer
+// (graphics_fb) for the cost of the drawing alone. min/median/max are host
+// microseconds per run over `iterations` runs (at most
+// GRAPHICS_BENCH_MAX_RUNS); traffic and checksums are what
+// tools/bench_compare.py holds exact against bench/baseline/.
+
+namespace {
+
+const double kDmaSpiBitsPerUs = 40.0;
+const double kDmaSegmentUs = 3.0;
+
+uint32_t pixelChecksum(const uint16_t *pixels, size_t count) {
+  uint32_t hash = 2166136261u;
+  for (size_t i = 0; i < count; i++) {
+    hash = (hash ^ (pixels[i] & 0xFF)) * 16777619u;
+    hash = (hash ^ (pixels[i] >> 8)) * 16777619u;
+  }
+  return hash;
+}
+
+void runPanel(uint8_t runs) {
+  tft.begin();
+  tft.setRotation(3);
+  GraphicsTarget target = {tft, &displayBus};
+
+  for (size_t i = 0; i < graphicsCaseCount; i++) {
+    displayBus.resetStats();
+    GraphicsResult result = runGraphicsCase(graphicsCases[i], target, runs);
+
+    const BusStats &stats = displayBus.stats();
+    uint64_t wireBytes = (uint64_t)stats.commandBytes + stats.dataBytes;
+    double dmaUs = wireBytes * 8.0 / kDmaSpiBitsPerUs + stats.segments * kDmaSegmentUs;
+
+    benchBegin("graphics", graphicsCases[i].name);
+    benchField("runs", result.runs);
+    benchField("min_us", result.minUs);
+    benchField("median_us", result.medianUs);
+    benchField("max_us", result.maxUs);
+    benchField("pixels", stats.pixels / result.runs);
+    benchField("windows", stats.addressWindows / result.runs);
+    benchField("wire_bytes", wireBytes / result.runs);
+    benchFieldF("est_dma_us", dmaUs / result.runs);
+    benchField("protocol_errors", stats.protocolErrors);
+    benchField("checksum", displayBus.checksum());
+    benchEnd();
+  }
+}
+
+void runFrameBuffer(uint8_t runs) {
+  const int16_t w = 320, h = 240;
+  uint16_t *pixels = (uint16_t *)malloc((size_t)w * h * sizeof(uint16_t));
+  if (!pixels) return;
+  FrameBuffer frame(w, h, pixels);
+  GraphicsTarget target = {frame, nullptr};
+
+  for (size_t i = 0; i < graphicsCaseCount; i++) {
+    GraphicsResult result = runGraphicsCase(graphicsCases[i], target, runs);
+    benchBegin("graphics_fb", graphicsCases[i].name);
+    benchField("runs", result.runs);
+    benchField("min_us", result.minUs);
+    benchField("median_us", result.medianUs);
+    benchField("max_us", result.maxUs);
+    benchField("checksum", pixelChecksum(pixels, (size_t)w * h));
+    benchEnd();
+  }
+  free(pixels);
+}
+
+} // namespace
+
+BENCH_SUITE(graphics, 9) {
+  uint8_t runs = iterations < GRAPHICS_BENCH_MAX_RUNS ? (uint8_t)iterations : GRAPHICS_BENCH_MAX_RUNS;
+  runPanel(runs);
+  runFrameBuffer(runs);
+}
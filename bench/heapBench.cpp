@@ -0,0 +1,77 @@
+#include "HeapGuard.h"
+#include "bench.h"
+#include "displayFunctions.h"
+
+// The zero-heap-after-setup policy on the host: brings the display up the
+// way setup() does, arms the heap guard in counting mode and runs the
+// loop() screen rotation, slide transitions, tick updates and needle
+// sweeps included. Any allocation shows up as after_setup; the heap
+// report follows.
+
+namespace {
+
+void runLoop(uint32_t iterations) {
+  static const WeatherCondition conditions[] = {WEATHER_SUNNY, WEATHER_CLOUDY, WEATHER_RAIN, WEATHER_SUNNY};
+  static const float speeds[] = {60.0f, 85.0f, 120.0f};
+
+  unsigned long simMs = 0;
+  for (uint32_t i = 0; i < iterations; i++) {
+    // Let the last screen finish sliding in
+    while (animateTransition(simMs += TRANSITION_FRAME_MS)) {
+    }
+    switch (i % 4) {
+    case 0: {
+      WeatherData weather = {15.0f + (i % 10), 60.0f + (i % 30), conditions[i / 4 % 4], i / 4 % 4 == 3};
+      displayWeather(weather);
+      break;
+    }
+    case 1: {
+      time_t t = (time_t)1750064400 + i * 61;
+      displayTime(t);
+      for (int s = 1; s <= 10; s++) updateTime(t + s);
+      break;
+    }
+    case 2: displayPopulation(2860000000UL + i * 10000000UL); break;
+    case 3:
+      displaySpeed(speeds[i / 4 % 3]);
+      for (int f = 0; f < 60; f++) animateSpeedNeedle(simMs += NEEDLE_FRAME_MS);
+      break;
+    }
+  }
+}
+
+void runHeap(const char *suite, bool useFrameBuffer, uint32_t iterations) {
+  tft.begin();
+  tft.setRotation(3);
+  compositor.begin(useFrameBuffer);
+  prepareDisplayCaches();
+  enableSmoothAnimations = true;
+  enableSlideTransitions = true;
+
+  resetHeapGuardStats();
+  heapGuardArm(false);
+  runLoop(iterations);
+  heapGuardDisarm();
+
+  const HeapGuardStats &stats = heapGuardStats();
+  HeapReport report = heapReport();
+  benchBegin(suite, useFrameBuffer ? "frame" : "direct");
+  benchField("guard", heapGuardEnabled());
+  benchField("iterations", iterations);
+  benchField("after_setup", stats.armedAllocations);
+  benchField("after_setup_bytes", stats.armedBytes);
+  benchField("heap_free", report.freeBytes);
+  // The host allocator has no largest block to report
+  if (report.largestFreeBlock) {
+    benchField("heap_largest", report.largestFreeBlock);
+    benchField("heap_frag_pct", report.fragmentationPercent);
+  }
+  benchEnd();
+}
+
+} // namespace
+
+BENCH_SUITE(heap, 400) {
+  runHeap("heap", true, iterations);
+  runHeap("heap", false, iterations);
+}
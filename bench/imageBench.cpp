@@ -0,0 +1,78 @@
+#include "RleImage.h"
+#include "bench.h"
+#include "displayFunctions.h"
+
+#include "../src/test/testImage.h"
+#include "../src/test/testImageRle.h"
+
+// src/test/testImage.h as the reference asset: the raw RGB565 array
+// pushed with drawRGBBitmap against the RLE version streamed a scanline
+// at a time. The panel must end up with the same pixels.
+
+namespace {
+
+const double kDmaSpiBitsPerUs = 40.0;
+const double kDmaSegmentUs = 3.0;
+
+void report(const char *name, uint32_t iterations, uint64_t elapsed) {
+  const BusStats &stats = displayBus.stats();
+  uint64_t wireBytes = (uint64_t)stats.commandBytes + stats.dataBytes;
+  double dmaUs = wireBytes * 8.0 / kDmaSpiBitsPerUs + stats.segments * kDmaSegmentUs;
+
+  benchBegin("image", name);
+  benchField("iterations", iterations);
+  benchFieldF("host_us", elapsed / 1000.0 / iterations);
+  benchField("wire_bytes", wireBytes / iterations);
+  benchField("windows", stats.addressWindows / iterations);
+  benchFieldF("est_dma_us", dmaUs / iterations);
+  benchField("protocol_errors", stats.protocolErrors);
+  benchField("checksum", displayBus.checksum());
+  benchEnd();
+}
+
+} // namespace
+
+BENCH_SUITE(image, 200) {
+  tft.begin();
+  tft.setRotation(0); // The asset is 240x320 portrait
+  compositor.begin(false);
+
+  RleImage image(testImageRle, sizeof(testImageRle));
+  benchBegin("image", "asset");
+  benchField("valid", image.isValid());
+  benchField("raw_bytes", sizeof(test));
+  benchField("rle_bytes", sizeof(testImageRle));
+  benchFieldF("ratio", (double)sizeof(test) / sizeof(testImageRle));
+  benchEnd();
+
+  displayBus.resetStats();
+  uint64_t start = benchNowNs();
+  for (uint32_t i = 0; i < iterations; i++) {
+    tft.drawRGBBitmap(0, 0, test, 240, 320);
+  }
+  report("raw_push", iterations, benchNowNs() - start);
+
+  displayBus.resetStats();
+  start = benchNowNs();
+  bool ok = true;
+  for (uint32_t i = 0; i < iterations; i++) {
+    ok &= drawRleImage(tft, 0, 0, image);
+  }
+  report("rle_push", iterations, benchNowNs() - start);
+
+  // Decode alone, no bus
+  uint16_t line[RLE_IMAGE_MAX_WIDTH];
+  start = benchNowNs();
+  uint32_t sum = 0;
+  for (uint32_t i = 0; i < iterations; i++) {
+    image.rewind();
+    while (image.nextRow(line)) sum += line[0];
+  }
+  uint64_t elapsed = benchNowNs() - start;
+  benchBegin("image", "rle_decode");
+  benchFieldF("host_us", elapsed / 1000.0 / iterations);
+  benchField("ok", ok && sum != 0);
+  benchEnd();
+
+  tft.setRotation(3);
+}
@@ -0,0 +1,101 @@
+#include <stdio.h>
+
+#include "Intersection.h"
+#include "bench.h"
+
+// The intersection controller ticked once per simulated millisecond for
+// `iterations` seconds, with 2 to 32 heads in four phase groups. The
+// cost per tick should not grow with the heads. Every change is checked
+// against the conflict matrix, and the cycle against the phase table.
+
+namespace {
+
+const uint8_t kGroups = 4;
+
+void runHeads(uint8_t headCount, uint32_t seconds) {
+  TrafficLight *heads[INTERSECTION_MAX_HEADS];
+  uint32_t conflicts[INTERSECTION_MAX_HEADS];
+  IntersectionPhase phases[kGroups];
+
+  // Head h runs in phase h % 4 and conflicts with every other group
+  for (uint8_t p = 0; p < kGroups; p++) phases[p] = {0, 5000, 2000, 1000};
+  for (uint8_t h = 0; h < headCount; h++) {
+    heads[h] = new TrafficLight(h * 3, h * 3 + 1, h * 3 + 2);
+    phases[h % kGroups].green |= 1UL << h;
+  }
+  for (uint8_t h = 0; h < headCount; h++) conflicts[h] = 0;
+  for (uint8_t h = 0; h < headCount; h++) {
+    for (uint8_t g = 0; g < headCount; g++) {
+      if (h % kGroups != g % kGroups) conflicts[h] |= 1UL << g;
+    }
+  }
+
+  Intersection intersection(heads, headCount, phases, kGroups, conflicts);
+  bool valid = intersection.begin(0);
+
+  uint32_t changes = 0, conflictsSeen = 0;
+  uint32_t cycleStart = 0, cycles = 0, cycleMs = 0;
+  const uint32_t ticks = seconds * 1000;
+
+  uint64_t start = benchNowNs();
+  for (uint32_t ms = 1; ms <= ticks; ms++) {
+    if (!intersection.tick(ms)) continue;
+    changes++;
+
+    uint32_t shown = intersection.greenMask() | intersection.yellowMask();
+    for (uint8_t h = 0; h < headCount; h++) {
+      if ((shown >> h & 1) && (conflicts[h] & shown)) conflictsSeen++;
+    }
+    if (intersection.phase() == 0 && intersection.interval() == INTERVAL_GREEN) {
+      cycleMs = ms - cycleStart;
+      cycleStart = ms;
+      cycles++;
+    }
+  }
+  uint64_t elapsed = benchNowNs() - start;
+
+  char name[16];
+  snprintf(name, sizeof(name), "heads_%u", headCount);
+  benchBegin("intersection", name);
+  benchField("valid", valid);
+  benchField("ticks", ticks);
+  benchField("changes", changes);
+  benchField("cycles", cycles);
+  benchField("cycle_ms", cycleMs);
+  benchField("conflicts", conflictsSeen);
+  benchFieldF("ns_per_tick", (double)elapsed / ticks);
+  benchEnd();
+
+  for (uint8_t h = 0; h < headCount; h++) delete heads[h];
+}
+
+} // namespace
+
+BENCH_SUITE(intersection, 3600) {
+  static const uint8_t sizes[] = {2, 4, 8, 16, 32};
+  for (uint8_t heads : sizes) runHeads(heads, iterations);
+
+  // A phase with conflicting heads green together must not start
+  TrafficLight a(0, 1, 2), b(3, 4, 5);
+  TrafficLight *const heads[] = {&a, &b};
+  const uint32_t conflicts[] = {1 << 1, 1 << 0};
+  const IntersectionPhase bad[] = {{0x3, 5000, 2000, 1000}};
+  Intersection intersection(heads, 2, bad, 1, conflicts);
+  bool started = intersection.begin(0);
+  benchBegin("intersection", "rejects_conflict");
+  benchField("started", started);
+  benchField("all_red", a.getCurrentState() == RED && b.getCurrentState() == RED);
+  benchEnd();
+
+  // Greens past 65.5 s run their full length; past the limit, no start
+  const IntersectionPhase longGreen[] = {{0x1, 90000, 4000, 2000}, {0x2, 90000, 4000, 2000}};
+  Intersection corridor(heads, 2, longGreen, 2, conflicts);
+  corridor.begin(0);
+  unsigned long firstChange = corridor.nextChange();
+  const IntersectionPhase tooLong[] = {{0x1, INTERSECTION_MAX_INTERVAL_MS + 1, 4000, 2000}};
+  Intersection overlong(heads, 2, tooLong, 1, conflicts);
+  benchBegin("intersection", "long_intervals");
+  benchField("first_change_ms", firstChange);
+  benchField("over_limit_started", overlong.begin(0));
+  benchEnd();
+}
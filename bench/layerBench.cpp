@@ -0,0 +1,127 @@
+#include <stdlib.h>
+
+#include <algorithm>
+
+#include "bench.h"
+#include "displayFunctions.h"
+
+// Static layers in frame buffer mode, rasterized every time against
+// blitted from their cached sprites. Each layer is first timed alone in a
+// memory FrameBuffer, then whole mode changes are timed with the cache off
+// and on, in alternating rounds so that both see the same machine. Times
+// are host microseconds, min and median over kRounds rounds of
+// `iterations` draws. Bus traffic is the same either way; the saving is
+// render time.
+
+namespace {
+
+const int kRounds = 15;
+
+double median(double *values) {
+  std::sort(values, values + kRounds);
+  return values[kRounds / 2];
+}
+
+void modeChange(uint32_t i) {
+  switch (i % 4) {
+  case 0: {
+    WeatherData weather = {18.2f, 82.5f, WEATHER_CLOUDY, false};
+    displayWeather(weather);
+    break;
+  }
+  case 1: displayTime((time_t)1750064400 + i * 61); break;
+  case 2: displayPopulation(2860000000UL + i * 10000000UL); break;
+  case 3: displaySpeed(i & 4 ? 120.0f : 60.0f); break;
+  }
+}
+
+// Host time per draw of one layer
+void runLayer(const NamedLayer &named, FrameBuffer &frame, uint32_t iterations) {
+  StaticLayer &layer = *named.layer;
+  layer.release();
+  layer.prepare(frame, BACKGROUND_COLOR);
+
+  double raster[kRounds], blit[kRounds];
+  for (int round = 0; round < kRounds; round++) {
+    uint64_t start = benchNowNs();
+    for (uint32_t i = 0; i < iterations; i++) layer.drawUncached(frame);
+    raster[round] = (benchNowNs() - start) / 1000.0 / iterations;
+
+    start = benchNowNs();
+    for (uint32_t i = 0; i < iterations; i++) layer.draw(frame, BACKGROUND_COLOR);
+    blit[round] = (benchNowNs() - start) / 1000.0 / iterations;
+  }
+
+  benchBegin("layers", named.name);
+  benchFieldF("raster_min_us", *std::min_element(raster, raster + kRounds));
+  benchFieldF("raster_median_us", median(raster));
+  benchFieldF("blit_min_us", *std::min_element(blit, blit + kRounds));
+  benchFieldF("blit_median_us", median(blit));
+  benchFieldF("saved_us", median(raster) - median(blit));
+  benchField("sprite_bytes", layer.bytes());
+  benchEnd();
+  layer.release();
+}
+
+// Host time per mode change, one round
+double runModeChanges(bool cache, uint32_t iterations, uint32_t &checksum) {
+  enableLayerCache = cache;
+  displayBus.resetStats();
+  uint64_t start = benchNowNs();
+  for (uint32_t i = 0; i < iterations; i++) modeChange(i);
+  uint64_t elapsed = benchNowNs() - start;
+  checksum = displayBus.checksum();
+  return elapsed / 1000.0 / iterations;
+}
+
+void reportModeChanges(const char *name, double *times, uint32_t iterations, uint32_t checksum) {
+  const BusStats &stats = displayBus.stats();
+  benchBegin("layers", name);
+  benchField("mode_changes", iterations);
+  benchFieldF("min_us", *std::min_element(times, times + kRounds));
+  benchFieldF("median_us", median(times));
+  benchField("wire_bytes", ((uint64_t)stats.commandBytes + stats.dataBytes) / iterations);
+  benchField("checksum", checksum);
+  benchEnd();
+}
+
+} // namespace
+
+BENCH_SUITE(layers, 400) {
+  tft.begin();
+  tft.setRotation(3);
+  compositor.begin();
+  enableSmoothAnimations = false;
+  enableSlideTransitions = false;
+
+  const int16_t w = 320, h = 240;
+  uint16_t *pixels = (uint16_t *)malloc((size_t)w * h * sizeof(uint16_t));
+  if (!pixels) return;
+  FrameBuffer frame(w, h, pixels);
+  frame.fillScreen(BACKGROUND_COLOR);
+  size_t count;
+  const NamedLayer *layers = displayLayers(count);
+  for (size_t i = 0; i < count; i++) runLayer(layers[i], frame, iterations);
+  free(pixels);
+
+  // Warm up, which also renders the sprites
+  enableLayerCache = true;
+  for (uint32_t i = 0; i < 4; i++) modeChange(i);
+  size_t spriteBytes = cachedLayerBytes();
+
+  double rasterized[kRounds], cached[kRounds];
+  uint32_t rasterChecksum = 0, cachedChecksum = 0;
+  for (int round = 0; round < kRounds; round++) {
+    rasterized[round] = runModeChanges(false, iterations, rasterChecksum);
+    cached[round] = runModeChanges(true, iterations, cachedChecksum);
+  }
+  reportModeChanges("rasterize", rasterized, iterations, rasterChecksum);
+  reportModeChanges("cached", cached, iterations, cachedChecksum);
+
+  double saved = median(rasterized) - median(cached);
+  benchBegin("layers", "saving");
+  benchFieldF("saved_us", saved);
+  benchFieldF("saved_pct", 100.0 * saved / median(rasterized));
+  benchField("sprite_bytes", spriteBytes);
+  benchEnd();
+}
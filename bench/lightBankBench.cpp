@@ -0,0 +1,116 @@
+#include <stdio.h>
+
+#include "Clock.h"
+#include "TrafficLight.h"
+#include "TrafficLightBank.h"
+#include "bench.h"
+
+// TrafficLightBank against the same lights as TrafficLight objects on a
+// ManualClock, each light with its own timing and start. `verify` steps
+// both by random amounts for `iterations` ticks and compares every
+// light's state and time in state after each tick. The timed cases run
+// `iterations` 1 ms ticks and report light updates per second.
+
+namespace {
+
+uint32_t rng = 1;
+
+uint32_t nextRandom() {
+  rng = rng * 1664525u + 1013904223u;
+  return rng >> 8;
+}
+
+struct Lights {
+  ManualClock clock;
+  TrafficLight **objects;
+  uint32_t *storage;
+  TrafficLightBank bank;
+
+  explicit Lights(size_t count)
+      : clock(0), objects(new TrafficLight *[count]), storage(new uint32_t[count * 6]),
+        bank(storage, storage + count, storage + count * 2, storage + count * 3, storage + count * 4,
+             storage + count * 5, count) {
+    // Staggered starts, up to 10 s apart, and timing from 1 s to 9 s
+    rng = 1;
+    for (size_t i = 0; i < count; i++) {
+      clock.advance(nextRandom() % (10000 / count + 1));
+      unsigned long red = 1000 + nextRandom() % 8000;
+      unsigned long yellow = 1000 + nextRandom() % 3000;
+      unsigned long green = 1000 + nextRandom() % 8000;
+      objects[i] = new TrafficLight(0, 1, 2, nullptr, &clock);
+      objects[i]->setTiming(red, yellow, green);
+      int light = bank.add(clock.nowMs());
+      bank.setTiming(light, red, yellow, green);
+    }
+  }
+
+  ~Lights() {
+    for (size_t i = 0; i < bank.size(); i++) delete objects[i];
+    delete[] objects;
+    delete[] storage;
+  }
+};
+
+void runVerify(size_t count, uint32_t ticks) {
+  Lights lights(count);
+  uint32_t changes = 0, mismatches = 0;
+  for (uint32_t t = 0; t < ticks; t++) {
+    lights.clock.advance(nextRandom() % 200);
+    unsigned long now = lights.clock.nowMs();
+    for (size_t i = 0; i < count; i++) lights.objects[i]->update();
+    changes += lights.bank.tick(now);
+
+    for (size_t i = 0; i < count; i++) {
+      TrafficLight &object = *lights.objects[i];
+      if (object.getCurrentState() != lights.bank.state(i) ||
+          object.getTimeInCurrentState() != lights.bank.timeInState(i, now)) {
+        mismatches++;
+      }
+    }
+  }
+
+  benchBegin("light_bank", "verify");
+  benchField("lights", count);
+  benchField("ticks", ticks);
+  benchField("changes", changes);
+  benchField("mismatches", mismatches);
+  benchEnd();
+}
+
+void runTimed(size_t count, uint32_t ticks) {
+  Lights lights(count);
+  unsigned long start = lights.clock.nowMs();
+
+  uint64_t t0 = benchNowNs();
+  for (uint32_t t = 1; t <= ticks; t++) {
+    lights.clock.set(start + t);
+    for (size_t i = 0; i < count; i++) lights.objects[i]->update();
+  }
+  uint64_t objectNs = benchNowNs() - t0;
+
+  uint32_t changes = 0;
+  t0 = benchNowNs();
+  for (uint32_t t = 1; t <= ticks; t++) changes += lights.bank.tick(start + t);
+  uint64_t bankNs = benchNowNs() - t0;
+
+  double updates = (double)count * ticks;
+  char name[24];
+  snprintf(name, sizeof(name), "lights_%u", (unsigned)count);
+  benchBegin("light_bank", name);
+  benchField("ticks", ticks);
+  benchField("changes", changes);
+  benchFieldF("objects_ns_per_tick", (double)objectNs / ticks);
+  benchFieldF("bank_ns_per_tick", (double)bankNs / ticks);
+  benchFieldF("objects_mlights_per_s", objectNs ? updates * 1e3 / objectNs : 0.0);
+  benchFieldF("bank_mlights_per_s", bankNs ? updates * 1e3 / bankNs : 0.0);
+  benchFieldF("speedup", bankNs ? (double)objectNs / bankNs : 0.0);
+  benchEnd();
+}
+
+} // namespace
+
+BENCH_SUITE(light_bank, 1000) {
+  runVerify(1000, iterations);
+  static const size_t sizes[] = {100, 1000, 10000, 100000};
+  for (size_t count : sizes) runTimed(count, iterations);
+}
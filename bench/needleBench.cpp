@@ -0,0 +1,94 @@
+#include "DisplayMemory.h"
+#include "bench.h"
+#include "displayFunctions.h"
+
+// Speedometer needle sweeps driven by a simulated millisecond clock, the
+// way loop() calls animateSpeedNeedle(). Each sweep must end on exactly
+// the pixels a snapped full repaint gives.
+
+namespace {
+
+const double kDmaSpiBitsPerUs = 40.0;
+const double kDmaSegmentUs = 3.0;
+
+unsigned long simMs = 1000;
+
+// Runs one sweep to the end; returns its length in ms
+unsigned long sweep(float speed) {
+  displaySpeed(speed);
+  unsigned long start = simMs;
+  unsigned long lastFrame = simMs;
+  while (simMs - lastFrame < 200) {
+    simMs++;
+    if (animateSpeedNeedle(simMs)) lastFrame = simMs;
+  }
+  return lastFrame - start;
+}
+
+void runNeedle(const char *suite, bool useFrameBuffer, uint32_t iterations,
+               uint8_t indexedBits = COMPOSITOR_INDEXED_BITS) {
+  static const float speeds[] = {60.0f, 120.0f, 20.0f, 150.0f};
+
+  tft.begin();
+  tft.setRotation(3);
+  compositor.begin(useFrameBuffer, COMPOSITOR_BAND_HEIGHT, indexedBits);
+  enableSlideTransitions = false;
+  enableSmoothAnimations = false;
+  displaySpeed(speeds[0]);
+  enableSmoothAnimations = true;
+
+  uint32_t mismatches = 0;
+  uint64_t sweepMs = 0;
+  BusStats total = {};
+  resetNeedleAnimatorStats();
+  for (uint32_t i = 0; i < iterations; i++) {
+    float speed = speeds[(i + 1) % 4];
+
+    // Only the animation frames count, not the repaint starting the sweep
+    displaySpeed(speed);
+    displayBus.resetStats();
+    sweepMs += sweep(speed);
+    const BusStats &stats = displayBus.stats();
+    total.commandBytes += stats.commandBytes;
+    total.dataBytes += stats.dataBytes;
+    total.addressWindows += stats.addressWindows;
+    total.segments += stats.segments;
+    total.protocolErrors += stats.protocolErrors;
+
+    uint32_t animated = displayBus.checksum();
+    enableSmoothAnimations = false;
+    displaySpeed(speed);
+    enableSmoothAnimations = true;
+    if (displayBus.checksum() != animated) mismatches++;
+  }
+
+  const NeedleAnimatorStats &needle = needleAnimatorStats();
+  uint32_t frames = needle.frames ? needle.frames : 1;
+  uint64_t wireBytes = (uint64_t)total.commandBytes + total.dataBytes;
+  double dmaUs = wireBytes * 8.0 / kDmaSpiBitsPerUs + total.segments * kDmaSegmentUs;
+
+  benchBegin(suite, "sweep");
+  benchField("sweeps", iterations);
+  benchField("frames", needle.frames);
+  benchField("sweep_ms", sweepMs / iterations);
+  benchField("wire_bytes", wireBytes / frames);
+  benchField("windows", total.addressWindows / frames);
+  benchFieldF("est_dma_us", dmaUs / frames);
+  benchFieldF("host_us", (double)needle.totalUs / frames);
+  benchField("host_max_us", needle.maxUs);
+  benchField("over_budget", needle.overBudget);
+  benchField("protocol_errors", total.protocolErrors);
+  benchField("mismatches", mismatches);
+  benchEnd();
+}
+
+} // namespace
+
+BENCH_SUITE(needle, 100) {
+  runNeedle("needle", true, iterations);
+  runNeedle("needle_direct", false, iterations);
+  displaySetPsramAvailable(false);
+  runNeedle("needle_indexed", true, iterations);
+  runNeedle("needle_banded", true, iterations, 0);
+  displaySetPsramAvailable(true);
+}
@@ -0,0 +1,215 @@
+#include "DisplayMemory.h"
+#include "Ticker.h"
+#include "bench.h"
+#include "displayFunctions.h"
+
+// Hardware-scroll transitions and the ticker, checked through the
+// recording bus's scroll emulation. `slide` runs every screen change of
+// the loop() rotation as a slide, double buffered, indexed and in bands.
+// After each step the glass must show the old screen moved left by the
+// columns brought in, and the new screen's left edge behind it; the wire
+// traffic is compared with a hard cut. `ticker` crawls a message across the
+// screen and checks each step against the text drawn in place.
+
+namespace {
+
+const double kDmaSpiBitsPerUs = 40.0;
+const double kDmaSegmentUs = 3.0;
+
+const int16_t kWidth = 320;
+const int16_t kHeight = 240;
+
+uint16_t oldScreen[kWidth * kHeight];
+uint16_t newScreen[kWidth * kHeight];
+uint16_t reference[kWidth * kHeight];
+
+void showScreen(int screen, uint32_t i) {
+  switch (screen % 4) {
+  case 0: {
+    WeatherData weather = {15.0f + (i % 10), 60.0f + (i % 30), (WeatherCondition)(i % 3), false};
+    displayWeather(weather);
+    break;
+  }
+  case 1: displayTime((time_t)1750064400 + i * 61); break;
+  case 2: displayPopulation(2860000000UL + i * 10000000UL); break;
+  case 3: displaySpeed(i & 1 ? 120.0f : 60.0f); break;
+  }
+}
+
+void captureGlass(uint16_t *out) {
+  for (int16_t y = 0; y < kHeight; y++) {
+    for (int16_t x = 0; x < kWidth; x++) out[y * kWidth + x] = displayBus.shownPixelAt(x, y);
+  }
+}
+
+// Old screen moved left by `brought` columns, new screen's left edge after it
+uint32_t slideMismatches(int16_t brought) {
+  uint32_t mismatches = 0;
+  for (int16_t y = 0; y < kHeight; y++) {
+    for (int16_t x = 0; x < kWidth; x++) {
+      int16_t from = x + brought;
+      uint16_t expected = from < kWidth ? oldScreen[y * kWidth + from] : newScreen[y * kWidth + from - kWidth];
+      if (displayBus.shownPixelAt(x, y) != expected) mismatches++;
+    }
+  }
+  return mismatches;
+}
+
+double dmaUs(const BusStats &stats) {
+  return (stats.commandBytes + stats.dataBytes) * 8.0 / kDmaSpiBitsPerUs + stats.segments * kDmaSegmentUs;
+}
+
+void runSlide(const char *name, uint32_t iterations) {
+  enableSmoothAnimations = false;
+  unsigned long simMs = 0;
+  uint32_t slides = 0, frames = 0, mismatches = 0, checked = 0;
+  uint64_t slideBytes = 0, slideSegments = 0, cutBytes = 0, scrolls = 0, elapsed = 0;
+  double slideDmaUs = 0, cutDmaUs = 0;
+
+  for (uint32_t i = 0; i < iterations; i++) {
+    int from = i % 4, to = (i + 1) % 4;
+    bool verify = i < 4;
+
+    // Both ends as hard cuts, for the reference and the wire cost
+    enableSlideTransitions = false;
+    showScreen(to, i + 1);
+    if (verify) captureGlass(newScreen);
+    showScreen(from, i);
+    if (verify) captureGlass(oldScreen);
+    displayBus.resetStats();
+    showScreen(to, i + 1);
+    cutBytes += displayBus.stats().commandBytes + displayBus.stats().dataBytes;
+    cutDmaUs += dmaUs(displayBus.stats());
+    showScreen(from, i);
+
+    enableSlideTransitions = true;
+    displayBus.resetStats();
+    uint64_t start = benchNowNs();
+    showScreen(to, i + 1);
+    int16_t brought = 0;
+    while (animateTransition(simMs += TRANSITION_FRAME_MS)) {
+      frames++;
+      brought = brought + TRANSITION_COLUMNS_PER_FRAME < kWidth ? brought + TRANSITION_COLUMNS_PER_FRAME : kWidth;
+      if (verify) {
+        uint64_t paused = benchNowNs();
+        mismatches += slideMismatches(brought);
+        checked++;
+        start += benchNowNs() - paused;
+      }
+    }
+    elapsed += benchNowNs() - start;
+    slides++;
+
+    const BusStats &stats = displayBus.stats();
+    slideBytes += stats.commandBytes + stats.dataBytes;
+    slideSegments += stats.segments;
+    scrolls += stats.scrolls;
+    slideDmaUs += dmaUs(stats);
+    if (stats.protocolErrors) mismatches++;
+    // Back at scroll 0 the memory is the new screen as drawn
+    if (verify && displayBus.shownChecksum() != displayBus.checksum()) mismatches++;
+  }
+  enableSlideTransitions = false;
+
+  benchBegin("scroll", name);
+  benchField("slides", slides);
+  benchField("frames_per_slide", frames / slides);
+  benchField("scrolls_per_slide", scrolls / slides);
+  benchField("wire_bytes", slideBytes / slides);
+  benchField("segments", slideSegments / slides);
+  benchField("cut_wire_bytes", cutBytes / slides);
+  benchFieldF("est_dma_us", slideDmaUs / slides);
+  benchFieldF("est_dma_frame_us", slideDmaUs / frames);
+  benchFieldF("cut_est_dma_us", cutDmaUs / slides);
+  benchFieldF("host_us", elapsed / 1000.0 / slides);
+  benchField("checked_steps", checked);
+  benchField("mismatches", mismatches);
+  benchEnd();
+}
+
+// Message at screen x = w - position, drawn in place
+uint32_t tickerMismatches(const char *message, int16_t textY, uint8_t size, uint32_t position, int32_t period) {
+  FrameBuffer screen(kWidth, kHeight, reference);
+  screen.setTextWrap(false);
+  screen.fillScreen(BACKGROUND_COLOR);
+  screen.setTextSize(size);
+  screen.setTextColor(TEXT_COLOR, BACKGROUND_COLOR);
+  screen.setCursor(kWidth - (int16_t)(position % period), textY);
+  screen.print(message);
+
+  uint32_t mismatches = 0;
+  for (int16_t y = 0; y < kHeight; y++) {
+    for (int16_t x = 0; x < kWidth; x++) {
+      if (displayBus.shownPixelAt(x, y) != reference[y * kWidth + x]) mismatches++;
+    }
+  }
+  return mismatches;
+}
+
+void runTicker(uint32_t iterations) {
+  static const char message[] = "Traffic advisory: speed checks on Main St until 18:00";
+  const int16_t textY = 200;
+  const uint8_t size = 2;
+  const int16_t stepColumns = 4;
+
+  tft.begin();
+  tft.setRotation(3);
+  compositor.begin(false);
+  Ticker ticker(tft, 0, kWidth, textY, size, TEXT_COLOR, BACKGROUND_COLOR);
+  if (!ticker.begin()) return;
+  ticker.start(message);
+
+  // Two full crawls, every step checked, then the timed run
+  uint32_t mismatches = 0, checked = 0;
+  while (ticker.position() < 2 * (uint32_t)ticker.period()) {
+    ticker.step(stepColumns);
+    mismatches += tickerMismatches(message, textY, size, ticker.position(), ticker.period());
+    checked++;
+  }
+
+  const uint32_t steps = iterations * 100;
+  displayBus.resetStats();
+  uint64_t start = benchNowNs();
+  for (uint32_t i = 0; i < steps; i++) ticker.step(stepColumns);
+  uint64_t elapsed = benchNowNs() - start;
+  const BusStats &stats = displayBus.stats();
+  mismatches += tickerMismatches(message, textY, size, ticker.position(), ticker.period());
+  mismatches += stats.protocolErrors;
+
+  // Without the scroll: the text rows resent on every step
+  uint32_t redrawBytes = kWidth * 8 * size * 2;
+
+  benchBegin("scroll", "ticker");
+  benchField("steps", steps);
+  benchField("columns_per_step", stepColumns);
+  benchField("wire_bytes", (stats.commandBytes + stats.dataBytes) / steps);
+  benchField("redraw_wire_bytes", redrawBytes);
+  benchFieldF("est_dma_us", dmaUs(stats) / steps);
+  benchFieldF("host_us", elapsed / 1000.0 / steps);
+  benchField("checked_steps", checked);
+  benchField("mismatches", mismatches);
+  benchEnd();
+
+  ticker.stop();
+}
+
+// Without PSRAM: indexedBits 0 for bands
+void beginScreens(bool psram, uint8_t indexedBits = COMPOSITOR_INDEXED_BITS) {
+  tft.begin();
+  tft.setRotation(3);
+  displaySetPsramAvailable(psram);
+  compositor.begin(true, COMPOSITOR_BAND_HEIGHT, indexedBits);
+  displaySetPsramAvailable(true);
+}
+
+} // namespace
+
+BENCH_SUITE(scroll, 20) {
+  beginScreens(true);
+  runSlide("slide", iterations);
+  beginScreens(false);
+  runSlide("slide_indexed", iterations);
+  beginScreens(false, 0);
+  runSlide("slide_banded", iterations);
+  runTicker(iterations);
+}
@@ -0,0 +1,135 @@
+#include <stdlib.h>
+#include <string.h>
+
+#include "FrameBuffer.h"
+#include "bench.h"
+#include "displayFunctions.h"
+
+// FrameBuffer's span kernels against Adafruit_GFX's generic path, a
+// surface with nothing but drawPixel() over the same kind of buffer.
+// Each case draws the same calls on both; the pixels must match.
+
+namespace {
+
+const int16_t kWidth = 320;
+const int16_t kHeight = 240;
+
+class PixelCanvas : public Surface {
+public:
+  PixelCanvas(uint16_t *pixels) : Surface(kWidth, kHeight), _pixels(pixels) {}
+
+  void drawPixel(int16_t x, int16_t y, uint16_t color) override {
+    if (x < 0 || y < 0 || x >= kWidth || y >= kHeight) return;
+    _pixels[(int32_t)y * kWidth + x] = color;
+  }
+
+private:
+  uint16_t *_pixels;
+};
+
+uint16_t sprite[64 * 64];
+uint16_t rows[kWidth * 40];
+
+typedef void (*DrawFn)(Surface &s, uint32_t i);
+
+uint16_t colorFor(uint32_t i) { return (uint16_t)(i * 2654435761u >> 16); }
+
+void fillScreenCase(Surface &s, uint32_t i) { s.fillScreen(colorFor(i)); }
+
+// Odd x and widths, so the word stores need their edge pixels
+void fillRectCase(Surface &s, uint32_t i) { s.fillRect(13 + i % 7, 21, 181 + i % 2, 97, colorFor(i)); }
+
+void hlineCase(Surface &s, uint32_t i) {
+  for (int16_t y = 0; y < kHeight; y += 2) s.drawFastHLine(3 + (y + i) % 5, y, 301, colorFor(i + y));
+}
+
+void vlineCase(Surface &s, uint32_t i) {
+  for (int16_t x = 0; x < kWidth; x += 2) s.drawFastVLine(x, 5 + (x + i) % 5, 221, colorFor(i + x));
+}
+
+void blitCase(Surface &s, uint32_t i) { s.blit(37 + i % 5, 41, 64, 64, sprite); }
+
+void blitRowsCase(Surface &s, uint32_t i) { s.blit(0, 100 + i % 3, kWidth, 40, rows); }
+
+void discCase(Surface &s, uint32_t i) { s.fillDisc(160, 120, 20 + i % 40, colorFor(i)); }
+
+void triangleCase(Surface &s, uint32_t i) {
+  s.fillTriangleSpans(160, 20 + i % 9, 40 + i % 13, 210, 290 - i % 11, 180, colorFor(i));
+}
+
+void sunCase(Surface &s, uint32_t i) {
+  setDrawTarget(s);
+  drawSunIcon(150 + i % 5, 110);
+}
+
+void rainCase(Surface &s, uint32_t i) {
+  setDrawTarget(s);
+  drawRainIcon(150 + i % 5, 100);
+}
+
+void clockHandCase(Surface &s, uint32_t i) {
+  setDrawTarget(s);
+  drawClockHand(160, 120, 70, (i * 6) % 360, 6, colorFor(i));
+}
+
+struct SpanCase {
+  const char *name;
+  DrawFn draw;
+};
+
+const SpanCase cases[] = {
+    {"fill_screen", fillScreenCase},
+    {"fill_rect", fillRectCase},
+    {"hline", hlineCase},
+    {"vline", vlineCase},
+    {"blit", blitCase},
+    {"blit_rows", blitRowsCase},
+    {"disc", discCase},
+    {"triangle", triangleCase},
+    {"sun_icon", sunCase},
+    {"rain_icon", rainCase},
+    {"clock_hand", clockHandCase},
+};
+
+uint64_t timeDraws(Surface &s, DrawFn draw, uint32_t iterations) {
+  uint64_t start = benchNowNs();
+  for (uint32_t i = 0; i < iterations; i++) draw(s, i);
+  return benchNowNs() - start;
+}
+
+} // namespace
+
+BENCH_SUITE(span, 200) {
+  const size_t count = (size_t)kWidth * kHeight;
+  uint16_t *generic = (uint16_t *)malloc(count * sizeof(uint16_t));
+  uint16_t *kernel = (uint16_t *)malloc(count * sizeof(uint16_t));
+  if (!generic || !kernel) return;
+
+  for (size_t i = 0; i < sizeof(sprite) / sizeof(sprite[0]); i++) sprite[i] = colorFor(i);
+  for (size_t i = 0; i < sizeof(rows) / sizeof(rows[0]); i++) rows[i] = colorFor(i + 7);
+
+  PixelCanvas genericCanvas(generic);
+  FrameBuffer frame(kWidth, kHeight, kernel);
+
+  for (const SpanCase &c : cases) {
+    memset(generic, 0, count * sizeof(uint16_t));
+    memset(kernel, 0, count * sizeof(uint16_t));
+    uint64_t genericNs = timeDraws(genericCanvas, c.draw, iterations);
+    uint64_t kernelNs = timeDraws(frame, c.draw, iterations);
+
+    uint32_t mismatches = 0;
+    for (size_t i = 0; i < count; i++) mismatches += generic[i] != kernel[i];
+
+    benchBegin("span", c.name);
+    benchField("iterations", iterations);
+    benchFieldF("ns_per_generic", (double)genericNs / iterations);
+    benchFieldF("ns_per_kernel", (double)kernelNs / iterations);
+    benchFieldF("speedup", kernelNs ? (double)genericNs / kernelNs : 0.0);
+    benchField("mismatches", mismatches);
+    benchEnd();
+  }
+
+  setDrawTarget(tft);
+  free(generic);
+  free(kernel);
+}
@@ -0,0 +1,227 @@
+#include <algorithm>
+#include <atomic>
+#include <thread>
+#include <vector>
+
+#include "TripleBuffer.h"
+#include "bench.h"
+#include "displayTask.h"
+
+// The control/display split on two host threads. `handoff` hammers the
+// TripleBuffer from both sides and checks no snapshot arrives torn or out
+// of order. `inline` runs a simulated control loop that renders in the
+// same iteration, as loop() used to; `split` renders from a second thread
+// through publishDisplaySnapshot(), as the display task does. The control
+// loop's worst iteration is what the traffic lights and sensors see. With
+// a single host CPU the two threads time-slice and `split` can't win.
+// `split_uart` and `split_uart_sample_prints` add the control loop's
+// serial output through a model of the 9600 baud UART, each iteration
+// being one 1 ms firmware tick: what the firmware prints now, and the
+// four lines every speed sample used to print. Time spent waiting for
+// the FIFO counts toward the iteration.
+
+namespace {
+
+const uint64_t kControlWorkNs = 5000; // Sensor reads and light updates
+const uint32_t kModeChangeEvery = 500; // Iterations
+const uint32_t kTickEvery = 50;
+
+// Bytes the control loop prints, every so many 1 ms iterations
+struct SerialLoad {
+  uint32_t sampleBytes; // Every iteration
+  uint32_t eventBytes;  // Every eventEvery iterations
+  uint32_t eventEvery;
+  uint32_t reportBytes; // The latency report, every 10 s
+};
+
+// Phase changes and the report; then with every speed sample and
+// darkness reading printed as well
+const SerialLoad kEventPrints = {0, 17, 8000, 110};
+const SerialLoad kSamplePrints = {40, 17 + 5, 100, 110};
+
+// 8N1 at 9600 baud behind the ESP32's 128 byte TX FIFO
+struct UartModel {
+  double queued = 0;
+
+  // One ms passes, then bytes are written; returns how long the writer
+  // waits for room
+  uint64_t write(uint32_t bytes) {
+    const double bytesPerMs = 9600 / 10 / 1000.0;
+    const double fifo = 128;
+    queued = queued > bytesPerMs ? queued - bytesPerMs : 0;
+    queued += bytes;
+    if (queued <= fifo) return 0;
+    double waitMs = (queued - fifo) / bytesPerMs;
+    queued = fifo;
+    return (uint64_t)(waitMs * 1e6);
+  }
+};
+
+struct Sample {
+  uint32_t sequence;
+  uint32_t words[15]; // Each sequence * (i + 1)
+};
+
+Sample makeSample(uint32_t sequence) {
+  Sample sample;
+  sample.sequence = sequence;
+  for (int i = 0; i < 15; i++) sample.words[i] = sequence * (i + 1);
+  return sample;
+}
+
+void runHandoff(uint32_t iterations) {
+  const uint32_t count = iterations * 1000;
+  TripleBuffer<Sample> buffer;
+
+  // Cost of a publish on its own
+  uint64_t start = benchNowNs();
+  for (uint32_t s = 1; s <= count; s++) buffer.publish(makeSample(s));
+  uint64_t elapsed = benchNowNs() - start;
+  Sample drained;
+  buffer.consume(drained);
+
+  std::atomic<bool> done(false);
+  uint32_t consumed = 0, torn = 0, outOfOrder = 0;
+
+  std::thread consumer([&] {
+    uint32_t last = 0;
+    Sample sample;
+    for (;;) {
+      bool finished = done.load();
+      while (buffer.consume(sample)) {
+        consumed++;
+        for (int i = 0; i < 15; i++) {
+          if (sample.words[i] != sample.sequence * (i + 1)) {
+            torn++;
+            break;
+          }
+        }
+        if (sample.sequence <= last || sample.sequence > count) outOfOrder++;
+        last = sample.sequence;
+      }
+      if (finished) break;
+    }
+  });
+
+  for (uint32_t s = 1; s <= count; s++) {
+    buffer.publish(makeSample(s));
+    // Give a consumer sharing the core a chance to run
+    if (s % 64 == 0) std::this_thread::yield();
+  }
+  done = true;
+  consumer.join();
+
+  benchBegin("task", "handoff");
+  benchField("published", count);
+  benchField("consumed", consumed);
+  benchField("torn", torn);
+  benchField("out_of_order", outOfOrder);
+  benchFieldF("ns_per_publish", (double)elapsed / count);
+  benchEnd();
+}
+
+void controlWork() {
+  uint64_t until = benchNowNs() + kControlWorkNs;
+  while (benchNowNs() < until) {
+  }
+}
+
+uint32_t modeSequence = 0;
+
+void runControlLoop(const char *name, bool split, uint32_t iterations, const SerialLoad *serial = nullptr) {
+  static const float speeds[] = {60.0f, 85.0f, 120.0f};
+
+  tft.begin();
+  tft.setRotation(3);
+  compositor.begin(true);
+  prepareDisplayCaches();
+  enableSmoothAnimations = true;
+  resetDisplayTaskStats();
+
+  std::atomic<bool> done(false);
+  std::thread renderer;
+  if (split) {
+    renderer = std::thread([&] {
+      while (!done.load()) {
+        if (!renderDisplay(millis())) std::this_thread::yield();
+      }
+    });
+  }
+
+  std::vector<uint32_t> iterationUs;
+  iterationUs.reserve(iterations);
+  UartModel uart;
+  uint64_t uartMaxNs = 0, uartTotalNs = 0;
+  DisplaySnapshot snapshot = {};
+  snapshot.time = (time_t)1750064400;
+  for (uint32_t i = 0; i < iterations; i++) {
+    uint64_t start = benchNowNs();
+    controlWork();
+
+    bool changed = false;
+    if (i % kModeChangeEvery == 0) {
+      uint32_t change = i / kModeChangeEvery;
+      snapshot.mode = (DisplayMode)(change % 4);
+      snapshot.modeSequence = ++modeSequence;
+      snapshot.weather = {15.0f + change % 10, 60.0f + change % 30, (WeatherCondition)(change % 3), false};
+      snapshot.population = 2860000000UL + change * 10000000UL;
+      snapshot.speed = speeds[change % 3];
+      changed = true;
+    }
+    if (i % kTickEvery == 0) {
+      snapshot.time++;
+      changed = true;
+    }
+    if (changed) publishDisplaySnapshot(snapshot);
+    if (!split) renderDisplay(millis());
+
+    uint64_t uartNs = 0;
+    if (serial) {
+      uint32_t bytes = serial->sampleBytes;
+      if (i % serial->eventEvery == 0) bytes += serial->eventBytes;
+      if (i % 10000 == 9999) bytes += serial->reportBytes;
+      uartNs = uart.write(bytes);
+      uartTotalNs += uartNs;
+      if (uartNs > uartMaxNs) uartMaxNs = uartNs;
+    }
+
+    iterationUs.push_back((uint32_t)((benchNowNs() - start + uartNs) / 1000));
+  }
+
+  done = true;
+  if (split) renderer.join();
+  // Whatever is still in the buffer
+  renderDisplay(millis());
+
+  uint64_t total = 0;
+  for (uint32_t us : iterationUs) total += us;
+  std::sort(iterationUs.begin(), iterationUs.end());
+  const DisplayTaskStats &stats = displayTaskStats();
+
+  benchBegin("task", name);
+  benchField("iterations", iterations);
+  benchField("cpus", std::thread::hardware_concurrency());
+  benchField("control_max_us", iterationUs.back());
+  benchField("control_p99_us", iterationUs[iterationUs.size() * 99 / 100]);
+  benchFieldF("control_mean_us", (double)total / iterations);
+  benchField("published", stats.published);
+  benchField("consumed", stats.consumed);
+  benchField("repaints", stats.repaints);
+  benchField("handoff_max_us", stats.maxHandoffUs);
+  benchField("render_max_us", stats.maxRenderUs);
+  if (serial) {
+    benchField("uart_wait_max_us", uartMaxNs / 1000);
+    benchFieldF("uart_wait_mean_us", (double)uartTotalNs / 1000 / iterations);
+  }
+  benchEnd();
+}
+
+} // namespace
+
+BENCH_SUITE(task, 20) {
+  runHandoff(iterations);
+  runControlLoop("inline", false, iterations * 1000);
+  runControlLoop("split", true, iterations * 1000);
+  runControlLoop("split_uart", true, iterations * 1000, &kEventPrints);
+  runControlLoop("split_uart_sample_prints", true, iterations * 1000, &kSamplePrints);
+}
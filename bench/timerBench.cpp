@@ -0,0 +1,195 @@
+#include <stdio.h>
+#include <stdlib.h>
+
+#include <new>
+
+#include "TimerWheel.h"
+#include "bench.h"
+
+// The timer wheel against a simulated clock. `exact` scatters timers over
+// eight hours, past the wheel's span, and sleeps from one deadline to the
+// next: every timer must fire once, on time and in order. `control` runs
+// the firmware's timers for `iterations` simulated seconds, sleeping
+// until the next deadline, and compares its wake-ups with a 1 ms polling
+// loop; `control_jitter` oversleeps each wake-up by up to 3 ms and shows
+// it in the per-timer lateness. `churn` is the cost of schedule() and
+// cancel(), and `wrap` crosses the clock's wraparound.
+
+namespace {
+
+uint32_t rng = 1;
+
+uint32_t nextRandom() {
+  rng = rng * 1664525u + 1013904223u;
+  return rng >> 8;
+}
+
+struct Check {
+  unsigned long last;
+  uint32_t fired;
+  uint32_t late;
+  uint32_t outOfOrder;
+};
+
+Check check;
+
+void checkFire(Timer &timer, unsigned long nowMs) {
+  check.fired++;
+  if (nowMs != timer.deadline()) check.late++;
+  if ((long)(nowMs - check.last) < 0) check.outOfOrder++;
+  check.last = nowMs;
+}
+
+// Sleeps from deadline to deadline until nothing is left
+uint32_t drain(TimerWheel &wheel, unsigned long &now) {
+  uint32_t wakeups = 0;
+  unsigned long deadline;
+  while (wheel.nextDeadline(deadline)) {
+    if ((long)(deadline - now) > 0) now = deadline;
+    wheel.run(now);
+    wakeups++;
+  }
+  return wakeups;
+}
+
+void runExact(uint32_t count, unsigned long start, unsigned long spanMs, const char *name) {
+  Timer *timers = (Timer *)malloc(count * sizeof(Timer));
+  if (!timers) return;
+
+  TimerWheel wheel;
+  wheel.begin(start);
+  check = Check();
+  check.last = start;
+
+  uint64_t t0 = benchNowNs();
+  for (uint32_t i = 0; i < count; i++) {
+    new (&timers[i]) Timer("exact", checkFire);
+    wheel.schedule(timers[i], start + 1 + nextRandom() % spanMs);
+  }
+  unsigned long now = start;
+  uint32_t wakeups = drain(wheel, now);
+  uint64_t elapsed = benchNowNs() - t0;
+
+  benchBegin("timer", name);
+  benchField("timers", count);
+  benchField("fired", check.fired);
+  benchField("late", check.late);
+  benchField("out_of_order", check.outOfOrder);
+  benchField("pending", wheel.pending());
+  benchField("wakeups", wakeups);
+  benchFieldF("ns_per_timer", (double)elapsed / count);
+  benchEnd();
+  free(timers);
+}
+
+// The control loop's timers, periodic from their own deadlines
+struct Periodic {
+  const char *name;
+  unsigned long periodMs;
+};
+
+const Periodic controlTimers[] = {
+    {"traffic", 2000},   // Shortest phase interval
+    {"darkness", 100},   // Sensor reading
+    {"speed", 1},        // Speed sensor sampling
+    {"clock", 50},       // Second changes on the time screen
+    {"mode", 10000},     // Screen rotation
+    {"latency", 10000},  // Report
+};
+const uint8_t kControlTimers = sizeof(controlTimers) / sizeof(controlTimers[0]);
+
+TimerWheel *controlWheel;
+
+void periodicFire(Timer &timer, unsigned long) {
+  const Periodic &periodic = *(const Periodic *)timer.context();
+  controlWheel->schedule(timer, timer.deadline() + periodic.periodMs);
+}
+
+void runControl(uint32_t seconds, uint32_t maxOversleepMs, const char *name) {
+  TimerWheel wheel;
+  controlWheel = &wheel;
+  wheel.begin(0);
+
+  Timer *timers[kControlTimers];
+  for (uint8_t i = 0; i < kControlTimers; i++) {
+    timers[i] = new Timer(controlTimers[i].name, periodicFire, (void *)&controlTimers[i]);
+    wheel.schedule(*timers[i], controlTimers[i].periodMs);
+  }
+
+  const unsigned long end = (unsigned long)seconds * 1000;
+  unsigned long now = 0;
+  uint32_t wakeups = 0;
+  uint64_t t0 = benchNowNs();
+  while (now < end) {
+    // Sleep until the earliest deadline, maybe a little longer
+    now += wheel.timeUntilNext(now, end - now);
+    if (maxOversleepMs) now += nextRandom() % (maxOversleepMs + 1);
+    wheel.run(now);
+    wakeups++;
+  }
+  uint64_t elapsed = benchNowNs() - t0;
+
+  benchBegin("timer", name);
+  benchField("seconds", seconds);
+  benchField("wakeups", wakeups);
+  benchField("polls", end);
+  benchFieldF("ns_per_wakeup", (double)elapsed / wakeups);
+  benchEnd();
+
+  for (uint8_t i = 0; i < kControlTimers; i++) {
+    const TimerStats &stats = timers[i]->stats();
+    char caseName[40];
+    snprintf(caseName, sizeof(caseName), "%s.%s", name, timers[i]->name());
+    benchBegin("timer", caseName);
+    benchField("fires", stats.fires);
+    benchField("max_late_ms", stats.maxLateMs);
+    benchFieldF("mean_late_ms", stats.fires ? (double)stats.totalLateMs / stats.fires : 0.0);
+    benchEnd();
+    delete timers[i];
+  }
+}
+
+void noop(Timer &, unsigned long) {}
+
+void runChurn(uint32_t count) {
+  Timer *timers = (Timer *)malloc(count * sizeof(Timer));
+  if (!timers) return;
+  for (uint32_t i = 0; i < count; i++) new (&timers[i]) Timer("churn", noop);
+
+  TimerWheel wheel;
+  wheel.begin(0);
+  uint64_t t0 = benchNowNs();
+  for (uint32_t i = 0; i < count; i++) wheel.schedule(timers[i], 1 + nextRandom() % 3600000);
+  uint64_t scheduled = benchNowNs() - t0;
+
+  // Every timer moved once, as a rescheduled deadline would be
+  t0 = benchNowNs();
+  for (uint32_t i = 0; i < count; i++) wheel.schedule(timers[i], 1 + nextRandom() % 3600000);
+  uint64_t moved = benchNowNs() - t0;
+
+  t0 = benchNowNs();
+  for (uint32_t i = 0; i < count; i++) wheel.cancel(timers[i]);
+  uint64_t cancelled = benchNowNs() - t0;
+
+  benchBegin("timer", "churn");
+  benchField("timers", count);
+  benchFieldF("ns_per_schedule", (double)scheduled / count);
+  benchFieldF("ns_per_move", (double)moved / count);
+  benchFieldF("ns_per_cancel", (double)cancelled / count);
+  benchField("pending", wheel.pending());
+  benchEnd();
+  free(timers);
+}
+
+} // namespace
+
+BENCH_SUITE(timer, 3600) {
+  rng = 1;
+  runExact(10000, 0, 8UL * 3600 * 1000, "exact");
+  runControl(iterations, 0, "control");
+  runControl(iterations, 3, "control_jitter");
+  runChurn(100000);
+
+  // Deadlines from just before the wraparound to just after
+  runExact(1000, (unsigned long)-5000, 10000, "wrap");
+}
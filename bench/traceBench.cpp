@@ -0,0 +1,108 @@
+#include <stdio.h>
+
+#include "RenderTrace.h"
+#include "bench.h"
+#include "displayFunctions.h"
+
+// The render trace on the host. `probe` times an empty function with and
+// without a TRACE_SCOPE in it: the cost of one probe, 0 when built without
+// RENDER_TRACE. `rotation` records the loop() screen rotation, clock ticks
+// and slide transitions included, and writes the ring to render.trace for
+// tools/trace2chrome.py.
+
+namespace {
+
+const char *const kTraceFile = "render.trace";
+
+volatile uint32_t sink;
+
+void __attribute__((noinline)) bare(uint32_t i) { sink = i; }
+
+void __attribute__((noinline)) probed(uint32_t i) {
+  TRACE_SCOPE("probed");
+  sink = i;
+}
+
+class FilePrint : public Print {
+public:
+  explicit FilePrint(FILE *file) : _file(file) {}
+  size_t write(uint8_t c) override { return fwrite(&c, 1, 1, _file); }
+  size_t write(const uint8_t *buffer, size_t size) override { return fwrite(buffer, 1, size, _file); }
+
+private:
+  FILE *_file;
+};
+
+void runProbe(uint32_t iterations) {
+  const uint32_t calls = iterations * 10000;
+  resetTrace();
+
+  uint64_t start = benchNowNs();
+  for (uint32_t i = 0; i < calls; i++) bare(i);
+  uint64_t bareNs = benchNowNs() - start;
+
+  start = benchNowNs();
+  for (uint32_t i = 0; i < calls; i++) probed(i);
+  uint64_t probedNs = benchNowNs() - start;
+
+  benchBegin("trace", "probe");
+  benchField("enabled", traceEnabled());
+  benchField("calls", calls);
+  benchFieldF("ns_per_probe", probedNs > bareNs ? (double)(probedNs - bareNs) / calls : 0.0);
+  benchField("recorded", traceStats().recorded);
+  benchEnd();
+}
+
+void runRotation(uint32_t iterations) {
+  tft.begin();
+  tft.setRotation(3);
+  compositor.begin(true);
+  enableSmoothAnimations = true;
+  enableSlideTransitions = true;
+  resetTrace();
+
+  unsigned long simMs = 0;
+  for (uint32_t i = 0; i < iterations; i++) {
+    switch (i % 4) {
+    case 0: {
+      WeatherData weather = {15.0f + (i % 10), 60.0f + (i % 30), (WeatherCondition)(i / 4 % 3), false};
+      displayWeather(weather);
+      break;
+    }
+    case 1: displayTime((time_t)1750064400 + i * 61); break;
+    case 2: displayPopulation(2860000000UL + i * 10000000UL); break;
+    case 3: displaySpeed(i / 4 % 2 ? 120.0f : 60.0f); break;
+    }
+    while (animateTransition(simMs += TRANSITION_FRAME_MS)) {
+    }
+    for (int s = 1; s <= 5 && i % 4 == 1; s++) updateTime((time_t)1750064400 + i * 61 + s);
+    for (int f = 0; f < 30; f++) animateSpeedNeedle(simMs += NEEDLE_FRAME_MS);
+  }
+  enableSlideTransitions = false;
+
+  size_t bytes = 0;
+  FILE *file = traceEnabled() ? fopen(kTraceFile, "wb") : nullptr;
+  if (file) {
+    FilePrint out(file);
+    bytes = traceDump(out);
+    fclose(file);
+  }
+
+  const TraceStats &stats = traceStats();
+  benchBegin("trace", "rotation");
+  benchField("enabled", traceEnabled());
+  benchField("mode_changes", iterations);
+  benchField("recorded", stats.recorded);
+  benchField("overwritten", stats.overwritten);
+  benchField("names", stats.names);
+  benchField("dump_bytes", bytes);
+  benchFieldS("file", file ? kTraceFile : "-");
+  benchEnd();
+}
+
+} // namespace
+
+BENCH_SUITE(trace, 20) {
+  runProbe(iterations);
+  runRotation(iterations);
+}
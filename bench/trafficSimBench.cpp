@@ -0,0 +1,94 @@
+#include <stdio.h>
+
+#include "Clock.h"
+#include "Intersection.h"
+#include "RecordingGpioPort.h"
+#include "SpeedDetector.h"
+#include "TrafficSim.h"
+#include "bench.h"
+
+// The firmware's intersection under simulated traffic for `iterations`
+// simulated hours: its two heads and phase table, and its speed detector
+// on approach 0, all on a ManualClock. Waits and queues are per approach;
+// speed error is the detector's reading against each vehicle's true
+// speed. `speedup` is simulated time over wall time.
+
+namespace {
+
+struct Scenario {
+  const char *name;
+  uint32_t vehiclesPerHour[2];
+};
+
+void runScenario(const Scenario &scenario, uint32_t hours) {
+  ManualClock clock(0);
+  RecordingGpioPort port;
+  TrafficLight head1(19, 14, 13, &port, &clock);
+  TrafficLight head2(5, 26, 12, &port, &clock);
+  TrafficLight *const heads[] = {&head1, &head2};
+  const uint32_t conflicts[] = {1 << 1, 1 << 0};
+  const IntersectionPhase phases[] = {
+      {1 << 0, 5000, 2000, 1000},
+      {1 << 1, 5000, 2000, 1000},
+  };
+  Intersection intersection(heads, 2, phases, 2, conflicts, &port);
+  SpeedDetector detector(0.5f, 100, 5000, 1000, &clock);
+
+  const SimApproach approaches[] = {
+      {0, scenario.vehiclesPerHour[0]},
+      {1, scenario.vehiclesPerHour[1]},
+  };
+  TrafficSim sim(intersection, clock, approaches, 2, &detector, 0.5f);
+  sim.begin();
+
+  uint64_t start = benchNowNs();
+  for (uint32_t h = 0; h < hours; h++) {
+    sim.run(3600000UL);
+    port.clearHistory();
+  }
+  uint64_t wallNs = benchNowNs() - start;
+
+  for (uint8_t a = 0; a < sim.approachCount(); a++) {
+    const SimApproachStats &stats = sim.approachStats(a);
+    char name[32];
+    snprintf(name, sizeof(name), "%s_approach%u", scenario.name, a);
+    benchBegin("traffic_sim", name);
+    benchField("vph", scenario.vehiclesPerHour[a]);
+    benchField("arrivals", stats.arrivals);
+    benchField("departures", stats.departures);
+    benchField("stopped", stats.stopped);
+    benchFieldF("avg_wait_ms", stats.departures ? (double)stats.totalWaitMs / stats.departures : 0.0);
+    benchField("max_wait_ms", stats.maxWaitMs);
+    benchFieldF("avg_queue", (double)stats.queueMs / (hours * 3600000.0));
+    benchField("max_queue", stats.maxQueue);
+    benchField("dropped", stats.dropped);
+    benchEnd();
+  }
+
+  const SimCycleStats &cycles = sim.cycleStats();
+  const SimSpeedStats &speed = sim.speedStats();
+  benchBegin("traffic_sim", scenario.name);
+  benchField("cycles", cycles.cycles);
+  benchField("min_cycle_ms", cycles.minMs);
+  benchField("max_cycle_ms", cycles.maxMs);
+  benchFieldF("avg_cycle_ms", cycles.cycles ? (double)cycles.totalMs / cycles.cycles : 0.0);
+  benchField("sensed", speed.vehicles);
+  benchField("measured", speed.measured);
+  benchField("timed_out", speed.timedOut);
+  benchFieldF("avg_error_kmh", speed.measured ? speed.totalErrorKmh / speed.measured : 0.0);
+  benchFieldF("max_error_kmh", speed.maxErrorKmh);
+  benchField("events", sim.events());
+  benchFieldF("speedup", wallNs ? hours * 3600000.0 * 1e6 / wallNs : 0.0);
+  benchEnd();
+}
+
+} // namespace
+
+BENCH_SUITE(traffic_sim, 24) {
+  static const Scenario scenarios[] = {
+      {"light", {60, 60}},
+      {"moderate", {200, 150}},
+      {"heavy", {400, 350}},
+  };
+  for (const Scenario &scenario : scenarios) runScenario(scenario, iterations);
+}
@@ -0,0 +1,72 @@
+#include <math.h>
+
+#include "FixedTrig.h"
+#include "bench.h"
+
+// FixedTrig against libm for the dial geometry: the double cos()/sin()
+// the screens used to call, float cosf()/sinf(), and the Q14 table, each
+// producing one polar point. Also the table's worst error in pixels at
+// the largest radius on screen.
+
+namespace {
+
+const int kRadius = 50;
+
+volatile int32_t sink;
+
+void report(const char *name, uint32_t points, uint64_t elapsed, int32_t sum) {
+  sink = sum;
+  benchBegin("trig", name);
+  benchField("points", points);
+  benchFieldF("ns_per_point", (double)elapsed / points);
+  benchEnd();
+}
+
+} // namespace
+
+BENCH_SUITE(trig, 2000) {
+  const uint32_t points = iterations * 256;
+
+  uint64_t start = benchNowNs();
+  int32_t sum = 0;
+  for (uint32_t i = 0; i < points; i++) {
+    double angle = (i & 4095) * (2 * M_PI / 4096);
+    sum += (int)(100 + kRadius * cos(angle)) + (int)(100 + kRadius * sin(angle));
+  }
+  report("libm_double", points, benchNowNs() - start, sum);
+
+  start = benchNowNs();
+  sum = 0;
+  for (uint32_t i = 0; i < points; i++) {
+    float angle = (i & 4095) * (float)(2 * M_PI / 4096);
+    sum += (int)(100 + kRadius * cosf(angle)) + (int)(100 + kRadius * sinf(angle));
+  }
+  report("libm_float", points, benchNowNs() - start, sum);
+
+  start = benchNowNs();
+  sum = 0;
+  for (uint32_t i = 0; i < points; i++) {
+    FixedPoint p = fixedPolar(100, 100, kRadius, (FixedAngle)i);
+    sum += p.x + p.y;
+  }
+  report("fixed", points, benchNowNs() - start, sum);
+
+  // Accuracy over a whole turn
+  double maxError = 0;
+  double maxPixelError = 0;
+  for (int32_t a = 0; a < kFixedAngleTurn; a++) {
+    double angle = a * (2 * M_PI / kFixedAngleTurn);
+    double error = fabs(fixedSin(a) / (double)kFixedOne - sin(angle));
+    if (error > maxError) maxError = error;
+
+    FixedPoint p = fixedPolar(0, 0, kRadius, a);
+    double dx = fabs(p.x - kRadius * cos(angle));
+    double dy = fabs(p.y - kRadius * sin(angle));
+    if (dx > maxPixelError) maxPixelError = dx;
+    if (dy > maxPixelError) maxPixelError = dy;
+  }
+  benchBegin("trig", "accuracy");
+  benchFieldF("max_sin_error", maxError);
+  benchFieldF("max_pixel_error", maxPixelError);
+  benchEnd();
+}
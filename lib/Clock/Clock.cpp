@@ -0,0 +1,6 @@
+#include "Clock.h"
+
+Clock &systemClock() {
+  static SystemClock clock;
+  return clock;
+}
@@ -0,0 +1,38 @@
+#ifndef CLOCK_H
+#define CLOCK_H
+
+#include <Arduino.h>
+
+// Millisecond time source for anything that would otherwise call
+// millis() itself. The firmware passes the system clock; host tests and
+// the traffic simulator pass a ManualClock and move time on themselves,
+// as fast as the code under test can keep up.
+class Clock {
+public:
+  virtual ~Clock() {}
+  virtual unsigned long nowMs() const = 0;
+};
+
+// millis()
+class SystemClock : public Clock {
+public:
+  unsigned long nowMs() const override { return millis(); }
+};
+
+// Stands still until set or advanced
+class ManualClock : public Clock {
+public:
+  explicit ManualClock(unsigned long startMs = 0) : _now(startMs) {}
+
+  unsigned long nowMs() const override { return _now; }
+  void set(unsigned long ms) { _now = ms; }
+  void advance(unsigned long ms) { _now += ms; }
+
+private:
+  unsigned long _now;
+};
+
+// Shared SystemClock, the default wherever a clock is optional
+Clock &systemClock();
+
+#endif // CLOCK_H
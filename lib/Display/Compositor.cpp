@@ -0,0 +1,380 @@
+#include "Compositor.h"
+
+#include <new>
+#include <string.h>
+
+#include "DisplayMemory.h"
+#include "RenderTrace.h"
+
+namespace {
+
+// A new address window (CASET/RASET/RAMWR plus a bus transaction) costs
+// about as much as pushing this many pixels
+const int32_t kWindowCostPx = 16;
+
+} // namespace
+
+Compositor::Compositor(Ili9341Panel &panel)
+    : _panel(panel), _backPixels(nullptr), _frontPixels(nullptr), _back(nullptr), _frontValid(false),
+      _backIndices(nullptr), _frontIndices(nullptr), _line(nullptr), _indexed(nullptr), _bandPixels(nullptr), _bandHashes(nullptr), _band(nullptr), _bandHeight(0), _bandsValid(false),
+      _slideColumns(0), _slideColumn(-1), _slideDrawn(false) {
+  resetStats();
+}
+
+Compositor::~Compositor() { releaseBuffers(); }
+
+bool Compositor::begin(bool useFrameBuffer, int16_t bandHeight, uint8_t indexedBits) {
+  releaseBuffers();
+
+  if (useFrameBuffer) {
+    size_t bytes = (size_t)_panel.width() * _panel.height() * sizeof(uint16_t);
+    _backPixels = (uint16_t *)displayAlloc(bytes, DISPLAY_MEMORY_PSRAM);
+    _frontPixels = (uint16_t *)displayAlloc(bytes, DISPLAY_MEMORY_PSRAM);
+    if (_backPixels && _frontPixels) {
+      _back = new (std::nothrow) FrameBuffer(_panel.width(), _panel.height(), _backPixels);
+    }
+    if (!_back) releaseBuffers();
+  }
+
+  if (useFrameBuffer && !_back && (indexedBits == 8 || indexedBits == 4)) {
+    size_t bytes = IndexedFrameBuffer::bytesFor(_panel.width(), _panel.height(), indexedBits);
+    _backIndices = (uint8_t *)displayAlloc(bytes, DISPLAY_MEMORY_INTERNAL);
+    _frontIndices = (uint8_t *)displayAlloc(bytes, DISPLAY_MEMORY_INTERNAL);
+    _line = (uint16_t *)displayAlloc(_panel.width() * sizeof(uint16_t), DISPLAY_MEMORY_INTERNAL);
+    if (_backIndices && _frontIndices && _line) {
+      _palette.setCapacity(1 << indexedBits);
+      _indexed = new (std::nothrow)
+          IndexedFrameBuffer(_panel.width(), _panel.height(), indexedBits, _backIndices, _palette);
+    }
+    if (!_indexed) releaseBuffers();
+  }
+
+  if (useFrameBuffer && !_back && !_indexed && bandHeight > 0) {
+    if (bandHeight > _panel.height()) bandHeight = _panel.height();
+    int bands = (_panel.height() + bandHeight - 1) / bandHeight;
+    _bandPixels =
+        (uint16_t *)displayAlloc((size_t)_panel.width() * bandHeight * sizeof(uint16_t), DISPLAY_MEMORY_INTERNAL);
+    _bandHashes = (uint32_t *)displayAlloc(bands * sizeof(uint32_t), DISPLAY_MEMORY_INTERNAL);
+    if (_bandPixels && _bandHashes) {
+      _band = new (std::nothrow) FrameBuffer(_panel.width(), bandHeight, _bandPixels);
+      _bandHeight = bandHeight;
+    }
+    if (!_band) releaseBuffers();
+  }
+
+  // Slide strips go through the front buffer (replaced by the new frame
+  // once the slide ends), the line buffer or the band
+  _slideColumns = 0;
+  if (_back || _indexed) {
+    _slideColumns = COMPOSITOR_SLIDE_COLUMNS;
+  } else if (_band) {
+    int16_t fit = (int32_t)_panel.width() * _bandHeight / _panel.height();
+    _slideColumns = fit < COMPOSITOR_SLIDE_COLUMNS ? fit : COMPOSITOR_SLIDE_COLUMNS;
+  }
+  _slideColumn = -1;
+  _panel.scrollTo(0);
+
+  _panel.setDamageTracker(_back || _indexed || _band ? nullptr : &_damage);
+  invalidate();
+  return _back || _indexed;
+}
+
+CompositorMode Compositor::mode() const {
+  if (_back) return COMPOSITOR_FRAME_BUFFER;
+  if (_indexed) return COMPOSITOR_INDEXED;
+  if (_band) return COMPOSITOR_BANDED;
+  return COMPOSITOR_DIRECT;
+}
+
+size_t Compositor::bandBytes() const {
+  if (!_band) return 0;
+  int bands = (_panel.height() + _bandHeight - 1) / _bandHeight;
+  return (size_t)_panel.width() * _bandHeight * sizeof(uint16_t) + bands * sizeof(uint32_t);
+}
+
+size_t Compositor::indexedBytes() const {
+  if (!_indexed) return 0;
+  return 2 * IndexedFrameBuffer::bytesFor(_panel.width(), _panel.height(), _indexed->bitsPerPixel()) +
+         _panel.width() * sizeof(uint16_t);
+}
+
+void Compositor::releaseBuffers() {
+  delete _back;
+  _back = nullptr;
+  displayFree(_backPixels);
+  displayFree(_frontPixels);
+  _backPixels = _frontPixels = nullptr;
+
+  delete _indexed;
+  _indexed = nullptr;
+  displayFree(_backIndices);
+  displayFree(_frontIndices);
+  displayFree(_line);
+  _backIndices = _frontIndices = nullptr;
+  _line = nullptr;
+
+  delete _band;
+  _band = nullptr;
+  displayFree(_bandPixels);
+  displayFree(_bandHashes);
+  _bandPixels = nullptr;
+  _bandHashes = nullptr;
+  _bandHeight = 0;
+}
+
+void Compositor::invalidate() {
+  _frontValid = false;
+  _bandsValid = false;
+  _damage.clear();
+  _damage.add(0, 0, _panel.width(), _panel.height());
+}
+
+Surface &Compositor::beginFrame(uint16_t background) {
+  TRACE_SCOPE("Compositor::beginFrame");
+  _stats.frames++;
+
+  if (_back) {
+    _back->fillScreen(background);
+    return *_back;
+  }
+
+  if (_indexed) {
+    if (_palette.misses()) {
+      // The front plane is in the old palette's indices
+      _stats.paletteResets++;
+      _palette.clear();
+      _frontValid = false;
+    }
+    _indexed->fillScreen(background);
+    return *_indexed;
+  }
+
+  if (_band) {
+    // Drawn outside the bands: nothing on the glass matches the hashes
+    _bandsValid = false;
+    _panel.fillScreen(background);
+    _stats.pixelsCleared += (uint32_t)_panel.width() * _panel.height();
+    return _panel;
+  }
+
+  int32_t cleared = 0;
+  int rects = _damage.count();
+
+  // Clearing is not new damage
+  _panel.setDamageTracker(nullptr);
+  _panel.startWrite();
+  for (int i = 0; i < rects; i++) {
+    const Rect &r = _damage.rect(i);
+    _panel.fillRect(r.x, r.y, r.w, r.h, background);
+    cleared += r.area();
+  }
+  _panel.endWrite();
+  _damage.clear();
+  _panel.setDamageTracker(&_damage);
+
+  int32_t screenArea = (int32_t)_panel.width() * _panel.height();
+  if (cleared > screenArea) cleared = screenArea;
+  _stats.rectsCleared += rects;
+  _stats.pixelsCleared += cleared;
+  _stats.pixelsSaved += screenArea - cleared;
+
+  return _panel;
+}
+
+Surface &Compositor::beginUpdate() {
+  _stats.updates++;
+  // The back buffer matches the front after a flush
+  if (_back) return *_back;
+  if (_indexed) return *_indexed;
+  _bandsValid = false;
+  return _panel;
+}
+
+void Compositor::endFrame() {
+  if (_back || _indexed) flush();
+}
+
+void Compositor::flush() {
+  TRACE_SCOPE("Compositor::flush");
+  int16_t w = _panel.width();
+  int16_t h = _panel.height();
+  uint32_t flushedBefore = _stats.pixelsFlushed;
+
+  // Outside the dirty box the back buffer still matches the front
+  Rect dirty = Rect{0, 0, w, h};
+  if (_back) {
+    if (_frontValid) dirty = _back->dirtyRect();
+    _back->clearDirty();
+  } else {
+    if (_frontValid) dirty = _indexed->dirtyRect();
+    _indexed->clearDirty();
+  }
+
+  // Greedy: a changed row joins the open run when repushing the widened
+  // run (and any unchanged rows in between) is cheaper than a new window
+  int16_t runStart = -1, runEnd = -1, runX0 = 0, runX1 = 0;
+  for (int16_t y = dirty.y; y < dirty.bottom(); y++) {
+    int16_t x0 = dirty.x, x1 = dirty.right() - 1;
+    if (_frontValid && !rowChange(y, x0, x1)) continue;
+
+    if (runStart >= 0) {
+      int16_t ux0 = x0 < runX0 ? x0 : runX0;
+      int16_t ux1 = x1 > runX1 ? x1 : runX1;
+      int32_t runRows = runEnd - runStart + 1;
+      int32_t merged = (int32_t)(ux1 - ux0 + 1) * (y - runStart + 1);
+      int32_t separate = (int32_t)(runX1 - runX0 + 1) * runRows + kWindowCostPx + (x1 - x0 + 1);
+      if (merged <= separate) {
+        runX0 = ux0;
+        runX1 = ux1;
+        runEnd = y;
+        continue;
+      }
+      pushRun(runStart, runEnd, runX0, runX1);
+    }
+    runStart = runEnd = y;
+    runX0 = x0;
+    runX1 = x1;
+  }
+  if (runStart >= 0) pushRun(runStart, runEnd, runX0, runX1);
+
+  _frontValid = true;
+  _stats.pixelsSaved += (uint32_t)w * h - (_stats.pixelsFlushed - flushedBefore);
+}
+
+// Narrows [x0, x1] to what row y changed since the last flush; false if
+// nothing did
+bool Compositor::rowChange(int16_t y, int16_t &x0, int16_t &x1) const {
+  if (_indexed) return _indexed->diffRow(_frontIndices, y, x0, x1);
+
+  const uint16_t *back = _back->row(y);
+  const uint16_t *front = _frontPixels + (int32_t)y * _back->width();
+  while (x0 <= x1 && back[x0] == front[x0]) x0++;
+  if (x0 > x1) return false;
+  while (back[x1] == front[x1]) x1--;
+  return true;
+}
+
+// One address window for the run, then copy it into the front buffer
+void Compositor::pushRun(int16_t y0, int16_t y1, int16_t x0, int16_t x1) {
+  int16_t spanW = x1 - x0 + 1;
+  _stats.pixelsFlushed += (uint32_t)spanW * (y1 - y0 + 1);
+
+  if (_indexed) {
+    pushIndexed(x0, y0, spanW, y1 - y0 + 1);
+    uint8_t bits = _indexed->bitsPerPixel();
+    size_t b0 = (size_t)x0 * bits / 8, b1 = (size_t)x1 * bits / 8;
+    for (int16_t y = y0; y <= y1; y++) {
+      memcpy(_frontIndices + (int32_t)y * _indexed->stride() + b0, _indexed->row(y) + b0, b1 - b0 + 1);
+    }
+    return;
+  }
+
+  int16_t w = _back->width();
+
+  _panel.startWrite();
+  _panel.setAddrWindow(x0, y0, spanW, y1 - y0 + 1);
+  for (int16_t y = y0; y <= y1; y++) {
+    uint16_t *back = _back->row(y) + x0;
+    _panel.pushPixels(back, spanW);
+    memcpy(_frontPixels + (int32_t)y * w + x0, back, spanW * sizeof(uint16_t));
+  }
+  _panel.endWrite();
+}
+
+// One address window; the rows go out through the line buffer, as many
+// whole rows per push as fit in it
+void Compositor::pushIndexed(int16_t x, int16_t y, int16_t w, int16_t h) {
+  int16_t rowsPerPush = _panel.width() / w;
+  _panel.startWrite();
+  _panel.setAddrWindow(x, y, w, h);
+  for (int16_t j = 0; j < h; j += rowsPerPush) {
+    int16_t rows = h - j < rowsPerPush ? h - j : rowsPerPush;
+    for (int16_t r = 0; r < rows; r++) _indexed->expandRow(x, y + j + r, w, _line + (int32_t)r * w);
+    _panel.pushPixels(_line, (uint32_t)rows * w);
+  }
+  _panel.endWrite();
+}
+
+Surface &Compositor::beginBand(int16_t y, uint16_t background) {
+  _band->setOrigin(0, y, _panel.width(), _panel.height());
+  _band->fillScreen(background);
+  return *_band;
+}
+
+// Pushes the band as one window unless the glass already shows it
+void Compositor::endBand(int16_t y) {
+  TRACE_SCOPE("Compositor::endBand");
+  int16_t rows = _panel.height() - y < _bandHeight ? _panel.height() - y : _bandHeight;
+  uint32_t count = (uint32_t)_panel.width() * rows;
+  const uint16_t *pixels = _band->pixels();
+
+  // FNV-1a over pixel pairs; a collision would leave one stale band until
+  // it changes again
+  uint32_t hash = 2166136261u;
+  const uint32_t *words = (const uint32_t *)pixels;
+  for (uint32_t i = 0; i < count / 2; i++) hash = (hash ^ words[i]) * 16777619u;
+  if (count & 1) hash = (hash ^ pixels[count - 1]) * 16777619u;
+
+  uint32_t &shown = _bandHashes[y / _bandHeight];
+  if (_bandsValid && shown == hash) {
+    _stats.pixelsSaved += count;
+    return;
+  }
+  shown = hash;
+
+  _panel.startWrite();
+  _panel.setAddrWindow(0, y, _panel.width(), rows);
+  _panel.pushPixels(pixels, count);
+  _panel.endWrite();
+  _stats.pixelsFlushed += count;
+}
+
+bool Compositor::beginSlide() {
+  if (!canSlide()) return false;
+  if (_panel.scrollFirst() != 0 || _panel.scrollCount() != _panel.width()) {
+    _panel.setScrollArea(0, _panel.width());
+  }
+  _slideColumn = 0;
+  _slideDrawn = false;
+  return true;
+}
+
+void Compositor::copySlideStrip(int16_t x, int16_t w) {
+  for (int16_t y = 0; y < _panel.height(); y++) {
+    memcpy(_frontPixels + (int32_t)y * w, _back->row(y) + x, w * sizeof(uint16_t));
+  }
+}
+
+void Compositor::pushSlideStrip(int16_t x, int16_t w) {
+  TRACE_SCOPE("Compositor::pushSlideStrip");
+  uint32_t count = (uint32_t)w * _panel.height();
+  _stats.pixelsFlushed += count;
+  if (_indexed) {
+    pushIndexed(x, 0, w, _panel.height());
+    return;
+  }
+  _panel.startWrite();
+  _panel.setAddrWindow(x, 0, w, _panel.height());
+  _panel.pushPixels(_back ? _frontPixels : _bandPixels, count);
+  _panel.endWrite();
+}
+
+// Scrolled all the way round, the glass shows the memory as drawn again
+void Compositor::endSlide() {
+  _stats.frames++;
+  _slideColumn = -1;
+  if (_back) {
+    memcpy(_frontPixels, _backPixels, (size_t)_panel.width() * _panel.height() * sizeof(uint16_t));
+    _back->clearDirty();
+    _frontValid = true;
+  } else if (_indexed) {
+    memcpy(_frontIndices, _backIndices, IndexedFrameBuffer::bytesFor(_panel.width(), _panel.height(),
+                                                                   _indexed->bitsPerPixel()));
+    _indexed->clearDirty();
+    _frontValid = true;
+  } else {
+    _bandsValid = false;
+  }
+}
+
+void Compositor::resetStats() { memset(&_stats, 0, sizeof(_stats)); }
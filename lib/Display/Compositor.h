@@ -0,0 +1,213 @@
+#ifndef COMPOSITOR_H
+#define COMPOSITOR_H
+
+#include "DamageTracker.h"
+#include "FrameBuffer.h"
+#include "Ili9341Panel.h"
+#include "IndexedFrameBuffer.h"
+
+// Rows per band in banded mode: 320x16 RGB565 is 10 KB of internal SRAM
+#define COMPOSITOR_BAND_HEIGHT 16
+
+// Bits per pixel of the indexed frame buffers (8 or 4, 0: none). Two
+// 320x240 planes at 4 bits are 75 KB of internal SRAM, 150 KB at 8.
+#define COMPOSITOR_INDEXED_BITS 4
+
+// Widest strip a slide transition pushes as one window
+#define COMPOSITOR_SLIDE_COLUMNS 16
+
+enum CompositorMode { COMPOSITOR_DIRECT, COMPOSITOR_BANDED, COMPOSITOR_FRAME_BUFFER, COMPOSITOR_INDEXED };
+
+struct CompositorStats {
+  uint32_t frames;
+  uint32_t updates;
+  uint32_t rectsCleared;
+  uint32_t pixelsCleared; // Background repainted on the panel
+  uint32_t pixelsFlushed; // Pushed from the back buffer
+  uint32_t pixelsSaved;   // Versus a fillScreen per frame
+  uint32_t paletteResets; // Indexed frames that ran out of palette entries
+};
+
+// Owns how a frame reaches the panel.
+//
+// Frame buffer mode: two full-screen RGB565 buffers in PSRAM. Screens
+// render into the back buffer at memory speed; endFrame() diffs it
+// against the front buffer (a copy of what is on the glass) and pushes
+// the changed row runs, one address window each.
+//
+// Indexed mode, when there is no PSRAM: the same double buffering on
+// two internal SRAM planes of 8 or 4 bit palette indices. The diff
+// compares index bytes; changed runs are expanded through the palette
+// one row at a time into a panel-wide line buffer on their way out. The
+// palette fills in as colors are drawn. A frame that ran out of entries
+// (its extra colors drawn as the nearest) restarts on an empty palette
+// and is pushed whole.
+//
+// Banded mode, when there is no PSRAM for either: a panel-wide strip of
+// internal SRAM. render() runs the screen's draw calls once per band,
+// clipped to it, and pushes the band whole, top to bottom. Every pixel
+// goes out once with its final color, so nothing flickers. A band whose
+// hash matches what was pushed last time is skipped.
+//
+// Direct mode, when not even the band can be allocated (or no frame
+// buffer was asked for): screens draw on the panel and beginFrame() only
+// repaints the background over what the last frame touched, since the
+// rest of the screen is background already.
+class Compositor {
+public:
+  Compositor(Ili9341Panel &panel);
+  ~Compositor();
+
+  // Call after the panel's rotation is set. Returns true if double
+  // buffering is active; without PSRAM it falls back to indexed planes of
+  // indexedBits (0: skip), then to bands of bandHeight rows (0: straight
+  // to direct).
+  bool begin(bool useFrameBuffer = true, int16_t bandHeight = COMPOSITOR_BAND_HEIGHT,
+             uint8_t indexedBits = COMPOSITOR_INDEXED_BITS);
+  CompositorMode mode() const;
+  // The RGB565 frame buffer, where a blit is a memcpy
+  bool hasFrameBuffer() const { return _back != nullptr; }
+  bool isIndexed() const { return _indexed != nullptr; }
+  bool isBanded() const { return _band != nullptr; }
+  // Internal SRAM held by the band and its hashes
+  size_t bandBytes() const;
+  // Internal SRAM held by the index planes and the line buffer
+  size_t indexedBytes() const;
+  const Palette &palette() const { return _palette; }
+
+  // Draws a frame with draw(Surface &): once, or once per band in banded
+  // mode, so draw must give the same result each time it runs
+  template <typename DrawFn>
+  void render(uint16_t background, DrawFn draw) {
+    if (!_band) {
+      draw(beginFrame(background));
+      endFrame();
+      return;
+    }
+    _stats.frames++;
+    for (int16_t y = 0; y < _panel.height(); y += _bandHeight) {
+      draw(beginBand(y, background));
+      endBand(y);
+    }
+    _bandsValid = true;
+  }
+
+  // An update in banded mode: redraws the bands covering rows [y0, y1).
+  // In the other modes it renders the whole frame.
+  template <typename DrawFn>
+  void renderRows(uint16_t background, int16_t y0, int16_t y1, DrawFn draw) {
+    if (!_band || !_bandsValid) {
+      render(background, draw);
+      return;
+    }
+    _stats.updates++;
+    if (y1 > _panel.height()) y1 = _panel.height();
+    for (int16_t y = y0 - y0 % _bandHeight; y < y1; y += _bandHeight) {
+      draw(beginBand(y, background));
+      endBand(y);
+    }
+  }
+
+  // Slide transition: the new frame comes in from the right as the old
+  // one leaves to the left. Each step moves the panel's vertical scroll
+  // start (the x axis in landscape) and pushes only the columns that came
+  // into view, so the rest of the glass is never sent again. Needs the
+  // frame buffer or the band as a strip buffer, and landscape.
+  bool canSlide() const { return _slideColumns > 0 && _panel.scrollsHorizontally(); }
+  bool beginSlide();
+  bool isSliding() const { return _slideColumn >= 0; }
+
+  // Brings in up to `columns` more columns of the frame draw(Surface &)
+  // paints; the same draw on every step. Returns true while the slide is
+  // still going.
+  template <typename DrawFn>
+  bool slide(uint16_t background, int16_t columns, DrawFn draw) {
+    if (!isSliding()) return false;
+    Surface *frame = frameSurface();
+    if (frame && _slideColumn == 0 && !_slideDrawn) {
+      // Whole frame once; the steps copy columns out of it
+      frame->fillScreen(background);
+      draw(*frame);
+      _slideDrawn = true;
+    }
+
+    int16_t end = _slideColumn + columns;
+    if (end > _panel.width()) end = _panel.width();
+    // The wire can't hide them: the columns wrap round to the right edge
+    // as stale pixels until their strip lands
+    _panel.scrollTo(end);
+    for (int16_t x = _slideColumn; x < end; x += _slideColumns) {
+      int16_t w = end - x < _slideColumns ? end - x : _slideColumns;
+      if (_back) {
+        copySlideStrip(x, w);
+      } else if (!_indexed) {
+        FrameBuffer strip(w, _panel.height(), _bandPixels);
+        strip.setOrigin(x, 0, _panel.width(), _panel.height());
+        strip.fillScreen(background);
+        draw(strip);
+      }
+      pushSlideStrip(x, w);
+    }
+    _slideColumn = end;
+
+    if (end == _panel.width()) endSlide();
+    return isSliding();
+  }
+
+  // The surface to draw the frame on. In banded mode this is the panel,
+  // cleared; use render() there.
+  Surface &beginFrame(uint16_t background);
+  void endFrame();
+
+  // Draw over the last frame without clearing it; finish with endFrame()
+  Surface &beginUpdate();
+
+  // Forget what is on the glass; the next frame repaints everything
+  void invalidate();
+
+  const CompositorStats &stats() const { return _stats; }
+  void resetStats();
+
+private:
+  void releaseBuffers();
+  Surface *frameSurface() const {
+    if (_back) return _back;
+    return _indexed;
+  }
+  void flush();
+  bool rowChange(int16_t y, int16_t &x0, int16_t &x1) const;
+  void pushRun(int16_t y0, int16_t y1, int16_t x0, int16_t x1);
+  void pushIndexed(int16_t x, int16_t y, int16_t w, int16_t h);
+  Surface &beginBand(int16_t y, uint16_t background);
+  void endBand(int16_t y);
+  void copySlideStrip(int16_t x, int16_t w);
+  void pushSlideStrip(int16_t x, int16_t w);
+  void endSlide();
+
+  Ili9341Panel &_panel;
+  DamageTracker _damage;
+  CompositorStats _stats;
+
+  uint16_t *_backPixels;
+  uint16_t *_frontPixels;
+  FrameBuffer *_back;
+  bool _frontValid;
+
+  uint8_t *_backIndices;
+  uint8_t *_frontIndices;
+  uint16_t *_line; // One panel row of RGB565, for the expansion
+  IndexedFrameBuffer *_indexed;
+  Palette _palette;
+
+  uint16_t *_bandPixels;
+  uint32_t *_bandHashes; // Per band, of what is on the glass
+  FrameBuffer *_band;
+  int16_t _bandHeight;
+  bool _bandsValid; // Hashes match the glass
+
+  int16_t _slideColumns; // Strip width the buffers allow, 0: can't slide
+  int16_t _slideColumn;  // Next column to bring in, -1 when not sliding
+  bool _slideDrawn;
+};
+
+#endif // COMPOSITOR_H
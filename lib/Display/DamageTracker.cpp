@@ -0,0 +1,85 @@
+#include "DamageTracker.h"
+
+namespace {
+
+Rect unite(const Rect &a, const Rect &b) {
+  int16_t x1 = a.x < b.x ? a.x : b.x;
+  int16_t y1 = a.y < b.y ? a.y : b.y;
+  int16_t x2 = a.right() > b.right() ? a.right() : b.right();
+  int16_t y2 = a.bottom() > b.bottom() ? a.bottom() : b.bottom();
+  Rect r = {x1, y1, (int16_t)(x2 - x1), (int16_t)(y2 - y1)};
+  return r;
+}
+
+bool nearby(const Rect &a, const Rect &b, int16_t gap) {
+  return a.x <= b.right() + gap && b.x <= a.right() + gap &&
+         a.y <= b.bottom() + gap && b.y <= a.bottom() + gap;
+}
+
+bool contains(const Rect &outer, const Rect &inner) {
+  return inner.x >= outer.x && inner.y >= outer.y &&
+         inner.right() <= outer.right() && inner.bottom() <= outer.bottom();
+}
+
+} // namespace
+
+void DamageTracker::add(int16_t x, int16_t y, int16_t w, int16_t h) {
+  if (w <= 0 || h <= 0) return;
+  Rect r = {x, y, w, h};
+
+  // Most calls land inside the box the previous few already made
+  for (int i = _count - 1; i >= 0; i--) {
+    if (contains(_rects[i], r)) return;
+  }
+
+  for (int i = 0; i < _count; i++) {
+    if (nearby(_rects[i], r, kMergeGap)) {
+      _rects[i] = unite(_rects[i], r);
+      absorb(i);
+      return;
+    }
+  }
+
+  if (_count < kMaxRects) {
+    _rects[_count++] = r;
+    return;
+  }
+
+  // Full: grow whichever entry costs the fewest extra pixels
+  int best = 0;
+  int32_t bestGrowth = 0x7FFFFFFF;
+  for (int i = 0; i < _count; i++) {
+    int32_t growth = unite(_rects[i], r).area() - _rects[i].area();
+    if (growth < bestGrowth) {
+      bestGrowth = growth;
+      best = i;
+    }
+  }
+  _rects[best] = unite(_rects[best], r);
+  absorb(best);
+}
+
+// Fold any other entries the grown rect now touches into it
+void DamageTracker::absorb(int index) {
+  bool merged = true;
+  while (merged) {
+    merged = false;
+    for (int i = 0; i < _count; i++) {
+      if (i == index || !nearby(_rects[index], _rects[i], kMergeGap)) continue;
+
+      _rects[index] = unite(_rects[index], _rects[i]);
+      _rects[i] = _rects[--_count];
+      if (index == _count) index = i;
+      merged = true;
+      break;
+    }
+  }
+}
+
+int32_t DamageTracker::area() const {
+  int32_t total = 0;
+  for (int i = 0; i < _count; i++) {
+    total += _rects[i].area();
+  }
+  return total;
+}
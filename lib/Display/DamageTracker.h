@@ -0,0 +1,39 @@
+#ifndef DAMAGE_TRACKER_H
+#define DAMAGE_TRACKER_H
+
+#include <stdint.h>
+
+struct Rect {
+  int16_t x, y, w, h;
+
+  int32_t area() const { return (int32_t)w * h; }
+  int16_t right() const { return x + w; }
+  int16_t bottom() const { return y + h; }
+};
+
+// Fixed-size list of screen regions touched since the last clear().
+// Rects that overlap or sit within kMergeGap pixels of each other are
+// merged as they come in, so a line of text collapses into one box; when
+// the list is full the new rect joins whichever entry grows the least.
+class DamageTracker {
+public:
+  static const int kMaxRects = 16;
+  static const int16_t kMergeGap = 8;
+
+  DamageTracker() : _count(0) {}
+
+  void add(int16_t x, int16_t y, int16_t w, int16_t h);
+  void clear() { _count = 0; }
+
+  int count() const { return _count; }
+  const Rect &rect(int i) const { return _rects[i]; }
+  int32_t area() const;
+
+private:
+  void absorb(int index);
+
+  Rect _rects[kMaxRects];
+  int _count;
+};
+
+#endif // DAMAGE_TRACKER_H
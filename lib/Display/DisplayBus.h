@@ -0,0 +1,32 @@
+#ifndef DISPLAY_BUS_H
+#define DISPLAY_BUS_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+// Byte transport between a panel driver and the display controller.
+// Commands go out with DC low, parameters and pixels with DC high.
+// Pixels are RGB565 in CPU byte order; backends put them on the wire
+// MSB first.
+class DisplayBus {
+public:
+  virtual ~DisplayBus() {}
+
+  virtual void begin() = 0;
+
+  virtual void writeCommand(uint8_t cmd) = 0;
+  virtual void writeData(const uint8_t *data, size_t len) = 0;
+  virtual void writePixels(const uint16_t *pixels, uint32_t count) = 0;
+  virtual void writeColor(uint16_t color, uint32_t count) = 0;
+
+  // Block until every queued transfer has reached the panel
+  virtual void waitIdle() {}
+
+  // Two big-endian 16-bit parameters (CASET/PASET style)
+  void writeData16(uint16_t a, uint16_t b) {
+    uint8_t data[4] = {(uint8_t)(a >> 8), (uint8_t)a, (uint8_t)(b >> 8), (uint8_t)b};
+    writeData(data, 4);
+  }
+};
+
+#endif // DISPLAY_BUS_H
@@ -0,0 +1,37 @@
+#include "DisplayMemory.h"
+
+#if defined(ESP32)
+
+#include <esp_heap_caps.h>
+
+void *displayAlloc(size_t bytes, DisplayMemory where) {
+  switch (where) {
+  case DISPLAY_MEMORY_PSRAM:
+    return heap_caps_malloc(bytes, MALLOC_CAP_SPIRAM | MALLOC_CAP_8BIT);
+  case DISPLAY_MEMORY_INTERNAL:
+    return heap_caps_malloc(bytes, MALLOC_CAP_INTERNAL | MALLOC_CAP_8BIT);
+  case DISPLAY_MEMORY_ANY:
+    break;
+  }
+  void *ptr = heap_caps_malloc(bytes, MALLOC_CAP_SPIRAM | MALLOC_CAP_8BIT);
+  return ptr ? ptr : heap_caps_malloc(bytes, MALLOC_CAP_INTERNAL | MALLOC_CAP_8BIT);
+}
+
+void displayFree(void *ptr) { heap_caps_free(ptr); }
+
+#else
+
+#include <stdlib.h>
+
+static bool psramAvailable = true;
+
+void displaySetPsramAvailable(bool available) { psramAvailable = available; }
+
+void *displayAlloc(size_t bytes, DisplayMemory where) {
+  if (where == DISPLAY_MEMORY_PSRAM && !psramAvailable) return nullptr;
+  return malloc(bytes);
+}
+
+void displayFree(void *ptr) { free(ptr); }
+
+#endif
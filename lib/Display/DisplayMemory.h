@@ -0,0 +1,22 @@
+#ifndef DISPLAY_MEMORY_H
+#define DISPLAY_MEMORY_H
+
+#include <stddef.h>
+
+// Where a large display buffer should live
+enum DisplayMemory {
+  DISPLAY_MEMORY_PSRAM,    // External PSRAM only
+  DISPLAY_MEMORY_INTERNAL, // Internal SRAM only
+  DISPLAY_MEMORY_ANY       // PSRAM if there is room, else internal
+};
+
+// Returns nullptr when the request can't be met
+void *displayAlloc(size_t bytes, DisplayMemory where);
+void displayFree(void *ptr);
+
+#if !defined(ARDUINO)
+// Host builds pretend to be a board with or without PSRAM
+void displaySetPsramAvailable(bool available);
+#endif
+
+#endif // DISPLAY_MEMORY_H
@@ -0,0 +1,171 @@
+#if defined(ESP32)
+
+#include "Esp32SpiBus.h"
+
+#include <Arduino.h>
+#include <assert.h>
+#include <driver/gpio.h>
+#include <esp_heap_caps.h>
+#include <string.h>
+
+namespace {
+
+// DC pin and level travel in the transaction's user field
+inline void *dcTag(int8_t pin, bool level) {
+  return (void *)(uintptr_t)(((uint32_t)pin << 1) | (level ? 1 : 0));
+}
+
+void IRAM_ATTR setDcBeforeTransfer(spi_transaction_t *t) {
+  uint32_t tag = (uint32_t)(uintptr_t)t->user;
+  gpio_set_level((gpio_num_t)(tag >> 1), tag & 1);
+}
+
+inline uint16_t swapBytes(uint16_t v) { return (uint16_t)((v << 8) | (v >> 8)); }
+
+} // namespace
+
+Esp32SpiBus::Esp32SpiBus(int8_t cs, int8_t dc, int8_t mosi, int8_t sclk, int8_t miso,
+                         uint32_t freq, spi_host_device_t host)
+    : _host(host), _cs(cs), _dc(dc), _mosi(mosi), _sclk(sclk), _miso(miso), _freq(freq),
+      _device(nullptr), _nextTrans(0), _inFlight(0), _nextBuffer(0), _currentBuffer(0),
+      _queuedSeq(0), _doneSeq(0) {
+  memset(_trans, 0, sizeof(_trans));
+  for (int i = 0; i < kBufferCount; i++) {
+    _buffers[i] = nullptr;
+    _bufferSeq[i] = 0;
+  }
+}
+
+void Esp32SpiBus::begin() {
+  pinMode(_dc, OUTPUT);
+
+  spi_bus_config_t buscfg;
+  memset(&buscfg, 0, sizeof(buscfg));
+  buscfg.mosi_io_num = _mosi;
+  buscfg.miso_io_num = _miso;
+  buscfg.sclk_io_num = _sclk;
+  buscfg.quadwp_io_num = -1;
+  buscfg.quadhd_io_num = -1;
+  buscfg.max_transfer_sz = kBufferPixels * 2;
+  ESP_ERROR_CHECK(spi_bus_initialize(_host, &buscfg, SPI_DMA_CH_AUTO));
+
+  spi_device_interface_config_t devcfg;
+  memset(&devcfg, 0, sizeof(devcfg));
+  devcfg.clock_speed_hz = _freq;
+  devcfg.mode = 0;
+  devcfg.spics_io_num = _cs;
+  devcfg.queue_size = kQueueDepth;
+  devcfg.pre_cb = setDcBeforeTransfer;
+  ESP_ERROR_CHECK(spi_bus_add_device(_host, &devcfg, &_device));
+
+  // DMA can only read internal RAM on the ESP32
+  for (int i = 0; i < kBufferCount; i++) {
+    _buffers[i] = (uint16_t *)heap_caps_malloc(kBufferPixels * 2, MALLOC_CAP_DMA);
+    assert(_buffers[i] != nullptr);
+  }
+}
+
+void Esp32SpiBus::writeCommand(uint8_t cmd) { sendPolling(&cmd, 1, false); }
+
+void Esp32SpiBus::writeData(const uint8_t *data, size_t len) { sendPolling(data, len, true); }
+
+void Esp32SpiBus::writePixels(const uint16_t *pixels, uint32_t count) {
+  while (count > 0) {
+    uint32_t chunk = count < kBufferPixels ? count : kBufferPixels;
+    uint16_t *buffer = acquireBuffer();
+    for (uint32_t i = 0; i < chunk; i++) {
+      buffer[i] = swapBytes(pixels[i]);
+    }
+    queueBuffer(buffer, chunk * 2);
+    pixels += chunk;
+    count -= chunk;
+  }
+}
+
+void Esp32SpiBus::writeColor(uint16_t color, uint32_t count) {
+  if (count == 0) return;
+
+  // One buffer of the color, queued as many times as needed
+  uint32_t fill = count < kBufferPixels ? count : kBufferPixels;
+  uint16_t *buffer = acquireBuffer();
+  uint16_t wire = swapBytes(color);
+  for (uint32_t i = 0; i < fill; i++) {
+    buffer[i] = wire;
+  }
+
+  while (count > 0) {
+    uint32_t chunk = count < fill ? count : fill;
+    queueBuffer(buffer, chunk * 2);
+    count -= chunk;
+  }
+}
+
+void Esp32SpiBus::waitIdle() {
+  while (_inFlight > 0) {
+    reclaimOne();
+  }
+}
+
+void Esp32SpiBus::sendPolling(const uint8_t *data, size_t len, bool dc) {
+  // Polled transfers may not overtake queued ones
+  waitIdle();
+
+  while (len > 0) {
+    spi_transaction_t t;
+    memset(&t, 0, sizeof(t));
+
+    size_t chunk = len;
+    if (chunk <= 4) {
+      t.flags = SPI_TRANS_USE_TXDATA;
+      memcpy(t.tx_data, data, chunk);
+    } else {
+      if (chunk > kBufferPixels * 2) chunk = kBufferPixels * 2;
+      memcpy(_buffers[0], data, chunk);
+      t.tx_buffer = _buffers[0];
+    }
+    t.length = chunk * 8;
+    t.user = dcTag(_dc, dc);
+    ESP_ERROR_CHECK(spi_device_polling_transmit(_device, &t));
+
+    data += chunk;
+    len -= chunk;
+  }
+}
+
+uint16_t *Esp32SpiBus::acquireBuffer() {
+  _currentBuffer = _nextBuffer;
+  _nextBuffer = (_nextBuffer + 1) % kBufferCount;
+
+  // Wait for the DMA engine to finish reading it
+  while (_doneSeq < _bufferSeq[_currentBuffer]) {
+    reclaimOne();
+  }
+  return _buffers[_currentBuffer];
+}
+
+void Esp32SpiBus::queueBuffer(const uint16_t *buffer, size_t bytes) {
+  if (_inFlight == kQueueDepth) {
+    reclaimOne();
+  }
+
+  spi_transaction_t &t = _trans[_nextTrans];
+  _nextTrans = (_nextTrans + 1) % kQueueDepth;
+
+  memset(&t, 0, sizeof(t));
+  t.tx_buffer = buffer;
+  t.length = bytes * 8;
+  t.user = dcTag(_dc, true);
+  ESP_ERROR_CHECK(spi_device_queue_trans(_device, &t, portMAX_DELAY));
+
+  _inFlight++;
+  _bufferSeq[_currentBuffer] = ++_queuedSeq;
+}
+
+void Esp32SpiBus::reclaimOne() {
+  spi_transaction_t *done;
+  ESP_ERROR_CHECK(spi_device_get_trans_result(_device, &done, portMAX_DELAY));
+  _inFlight--;
+  _doneSeq++;
+}
+
+#endif // ESP32
@@ -0,0 +1,56 @@
+#ifndef ESP32_SPI_BUS_H
+#define ESP32_SPI_BUS_H
+
+#if defined(ESP32)
+
+#include <driver/spi_master.h>
+
+#include "DisplayBus.h"
+
+// Hardware SPI backend using the ESP-IDF master driver. Commands and
+// parameters are sent as short polled transfers; pixel runs are copied
+// (byte swapped) into two internal DMA buffers and queued, so the CPU
+// fills the next buffer while the previous one is on the wire.
+class Esp32SpiBus : public DisplayBus {
+public:
+  Esp32SpiBus(int8_t cs, int8_t dc, int8_t mosi, int8_t sclk, int8_t miso,
+              uint32_t freq, spi_host_device_t host = SPI3_HOST);
+
+  void begin() override;
+
+  void writeCommand(uint8_t cmd) override;
+  void writeData(const uint8_t *data, size_t len) override;
+  void writePixels(const uint16_t *pixels, uint32_t count) override;
+  void writeColor(uint16_t color, uint32_t count) override;
+  void waitIdle() override;
+
+private:
+  static const int kQueueDepth = 8;
+  static const int kBufferCount = 2;
+  static const uint32_t kBufferPixels = 2048;
+
+  void sendPolling(const uint8_t *data, size_t len, bool dc);
+  uint16_t *acquireBuffer();
+  void queueBuffer(const uint16_t *buffer, size_t bytes);
+  void reclaimOne();
+
+  spi_host_device_t _host;
+  int8_t _cs, _dc, _mosi, _sclk, _miso;
+  uint32_t _freq;
+  spi_device_handle_t _device;
+
+  spi_transaction_t _trans[kQueueDepth];
+  uint8_t _nextTrans;
+  uint8_t _inFlight;
+
+  uint16_t *_buffers[kBufferCount];
+  uint32_t _bufferSeq[kBufferCount]; // Last transfer reading each buffer
+  uint8_t _nextBuffer;
+  uint8_t _currentBuffer;
+  uint32_t _queuedSeq;
+  uint32_t _doneSeq;
+};
+
+#endif // ESP32
+
+#endif // ESP32_SPI_BUS_H
@@ -0,0 +1,162 @@
+#include "FrameBuffer.h"
+
+#include <string.h>
+
+#include "SpanRaster.h"
+
+namespace {
+
+typedef uint32_t __attribute__((may_alias)) PixelPair;
+
+// Two pixels per store once the pointer is word aligned
+void fillPixels(uint16_t *out, int32_t count, uint16_t color) {
+  if (count > 0 && ((uintptr_t)out & 2)) {
+    *out++ = color;
+    count--;
+  }
+  PixelPair pair = color | (uint32_t)color << 16;
+  PixelPair *words = (PixelPair *)out;
+  for (int32_t i = count >> 1; i > 0; i--) *words++ = pair;
+  if (count & 1) out[count - 1] = color;
+}
+
+} // namespace
+
+void FrameBuffer::drawPixel(int16_t x, int16_t y, uint16_t color) {
+  x -= _originX;
+  y -= _originY;
+  if ((x < 0) || (y < 0) || (x >= WIDTH) || (y >= HEIGHT)) return;
+  _pixels[(int32_t)y * WIDTH + x] = color;
+  touch(x, y);
+}
+
+void FrameBuffer::drawFastHLine(int16_t x, int16_t y, int16_t w, uint16_t color) { span(x, y, w, color); }
+
+void FrameBuffer::drawFastVLine(int16_t x, int16_t y, int16_t h, uint16_t color) {
+  x -= _originX;
+  y -= _originY;
+  if (h < 0) {
+    y += h + 1;
+    h = -h;
+  }
+  if (y < 0) {
+    h += y;
+    y = 0;
+  }
+  if (y + h > HEIGHT) h = HEIGHT - y;
+  if (x < 0 || x >= WIDTH || h <= 0) return;
+
+  uint16_t *out = row(y) + x;
+  for (int16_t j = 0; j < h; j++, out += WIDTH) *out = color;
+  touch(x, y);
+  touch(x, y + h - 1);
+}
+
+void FrameBuffer::fillRect(int16_t x, int16_t y, int16_t w, int16_t h, uint16_t color) {
+  x -= _originX;
+  y -= _originY;
+  if (w < 0) {
+    x += w + 1;
+    w = -w;
+  }
+  if (h < 0) {
+    y += h + 1;
+    h = -h;
+  }
+  if (x < 0) {
+    w += x;
+    x = 0;
+  }
+  if (y < 0) {
+    h += y;
+    y = 0;
+  }
+  if (x + w > WIDTH) w = WIDTH - x;
+  if (y + h > HEIGHT) h = HEIGHT - y;
+  if (w <= 0 || h <= 0) return;
+
+  if (w == WIDTH) {
+    fillPixels(row(y), (int32_t)w * h, color);
+  } else {
+    for (int16_t j = 0; j < h; j++) fillPixels(row(y + j) + x, w, color);
+  }
+  touch(x, y);
+  touch(x + w - 1, y + h - 1);
+}
+
+void FrameBuffer::fillScreen(uint16_t color) {
+  fillPixels(_pixels, (int32_t)WIDTH * HEIGHT, color);
+  touch(0, 0);
+  touch(WIDTH - 1, HEIGHT - 1);
+}
+
+void FrameBuffer::blit(int16_t x, int16_t y, int16_t w, int16_t h, const uint16_t *pixels) {
+  int16_t stride = w;
+  x -= _originX;
+  y -= _originY;
+
+  // Clip, moving the source pointer along
+  if (x < 0) {
+    pixels -= x;
+    w += x;
+    x = 0;
+  }
+  if (y < 0) {
+    pixels -= (int32_t)y * stride;
+    h += y;
+    y = 0;
+  }
+  if (x + w > WIDTH) w = WIDTH - x;
+  if (y + h > HEIGHT) h = HEIGHT - y;
+  if (w <= 0 || h <= 0) return;
+
+  if (w == WIDTH && stride == WIDTH) {
+    // Whole rows on both sides: one copy
+    memcpy(row(y), pixels, (size_t)w * h * sizeof(uint16_t));
+  } else {
+    for (int16_t j = 0; j < h; j++) {
+      memcpy(row(y + j) + x, pixels + (int32_t)j * stride, w * sizeof(uint16_t));
+    }
+  }
+  touch(x, y);
+  touch(x + w - 1, y + h - 1);
+}
+
+void FrameBuffer::fillDisc(int16_t x, int16_t y, int16_t r, uint16_t color) {
+  discSpans(x, y, r, [&](int16_t sx, int16_t sy, int16_t w) { span(sx, sy, w, color); });
+}
+
+void FrameBuffer::fillTriangleSpans(int16_t x0, int16_t y0, int16_t x1, int16_t y1, int16_t x2, int16_t y2,
+                                    uint16_t color) {
+  triangleSpans(x0, y0, x1, y1, x2, y2, [&](int16_t sx, int16_t sy, int16_t w) { span(sx, sy, w, color); });
+}
+
+void FrameBuffer::span(int16_t x, int16_t y, int16_t w, uint16_t color) {
+  x -= _originX;
+  y -= _originY;
+  if (w < 0) {
+    x += w + 1;
+    w = -w;
+  }
+  if (y < 0 || y >= HEIGHT) return;
+  if (x < 0) {
+    w += x;
+    x = 0;
+  }
+  if (x + w > WIDTH) w = WIDTH - x;
+  if (w <= 0) return;
+
+  fillPixels(row(y) + x, w, color);
+  touch(x, y);
+  touch(x + w - 1, y);
+}
+
+Rect FrameBuffer::dirtyRect() const {
+  if (!isDirty()) return Rect{0, 0, 0, 0};
+  return Rect{_dirtyX0, _dirtyY0, (int16_t)(_dirtyX1 - _dirtyX0 + 1), (int16_t)(_dirtyY1 - _dirtyY0 + 1)};
+}
+
+void FrameBuffer::clearDirty() {
+  _dirtyX0 = _dirtyY0 = INT16_MAX;
+  _dirtyX1 = _dirtyY1 = -1;
+}
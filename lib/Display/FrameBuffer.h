@@ -0,0 +1,64 @@
+#ifndef FRAME_BUFFER_H
+#define FRAME_BUFFER_H
+
+#include "Surface.h"
+
+// RGB565 surface over caller-owned memory, one row after another.
+// Always rotation 0; size it to the panel's rotated width and height, or
+// make it a sprite: a piece of the screen, drawn on in screen coordinates.
+// Keeps the bounding box of what was drawn so a flush can skip the rest.
+// Fills go a row span at a time, two pixels per 32-bit store, instead of
+// through Adafruit_GFX's drawPixel() per pixel.
+class FrameBuffer : public Surface {
+public:
+  FrameBuffer(int16_t w, int16_t h, uint16_t *pixels)
+      : Surface(w, h), _pixels(pixels), _originX(0), _originY(0) {
+    clearDirty();
+  }
+
+  void drawPixel(int16_t x, int16_t y, uint16_t color) override;
+  void drawFastHLine(int16_t x, int16_t y, int16_t w, uint16_t color) override;
+  void drawFastVLine(int16_t x, int16_t y, int16_t h, uint16_t color) override;
+  void fillRect(int16_t x, int16_t y, int16_t w, int16_t h, uint16_t color) override;
+  void fillScreen(uint16_t color) override;
+  void blit(int16_t x, int16_t y, int16_t w, int16_t h, const uint16_t *pixels) override;
+  void fillDisc(int16_t x, int16_t y, int16_t r, uint16_t color) override;
+  void fillTriangleSpans(int16_t x0, int16_t y0, int16_t x1, int16_t y1, int16_t x2, int16_t y2,
+                         uint16_t color) override;
+
+  // Sprite mode: pixel (0, 0) sits at (x, y) on a screen of the given
+  // size, which is what width(), height() and text wrapping report
+  void setOrigin(int16_t x, int16_t y, int16_t screenWidth, int16_t screenHeight) {
+    _originX = x;
+    _originY = y;
+    _width = screenWidth;
+    _height = screenHeight;
+  }
+  int16_t originX() const { return _originX; }
+  int16_t originY() const { return _originY; }
+
+  uint16_t *pixels() const { return _pixels; }
+  uint16_t *row(int16_t y) const { return _pixels + (int32_t)y * WIDTH; }
+
+  // In buffer coordinates
+  bool isDirty() const { return _dirtyX0 <= _dirtyX1; }
+  Rect dirtyRect() const;
+  void clearDirty();
+
+private:
+  // In screen coordinates; clips
+  void span(int16_t x, int16_t y, int16_t w, uint16_t color);
+
+  void touch(int16_t x, int16_t y) {
+    if (x < _dirtyX0) _dirtyX0 = x;
+    if (x > _dirtyX1) _dirtyX1 = x;
+    if (y < _dirtyY0) _dirtyY0 = y;
+    if (y > _dirtyY1) _dirtyY1 = y;
+  }
+
+  uint16_t *_pixels;
+  int16_t _originX, _originY;
+  int16_t _dirtyX0, _dirtyY0, _dirtyX1, _dirtyY1; // Inclusive
+};
+
+#endif // FRAME_BUFFER_H
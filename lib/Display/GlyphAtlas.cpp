@@ -0,0 +1,97 @@
+#include "GlyphAtlas.h"
+
+#include <string.h>
+
+#include "FrameBuffer.h"
+
+GlyphAtlas::GlyphAtlas(size_t capacityBytes, DisplayMemory where)
+    : _capacity(capacityBytes / sizeof(uint16_t)), _where(where), _arena(nullptr), _allocFailed(false) {
+  memset(&_stats, 0, sizeof(_stats));
+  clear();
+}
+
+GlyphAtlas::~GlyphAtlas() { displayFree(_arena); }
+
+void GlyphAtlas::clear() {
+  _used = 0;
+  _count = 0;
+  memset(_slots, 0, sizeof(_slots));
+}
+
+int16_t GlyphAtlas::drawText(Surface &target, int16_t x, int16_t y, const char *text, uint8_t size,
+                             uint16_t color, uint16_t bg) {
+  for (; *text; text++) {
+    drawChar(target, x, y, *text, size, color, bg);
+    x += 6 * size;
+  }
+  return x;
+}
+
+void GlyphAtlas::drawChar(Surface &target, int16_t x, int16_t y, char c, uint8_t size, uint16_t color,
+                          uint16_t bg) {
+  const uint16_t *pixels = glyph((uint8_t)c, size, color, bg);
+  if (pixels) {
+    target.blit(x, y, 6 * size, 8 * size, pixels);
+  } else {
+    target.drawChar(x, y, c, color, bg, size);
+  }
+}
+
+const uint16_t *GlyphAtlas::glyph(uint8_t c, uint8_t size, uint16_t color, uint16_t bg) {
+  if (size == 0) return nullptr;
+
+  uint32_t hash = c * 0x9E37u ^ size * 0x85EBu ^ color * 0xC2B2u ^ bg * 0x27D4u;
+  for (int probe = 0; probe < kSlots; probe++) {
+    Slot &slot = _slots[(hash + probe) & (kSlots - 1)];
+    if (slot.size == 0) break;
+    if (slot.c == c && slot.size == size && slot.color == color && slot.bg == bg) {
+      _stats.hits++;
+      return _arena + slot.offset;
+    }
+  }
+
+  _stats.misses++;
+  const uint16_t *pixels = render(c, size, color, bg);
+  if (!pixels) return nullptr;
+
+  for (int probe = 0;; probe++) {
+    Slot &slot = _slots[(hash + probe) & (kSlots - 1)];
+    if (slot.size == 0) {
+      slot.offset = pixels - _arena;
+      slot.color = color;
+      slot.bg = bg;
+      slot.c = c;
+      slot.size = size;
+      _count++;
+      return pixels;
+    }
+  }
+}
+
+bool GlyphAtlas::reserve() {
+  if (!_arena && !_allocFailed) {
+    _arena = (uint16_t *)displayAlloc(_capacity * sizeof(uint16_t), _where);
+    _allocFailed = !_arena;
+  }
+  return _arena != nullptr;
+}
+
+// Rasterizes the glyph with Adafruit_GFX itself, into the arena
+const uint16_t *GlyphAtlas::render(uint8_t c, uint8_t size, uint16_t color, uint16_t bg) {
+  if (!reserve()) return nullptr;
+
+  int16_t w = 6 * size, h = 8 * size;
+  size_t pixelCount = (size_t)w * h;
+  if (pixelCount > _capacity) return nullptr;
+  if (_used + pixelCount > _capacity || _count == kMaxGlyphs) {
+    clear();
+    _stats.flushes++;
+  }
+
+  uint16_t *pixels = _arena + _used;
+  FrameBuffer cell(w, h, pixels);
+  cell.fillScreen(bg);
+  cell.drawChar(0, 0, c, color, bg, size);
+  _used += pixelCount;
+  return pixels;
+}
@@ -0,0 +1,58 @@
+#ifndef GLYPH_ATLAS_H
+#define GLYPH_ATLAS_H
+
+#include "DisplayMemory.h"
+#include "Surface.h"
+
+struct GlyphAtlasStats {
+  uint32_t hits;
+  uint32_t misses;
+  uint32_t flushes; // Times the atlas filled up and started over
+};
+
+// Characters of the built-in 5x7 font, pre-scaled with their colors baked
+// in, so drawing one is a single blit instead of a fillRect per lit font
+// pixel. Glyphs are opaque 6x8 cells times the size, exactly what
+// Adafruit_GFX::drawChar() draws with a background color. Entries are
+// added as text is drawn; when the arena is full it starts over.
+class GlyphAtlas {
+public:
+  GlyphAtlas(size_t capacityBytes, DisplayMemory where);
+  ~GlyphAtlas();
+
+  // One line of text, no wrapping; returns the x after the last cell.
+  // Falls back to drawChar() when the arena can't be allocated.
+  int16_t drawText(Surface &target, int16_t x, int16_t y, const char *text, uint8_t size, uint16_t color,
+                   uint16_t bg);
+  void drawChar(Surface &target, int16_t x, int16_t y, char c, uint8_t size, uint16_t color, uint16_t bg);
+
+  // Allocates the arena now rather than on the first glyph
+  bool reserve();
+  void clear();
+  size_t bytesUsed() const { return _used * sizeof(uint16_t); }
+  const GlyphAtlasStats &stats() const { return _stats; }
+
+private:
+  static const int kSlots = 256; // Hash table, power of two
+  static const int kMaxGlyphs = kSlots / 2;
+
+  struct Slot {
+    uint32_t offset; // Into _arena, in pixels
+    uint16_t color, bg;
+    uint8_t c, size; // size 0: empty slot
+  };
+
+  const uint16_t *glyph(uint8_t c, uint8_t size, uint16_t color, uint16_t bg);
+  const uint16_t *render(uint8_t c, uint8_t size, uint16_t color, uint16_t bg);
+
+  size_t _capacity; // Pixels
+  DisplayMemory _where;
+  uint16_t *_arena;
+  bool _allocFailed;
+  size_t _used;
+  int _count;
+  Slot _slots[kSlots];
+  GlyphAtlasStats _stats;
+};
+
+#endif // GLYPH_ATLAS_H
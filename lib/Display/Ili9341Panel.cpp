@@ -0,0 +1,369 @@
+#include "Ili9341Panel.h"
+
+#define ILI9341_SWRESET 0x01
+#define ILI9341_SLPOUT 0x11
+#define ILI9341_INVOFF 0x20
+#define ILI9341_INVON 0x21
+#define ILI9341_GAMMASET 0x26
+#define ILI9341_DISPON 0x29
+#define ILI9341_CASET 0x2A
+#define ILI9341_PASET 0x2B
+#define ILI9341_RAMWR 0x2C
+#define ILI9341_VSCRDEF 0x33
+#define ILI9341_MADCTL 0x36
+#define ILI9341_VSCRSADD 0x37
+#define ILI9341_PIXFMT 0x3A
+#define ILI9341_FRMCTR1 0xB1
+#define ILI9341_DFUNCTR 0xB6
+#define ILI9341_PWCTR1 0xC0
+#define ILI9341_PWCTR2 0xC1
+#define ILI9341_VMCTR1 0xC5
+#define ILI9341_VMCTR2 0xC7
+#define ILI9341_GMCTRP1 0xE0
+#define ILI9341_GMCTRN1 0xE1
+
+#define MADCTL_MY 0x80
+#define MADCTL_MX 0x40
+#define MADCTL_MV 0x20
+#define MADCTL_BGR 0x08
+
+// Same power-up sequence as Adafruit_ILI9341: command, argument count
+// (bit 7 = wait 150 ms afterwards), arguments
+static const uint8_t PROGMEM initcmd[] = {
+  0xEF, 3, 0x03, 0x80, 0x02,
+  0xCF, 3, 0x00, 0xC1, 0x30,
+  0xED, 4, 0x64, 0x03, 0x12, 0x81,
+  0xE8, 3, 0x85, 0x00, 0x78,
+  0xCB, 5, 0x39, 0x2C, 0x00, 0x34, 0x02,
+  0xF7, 1, 0x20,
+  0xEA, 2, 0x00, 0x00,
+  ILI9341_PWCTR1  , 1, 0x23,             // Power control VRH[5:0]
+  ILI9341_PWCTR2  , 1, 0x10,             // Power control SAP[2:0];BT[3:0]
+  ILI9341_VMCTR1  , 2, 0x3e, 0x28,       // VCM control
+  ILI9341_VMCTR2  , 1, 0x86,             // VCM control2
+  ILI9341_MADCTL  , 1, 0x48,             // Memory Access Control
+  ILI9341_VSCRSADD, 1, 0x00,             // Vertical scroll zero
+  ILI9341_PIXFMT  , 1, 0x55,
+  ILI9341_FRMCTR1 , 2, 0x00, 0x18,
+  ILI9341_DFUNCTR , 3, 0x08, 0x82, 0x27, // Display Function Control
+  0xF2, 1, 0x00,                         // 3Gamma Function Disable
+  ILI9341_GAMMASET , 1, 0x01,            // Gamma curve selected
+  ILI9341_GMCTRP1 , 15, 0x0F, 0x31, 0x2B, 0x0C, 0x0E, 0x08, // Set Gamma
+    0x4E, 0xF1, 0x37, 0x07, 0x10, 0x03, 0x0E, 0x09, 0x00,
+  ILI9341_GMCTRN1 , 15, 0x00, 0x0E, 0x14, 0x03, 0x11, 0x07, // Set Gamma
+    0x31, 0xC1, 0x48, 0x08, 0x0F, 0x0C, 0x31, 0x36, 0x0F,
+  ILI9341_SLPOUT  , 0x80,                // Exit Sleep
+  ILI9341_DISPON  , 0x80,                // Display on
+  0x00                                   // End of list
+};
+
+Ili9341Panel::Ili9341Panel(DisplayBus &bus, int8_t rst)
+    : Surface(ILI9341_PANEL_WIDTH, ILI9341_PANEL_HEIGHT), _bus(bus), _rst(rst), _writeDepth(0), _mirrored(false),
+      _scrollFirst(0), _scrollCount(ILI9341_PANEL_HEIGHT), _scrollOffset(0) {
+  _oldX1 = _oldX2 = _oldY1 = _oldY2 = 0xFFFF;
+}
+
+void Ili9341Panel::begin() {
+  _bus.begin();
+
+  if (_rst >= 0) {
+    pinMode(_rst, OUTPUT);
+    digitalWrite(_rst, HIGH);
+    delay(100);
+    digitalWrite(_rst, LOW);
+    delay(100);
+    digitalWrite(_rst, HIGH);
+    delay(200);
+  } else {
+    sendCommand(ILI9341_SWRESET, nullptr, 0);
+    delay(150);
+  }
+
+  uint8_t cmd, x, numArgs;
+  const uint8_t *addr = initcmd;
+  while ((cmd = pgm_read_byte(addr++)) > 0) {
+    x = pgm_read_byte(addr++);
+    numArgs = x & 0x7F;
+    uint8_t args[16];
+    for (uint8_t i = 0; i < numArgs; i++) {
+      args[i] = pgm_read_byte(addr++);
+    }
+    sendCommand(cmd, args, numArgs);
+    if (x & 0x80) delay(150);
+  }
+
+  _width = ILI9341_PANEL_WIDTH;
+  _height = ILI9341_PANEL_HEIGHT;
+  _oldX1 = _oldX2 = _oldY1 = _oldY2 = 0xFFFF;
+  _mirrored = false;
+  _scrollFirst = _scrollOffset = 0;
+  _scrollCount = ILI9341_PANEL_HEIGHT;
+}
+
+void Ili9341Panel::sendCommand(uint8_t cmd, const uint8_t *data, uint8_t len) {
+  _bus.writeCommand(cmd);
+  if (len > 0) _bus.writeData(data, len);
+}
+
+void Ili9341Panel::setRotation(uint8_t m) {
+  rotation = m % 4; // can't be higher than 3
+  switch (rotation) {
+  case 0:
+    m = (MADCTL_MX | MADCTL_BGR);
+    _width = ILI9341_PANEL_WIDTH;
+    _height = ILI9341_PANEL_HEIGHT;
+    break;
+  case 1:
+    m = (MADCTL_MV | MADCTL_BGR);
+    _width = ILI9341_PANEL_HEIGHT;
+    _height = ILI9341_PANEL_WIDTH;
+    break;
+  case 2:
+    m = (MADCTL_MY | MADCTL_BGR);
+    _width = ILI9341_PANEL_WIDTH;
+    _height = ILI9341_PANEL_HEIGHT;
+    break;
+  case 3:
+    m = (MADCTL_MX | MADCTL_MY | MADCTL_MV | MADCTL_BGR);
+    _width = ILI9341_PANEL_HEIGHT;
+    _height = ILI9341_PANEL_WIDTH;
+    break;
+  }
+
+  sendCommand(ILI9341_MADCTL, &m, 1);
+  _oldX1 = _oldX2 = _oldY1 = _oldY2 = 0xFFFF;
+  _mirrored = (m & MADCTL_MY) != 0;
+}
+
+void Ili9341Panel::setScrollArea(int16_t first, int16_t count) {
+  if (first < 0) first = 0;
+  if (first > ILI9341_PANEL_HEIGHT - 1) first = ILI9341_PANEL_HEIGHT - 1;
+  if (count < 1) count = 1;
+  if (count > ILI9341_PANEL_HEIGHT - first) count = ILI9341_PANEL_HEIGHT - first;
+
+  // Top and bottom fixed areas in native rows, which MY reverses
+  uint16_t top = _mirrored ? ILI9341_PANEL_HEIGHT - first - count : first;
+  uint16_t bottom = ILI9341_PANEL_HEIGHT - top - count;
+  uint8_t args[6] = {(uint8_t)(top >> 8),   (uint8_t)top,          (uint8_t)(count >> 8),
+                     (uint8_t)count,        (uint8_t)(bottom >> 8), (uint8_t)bottom};
+  sendCommand(ILI9341_VSCRDEF, args, sizeof(args));
+
+  _scrollFirst = first;
+  _scrollCount = count;
+  _scrollOffset = -1; // Force the start line out
+  scrollTo(0);
+}
+
+void Ili9341Panel::scrollTo(int16_t offset) {
+  offset %= _scrollCount;
+  if (offset < 0) offset += _scrollCount;
+  if (offset == _scrollOffset) return;
+  _scrollOffset = offset;
+
+  // The start line is the memory row shown first in native order. Mirrored,
+  // screen coordinates count down through the native rows, so the memory
+  // moves the other way.
+  uint16_t top = _mirrored ? ILI9341_PANEL_HEIGHT - _scrollFirst - _scrollCount : _scrollFirst;
+  uint16_t start = top + (_mirrored ? (_scrollCount - offset) % _scrollCount : offset);
+  uint8_t args[2] = {(uint8_t)(start >> 8), (uint8_t)start};
+  sendCommand(ILI9341_VSCRSADD, args, sizeof(args));
+}
+
+void Ili9341Panel::invertDisplay(bool invert) {
+  sendCommand(invert ? ILI9341_INVON : ILI9341_INVOFF, nullptr, 0);
+}
+
+void Ili9341Panel::startWrite(void) { _writeDepth++; }
+
+void Ili9341Panel::endWrite(void) {
+  if (_writeDepth > 0) _writeDepth--;
+}
+
+void Ili9341Panel::setAddrWindow(uint16_t x1, uint16_t y1, uint16_t w, uint16_t h) {
+  uint16_t x2 = (x1 + w - 1), y2 = (y1 + h - 1);
+  if (x1 != _oldX1 || x2 != _oldX2) {
+    _bus.writeCommand(ILI9341_CASET); // Column address set
+    _bus.writeData16(x1, x2);
+    _oldX1 = x1;
+    _oldX2 = x2;
+  }
+  if (y1 != _oldY1 || y2 != _oldY2) {
+    _bus.writeCommand(ILI9341_PASET); // Row address set
+    _bus.writeData16(y1, y2);
+    _oldY1 = y1;
+    _oldY2 = y2;
+  }
+  _bus.writeCommand(ILI9341_RAMWR); // Write to RAM
+}
+
+void Ili9341Panel::drawPixel(int16_t x, int16_t y, uint16_t color) {
+  if ((x >= 0) && (x < _width) && (y >= 0) && (y < _height)) {
+    startWrite();
+    setAddrWindow(x, y, 1, 1);
+    _bus.writeColor(color, 1);
+    endWrite();
+    markDamage(x, y, 1, 1);
+  }
+}
+
+bool Ili9341Panel::openWindow(int16_t x, int16_t y, int16_t w, int16_t h) {
+  if (x < 0 || y < 0 || w <= 0 || h <= 0 || x + w > _width || y + h > _height) return false;
+  setAddrWindow(x, y, w, h);
+  markDamage(x, y, w, h);
+  return true;
+}
+
+void Ili9341Panel::writePixel(int16_t x, int16_t y, uint16_t color) {
+  if ((x >= 0) && (x < _width) && (y >= 0) && (y < _height)) {
+    setAddrWindow(x, y, 1, 1);
+    _bus.writeColor(color, 1);
+    markDamage(x, y, 1, 1);
+  }
+}
+
+void Ili9341Panel::writeFillRectPreclipped(int16_t x, int16_t y, int16_t w, int16_t h, uint16_t color) {
+  setAddrWindow(x, y, w, h);
+  _bus.writeColor(color, (uint32_t)w * h);
+  markDamage(x, y, w, h);
+}
+
+void Ili9341Panel::writeFillRect(int16_t x, int16_t y, int16_t w, int16_t h, uint16_t color) {
+  if (w && h) {   // Nonzero width and height?
+    if (w < 0) {  // If negative width...
+      x += w + 1; //   Move X to left edge
+      w = -w;     //   Use positive width
+    }
+    if (x < _width) { // Not off right
+      if (h < 0) {    // If negative height...
+        y += h + 1;   //   Move Y to top edge
+        h = -h;       //   Use positive height
+      }
+      if (y < _height) { // Not off bottom
+        int16_t x2 = x + w - 1;
+        if (x2 >= 0) { // Not off left
+          int16_t y2 = y + h - 1;
+          if (y2 >= 0) { // Not off top
+            // Rectangle partly or fully overlaps screen
+            if (x < 0) {
+              x = 0;
+              w = x2 + 1;
+            } // Clip left
+            if (y < 0) {
+              y = 0;
+              h = y2 + 1;
+            } // Clip top
+            if (x2 >= _width) {
+              w = _width - x;
+            } // Clip right
+            if (y2 >= _height) {
+              h = _height - y;
+            } // Clip bottom
+            writeFillRectPreclipped(x, y, w, h, color);
+          }
+        }
+      }
+    }
+  }
+}
+
+void Ili9341Panel::writeFastHLine(int16_t x, int16_t y, int16_t w, uint16_t color) {
+  if ((y >= 0) && (y < _height) && w) { // Y on screen, nonzero width
+    if (w < 0) {                        // If negative width...
+      x += w + 1;                       //   Move X to left edge
+      w = -w;                           //   Use positive width
+    }
+    if (x < _width) { // Not off right
+      int16_t x2 = x + w - 1;
+      if (x2 >= 0) { // Not off left
+        // Line partly or fully overlaps screen
+        if (x < 0) {
+          x = 0;
+          w = x2 + 1;
+        } // Clip left
+        if (x2 >= _width) {
+          w = _width - x;
+        } // Clip right
+        writeFillRectPreclipped(x, y, w, 1, color);
+      }
+    }
+  }
+}
+
+void Ili9341Panel::writeFastVLine(int16_t x, int16_t y, int16_t h, uint16_t color) {
+  if ((x >= 0) && (x < _width) && h) { // X on screen, nonzero height
+    if (h < 0) {                       // If negative height...
+      y += h + 1;                      //   Move Y to top edge
+      h = -h;                          //   Use positive height
+    }
+    if (y < _height) { // Not off bottom
+      int16_t y2 = y + h - 1;
+      if (y2 >= 0) { // Not off top
+        // Line partly or fully overlaps screen
+        if (y < 0) {
+          y = 0;
+          h = y2 + 1;
+        } // Clip top
+        if (y2 >= _height) {
+          h = _height - y;
+        } // Clip bottom
+        writeFillRectPreclipped(x, y, 1, h, color);
+      }
+    }
+  }
+}
+
+void Ili9341Panel::fillRect(int16_t x, int16_t y, int16_t w, int16_t h, uint16_t color) {
+  startWrite();
+  writeFillRect(x, y, w, h, color);
+  endWrite();
+}
+
+void Ili9341Panel::drawFastHLine(int16_t x, int16_t y, int16_t w, uint16_t color) {
+  startWrite();
+  writeFastHLine(x, y, w, color);
+  endWrite();
+}
+
+void Ili9341Panel::drawFastVLine(int16_t x, int16_t y, int16_t h, uint16_t color) {
+  startWrite();
+  writeFastVLine(x, y, h, color);
+  endWrite();
+}
+
+void Ili9341Panel::drawRGBBitmap(int16_t x, int16_t y, const uint16_t *pcolors, int16_t w, int16_t h) {
+  int16_t x2, y2;                 // Lower-right coord
+  if ((x >= _width) ||            // Off-edge right
+      (y >= _height) ||           // " top
+      ((x2 = (x + w - 1)) < 0) || // " left
+      ((y2 = (y + h - 1)) < 0))
+    return; // " bottom
+
+  int16_t bx1 = 0, by1 = 0, // Clipped top-left within bitmap
+      saveW = w;            // Save original bitmap width value
+  if (x < 0) {              // Clip left
+    w += x;
+    bx1 = -x;
+    x = 0;
+  }
+  if (y < 0) { // Clip top
+    h += y;
+    by1 = -y;
+    y = 0;
+  }
+  if (x2 >= _width) w = _width - x;   // Clip right
+  if (y2 >= _height) h = _height - y; // Clip bottom
+
+  pcolors += by1 * saveW + bx1; // Offset bitmap ptr to clipped top-left
+  markDamage(x, y, w, h);
+  startWrite();
+  setAddrWindow(x, y, w, h); // Clipped area
+  if (w == saveW) {
+    _bus.writePixels(pcolors, (uint32_t)w * h); // Contiguous rows, one run
+  } else {
+    while (h--) { // For each (clipped) scanline...
+      _bus.writePixels(pcolors, w);
+      pcolors += saveW; // Advance pointer by one full (unclipped) line
+    }
+  }
+  endWrite();
+}
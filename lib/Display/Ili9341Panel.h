@@ -0,0 +1,74 @@
+#ifndef ILI9341_PANEL_H
+#define ILI9341_PANEL_H
+
+#include "DisplayBus.h"
+#include "Surface.h"
+
+#define ILI9341_PANEL_WIDTH 240
+#define ILI9341_PANEL_HEIGHT 320
+
+// ILI9341 driver on top of a DisplayBus. Draws exactly like
+// Adafruit_ILI9341 (same clipping, same address window caching) but the
+// transport is pluggable: DMA SPI on the ESP32, recording bus on the host.
+class Ili9341Panel : public Surface {
+public:
+  Ili9341Panel(DisplayBus &bus, int8_t rst = -1);
+
+  void begin();
+  void setRotation(uint8_t r) override;
+  void invertDisplay(bool i) override;
+
+  void drawPixel(int16_t x, int16_t y, uint16_t color) override;
+  void startWrite(void) override;
+  void endWrite(void) override;
+  void writePixel(int16_t x, int16_t y, uint16_t color) override;
+  void writeFillRect(int16_t x, int16_t y, int16_t w, int16_t h, uint16_t color) override;
+  void writeFastHLine(int16_t x, int16_t y, int16_t w, uint16_t color) override;
+  void writeFastVLine(int16_t x, int16_t y, int16_t h, uint16_t color) override;
+  void fillRect(int16_t x, int16_t y, int16_t w, int16_t h, uint16_t color) override;
+  void drawFastHLine(int16_t x, int16_t y, int16_t w, uint16_t color) override;
+  void drawFastVLine(int16_t x, int16_t y, int16_t h, uint16_t color) override;
+
+  using Adafruit_GFX::drawRGBBitmap;
+  void drawRGBBitmap(int16_t x, int16_t y, const uint16_t *pcolors, int16_t w, int16_t h);
+  // One address window
+  void blit(int16_t x, int16_t y, int16_t w, int16_t h, const uint16_t *pixels) override {
+    drawRGBBitmap(x, y, pixels, w, h);
+  }
+
+  // Raw window access for bulk pushes; the caller clips
+  void setAddrWindow(uint16_t x, uint16_t y, uint16_t w, uint16_t h);
+  // setAddrWindow() for a rect that must be fully on screen, recorded as
+  // damage. False, and nothing sent, if it isn't.
+  bool openWindow(int16_t x, int16_t y, int16_t w, int16_t h);
+  void pushPixels(const uint16_t *pixels, uint32_t count) { _bus.writePixels(pixels, count); }
+  void pushColor(uint16_t color, uint32_t count) { _bus.writeColor(color, count); }
+
+  // Hardware scrolling (VSCRDEF/VSCRSADD). It moves the panel's native
+  // rows, which is the x axis in landscape: a scroll area is a run of
+  // whole columns, or rows in portrait, in screen coordinates. Scrolled
+  // by offset, screen line first + i shows what was drawn at
+  // first + (i + offset) % count. Drawing always addresses the memory,
+  // not the glass.
+  bool scrollsHorizontally() const { return _width > _height; }
+  void setScrollArea(int16_t first, int16_t count);
+  void scrollTo(int16_t offset);
+  int16_t scrollFirst() const { return _scrollFirst; }
+  int16_t scrollCount() const { return _scrollCount; }
+  int16_t scrollOffset() const { return _scrollOffset; }
+
+  DisplayBus &bus() { return _bus; }
+
+private:
+  void writeFillRectPreclipped(int16_t x, int16_t y, int16_t w, int16_t h, uint16_t color);
+  void sendCommand(uint8_t cmd, const uint8_t *data, uint8_t len);
+
+  DisplayBus &_bus;
+  int8_t _rst;
+  uint8_t _writeDepth;
+  uint16_t _oldX1, _oldX2, _oldY1, _oldY2;
+  bool _mirrored; // MADCTL MY: screen lines run against the native rows
+  int16_t _scrollFirst, _scrollCount, _scrollOffset;
+};
+
+#endif // ILI9341_PANEL_H
@@ -0,0 +1,196 @@
+#include "IndexedFrameBuffer.h"
+
+#include <string.h>
+
+#include "SpanRaster.h"
+
+void Palette::setCapacity(uint16_t capacity) {
+  _capacity = capacity > 256 ? 256 : capacity;
+  clear();
+}
+
+void Palette::clear() {
+  memset(_colors, 0, sizeof(_colors));
+  _count = 0;
+  _lastColor = 0;
+  _lastIndex = 0;
+  _misses = 0;
+}
+
+uint8_t Palette::lookup(uint16_t color) {
+  uint8_t index = 0;
+  bool found = false;
+  for (uint16_t i = 0; i < _count; i++) {
+    if (_colors[i] == color) {
+      index = (uint8_t)i;
+      found = true;
+      break;
+    }
+  }
+
+  if (!found && _count < _capacity) {
+    index = (uint8_t)_count;
+    _colors[_count++] = color;
+  } else if (!found) {
+    // Full: nearest by squared distance, green at its own 6-bit scale
+    int32_t best = INT32_MAX;
+    for (uint16_t i = 0; i < _count; i++) {
+      int32_t dr = (int32_t)(_colors[i] >> 11) - (color >> 11);
+      int32_t dg = (int32_t)((_colors[i] >> 5) & 0x3F) - ((color >> 5) & 0x3F);
+      int32_t db = (int32_t)(_colors[i] & 0x1F) - (color & 0x1F);
+      int32_t distance = 4 * dr * dr + dg * dg + 4 * db * db;
+      if (distance < best) {
+        best = distance;
+        index = (uint8_t)i;
+      }
+    }
+    _misses++;
+  }
+
+  _lastColor = color;
+  _lastIndex = index;
+  return index;
+}
+
+void IndexedFrameBuffer::drawPixel(int16_t x, int16_t y, uint16_t color) {
+  if ((x < 0) || (y < 0) || (x >= WIDTH) || (y >= HEIGHT)) return;
+  setIndex(row(y), x, _palette.indexOf(color));
+  touch(x, y);
+}
+
+void IndexedFrameBuffer::drawFastHLine(int16_t x, int16_t y, int16_t w, uint16_t color) {
+  fillRect(x, y, w, 1, color);
+}
+
+void IndexedFrameBuffer::drawFastVLine(int16_t x, int16_t y, int16_t h, uint16_t color) {
+  fillRect(x, y, 1, h, color);
+}
+
+void IndexedFrameBuffer::fillRect(int16_t x, int16_t y, int16_t w, int16_t h, uint16_t color) {
+  if (w < 0) {
+    x += w + 1;
+    w = -w;
+  }
+  if (h < 0) {
+    y += h + 1;
+    h = -h;
+  }
+  int16_t x0 = x < 0 ? 0 : x;
+  int16_t y0 = y < 0 ? 0 : y;
+  int16_t x1 = x + w > WIDTH ? WIDTH - 1 : x + w - 1;
+  int16_t y1 = y + h > HEIGHT ? HEIGHT - 1 : y + h - 1;
+  if (x0 > x1 || y0 > y1) return;
+
+  uint8_t index = _palette.indexOf(color);
+  for (int16_t j = y0; j <= y1; j++) fillSpan(row(j), x0, x1, index);
+  touch(x0, y0);
+  touch(x1, y1);
+}
+
+void IndexedFrameBuffer::fillScreen(uint16_t color) {
+  uint8_t index = _palette.indexOf(color);
+  memset(_indices, _bits == 8 ? index : index * 0x11, _stride * HEIGHT);
+  touch(0, 0);
+  touch(WIDTH - 1, HEIGHT - 1);
+}
+
+void IndexedFrameBuffer::blit(int16_t x, int16_t y, int16_t w, int16_t h, const uint16_t *pixels) {
+  int16_t stride = w;
+
+  if (x < 0) {
+    pixels -= x;
+    w += x;
+    x = 0;
+  }
+  if (y < 0) {
+    pixels -= (int32_t)y * stride;
+    h += y;
+    y = 0;
+  }
+  if (x + w > WIDTH) w = WIDTH - x;
+  if (y + h > HEIGHT) h = HEIGHT - y;
+  if (w <= 0 || h <= 0) return;
+
+  for (int16_t j = 0; j < h; j++) {
+    uint8_t *dst = row(y + j);
+    const uint16_t *src = pixels + (int32_t)j * stride;
+    for (int16_t i = 0; i < w; i++) setIndex(dst, x + i, _palette.indexOf(src[i]));
+  }
+  touch(x, y);
+  touch(x + w - 1, y + h - 1);
+}
+
+void IndexedFrameBuffer::fillDisc(int16_t x, int16_t y, int16_t r, uint16_t color) {
+  discSpans(x, y, r, [&](int16_t sx, int16_t sy, int16_t w) { fillRect(sx, sy, w, 1, color); });
+}
+
+void IndexedFrameBuffer::fillTriangleSpans(int16_t x0, int16_t y0, int16_t x1, int16_t y1, int16_t x2, int16_t y2,
+                                           uint16_t color) {
+  triangleSpans(x0, y0, x1, y1, x2, y2, [&](int16_t sx, int16_t sy, int16_t w) { fillRect(sx, sy, w, 1, color); });
+}
+
+bool IndexedFrameBuffer::diffRow(const uint8_t *front, int16_t y, int16_t &x0, int16_t &x1) const {
+  const uint8_t *back = row(y);
+  front += (int32_t)y * _stride;
+
+  int16_t b0 = _bits == 8 ? x0 : x0 >> 1;
+  int16_t b1 = _bits == 8 ? x1 : x1 >> 1;
+  while (b0 <= b1 && back[b0] == front[b0]) b0++;
+  if (b0 > b1) return false;
+  while (back[b1] == front[b1]) b1--;
+
+  if (_bits == 8) {
+    x0 = b0;
+    x1 = b1;
+  } else {
+    int16_t last = x1;
+    x0 = b0 << 1;
+    x1 = (b1 << 1) + 1;
+    if (x1 > last) x1 = last;
+  }
+  return true;
+}
+
+void IndexedFrameBuffer::expandRow(int16_t x, int16_t y, int16_t w, uint16_t *out) const {
+  const uint8_t *src = row(y);
+  const uint16_t *lut = _palette.colors();
+
+  if (_bits == 8) {
+    src += x;
+    for (int16_t i = 0; i < w; i++) out[i] = lut[src[i]];
+    return;
+  }
+
+  src += x >> 1;
+  if (x & 1 && w > 0) {
+    *out++ = lut[*src++ & 0x0F];
+    w--;
+  }
+  for (; w >= 2; w -= 2) {
+    uint8_t pair = *src++;
+    *out++ = lut[pair >> 4];
+    *out++ = lut[pair & 0x0F];
+  }
+  if (w) *out = lut[*src >> 4];
+}
+
+Rect IndexedFrameBuffer::dirtyRect() const {
+  if (!isDirty()) return Rect{0, 0, 0, 0};
+  return Rect{_dirtyX0, _dirtyY0, (int16_t)(_dirtyX1 - _dirtyX0 + 1), (int16_t)(_dirtyY1 - _dirtyY0 + 1)};
+}
+
+void IndexedFrameBuffer::clearDirty() {
+  _dirtyX0 = _dirtyY0 = INT16_MAX;
+  _dirtyX1 = _dirtyY1 = -1;
+}
+
+void IndexedFrameBuffer::fillSpan(uint8_t *row, int16_t x0, int16_t x1, uint8_t index) {
+  if (_bits == 8) {
+    memset(row + x0, index, x1 - x0 + 1);
+    return;
+  }
+  // Odd pixels at the ends share a byte with their neighbour
+  if (x0 & 1) setIndex(row, x0++, index);
+  if (x1 >= x0 && !(x1 & 1)) setIndex(row, x1--, index);
+  if (x1 > x0) memset(row + (x0 >> 1), index * 0x11, (x1 - x0 + 1) >> 1);
+}
@@ -0,0 +1,114 @@
+#ifndef INDEXED_FRAME_BUFFER_H
+#define INDEXED_FRAME_BUFFER_H
+
+#include "Surface.h"
+
+// RGB565 colors handed out as indices, in the order they are first drawn.
+// Entries are never reused or moved, so equal indices always mean equal
+// colors and two buffers on one palette can be compared byte for byte.
+// Once it is full, a new color gets the nearest entry and counts a miss.
+class Palette {
+public:
+  explicit Palette(uint16_t capacity = 256) { setCapacity(capacity); }
+
+  // Empties the palette; at most 256 entries
+  void setCapacity(uint16_t capacity);
+  void clear();
+
+  uint8_t indexOf(uint16_t color) {
+    // Draw calls come in long runs of one color
+    if (color == _lastColor && _count > 0) return _lastIndex;
+    return lookup(color);
+  }
+
+  uint16_t color(uint8_t index) const { return _colors[index]; }
+  const uint16_t *colors() const { return _colors; }
+  uint16_t size() const { return _count; }
+  uint16_t capacity() const { return _capacity; }
+  uint32_t misses() const { return _misses; }
+
+private:
+  uint8_t lookup(uint16_t color);
+
+  uint16_t _colors[256];
+  uint16_t _count;
+  uint16_t _capacity;
+  uint16_t _lastColor;
+  uint8_t _lastIndex;
+  uint32_t _misses;
+};
+
+// Surface of 8 or 4 bit palette indices over caller-owned memory: half or
+// a quarter of an RGB565 buffer, so fills and clears touch that much less.
+// At 4 bits the even pixel of each pair is the high nibble. Always
+// rotation 0 and screen sized; expandRow() turns a row back into RGB565
+// for the panel. Keeps the bounding box of what was drawn like
+// FrameBuffer.
+class IndexedFrameBuffer : public Surface {
+public:
+  IndexedFrameBuffer(int16_t w, int16_t h, uint8_t bitsPerPixel, uint8_t *indices, Palette &palette)
+      : Surface(w, h), _indices(indices), _palette(palette), _bits(bitsPerPixel),
+        _stride(strideFor(w, bitsPerPixel)) {
+    clearDirty();
+  }
+
+  static size_t strideFor(int16_t w, uint8_t bitsPerPixel) { return ((size_t)w * bitsPerPixel + 7) / 8; }
+  static size_t bytesFor(int16_t w, int16_t h, uint8_t bitsPerPixel) { return strideFor(w, bitsPerPixel) * h; }
+
+  void drawPixel(int16_t x, int16_t y, uint16_t color) override;
+  void drawFastHLine(int16_t x, int16_t y, int16_t w, uint16_t color) override;
+  void drawFastVLine(int16_t x, int16_t y, int16_t h, uint16_t color) override;
+  void fillRect(int16_t x, int16_t y, int16_t w, int16_t h, uint16_t color) override;
+  void fillScreen(uint16_t color) override;
+  void blit(int16_t x, int16_t y, int16_t w, int16_t h, const uint16_t *pixels) override;
+  void fillDisc(int16_t x, int16_t y, int16_t r, uint16_t color) override;
+  void fillTriangleSpans(int16_t x0, int16_t y0, int16_t x1, int16_t y1, int16_t x2, int16_t y2,
+                         uint16_t color) override;
+
+  uint8_t bitsPerPixel() const { return _bits; }
+  size_t stride() const { return _stride; }
+  uint8_t *indices() const { return _indices; }
+  uint8_t *row(int16_t y) const { return _indices + (int32_t)y * _stride; }
+  Palette &palette() const { return _palette; }
+
+  // Narrows [x0, x1] to the pixels of row y that differ from `front`, a
+  // buffer of the same layout; false if none do. At 4 bits the span is
+  // whole pairs, so it may take in one unchanged pixel at either end.
+  bool diffRow(const uint8_t *front, int16_t y, int16_t &x0, int16_t &x1) const;
+
+  // w pixels of row y from x, through the palette
+  void expandRow(int16_t x, int16_t y, int16_t w, uint16_t *out) const;
+
+  bool isDirty() const { return _dirtyX0 <= _dirtyX1; }
+  Rect dirtyRect() const;
+  void clearDirty();
+
+private:
+  // Clipped, inclusive columns
+  void fillSpan(uint8_t *row, int16_t x0, int16_t x1, uint8_t index);
+
+  void setIndex(uint8_t *row, int16_t x, uint8_t index) {
+    if (_bits == 8) {
+      row[x] = index;
+    } else if (x & 1) {
+      row[x >> 1] = (row[x >> 1] & 0xF0) | index;
+    } else {
+      row[x >> 1] = (row[x >> 1] & 0x0F) | (index << 4);
+    }
+  }
+
+  void touch(int16_t x, int16_t y) {
+    if (x < _dirtyX0) _dirtyX0 = x;
+    if (x > _dirtyX1) _dirtyX1 = x;
+    if (y < _dirtyY0) _dirtyY0 = y;
+    if (y > _dirtyY1) _dirtyY1 = y;
+  }
+
+  uint8_t *_indices;
+  Palette &_palette;
+  uint8_t _bits;
+  size_t _stride;
+  int16_t _dirtyX0, _dirtyY0, _dirtyX1, _dirtyY1; // Inclusive
+};
+
+#endif // INDEXED_FRAME_BUFFER_H
@@ -0,0 +1,227 @@
+#if !defined(ARDUINO)
+
+#include "RecordingBus.h"
+
+#include <stdio.h>
+#include <string.h>
+
+namespace {
+
+const uint8_t kCaset = 0x2A;
+const uint8_t kPaset = 0x2B;
+const uint8_t kRamwr = 0x2C;
+const uint8_t kVscrdef = 0x33;
+const uint8_t kMadctl = 0x36;
+const uint8_t kVscrsadd = 0x37;
+const uint8_t kMadctlMy = 0x80;
+const uint8_t kMadctlMv = 0x20;
+
+} // namespace
+
+RecordingBus::RecordingBus() {
+  memset(_gram, 0, sizeof(_gram));
+  begin();
+  resetStats();
+}
+
+void RecordingBus::begin() {
+  _command = 0;
+  _paramCount = 0;
+  _mv = false;
+  _my = false;
+  _scrollTop = 0;
+  _scrollHeight = kPanelHeight;
+  _scrollStart = 0;
+  _ramwr = false;
+  _halfPixel = false;
+  _x1 = _y1 = 0;
+  _x2 = kPanelWidth - 1;
+  _y2 = kPanelHeight - 1;
+  _curX = _curY = 0;
+}
+
+void RecordingBus::resetStats() { memset(&_stats, 0, sizeof(_stats)); }
+
+void RecordingBus::protocolError(const char *what) {
+  if (_stats.protocolErrors++ == 0) {
+    fprintf(stderr, "RecordingBus: %s (command 0x%02X)\n", what, _command);
+  }
+}
+
+void RecordingBus::writeCommand(uint8_t cmd) {
+  if (_halfPixel) protocolError("command splits a pixel");
+
+  _stats.commandBytes++;
+  _stats.segments++;
+  _command = cmd;
+  _paramCount = 0;
+  _ramwr = false;
+  _halfPixel = false;
+
+  if (cmd == kRamwr) {
+    if (_x1 > _x2 || _y1 > _y2 || _x2 >= width() || _y2 >= height()) {
+      protocolError("RAMWR window outside the panel");
+    }
+    _ramwr = true;
+    _curX = _x1;
+    _curY = _y1;
+    _stats.addressWindows++;
+  }
+}
+
+void RecordingBus::writeData(const uint8_t *data, size_t len) {
+  _stats.dataBytes += len;
+  _stats.segments++;
+
+  for (size_t i = 0; i < len; i++) {
+    if (_ramwr) {
+      if (_halfPixel) {
+        storePixel((uint16_t)((_pixelHigh << 8) | data[i]));
+        _halfPixel = false;
+      } else {
+        _pixelHigh = data[i];
+        _halfPixel = true;
+      }
+    } else {
+      parameter(data[i]);
+    }
+  }
+}
+
+void RecordingBus::writePixels(const uint16_t *pixels, uint32_t count) {
+  _stats.dataBytes += count * 2;
+  _stats.segments++;
+
+  if (!_ramwr || _halfPixel) {
+    protocolError("pixel data outside RAMWR");
+    return;
+  }
+  for (uint32_t i = 0; i < count; i++) {
+    storePixel(pixels[i]);
+  }
+}
+
+void RecordingBus::writeColor(uint16_t color, uint32_t count) {
+  _stats.dataBytes += count * 2;
+  _stats.segments++;
+
+  if (!_ramwr || _halfPixel) {
+    protocolError("pixel data outside RAMWR");
+    return;
+  }
+  for (uint32_t i = 0; i < count; i++) {
+    storePixel(color);
+  }
+}
+
+void RecordingBus::parameter(uint8_t value) {
+  if (_paramCount < sizeof(_params)) {
+    _params[_paramCount] = value;
+  }
+  _paramCount++;
+
+  switch (_command) {
+  case kCaset:
+    if (_paramCount == 4) {
+      _x1 = (uint16_t)((_params[0] << 8) | _params[1]);
+      _x2 = (uint16_t)((_params[2] << 8) | _params[3]);
+    }
+    break;
+  case kPaset:
+    if (_paramCount == 4) {
+      _y1 = (uint16_t)((_params[0] << 8) | _params[1]);
+      _y2 = (uint16_t)((_params[2] << 8) | _params[3]);
+    }
+    break;
+  case kMadctl:
+    if (_paramCount == 1) {
+      _mv = (value & kMadctlMv) != 0;
+      _my = (value & kMadctlMy) != 0;
+    }
+    break;
+  case kVscrdef:
+    if (_paramCount == 6) {
+      uint16_t top = (uint16_t)((_params[0] << 8) | _params[1]);
+      uint16_t height = (uint16_t)((_params[2] << 8) | _params[3]);
+      uint16_t bottom = (uint16_t)((_params[4] << 8) | _params[5]);
+      if (top + height + bottom != kPanelHeight || height == 0) {
+        protocolError("VSCRDEF areas don't add up to the panel");
+        return;
+      }
+      _scrollTop = top;
+      _scrollHeight = height;
+      _scrollStart = top;
+    }
+    break;
+  case kVscrsadd:
+    if (_paramCount == 2) {
+      uint16_t start = (uint16_t)((_params[0] << 8) | _params[1]);
+      if (start < _scrollTop || start >= _scrollTop + _scrollHeight) {
+        protocolError("VSCRSADD outside the scroll area");
+        return;
+      }
+      _scrollStart = start;
+      _stats.scrolls++;
+    }
+    break;
+  default:
+    break;
+  }
+}
+
+void RecordingBus::storePixel(uint16_t color) {
+  if (_curY > _y2) {
+    protocolError("pixel data overruns the RAMWR window");
+    return;
+  }
+
+  _stats.pixels++;
+  if (_curX < width() && _curY < height()) {
+    _gram[_curY * width() + _curX] = color;
+  }
+  if (++_curX > _x2) {
+    _curX = _x1;
+    _curY++;
+  }
+}
+
+uint16_t RecordingBus::pixelAt(int16_t x, int16_t y) const {
+  if (x < 0 || y < 0 || x >= width() || y >= height()) return 0;
+  return _gram[y * width() + x];
+}
+
+uint16_t RecordingBus::shownPixelAt(int16_t x, int16_t y) const {
+  // The scroll moves native rows: x in landscape, y in portrait, counted
+  // from the other end when MY is set
+  int16_t &along = _mv ? x : y;
+  int16_t row = _my ? kPanelHeight - 1 - along : along;
+  if (row >= _scrollTop && row < _scrollTop + _scrollHeight) {
+    row = _scrollTop + (_scrollStart - _scrollTop + row - _scrollTop) % _scrollHeight;
+  }
+  along = _my ? kPanelHeight - 1 - row : row;
+  return pixelAt(x, y);
+}
+
+uint32_t RecordingBus::shownChecksum() const {
+  uint32_t hash = 2166136261u;
+  for (int16_t y = 0; y < height(); y++) {
+    for (int16_t x = 0; x < width(); x++) {
+      uint16_t pixel = shownPixelAt(x, y);
+      hash = (hash ^ (pixel & 0xFF)) * 16777619u;
+      hash = (hash ^ (pixel >> 8)) * 16777619u;
+    }
+  }
+  return hash;
+}
+
+uint32_t RecordingBus::checksum() const {
+  // FNV-1a over the visible pixels
+  uint32_t hash = 2166136261u;
+  for (int32_t i = 0; i < (int32_t)kPanelWidth * kPanelHeight; i++) {
+    hash = (hash ^ (_gram[i] & 0xFF)) * 16777619u;
+    hash = (hash ^ (_gram[i] >> 8)) * 16777619u;
+  }
+  return hash;
+}
+
+#endif // !ARDUINO
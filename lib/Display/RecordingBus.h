@@ -0,0 +1,80 @@
+#ifndef RECORDING_BUS_H
+#define RECORDING_BUS_H
+
+#if !defined(ARDUINO)
+
+#include "DisplayBus.h"
+
+// Traffic seen by the recording bus since the last reset
+struct BusStats {
+  uint32_t commandBytes;
+  uint32_t dataBytes;
+  uint32_t addressWindows; // RAMWR commands
+  uint32_t pixels;
+  uint32_t segments;       // DC runs, i.e. separate transfers on the wire
+  uint32_t scrolls;        // VSCRSADD commands
+  uint32_t protocolErrors;
+};
+
+// Host backend. Decodes the byte stream like an ILI9341 would (CASET,
+// PASET, RAMWR, MADCTL, VSCRDEF and VSCRSADD) into an emulated GRAM, and
+// counts anything the real controller would choke on: pixel data outside
+// RAMWR, windows off the panel, window overruns, split pixels and scroll
+// areas that don't add up to the panel.
+class RecordingBus : public DisplayBus {
+public:
+  RecordingBus();
+
+  void begin() override;
+
+  void writeCommand(uint8_t cmd) override;
+  void writeData(const uint8_t *data, size_t len) override;
+  void writePixels(const uint16_t *pixels, uint32_t count) override;
+  void writeColor(uint16_t color, uint32_t count) override;
+
+  const BusStats &stats() const { return _stats; }
+  void resetStats();
+
+  // GRAM in the current MADCTL orientation (mirroring is not modelled)
+  int16_t width() const { return _mv ? kPanelHeight : kPanelWidth; }
+  int16_t height() const { return _mv ? kPanelWidth : kPanelHeight; }
+  uint16_t pixelAt(int16_t x, int16_t y) const;
+  uint32_t checksum() const;
+
+  // What the glass shows: GRAM seen through the vertical scroll, in the
+  // same orientation. Scroll areas are in native rows.
+  uint16_t shownPixelAt(int16_t x, int16_t y) const;
+  uint32_t shownChecksum() const;
+  uint16_t scrollTop() const { return _scrollTop; }
+  uint16_t scrollHeight() const { return _scrollHeight; }
+  uint16_t scrollStart() const { return _scrollStart; }
+
+private:
+  static const int16_t kPanelWidth = 240;
+  static const int16_t kPanelHeight = 320;
+
+  void parameter(uint8_t value);
+  void storePixel(uint16_t color);
+  void protocolError(const char *what);
+
+  uint16_t _gram[kPanelWidth * kPanelHeight];
+  BusStats _stats;
+
+  uint8_t _command;
+  uint8_t _params[6];
+  uint8_t _paramCount;
+  bool _mv;
+  bool _my;
+
+  uint16_t _scrollTop, _scrollHeight, _scrollStart;
+
+  bool _ramwr;
+  bool _halfPixel;
+  uint8_t _pixelHigh;
+  uint16_t _x1, _x2, _y1, _y2;
+  uint16_t _curX, _curY;
+};
+
+#endif // !ARDUINO
+
+#endif // RECORDING_BUS_H
@@ -0,0 +1,119 @@
+#include "RleImage.h"
+
+namespace {
+
+const uint8_t kVersion = 1;
+const size_t kHeaderBytes = 10;
+
+} // namespace
+
+RleImage::RleImage(const uint8_t *data, size_t size)
+    : _data(data), _size(size), _rows(nullptr), _pos(data), _end(data + size), _width(0), _height(0), _row(0),
+      _paletteCount(0) {
+  if (size < kHeaderBytes) return;
+  if (readByte() != 'R' || readByte() != 'I' || readByte() != kVersion) return;
+  readByte(); // Reserved
+
+  uint16_t width = readWord();
+  uint16_t height = readWord();
+  _paletteCount = readWord();
+  if (width == 0 || width > RLE_IMAGE_MAX_WIDTH || height == 0 || height > INT16_MAX) return;
+  if (_paletteCount > 256 || kHeaderBytes + _paletteCount * 2u > size) return;
+
+  for (uint16_t i = 0; i < _paletteCount; i++) {
+    _palette[i] = readWord();
+  }
+  _width = width;
+  _height = height;
+  _rows = _pos;
+}
+
+void RleImage::rewind() {
+  _pos = _rows;
+  _row = 0;
+}
+
+bool RleImage::nextRow(uint16_t *out) {
+  if (!_rows || _row >= _height) return false;
+
+  int16_t x = 0;
+  while (x < _width) {
+    if (_pos >= _end) return false;
+    uint8_t op = readByte();
+    int16_t count;
+
+    if (op < 0x80) {
+      // Run of one palette color
+      count = op + 1;
+      if (x + count > _width || _pos >= _end) return false;
+      uint8_t index = readByte();
+      if (index >= _paletteCount) return false;
+      uint16_t color = _palette[index];
+      for (int16_t i = 0; i < count; i++) out[x + i] = color;
+    } else if (op < 0xC0) {
+      // Palette indices, one per pixel
+      count = (op & 0x3F) + 1;
+      if (x + count > _width || _pos + count > _end) return false;
+      for (int16_t i = 0; i < count; i++) {
+        uint8_t index = readByte();
+        if (index >= _paletteCount) return false;
+        out[x + i] = _palette[index];
+      }
+    } else {
+      // Run of a color outside the palette
+      count = (op & 0x3F) + 1;
+      if (x + count > _width || _pos + 2 > _end) return false;
+      uint16_t color = readWord();
+      for (int16_t i = 0; i < count; i++) out[x + i] = color;
+    }
+    x += count;
+  }
+
+  _row++;
+  return true;
+}
+
+bool drawRleImage(Surface &target, int16_t x, int16_t y, RleImage &image) {
+  if (!image.isValid()) return false;
+
+  uint16_t line[RLE_IMAGE_MAX_WIDTH];
+  image.rewind();
+  target.startWrite();
+  int16_t rows = image.height();
+  if (y + rows > target.height()) rows = target.height() - y; // Rest is off screen
+  for (int16_t row = 0; row < rows; row++) {
+    if (!image.nextRow(line)) {
+      target.endWrite();
+      return false;
+    }
+    target.blit(x, y + row, image.width(), 1, line);
+  }
+  target.endWrite();
+  return true;
+}
+
+bool drawRleImage(Ili9341Panel &panel, int16_t x, int16_t y, RleImage &image) {
+  if (!image.isValid()) return false;
+
+  panel.startWrite();
+  if (!panel.openWindow(x, y, image.width(), image.height())) {
+    panel.endWrite();
+    return drawRleImage(static_cast<Surface &>(panel), x, y, image);
+  }
+
+  // The bus copies each row into its DMA buffers, so one line is enough
+  uint16_t line[RLE_IMAGE_MAX_WIDTH];
+  image.rewind();
+  bool ok = true;
+  for (int16_t row = 0; row < image.height(); row++) {
+    if (!image.nextRow(line)) {
+      // Pad the window so the panel isn't left mid-RAMWR
+      panel.pushColor(0, (uint32_t)(image.height() - row) * image.width());
+      ok = false;
+      break;
+    }
+    panel.pushPixels(line, image.width());
+  }
+  panel.endWrite();
+  return ok;
+}
@@ -0,0 +1,57 @@
+#ifndef RLE_IMAGE_H
+#define RLE_IMAGE_H
+
+#include <Arduino.h>
+
+#include "Ili9341Panel.h"
+#include "Surface.h"
+
+#define RLE_IMAGE_MAX_WIDTH 320
+
+// Reader for the RLE/palette images written by tools/rgb565_to_rle.py
+// (format described there). Every row is encoded on its own, so rows
+// decode one at a time into a scanline buffer and a whole image never
+// has to sit in RAM. The data can stay in flash.
+class RleImage {
+public:
+  RleImage(const uint8_t *data, size_t size);
+
+  // Header parsed and the size is one we can decode
+  bool isValid() const { return _rows != nullptr; }
+  int16_t width() const { return _width; }
+  int16_t height() const { return _height; }
+  size_t size() const { return _size; }
+
+  // Back to row 0
+  void rewind();
+
+  // Decodes the next row into width() pixels. False past the last row or
+  // on corrupt data.
+  bool nextRow(uint16_t *out);
+
+private:
+  uint8_t readByte() { return pgm_read_byte(_pos++); }
+  uint16_t readWord() {
+    uint16_t lo = readByte();
+    return lo | (uint16_t)readByte() << 8;
+  }
+
+  const uint8_t *_data;
+  size_t _size;
+  const uint8_t *_rows; // First row's ops
+  const uint8_t *_pos;
+  const uint8_t *_end;
+  int16_t _width, _height;
+  int16_t _row;
+  uint16_t _paletteCount;
+  uint16_t _palette[256]; // Copied out of flash
+};
+
+// Streams the image onto target with its top-left at (x, y), one blit
+// per scanline. Returns false if the data is corrupt.
+bool drawRleImage(Surface &target, int16_t x, int16_t y, RleImage &image);
+
+// Same on the panel, as a single address window when the image fits
+bool drawRleImage(Ili9341Panel &panel, int16_t x, int16_t y, RleImage &image);
+
+#endif // RLE_IMAGE_H
@@ -0,0 +1,110 @@
+#ifndef SPAN_RASTER_H
+#define SPAN_RASTER_H
+
+#include <stdint.h>
+
+// Adafruit_GFX's fillCircle() and fillTriangle() as row spans, calling
+// span(x, y, w) for each. They cover exactly the pixels the originals do,
+// so a surface that fills rows fast can take them over. Spans may
+// overlap and are not clipped.
+
+// fillCircle() draws columns; its midpoint circle is symmetric about the
+// diagonal, so the same steps transposed give rows
+template <typename SpanFn>
+void discSpans(int16_t x0, int16_t y0, int16_t r, SpanFn span) {
+  int16_t f = 1 - r;
+  int16_t ddF_x = 1;
+  int16_t ddF_y = -2 * r;
+  int16_t x = 0;
+  int16_t y = r;
+  int16_t px = x;
+  int16_t py = y;
+
+  span(x0 - r, y0, 2 * r + 1);
+  while (x < y) {
+    if (f >= 0) {
+      y--;
+      ddF_y += 2;
+      f += ddF_y;
+    }
+    x++;
+    ddF_x += 2;
+    f += ddF_x;
+    if (x < (y + 1)) {
+      span(x0 - y, y0 + x, 2 * y + 1);
+      span(x0 - y, y0 - x, 2 * y + 1);
+    }
+    if (y != py) {
+      span(x0 - px, y0 + py, 2 * px + 1);
+      span(x0 - px, y0 - py, 2 * px + 1);
+      py = y;
+    }
+    px = x;
+  }
+}
+
+template <typename SpanFn>
+void triangleSpans(int16_t x0, int16_t y0, int16_t x1, int16_t y1, int16_t x2, int16_t y2, SpanFn span) {
+  int16_t a, b, y, last, t;
+
+  // Sort coordinates by Y order (y2 >= y1 >= y0)
+  if (y0 > y1) {
+    t = y0, y0 = y1, y1 = t;
+    t = x0, x0 = x1, x1 = t;
+  }
+  if (y1 > y2) {
+    t = y2, y2 = y1, y1 = t;
+    t = x2, x2 = x1, x1 = t;
+  }
+  if (y0 > y1) {
+    t = y0, y0 = y1, y1 = t;
+    t = x0, x0 = x1, x1 = t;
+  }
+
+  if (y0 == y2) { // All on one line
+    a = b = x0;
+    if (x1 < a)
+      a = x1;
+    else if (x1 > b)
+      b = x1;
+    if (x2 < a)
+      a = x2;
+    else if (x2 > b)
+      b = x2;
+    span(a, y0, b - a + 1);
+    return;
+  }
+
+  int16_t dx01 = x1 - x0, dy01 = y1 - y0, dx02 = x2 - x0, dy02 = y2 - y0, dx12 = x2 - x1, dy12 = y2 - y1;
+  int32_t sa = 0, sb = 0;
+
+  // Upper part: edges 0-1 and 0-2, including scanline y1 only when the
+  // bottom is flat
+  if (y1 == y2)
+    last = y1;
+  else
+    last = y1 - 1;
+
+  for (y = y0; y <= last; y++) {
+    a = x0 + sa / dy01;
+    b = x0 + sb / dy02;
+    sa += dx01;
+    sb += dx02;
+    if (a > b) t = a, a = b, b = t;
+    span(a, y, b - a + 1);
+  }
+
+  // Lower part: edges 1-2 and 0-2
+  sa = (int32_t)dx12 * (y - y1);
+  sb = (int32_t)dx02 * (y - y0);
+  for (; y <= y2; y++) {
+    a = x1 + sa / dy12;
+    b = x0 + sb / dy02;
+    sa += dx12;
+    sb += dx02;
+    if (a > b) t = a, a = b, b = t;
+    span(a, y, b - a + 1);
+  }
+}
+
+#endif // SPAN_RASTER_H
@@ -0,0 +1,45 @@
+#include "StaticLayer.h"
+
+#include <new>
+
+#include "DisplayMemory.h"
+
+StaticLayer::StaticLayer(int16_t x, int16_t y, int16_t w, int16_t h, DrawFn draw)
+    : _bounds{x, y, w, h}, _draw(draw), _sprite(nullptr), _pixels(nullptr), _allocFailed(false) {}
+
+StaticLayer::~StaticLayer() { release(); }
+
+void StaticLayer::draw(Surface &target, uint16_t background) {
+  if (prepare(target, background)) {
+    target.blit(_bounds.x, _bounds.y, _bounds.w, _bounds.h, _pixels);
+  } else {
+    _draw(target);
+  }
+}
+
+bool StaticLayer::prepare(const Surface &screen, uint16_t background) {
+  if (!_sprite && !_allocFailed) _allocFailed = !render(screen, background);
+  return _sprite != nullptr;
+}
+
+bool StaticLayer::render(const Surface &screen, uint16_t background) {
+  _pixels = (uint16_t *)displayAlloc(bytes(), DISPLAY_MEMORY_PSRAM);
+  if (_pixels) _sprite = new (std::nothrow) FrameBuffer(_bounds.w, _bounds.h, _pixels);
+  if (!_sprite) {
+    release();
+    return false;
+  }
+
+  _sprite->setOrigin(_bounds.x, _bounds.y, screen.width(), screen.height());
+  _sprite->fillScreen(background);
+  _draw(*_sprite);
+  return true;
+}
+
+void StaticLayer::release() {
+  delete _sprite;
+  _sprite = nullptr;
+  displayFree(_pixels);
+  _pixels = nullptr;
+  _allocFailed = false;
+}
@@ -0,0 +1,38 @@
+#ifndef STATIC_LAYER_H
+#define STATIC_LAYER_H
+
+#include "FrameBuffer.h"
+
+// Part of a screen that never changes (title, dial face). The first
+// draw() renders it into an RGB565 sprite in PSRAM; later ones blit the
+// sprite as a single rectangle. Without PSRAM it is drawn every time.
+class StaticLayer {
+public:
+  // Draws the layer in screen coordinates
+  typedef void (*DrawFn)(Surface &surface);
+
+  StaticLayer(int16_t x, int16_t y, int16_t w, int16_t h, DrawFn draw);
+  ~StaticLayer();
+
+  void draw(Surface &target, uint16_t background);
+  // Renders the sprite ahead of the first draw(), e.g. during setup()
+  bool prepare(const Surface &screen, uint16_t background);
+  void drawUncached(Surface &target) { _draw(target); }
+
+  bool isCached() const { return _sprite != nullptr; }
+  size_t bytes() const { return (size_t)_bounds.w * _bounds.h * sizeof(uint16_t); }
+
+  // Frees the sprite; the next draw() renders it again
+  void release();
+
+private:
+  bool render(const Surface &screen, uint16_t background);
+
+  Rect _bounds;
+  DrawFn _draw;
+  FrameBuffer *_sprite;
+  uint16_t *_pixels;
+  bool _allocFailed;
+};
+
+#endif // STATIC_LAYER_H
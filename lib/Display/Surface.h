@@ -0,0 +1,38 @@
+#ifndef SURFACE_H
+#define SURFACE_H
+
+#include <Adafruit_GFX.h>
+
+#include "DamageTracker.h"
+
+// Something the screens can draw on. Every pixel a surface actually
+// writes is reported to the attached tracker, if any.
+class Surface : public Adafruit_GFX {
+public:
+  Surface(int16_t w, int16_t h) : Adafruit_GFX(w, h), _damage(nullptr) {}
+
+  // Copies a w x h block of RGB565 pixels, row after row
+  virtual void blit(int16_t x, int16_t y, int16_t w, int16_t h, const uint16_t *pixels) {
+    drawRGBBitmap(x, y, const_cast<uint16_t *>(pixels), w, h);
+  }
+
+  // fillCircle() and fillTriangle(), which Adafruit_GFX doesn't let a
+  // subclass replace. Memory surfaces fill the same pixels as row spans.
+  virtual void fillDisc(int16_t x, int16_t y, int16_t r, uint16_t color) { fillCircle(x, y, r, color); }
+  virtual void fillTriangleSpans(int16_t x0, int16_t y0, int16_t x1, int16_t y1, int16_t x2, int16_t y2,
+                                 uint16_t color) {
+    fillTriangle(x0, y0, x1, y1, x2, y2, color);
+  }
+
+  void setDamageTracker(DamageTracker *tracker) { _damage = tracker; }
+  DamageTracker *damageTracker() const { return _damage; }
+
+protected:
+  void markDamage(int16_t x, int16_t y, int16_t w, int16_t h) {
+    if (_damage) _damage->add(x, y, w, h);
+  }
+
+  DamageTracker *_damage;
+};
+
+#endif // SURFACE_H
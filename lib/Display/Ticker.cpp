@@ -0,0 +1,87 @@
+#include "Ticker.h"
+
+#include <string.h>
+
+#include "DisplayMemory.h"
+
+Ticker::Ticker(Ili9341Panel &panel, int16_t x, int16_t w, int16_t textY, uint8_t textSize, uint16_t color,
+               uint16_t background)
+    : _panel(panel), _x(x), _w(w), _textY(textY), _textSize(textSize), _color(color), _background(background),
+      _pixels(nullptr), _message(nullptr), _position(0) {}
+
+Ticker::~Ticker() { displayFree(_pixels); }
+
+bool Ticker::begin() {
+  if (!_panel.scrollsHorizontally()) return false;
+  if (!_pixels) {
+    size_t bytes = (size_t)TICKER_MAX_STEP * _panel.height() * sizeof(uint16_t);
+    _pixels = (uint16_t *)displayAlloc(bytes, DISPLAY_MEMORY_INTERNAL);
+  }
+  return _pixels != nullptr;
+}
+
+int32_t Ticker::period() const {
+  if (!_message) return 0;
+  return _w + (int32_t)strlen(_message) * 6 * _textSize;
+}
+
+void Ticker::start(const char *message) {
+  if (!_pixels) return;
+  _panel.setScrollArea(_x, _w);
+  _panel.fillRect(_x, 0, _w, _panel.height(), _background);
+  _message = message;
+  _position = 0;
+}
+
+void Ticker::step(int16_t columns) {
+  if (!_message) return;
+  if (columns < 1) columns = 1;
+  if (columns > TICKER_MAX_STEP) columns = TICKER_MAX_STEP;
+
+  // Scrolling first puts the columns to redraw at the right edge, where
+  // they show stale until their strip lands
+  uint32_t exposed = _position + _w;
+  _position += columns;
+  _panel.scrollTo((int16_t)(_position % _w));
+  drawColumns(exposed, columns);
+}
+
+void Ticker::stop() {
+  if (!_message) return;
+  _panel.setScrollArea(0, _panel.width());
+  _panel.fillRect(_x, 0, _w, _panel.height(), _background);
+  _message = nullptr;
+}
+
+// Content column k sits in memory column x + k % w. The message starts
+// at content column w, after a blank area's worth, and repeats every
+// period().
+void Ticker::drawColumns(uint32_t first, int16_t count) {
+  int16_t charW = 6 * _textSize;
+  int32_t length = (int32_t)strlen(_message);
+  int32_t cycle = period();
+
+  while (count > 0) {
+    // Stop at the end of the area; the rest wraps to its start
+    int16_t column = (int16_t)(first % _w);
+    int16_t run = count < _w - column ? count : _w - column;
+    int32_t content = (int32_t)(first % cycle);
+
+    FrameBuffer strip(run, _panel.height(), _pixels);
+    strip.setOrigin(content, 0, cycle + TICKER_MAX_STEP, _panel.height());
+    strip.fillScreen(_background);
+    for (int32_t i = 0; i < length; i++) {
+      int32_t charX = _w + i * charW;
+      if (charX + charW <= content || charX >= content + run) continue;
+      strip.drawChar(charX, _textY, _message[i], _color, _background, _textSize);
+    }
+
+    _panel.startWrite();
+    _panel.setAddrWindow(_x + column, 0, run, _panel.height());
+    _panel.pushPixels(_pixels, (uint32_t)run * _panel.height());
+    _panel.endWrite();
+
+    first += run;
+    count -= run;
+  }
+}
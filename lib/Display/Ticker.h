@@ -0,0 +1,52 @@
+#ifndef TICKER_H
+#define TICKER_H
+
+#include "FrameBuffer.h"
+#include "Ili9341Panel.h"
+
+// Widest step, and the strip buffer: this many columns, screen tall
+#define TICKER_MAX_STEP 8
+
+// A message crawling right to left through a hardware scroll area. A
+// step moves the scroll start and draws only the columns that came into
+// view, so the text already on the glass is never sent again.
+//
+// The scroll moves whole columns in landscape, so the area is every row
+// between x and x + w; the text runs at textY and the rest is background.
+// Nothing else may draw on those columns while the ticker runs. stop()
+// leaves them blank for the caller to repaint.
+class Ticker {
+public:
+  Ticker(Ili9341Panel &panel, int16_t x, int16_t w, int16_t textY, uint8_t textSize, uint16_t color,
+         uint16_t background);
+  ~Ticker();
+
+  // Allocates the strip buffer. False in portrait or without the memory.
+  bool begin();
+
+  // Blanks the area and starts the message at the right edge; the text
+  // is not copied
+  void start(const char *message);
+  void step(int16_t columns = 1);
+  void stop();
+
+  bool isRunning() const { return _message != nullptr; }
+  // Columns scrolled since start()
+  uint32_t position() const { return _position; }
+  // One message plus the blank area it enters from
+  int32_t period() const;
+
+private:
+  void drawColumns(uint32_t first, int16_t count);
+
+  Ili9341Panel &_panel;
+  int16_t _x, _w, _textY;
+  uint8_t _textSize;
+  uint16_t _color, _background;
+
+  uint16_t *_pixels;
+  const char *_message;
+  uint32_t _position;
+};
+
+#endif // TICKER_H
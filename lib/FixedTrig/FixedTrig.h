@@ -0,0 +1,131 @@
+#ifndef FIXED_TRIG_H
+#define FIXED_TRIG_H
+
+#include <stdint.h>
+
+// Integer sin/cos for screen geometry. Angles are 1/4096 of a turn so
+// they wrap with a mask; results are Q14 (16384 == 1.0). The quarter-wave
+// table is built at compile time and lives in flash.
+
+typedef uint16_t FixedAngle;
+
+const int kFixedAngleBits = 12;
+const int32_t kFixedAngleTurn = 1 << kFixedAngleBits;
+const int32_t kFixedAngleQuarter = kFixedAngleTurn / 4;
+
+const int kFixedTrigShift = 14;
+const int32_t kFixedOne = 1 << kFixedTrigShift;
+
+namespace fixed_trig_detail {
+
+constexpr double kPi = 3.14159265358979323846;
+
+// Taylor series; plenty of terms for |x| <= pi/2
+constexpr double sinSeries(double x) {
+  double term = x;
+  double sum = x;
+  for (int n = 1; n < 12; n++) {
+    term = -term * x * x / ((2 * n) * (2 * n + 1));
+    sum += term;
+  }
+  return sum;
+}
+
+struct QuarterTable {
+  int16_t values[kFixedAngleQuarter + 1];
+};
+
+constexpr QuarterTable makeQuarterTable() {
+  QuarterTable table = {};
+  for (int i = 0; i <= kFixedAngleQuarter; i++) {
+    double s = sinSeries(kPi / 2 * i / kFixedAngleQuarter);
+    table.values[i] = (int16_t)(s * kFixedOne + 0.5);
+  }
+  return table;
+}
+
+inline constexpr QuarterTable kQuarterSine = makeQuarterTable();
+
+} // namespace fixed_trig_detail
+
+// Q14 sine and cosine
+inline int16_t fixedSin(FixedAngle angle) {
+  const int16_t *table = fixed_trig_detail::kQuarterSine.values;
+  uint16_t index = angle & (kFixedAngleQuarter - 1);
+  switch ((angle >> (kFixedAngleBits - 2)) & 3) {
+  case 0: return table[index];
+  case 1: return table[kFixedAngleQuarter - index];
+  case 2: return -table[index];
+  default: return -table[kFixedAngleQuarter - index];
+  }
+}
+
+inline int16_t fixedCos(FixedAngle angle) { return fixedSin(angle + kFixedAngleQuarter); }
+
+// Nearest table angle
+constexpr FixedAngle degreesToFixedAngle(int32_t degrees) {
+  int32_t turns = degrees % 360;
+  if (turns < 0) turns += 360;
+  return (FixedAngle)((turns * kFixedAngleTurn + 180) / 360 & (kFixedAngleTurn - 1));
+}
+
+inline FixedAngle degreesToFixedAngle(float degrees) {
+  float scaled = degrees * (kFixedAngleTurn / 360.0f);
+  int32_t rounded = (int32_t)(scaled < 0 ? scaled - 0.5f : scaled + 0.5f);
+  return (FixedAngle)(rounded & (kFixedAngleTurn - 1));
+}
+
+inline FixedAngle radiansToFixedAngle(float radians) {
+  float scaled = radians * (float)(kFixedAngleTurn / (2 * fixed_trig_detail::kPi));
+  int32_t rounded = (int32_t)(scaled < 0 ? scaled - 0.5f : scaled + 0.5f);
+  return (FixedAngle)(rounded & (kFixedAngleTurn - 1));
+}
+
+// a - b the short way round, -2048 to 2047
+inline int16_t fixedAngleDelta(FixedAngle a, FixedAngle b) {
+  return (int16_t)(((a - b + kFixedAngleTurn / 2) & (kFixedAngleTurn - 1)) - kFixedAngleTurn / 2);
+}
+
+// Rounded value * sin/cos, for value up to +-131071
+inline int32_t fixedMulSin(int32_t value, FixedAngle angle) {
+  return (value * fixedSin(angle) + (kFixedOne >> 1)) >> kFixedTrigShift;
+}
+
+inline int32_t fixedMulCos(int32_t value, FixedAngle angle) {
+  return (value * fixedCos(angle) + (kFixedOne >> 1)) >> kFixedTrigShift;
+}
+
+struct FixedPoint {
+  int16_t x, y;
+};
+
+// Lengths in 1/16 pixel, for radii like 55 * 0.9
+constexpr int32_t pixelsToQ4(float pixels) { return (int32_t)(pixels * 16 + 0.5f); }
+
+// The point length/16 pixels from (cx, cy) at angle; 0 points along +x
+// and angles grow toward +y, as on the screen
+inline FixedPoint fixedPolarQ4(int16_t cx, int16_t cy, int32_t lengthQ4, FixedAngle angle) {
+  const int shift = kFixedTrigShift + 4;
+  const int32_t half = 1 << (shift - 1);
+  FixedPoint p;
+  p.x = cx + (int16_t)((lengthQ4 * fixedCos(angle) + half) >> shift);
+  p.y = cy + (int16_t)((lengthQ4 * fixedSin(angle) + half) >> shift);
+  return p;
+}
+
+inline FixedPoint fixedPolar(int16_t cx, int16_t cy, int32_t length, FixedAngle angle) {
+  return fixedPolarQ4(cx, cy, length * 16, angle);
+}
+
+// (x, y) rotated by angle about the origin
+inline FixedPoint fixedRotate(int16_t x, int16_t y, FixedAngle angle) {
+  int32_t c = fixedCos(angle);
+  int32_t s = fixedSin(angle);
+  const int32_t half = kFixedOne >> 1;
+  FixedPoint p;
+  p.x = (int16_t)((x * c - y * s + half) >> kFixedTrigShift);
+  p.y = (int16_t)((x * s + y * c + half) >> kFixedTrigShift);
+  return p;
+}
+
+#endif // FIXED_TRIG_H
@@ -0,0 +1,279 @@
+#include "GraphicsBench.h"
+
+#include <Arduino.h>
+
+namespace {
+
+const uint16_t kBlack = 0x0000;
+const uint16_t kBlue = 0x001F;
+const uint16_t kRed = 0xF800;
+const uint16_t kGreen = 0x07E0;
+const uint16_t kCyan = 0x07FF;
+const uint16_t kMagenta = 0xF81F;
+const uint16_t kYellow = 0xFFE0;
+const uint16_t kWhite = 0xFFFF;
+
+uint16_t color565(uint8_t r, uint8_t g, uint8_t b) {
+  return ((r & 0xF8) << 8) | ((g & 0xFC) << 3) | (b >> 3);
+}
+
+// Microseconds since start once the bus has put everything on the glass
+unsigned long elapsed(GraphicsTarget &target, unsigned long start) {
+  if (target.bus) target.bus->waitIdle();
+  return micros() - start;
+}
+
+unsigned long testFillScreen(GraphicsTarget &target) {
+  Surface &tft = target.surface;
+  unsigned long start = micros();
+  tft.fillScreen(kBlack);
+  yield();
+  tft.fillScreen(kRed);
+  yield();
+  tft.fillScreen(kGreen);
+  yield();
+  tft.fillScreen(kBlue);
+  yield();
+  tft.fillScreen(kBlack);
+  yield();
+  return elapsed(target, start);
+}
+
+unsigned long testText(GraphicsTarget &target) {
+  Surface &tft = target.surface;
+  tft.fillScreen(kBlack);
+  unsigned long start = micros();
+  tft.setCursor(0, 0);
+  tft.setTextColor(kWhite);
+  tft.setTextSize(1);
+  tft.println("Hello World!");
+  tft.setTextColor(kYellow);
+  tft.setTextSize(2);
+  tft.println(1234.56);
+  tft.setTextColor(kRed);
+  tft.setTextSize(3);
+  tft.println(0xDEADBEEF, HEX);
+  tft.println();
+  tft.setTextColor(kGreen);
+  tft.setTextSize(5);
+  tft.println("Groop");
+  tft.setTextSize(2);
+  tft.println("I implore thee,");
+  tft.setTextSize(1);
+  tft.println("my foonting turlingdromes.");
+  tft.println("And hooptiously drangle me");
+  tft.println("with crinkly bindlewurdles,");
+  tft.println("Or I will rend thee");
+  tft.println("in the gobberwarts");
+  tft.println("with my blurglecruncheon,");
+  tft.println("see if I don't!");
+  return elapsed(target, start);
+}
+
+// Fans of lines from one corner to the two far edges
+unsigned long lineFan(GraphicsTarget &target, int x1, int y1, uint16_t color) {
+  Surface &tft = target.surface;
+  int w = tft.width(), h = tft.height();
+  tft.fillScreen(kBlack);
+  yield();
+
+  unsigned long start = micros();
+  int y2 = h - 1 - y1;
+  for (int x2 = 0; x2 < w; x2 += 6) tft.drawLine(x1, y1, x2, y2, color);
+  int x2 = w - 1 - x1;
+  for (y2 = 0; y2 < h; y2 += 6) tft.drawLine(x1, y1, x2, y2, color);
+  return elapsed(target, start);
+}
+
+// All four corners; the original only counted the last one
+unsigned long testLines(GraphicsTarget &target) {
+  int w = target.surface.width(), h = target.surface.height();
+  return lineFan(target, 0, 0, kCyan) + lineFan(target, w - 1, 0, kCyan) + lineFan(target, 0, h - 1, kCyan) +
+         lineFan(target, w - 1, h - 1, kCyan);
+}
+
+unsigned long testFastLines(GraphicsTarget &target) {
+  Surface &tft = target.surface;
+  int w = tft.width(), h = tft.height();
+
+  tft.fillScreen(kBlack);
+  unsigned long start = micros();
+  for (int y = 0; y < h; y += 5) tft.drawFastHLine(0, y, w, kRed);
+  for (int x = 0; x < w; x += 5) tft.drawFastVLine(x, 0, h, kBlue);
+  return elapsed(target, start);
+}
+
+unsigned long testRects(GraphicsTarget &target) {
+  Surface &tft = target.surface;
+  int cx = tft.width() / 2, cy = tft.height() / 2;
+  int n = min(tft.width(), tft.height());
+
+  tft.fillScreen(kBlack);
+  unsigned long start = micros();
+  for (int i = 2; i < n; i += 6) {
+    int i2 = i / 2;
+    tft.drawRect(cx - i2, cy - i2, i, i, kGreen);
+  }
+  return elapsed(target, start);
+}
+
+unsigned long testFilledRects(GraphicsTarget &target) {
+  Surface &tft = target.surface;
+  int cx = tft.width() / 2 - 1, cy = tft.height() / 2 - 1;
+  int n = min(tft.width(), tft.height());
+  unsigned long t = 0;
+
+  tft.fillScreen(kBlack);
+  for (int i = n; i > 0; i -= 6) {
+    int i2 = i / 2;
+    unsigned long start = micros();
+    tft.fillRect(cx - i2, cy - i2, i, i, kYellow);
+    t += elapsed(target, start);
+    // Outlines are not included in timing results
+    tft.drawRect(cx - i2, cy - i2, i, i, kMagenta);
+    yield();
+  }
+  return t;
+}
+
+unsigned long testFilledCircles(GraphicsTarget &target) {
+  Surface &tft = target.surface;
+  const int radius = 10;
+  int w = tft.width(), h = tft.height(), r2 = radius * 2;
+
+  tft.fillScreen(kBlack);
+  unsigned long start = micros();
+  for (int x = radius; x < w; x += r2) {
+    for (int y = radius; y < h; y += r2) tft.fillCircle(x, y, radius, kMagenta);
+  }
+  return elapsed(target, start);
+}
+
+// Not cleared first, as in the original; it doesn't change the timing
+unsigned long testCircles(GraphicsTarget &target) {
+  Surface &tft = target.surface;
+  const int radius = 10;
+  int r2 = radius * 2, w = tft.width() + radius, h = tft.height() + radius;
+
+  unsigned long start = micros();
+  for (int x = 0; x < w; x += r2) {
+    for (int y = 0; y < h; y += r2) tft.drawCircle(x, y, radius, kWhite);
+  }
+  return elapsed(target, start);
+}
+
+unsigned long testTriangles(GraphicsTarget &target) {
+  Surface &tft = target.surface;
+  int cx = tft.width() / 2 - 1, cy = tft.height() / 2 - 1;
+  int n = min(cx, cy);
+
+  tft.fillScreen(kBlack);
+  unsigned long start = micros();
+  for (int i = 0; i < n; i += 5) {
+    tft.drawTriangle(cx, cy - i,     // peak
+                     cx - i, cy + i, // bottom left
+                     cx + i, cy + i, // bottom right
+                     color565(i, i, i));
+  }
+  return elapsed(target, start);
+}
+
+unsigned long testFilledTriangles(GraphicsTarget &target) {
+  Surface &tft = target.surface;
+  int cx = tft.width() / 2 - 1, cy = tft.height() / 2 - 1;
+  unsigned long t = 0;
+
+  tft.fillScreen(kBlack);
+  for (int i = min(cx, cy); i > 10; i -= 5) {
+    unsigned long start = micros();
+    tft.fillTriangle(cx, cy - i, cx - i, cy + i, cx + i, cy + i, color565(0, i * 10, i * 10));
+    t += elapsed(target, start);
+    tft.drawTriangle(cx, cy - i, cx - i, cy + i, cx + i, cy + i, color565(i * 10, i * 10, 0));
+    yield();
+  }
+  return t;
+}
+
+unsigned long testRoundRects(GraphicsTarget &target) {
+  Surface &tft = target.surface;
+  int cx = tft.width() / 2 - 1, cy = tft.height() / 2 - 1;
+  int w = min(tft.width(), tft.height());
+
+  tft.fillScreen(kBlack);
+  unsigned long start = micros();
+  for (int i = 0; i < w; i += 6) {
+    int i2 = i / 2;
+    tft.drawRoundRect(cx - i2, cy - i2, i, i, i / 8, color565(i, 0, 0));
+  }
+  return elapsed(target, start);
+}
+
+unsigned long testFilledRoundRects(GraphicsTarget &target) {
+  Surface &tft = target.surface;
+  int cx = tft.width() / 2 - 1, cy = tft.height() / 2 - 1;
+
+  tft.fillScreen(kBlack);
+  unsigned long start = micros();
+  for (int i = min(tft.width(), tft.height()); i > 20; i -= 6) {
+    int i2 = i / 2;
+    tft.fillRoundRect(cx - i2, cy - i2, i, i, i / 8, color565(0, i, 0));
+    yield();
+  }
+  return elapsed(target, start);
+}
+
+} // namespace
+
+const GraphicsCase graphicsCases[] = {
+    {"fill_screen", testFillScreen},
+    {"text", testText},
+    {"lines", testLines},
+    {"fast_lines", testFastLines},
+    {"rects", testRects},
+    {"filled_rects", testFilledRects},
+    {"filled_circles", testFilledCircles},
+    {"circles", testCircles},
+    {"triangles", testTriangles},
+    {"filled_triangles", testFilledTriangles},
+    {"round_rects", testRoundRects},
+    {"filled_round_rects", testFilledRoundRects},
+};
+
+const size_t graphicsCaseCount = sizeof(graphicsCases) / sizeof(graphicsCases[0]);
+
+GraphicsResult runGraphicsCase(const GraphicsCase &graphicsCase, GraphicsTarget &target, uint8_t runs) {
+  if (runs < 1) runs = 1;
+  if (runs > GRAPHICS_BENCH_MAX_RUNS) runs = GRAPHICS_BENCH_MAX_RUNS;
+
+  // Insertion sort as the runs come in
+  uint32_t times[GRAPHICS_BENCH_MAX_RUNS];
+  for (uint8_t i = 0; i < runs; i++) {
+    uint32_t us = graphicsCase.run(target);
+    uint8_t j = i;
+    while (j > 0 && times[j - 1] > us) {
+      times[j] = times[j - 1];
+      j--;
+    }
+    times[j] = us;
+  }
+
+  GraphicsResult result;
+  result.runs = runs;
+  result.minUs = times[0];
+  result.medianUs = times[runs / 2];
+  result.maxUs = times[runs - 1];
+  return result;
+}
+
+void printGraphicsResult(Print &out, const char *caseName, const GraphicsResult &result) {
+  out.print("graphics.");
+  out.print(caseName);
+  out.print(" runs=");
+  out.print((unsigned)result.runs);
+  out.print(" min_us=");
+  out.print((unsigned long)result.minUs);
+  out.print(" median_us=");
+  out.print((unsigned long)result.medianUs);
+  out.print(" max_us=");
+  out.print((unsigned long)result.maxUs);
+}
@@ -0,0 +1,46 @@
+#ifndef GRAPHICS_BENCH_H
+#define GRAPHICS_BENCH_H
+
+#include <Print.h>
+
+#include "DisplayBus.h"
+#include "Surface.h"
+
+// The Adafruit ILI9341 graphics test (fills, text, lines, rects, circles,
+// triangles, round rects) as repeatable cases on any Surface. Each run
+// returns the microseconds spent in the timed drawing; untimed setup such
+// as clearing the screen is left out, as in the original. The device
+// build (env:graphics_bench) and the native `graphics` suite print the
+// same "graphics.<case> key=value" lines, which tools/bench_compare.py
+// checks against a stored baseline.
+
+#define GRAPHICS_BENCH_MAX_RUNS 31
+
+struct GraphicsTarget {
+  Surface &surface;
+  DisplayBus *bus; // Drained before each reading; nullptr for memory surfaces
+};
+
+struct GraphicsCase {
+  const char *name;
+  unsigned long (*run)(GraphicsTarget &target);
+};
+
+extern const GraphicsCase graphicsCases[];
+extern const size_t graphicsCaseCount;
+
+struct GraphicsResult {
+  uint8_t runs;
+  uint32_t minUs;
+  uint32_t medianUs;
+  uint32_t maxUs;
+};
+
+// Runs a case `runs` times (at most GRAPHICS_BENCH_MAX_RUNS)
+GraphicsResult runGraphicsCase(const GraphicsCase &graphicsCase, GraphicsTarget &target, uint8_t runs);
+
+// "graphics.<case> runs=.. min_us=.. median_us=.. max_us=..", no newline,
+// so callers can append fields of their own
+void printGraphicsResult(Print &out, const char *caseName, const GraphicsResult &result);
+
+#endif // GRAPHICS_BENCH_H
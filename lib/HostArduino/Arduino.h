@@ -0,0 +1,68 @@
+#ifndef HOST_ARDUINO_H
+#define HOST_ARDUINO_H
+
+// Host build of the small slice of the Arduino core the firmware uses.
+// Only compiled for the native environment.
+
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+#include <algorithm>
+
+#include "Print.h"
+#include "WString.h"
+
+using std::max;
+using std::min;
+
+#define PI 3.1415926535897932384626433832795
+#define HIGH 0x1
+#define LOW 0x0
+#define INPUT 0x01
+#define OUTPUT 0x03
+
+#define PROGMEM
+#define F(str) (str)
+#define pgm_read_byte(addr) (*(const uint8_t *)(addr))
+#define pgm_read_word(addr) (*(const uint16_t *)(addr))
+
+// Timing
+unsigned long millis();
+unsigned long micros();
+void delay(unsigned long ms);
+void delayMicroseconds(unsigned int us);
+void yield();
+
+// GPIO
+void pinMode(uint8_t pin, uint8_t mode);
+void digitalWrite(uint8_t pin, uint8_t val);
+int digitalRead(uint8_t pin);
+int analogRead(uint8_t pin);
+
+long map(long x, long in_min, long in_max, long out_min, long out_max);
+
+template <typename T, typename L, typename H>
+inline T constrain(T amt, L low, H high) {
+  return amt < low ? low : (amt > high ? high : amt);
+}
+
+// Host-side hooks for driving the stand-ins
+void hostSetAnalog(uint8_t pin, int value);
+int hostPinLevel(uint8_t pin);
+
+// Console serial port, printed to stdout
+class HardwareSerial : public Print {
+public:
+  void begin(unsigned long baud) { (void)baud; }
+  int available() { return 0; } // No input on the host
+  int read() { return -1; }
+  size_t write(uint8_t c) override;
+  size_t write(const uint8_t *buffer, size_t size) override;
+  using Print::write;
+};
+
+extern HardwareSerial Serial;
+
+#endif // HOST_ARDUINO_H
@@ -0,0 +1,73 @@
+#include "Arduino.h"
+#include "SPI.h"
+
+#include <chrono>
+#include <thread>
+
+namespace {
+
+const std::chrono::steady_clock::time_point startTime = std::chrono::steady_clock::now();
+
+int pinLevels[64];
+int analogLevels[64];
+
+} // namespace
+
+HardwareSerial Serial;
+
+unsigned long millis() {
+  return (unsigned long)std::chrono::duration_cast<std::chrono::milliseconds>(
+             std::chrono::steady_clock::now() - startTime)
+      .count();
+}
+
+unsigned long micros() {
+  return (unsigned long)std::chrono::duration_cast<std::chrono::microseconds>(
+             std::chrono::steady_clock::now() - startTime)
+      .count();
+}
+
+void delay(unsigned long ms) {
+  std::this_thread::sleep_for(std::chrono::milliseconds(ms));
+}
+
+void delayMicroseconds(unsigned int us) {
+  std::this_thread::sleep_for(std::chrono::microseconds(us));
+}
+
+// Nothing else to run on the host; a real yield would only add noise to
+// the benchmarks
+void yield() {}
+
+void pinMode(uint8_t pin, uint8_t mode) {
+  (void)pin;
+  (void)mode;
+}
+
+void digitalWrite(uint8_t pin, uint8_t val) {
+  if (pin < 64) pinLevels[pin] = val ? HIGH : LOW;
+}
+
+int digitalRead(uint8_t pin) { return pin < 64 ? pinLevels[pin] : LOW; }
+
+int analogRead(uint8_t pin) { return pin < 64 ? analogLevels[pin] : 0; }
+
+long map(long x, long in_min, long in_max, long out_min, long out_max) {
+  return (x - in_min) * (out_max - out_min) / (in_max - in_min) + out_min;
+}
+
+void hostSetAnalog(uint8_t pin, int value) {
+  if (pin < 64) analogLevels[pin] = value;
+}
+
+int hostPinLevel(uint8_t pin) { return digitalRead(pin); }
+
+size_t HardwareSerial::write(uint8_t c) {
+  return fputc(c, stdout) == EOF ? 0 : 1;
+}
+
+size_t HardwareSerial::write(const uint8_t *buffer, size_t size) {
+  return fwrite(buffer, 1, size, stdout);
+}
+
+SPIClass SPI;
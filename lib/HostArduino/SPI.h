@@ -0,0 +1,16 @@
+#ifndef HOST_SPI_H
+#define HOST_SPI_H
+
+#include <stdint.h>
+
+// Placeholder SPI peripheral; the host panel never touches real hardware
+class SPIClass {
+public:
+  void begin() {}
+  void end() {}
+  void setFrequency(uint32_t freq) { (void)freq; }
+};
+
+extern SPIClass SPI;
+
+#endif // HOST_SPI_H
@@ -0,0 +1,97 @@
+#include "TimeLib.h"
+
+#include "Arduino.h"
+
+namespace {
+
+time_t sysTime = 0;
+unsigned long prevMillis = 0;
+
+// Days since 1970-01-01 for a civil date (proleptic Gregorian)
+long daysFromCivil(int y, int m, int d) {
+  y -= m <= 2;
+  const long era = (y >= 0 ? y : y - 399) / 400;
+  const unsigned yoe = (unsigned)(y - era * 400);
+  const unsigned doy = (153 * (m + (m > 2 ? -3 : 9)) + 2) / 5 + d - 1;
+  const unsigned doe = yoe * 365 + yoe / 4 - yoe / 100 + doy;
+  return era * 146097 + (long)doe - 719468;
+}
+
+void civilFromDays(long z, int *y, int *m, int *d) {
+  z += 719468;
+  const long era = (z >= 0 ? z : z - 146096) / 146097;
+  const unsigned doe = (unsigned)(z - era * 146097);
+  const unsigned yoe = (doe - doe / 1460 + doe / 36524 - doe / 146096) / 365;
+  const unsigned doy = doe - (365 * yoe + yoe / 4 - yoe / 100);
+  const unsigned mp = (5 * doy + 2) / 153;
+  *d = doy - (153 * mp + 2) / 5 + 1;
+  *m = mp < 10 ? mp + 3 : mp - 9;
+  *y = (int)(yoe + era * 400) + (*m <= 2);
+}
+
+long daysOf(time_t t) { return (long)(t >= 0 ? t / 86400 : (t - 86399) / 86400); }
+
+long secondsOfDay(time_t t) { return (long)(t - (time_t)daysOf(t) * 86400); }
+
+} // namespace
+
+void setTime(time_t t) {
+  sysTime = t;
+  prevMillis = millis();
+}
+
+void setTime(int hr, int min, int sec, int dy, int mnth, int yr) {
+  // Same two-digit year handling as TimeLib
+  if (yr < 100) yr += 2000;
+  time_t t = (time_t)daysFromCivil(yr, mnth, dy) * 86400;
+  setTime(t + hr * 3600L + min * 60L + sec);
+}
+
+time_t now() {
+  unsigned long elapsed = millis() - prevMillis;
+  sysTime += elapsed / 1000;
+  prevMillis += (elapsed / 1000) * 1000;
+  return sysTime;
+}
+
+int hour() { return hour(now()); }
+int hour(time_t t) { return (int)(secondsOfDay(t) / 3600); }
+
+int hourFormat12() { return hourFormat12(now()); }
+int hourFormat12(time_t t) {
+  int h = hour(t);
+  if (h == 0) return 12;
+  return h > 12 ? h - 12 : h;
+}
+
+bool isAM(time_t t) { return !isPM(t); }
+bool isPM(time_t t) { return hour(t) >= 12; }
+
+int minute() { return minute(now()); }
+int minute(time_t t) { return (int)(secondsOfDay(t) / 60 % 60); }
+
+int second() { return second(now()); }
+int second(time_t t) { return (int)(secondsOfDay(t) % 60); }
+
+int weekday(time_t t) { return (int)((daysOf(t) + 4) % 7 + 7) % 7 + 1; }
+
+int day() { return day(now()); }
+int day(time_t t) {
+  int y, m, d;
+  civilFromDays(daysOf(t), &y, &m, &d);
+  return d;
+}
+
+int month() { return month(now()); }
+int month(time_t t) {
+  int y, m, d;
+  civilFromDays(daysOf(t), &y, &m, &d);
+  return m;
+}
+
+int year() { return year(now()); }
+int year(time_t t) {
+  int y, m, d;
+  civilFromDays(daysOf(t), &y, &m, &d);
+  return y;
+}
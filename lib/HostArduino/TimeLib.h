@@ -0,0 +1,30 @@
+#ifndef HOST_TIMELIB_H
+#define HOST_TIMELIB_H
+
+#include <time.h>
+
+// Host build of the TimeLib calls used by the firmware (UTC, no sync provider)
+
+void setTime(time_t t);
+void setTime(int hr, int min, int sec, int day, int month, int yr);
+time_t now();
+
+int hour();
+int hour(time_t t);
+int hourFormat12();
+int hourFormat12(time_t t);
+bool isAM(time_t t);
+bool isPM(time_t t);
+int minute();
+int minute(time_t t);
+int second();
+int second(time_t t);
+int day();
+int day(time_t t);
+int weekday(time_t t);
+int month();
+int month(time_t t);
+int year();
+int year(time_t t);
+
+#endif // HOST_TIMELIB_H
@@ -0,0 +1,11 @@
+#include "WString.h"
+
+void String::replace(const String &find, const String &replace) {
+  if (find._s.empty()) return;
+
+  size_t pos = 0;
+  while ((pos = _s.find(find._s, pos)) != std::string::npos) {
+    _s.replace(pos, find._s.length(), replace._s);
+    pos += replace._s.length();
+  }
+}
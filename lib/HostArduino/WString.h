@@ -0,0 +1,46 @@
+#ifndef HOST_WSTRING_H
+#define HOST_WSTRING_H
+
+#include <string>
+
+// Arduino String backed by std::string (heap allocating, like the original)
+class String {
+public:
+  String() {}
+  String(const char *cstr) : _s(cstr ? cstr : "") {}
+  String(char c) : _s(1, c) {}
+  String(int value) : _s(std::to_string(value)) {}
+  String(unsigned int value) : _s(std::to_string(value)) {}
+  String(long value) : _s(std::to_string(value)) {}
+  String(unsigned long value) : _s(std::to_string(value)) {}
+  String(long long value) : _s(std::to_string(value)) {}
+  String(unsigned long long value) : _s(std::to_string(value)) {}
+
+  unsigned int length() const { return _s.length(); }
+  const char *c_str() const { return _s.c_str(); }
+
+  int indexOf(char c) const { return find(_s.find(c)); }
+  int indexOf(const char *str) const { return find(_s.find(str)); }
+  int indexOf(const String &str) const { return find(_s.find(str._s)); }
+
+  void replace(const String &find, const String &replace);
+
+  String &operator+=(const String &rhs) { _s += rhs._s; return *this; }
+  String &operator+=(const char *rhs) { _s += rhs; return *this; }
+  String &operator+=(char rhs) { _s += rhs; return *this; }
+
+  char operator[](unsigned int index) const {
+    return index < _s.length() ? _s[index] : 0;
+  }
+
+  bool operator==(const String &rhs) const { return _s == rhs._s; }
+  bool operator==(const char *rhs) const { return _s == rhs; }
+  bool operator!=(const String &rhs) const { return _s != rhs._s; }
+
+private:
+  static int find(size_t pos) { return pos == std::string::npos ? -1 : (int)pos; }
+
+  std::string _s;
+};
+
+#endif // HOST_WSTRING_H
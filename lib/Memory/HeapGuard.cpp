@@ -0,0 +1,190 @@
+#include "HeapGuard.h"
+
+#include <stdlib.h>
+#include <string.h>
+
+#if defined(ESP32)
+#include <esp_heap_caps.h>
+#include <freertos/FreeRTOS.h>
+#include <freertos/task.h>
+#include <rom/ets_sys.h>
+#elif defined(__GLIBC__)
+#include <malloc.h>
+#include <stdio.h>
+#else
+#include <stdio.h>
+#endif
+
+static HeapGuardStats stats;
+static volatile bool armed = false;
+static bool trapping = false;
+
+#if defined(ESP32)
+// Other tasks (WiFi, the SPI driver) may allocate; only the tasks added
+// to the guard are policed. Adding takes the lock and fills the slot
+// before the count moves past it, so the allocator, which reads without
+// the lock, never sees a slot half written.
+#define HEAP_GUARD_MAX_TASKS 4
+static TaskHandle_t guardedTasks[HEAP_GUARD_MAX_TASKS];
+static volatile int guardedTaskCount = 0;
+static portMUX_TYPE guardedTasksLock = portMUX_INITIALIZER_UNLOCKED;
+
+static bool onGuardedTask() {
+  TaskHandle_t task = xTaskGetCurrentTaskHandle();
+  int count = guardedTaskCount;
+  for (int i = 0; i < count; i++) {
+    if (guardedTasks[i] == task) return true;
+  }
+  return false;
+}
+
+void heapGuardAddTask(TaskHandle_t task) {
+  portENTER_CRITICAL(&guardedTasksLock);
+  bool guarded = false;
+  for (int i = 0; i < guardedTaskCount; i++) {
+    if (guardedTasks[i] == task) guarded = true;
+  }
+  if (!guarded && guardedTaskCount < HEAP_GUARD_MAX_TASKS) {
+    guardedTasks[guardedTaskCount] = task;
+    guardedTaskCount = guardedTaskCount + 1;
+  }
+  portEXIT_CRITICAL(&guardedTasksLock);
+}
+#else
+static bool onGuardedTask() { return true; }
+#endif
+
+bool heapGuardEnabled() {
+#if defined(HEAP_GUARD)
+  return true;
+#else
+  return false;
+#endif
+}
+
+void heapGuardArm(bool trap) {
+#if defined(ESP32)
+  heapGuardAddTask(xTaskGetCurrentTaskHandle());
+#endif
+  trapping = trap;
+  armed = true;
+}
+
+void heapGuardDisarm() {
+  armed = false;
+#if defined(ESP32)
+  portENTER_CRITICAL(&guardedTasksLock);
+  guardedTaskCount = 0;
+  portEXIT_CRITICAL(&guardedTasksLock);
+#endif
+}
+
+bool heapGuardArmed() { return armed; }
+
+const HeapGuardStats &heapGuardStats() { return stats; }
+
+void resetHeapGuardStats() { memset(&stats, 0, sizeof(stats)); }
+
+HeapReport heapReport() {
+  HeapReport report;
+  memset(&report, 0, sizeof(report));
+#if defined(ESP32)
+  report.freeBytes = heap_caps_get_free_size(MALLOC_CAP_8BIT);
+  report.largestFreeBlock = heap_caps_get_largest_free_block(MALLOC_CAP_8BIT);
+  report.minimumFreeBytes = heap_caps_get_minimum_free_size(MALLOC_CAP_8BIT);
+#elif defined(__GLIBC__)
+  // glibc doesn't expose its largest hole, so no largest block or
+  // fragmentation on the host: only free bytes
+  struct mallinfo2 info = mallinfo2();
+  report.freeBytes = info.fordblks;
+#endif
+  if (report.freeBytes && report.largestFreeBlock) {
+    report.fragmentationPercent = 100 - (uint32_t)((uint64_t)report.largestFreeBlock * 100 / report.freeBytes);
+  }
+  return report;
+}
+
+void printHeapReport(Print &out) {
+  HeapReport report = heapReport();
+  out.print("heap free=");
+  out.print((unsigned long)report.freeBytes);
+  if (report.largestFreeBlock) {
+    out.print(" largest=");
+    out.print((unsigned long)report.largestFreeBlock);
+  }
+  if (report.minimumFreeBytes) {
+    out.print(" min_free=");
+    out.print((unsigned long)report.minimumFreeBytes);
+  }
+  if (report.largestFreeBlock) {
+    out.print(" frag=");
+    out.print((unsigned long)report.fragmentationPercent);
+    out.print("%");
+  }
+  out.print(" allocs=");
+  out.print((unsigned long)stats.allocations);
+  out.print(" after_setup=");
+  out.println((unsigned long)stats.armedAllocations);
+}
+
+#if defined(HEAP_GUARD)
+
+// Counts an allocation; aborts if it breaks the policy. Must not allocate.
+static void checkAllocation(size_t size, void *caller) {
+  stats.allocations++;
+  if (!armed || !onGuardedTask()) return;
+
+  stats.armedAllocations++;
+  stats.armedBytes += size;
+  stats.lastCaller = caller;
+  if (!trapping) return;
+
+  armed = false;
+#if defined(ESP32)
+  ets_printf("HeapGuard: %u byte allocation after setup() from %p\n", (unsigned)size, caller);
+#else
+  fprintf(stderr, "HeapGuard: %zu byte allocation after setup() from %p\n", size, caller);
+#endif
+  abort();
+}
+
+extern "C" {
+
+void *__real_malloc(size_t size);
+void *__real_calloc(size_t count, size_t size);
+void *__real_realloc(void *ptr, size_t size);
+void __real_free(void *ptr);
+
+void *__wrap_malloc(size_t size) {
+  checkAllocation(size, __builtin_return_address(0));
+  return __real_malloc(size);
+}
+
+void *__wrap_calloc(size_t count, size_t size) {
+  checkAllocation(count * size, __builtin_return_address(0));
+  return __real_calloc(count, size);
+}
+
+void *__wrap_realloc(void *ptr, size_t size) {
+  checkAllocation(size, __builtin_return_address(0));
+  return __real_realloc(ptr, size);
+}
+
+void __wrap_free(void *ptr) {
+  if (ptr) stats.frees++;
+  __real_free(ptr);
+}
+
+#if defined(ESP32)
+// Display buffers come straight from heap_caps_malloc
+void *__real_heap_caps_malloc(size_t size, uint32_t caps);
+
+void *__wrap_heap_caps_malloc(size_t size, uint32_t caps) {
+  checkAllocation(size, __builtin_return_address(0));
+  return __real_heap_caps_malloc(size, caps);
+}
+#endif
+
+} // extern "C"
+
+#endif // HEAP_GUARD
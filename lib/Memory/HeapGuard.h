@@ -0,0 +1,55 @@
+#ifndef HEAP_GUARD_H
+#define HEAP_GUARD_H
+
+#include <Print.h>
+#include <stddef.h>
+#include <stdint.h>
+
+#if defined(ESP32)
+#include <freertos/FreeRTOS.h>
+#include <freertos/task.h>
+#endif
+
+// Zero-heap-after-setup policy. Built with HEAP_GUARD and the allocator
+// wrapped at link time (see the heapguard environment in platformio.ini),
+// every malloc/calloc/realloc is counted, and once heapGuardArm() has run
+// at the end of setup() any allocation from the loop task aborts with the
+// caller's address. setup() adds the tasks it starts with
+// heapGuardAddTask() before arming. Without HEAP_GUARD arming is a no-op.
+
+struct HeapGuardStats {
+  uint32_t allocations; // malloc, calloc and realloc calls
+  uint32_t frees;
+  uint32_t armedAllocations; // From the guarded task while armed
+  size_t armedBytes;
+  void *lastCaller; // Return address of the last armed allocation
+};
+
+// Heap state from the allocator itself
+struct HeapReport {
+  size_t freeBytes;
+  size_t largestFreeBlock; // 0 if unknown
+  size_t minimumFreeBytes; // Low-water mark since boot, 0 if unknown
+  uint32_t fragmentationPercent; // Free bytes unusable for the largest request, 0 if unknown
+};
+
+bool heapGuardEnabled();
+
+// Polices the calling task (on the host: every thread). trap false only
+// counts, for host runs that want a report instead.
+void heapGuardArm(bool trap = true);
+void heapGuardDisarm();
+
+#if defined(ESP32)
+// Polices another task too, once armed
+void heapGuardAddTask(TaskHandle_t task);
+#endif
+bool heapGuardArmed();
+
+const HeapGuardStats &heapGuardStats();
+void resetHeapGuardStats();
+
+HeapReport heapReport();
+void printHeapReport(Print &out);
+
+#endif // HEAP_GUARD_H
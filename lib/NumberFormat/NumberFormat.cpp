@@ -0,0 +1,106 @@
+#include "NumberFormat.h"
+
+namespace {
+
+const uint32_t kPow10[NUMBER_FORMAT_MAX_DECIMALS + 1] = {1, 10, 100, 1000, 10000, 100000, 1000000};
+const float kPow10f[NUMBER_FORMAT_MAX_DECIMALS + 1] = {1e0f, 1e1f, 1e2f, 1e3f, 1e4f, 1e5f, 1e6f};
+
+// Appends to a caller buffer, dropping what doesn't fit
+class Writer {
+public:
+  Writer(char *out, size_t size) : _out(out), _size(size), _length(0) {}
+
+  void put(char c) {
+    if (_length + 1 < _size) _out[_length++] = c;
+  }
+  void put(const char *text) {
+    while (text && *text) put(*text++);
+  }
+  // Least significant digit first into digits; returns the count
+  static int digitsOf(unsigned long value, char *digits) {
+    int count = 0;
+    do {
+      digits[count++] = '0' + value % 10;
+      value /= 10;
+    } while (value);
+    return count;
+  }
+  size_t finish() {
+    if (_size) _out[_length] = '\0';
+    return _length;
+  }
+
+private:
+  char *_out;
+  size_t _size;
+  size_t _length;
+};
+
+} // namespace
+
+size_t formatUnsigned(char *out, size_t size, unsigned long value, uint8_t width, char pad) {
+  Writer w(out, size);
+  char digits[20];
+  int count = Writer::digitsOf(value, digits);
+  for (int i = count; i < width; i++) w.put(pad);
+  while (count) w.put(digits[--count]);
+  return w.finish();
+}
+
+size_t formatGrouped(char *out, size_t size, unsigned long value, char separator) {
+  Writer w(out, size);
+  char digits[20];
+  int count = Writer::digitsOf(value, digits);
+  for (int i = count - 1; i >= 0; i--) {
+    w.put(digits[i]);
+    if (i > 0 && i % 3 == 0) w.put(separator);
+  }
+  return w.finish();
+}
+
+size_t formatFixed(char *out, size_t size, int32_t value, uint8_t decimals, const char *unit) {
+  if (decimals > NUMBER_FORMAT_MAX_DECIMALS) decimals = NUMBER_FORMAT_MAX_DECIMALS;
+
+  Writer w(out, size);
+  uint32_t magnitude = value < 0 ? 0u - (uint32_t)value : (uint32_t)value;
+  if (value < 0) w.put('-');
+
+  char digits[20];
+  int count = Writer::digitsOf(magnitude / kPow10[decimals], digits);
+  while (count) w.put(digits[--count]);
+
+  if (decimals) {
+    w.put('.');
+    count = Writer::digitsOf(magnitude % kPow10[decimals], digits);
+    for (int i = count; i < decimals; i++) w.put('0');
+    while (count) w.put(digits[--count]);
+  }
+
+  w.put(unit);
+  return w.finish();
+}
+
+size_t formatDecimal(char *out, size_t size, float value, uint8_t decimals, const char *unit) {
+  if (decimals > NUMBER_FORMAT_MAX_DECIMALS) decimals = NUMBER_FORMAT_MAX_DECIMALS;
+
+  float scaled = value * kPow10f[decimals];
+  scaled += scaled < 0 ? -0.5f : 0.5f;
+  // Saturate rather than overflow the conversion; NaN shows as 0
+  int32_t fixed;
+  if (scaled != scaled) {
+    fixed = 0;
+  } else if (scaled >= 2147483520.0f) {
+    fixed = INT32_MAX;
+  } else if (scaled <= -2147483520.0f) {
+    fixed = -INT32_MAX;
+  } else {
+    fixed = (int32_t)scaled;
+  }
+  return formatFixed(out, size, fixed, decimals, unit);
+}
+
+size_t formatText(char *out, size_t size, const char *text) {
+  Writer w(out, size);
+  w.put(text);
+  return w.finish();
+}
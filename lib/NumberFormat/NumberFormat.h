@@ -0,0 +1,35 @@
+#ifndef NUMBER_FORMAT_H
+#define NUMBER_FORMAT_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+// Display number formatting into caller buffers: no heap, no printf, and
+// no floating-point division (the ESP32 FPU has none, and Print's float
+// path runs in soft double). Each function writes at most size - 1
+// characters plus a NUL and returns the length written, so calls compose:
+//
+//   size_t n = formatUnsigned(out, size, hour, 2, ' ');
+//   n += formatText(out + n, size - n, ":");
+
+#define NUMBER_FORMAT_MAX_DECIMALS 6
+
+// Integers take unsigned long like Print: 32 bits on the ESP32, where the
+// divide by ten is a single instruction.
+
+// value, left padded with pad to at least width characters
+size_t formatUnsigned(char *out, size_t size, unsigned long value, uint8_t width = 0, char pad = '0');
+
+// Thousands grouping: 2860000000 -> "2,860,000,000"
+size_t formatGrouped(char *out, size_t size, unsigned long value, char separator = ',');
+
+// Fixed point: value in units of 10^-decimals, then unit (may be null).
+// formatFixed(out, size, -215, 1, " C") -> "-21.5 C"
+size_t formatFixed(char *out, size_t size, int32_t value, uint8_t decimals, const char *unit = nullptr);
+
+// value rounded half away from zero to decimals places, as formatFixed
+size_t formatDecimal(char *out, size_t size, float value, uint8_t decimals, const char *unit = nullptr);
+
+size_t formatText(char *out, size_t size, const char *text);
+
+#endif // NUMBER_FORMAT_H
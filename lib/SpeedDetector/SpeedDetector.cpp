@@ -0,0 +1,49 @@
+#include "SpeedDetector.h"
+
+// SpeedDetector implementation
+
+SpeedDetector::SpeedDetector(float distanceM, int threshold, unsigned long timeoutMs, unsigned long cooldownMs,
+                             Clock *clock)
+    : _distance(distanceM), _threshold(threshold), _timeout(timeoutMs), _cooldown(cooldownMs),
+      _clock(clock ? clock : &systemClock()), _state(WAITING_FOR_FIRST_SENSOR), _sensor1Blocked(true), _startTime(0), _cooldownEnd(0),
+      _transitMs(0) {}
+
+SpeedEvent SpeedDetector::update(int sensor1, int sensor2) {
+  unsigned long now = _clock->nowMs();
+  bool arrived = sensor1 > _threshold && !_sensor1Blocked;
+  _sensor1Blocked = sensor1 > _threshold;
+
+  switch (_state) {
+    case WAITING_FOR_FIRST_SENSOR:
+      if (arrived) {
+        _startTime = now;
+        _state = WAITING_FOR_SECOND_SENSOR;
+        return SPEED_FIRST_SENSOR;
+      }
+      break;
+
+    case WAITING_FOR_SECOND_SENSOR:
+      if (now - _startTime > _timeout) {
+        _state = WAITING_FOR_FIRST_SENSOR;
+        return SPEED_TIMED_OUT;
+      }
+      if (sensor2 > _threshold) {
+        _transitMs = now - _startTime;
+        _cooldownEnd = now + _cooldown;
+        _state = COOLDOWN;
+        return SPEED_MEASURED;
+      }
+      break;
+
+    case COOLDOWN:
+      if ((long)(now - _cooldownEnd) >= 0) {
+        _state = WAITING_FOR_FIRST_SENSOR;
+      }
+      break;
+  }
+  return SPEED_NO_EVENT;
+}
+
+float SpeedDetector::speed() const {
+  return _transitMs > 0 ? _distance * 1000.0f / _transitMs : 0.0f;
+}
@@ -0,0 +1,57 @@
+#ifndef SPEED_DETECTOR_H
+#define SPEED_DETECTOR_H
+
+#include "Clock.h"
+
+// Speed detection states
+enum SpeedDetectorState {
+  WAITING_FOR_FIRST_SENSOR,
+  WAITING_FOR_SECOND_SENSOR,
+  COOLDOWN
+};
+
+// What an update() saw
+enum SpeedEvent {
+  SPEED_NO_EVENT,
+  SPEED_FIRST_SENSOR, // Something at the first sensor, timing started
+  SPEED_MEASURED,     // And at the second: transitMs() and speed() are new
+  SPEED_TIMED_OUT     // The second sensor never saw it
+};
+
+// Speed from two sensors a known distance apart: the time from the first
+// sensor going over threshold to the second reading over it. Timing only
+// starts on the first sensor's clear-to-blocked edge, so a vehicle met
+// mid-pass (already there at power-up or when a cooldown ends) is let
+// go rather than read as a near-zero transit. Gives up on the second
+// sensor after the timeout, and ignores both for the cooldown after a
+// measurement. Time comes from the clock, the system clock by default.
+class SpeedDetector {
+public:
+  SpeedDetector(float distanceM, int threshold, unsigned long timeoutMs, unsigned long cooldownMs,
+                Clock *clock = nullptr);
+
+  // Call with both sensor readings every sample
+  SpeedEvent update(int sensor1, int sensor2);
+
+  SpeedDetectorState state() const { return _state; }
+  unsigned long cooldownEnd() const { return _cooldownEnd; }
+
+  // Last measurement; speed is 0 if the transit took under 1 ms
+  unsigned long transitMs() const { return _transitMs; }
+  float speed() const; // m/s
+
+private:
+  float _distance;
+  int _threshold;
+  unsigned long _timeout;
+  unsigned long _cooldown;
+  Clock *_clock;
+
+  SpeedDetectorState _state;
+  bool _sensor1Blocked; // At the last update; blocked until seen clear
+  unsigned long _startTime;
+  unsigned long _cooldownEnd;
+  unsigned long _transitMs;
+};
+
+#endif // SPEED_DETECTOR_H
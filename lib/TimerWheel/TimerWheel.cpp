@@ -0,0 +1,270 @@
+#include "TimerWheel.h"
+
+#include <string.h>
+
+// TimerWheel implementation
+
+namespace {
+
+const unsigned long kSlotMask = TIMER_WHEEL_SLOTS - 1;
+const unsigned long kSpanMask = (1UL << (TIMER_WHEEL_BITS * TIMER_WHEEL_LEVELS)) - 1;
+
+// Lists that aren't wheel slots: overflow, due and firing
+const uint8_t kNoLevel = TIMER_WHEEL_LEVELS;
+
+bool before(unsigned long a, unsigned long b) { return (long)(a - b) < 0; }
+
+unsigned digit(unsigned long t, unsigned level) { return (t >> (TIMER_WHEEL_BITS * level)) & kSlotMask; }
+
+} // namespace
+
+TimerWheel::TimerWheel() : _overflow(nullptr), _due(nullptr), _firing(nullptr), _pending(0) {
+  memset(_slots, 0, sizeof(_slots));
+  begin(0);
+}
+
+void TimerWheel::begin(unsigned long nowMs) {
+  // Timers still linked in just become idle
+  auto forget = [](Timer *list) {
+    while (list) {
+      Timer *next = list->_next;
+      list->_next = nullptr;
+      list->_prev = nullptr;
+      list->_list = nullptr;
+      list = next;
+    }
+  };
+  for (unsigned level = 0; level < TIMER_WHEEL_LEVELS; level++) {
+    for (unsigned slot = 0; slot < TIMER_WHEEL_SLOTS; slot++) forget(_slots[level][slot]);
+  }
+  forget(_overflow);
+  forget(_due);
+  forget(_firing);
+
+  memset(_slots, 0, sizeof(_slots));
+  memset(_occupied, 0, sizeof(_occupied));
+  _overflow = nullptr;
+  _due = nullptr;
+  _firing = nullptr;
+  _now = nowMs;
+  _pending = 0;
+  _running = false;
+}
+
+void TimerWheel::schedule(Timer &timer, unsigned long deadlineMs) {
+  if (timer.isPending()) unlink(timer);
+  timer._deadline = deadlineMs;
+
+  // From a callback, "now" waits for the next run()
+  if (_running && !before(_now, deadlineMs)) {
+    link(timer, &_due, kNoLevel, 0);
+  } else {
+    place(timer);
+  }
+}
+
+void TimerWheel::cancel(Timer &timer) {
+  if (timer.isPending()) unlink(timer);
+}
+
+uint32_t TimerWheel::run(unsigned long nowMs) {
+  if (before(nowMs, _now)) nowMs = _now;
+  _running = true;
+
+  moveAll(&_due, &_firing);
+  uint32_t fired = fireList(&_firing, nowMs);
+
+  for (;;) {
+    // The rest of this block of level 0 slots, up to nowMs
+    bool lastBlock = !before(_now | kSlotMask, nowMs);
+    fired += fireSlots(digit(_now, 0), lastBlock ? digit(nowMs, 0) : kSlotMask, nowMs);
+
+    // Then straight on to the next slot that comes down from above
+    unsigned long at;
+    if (lastBlock || !nextCascade(at) || before(nowMs, at)) break;
+    cascade(at);
+  }
+
+  _now = nowMs;
+  _running = false;
+  return fired;
+}
+
+bool TimerWheel::nextDeadline(unsigned long &deadlineMs) const {
+  bool found = false;
+  unsigned long earliest = 0;
+  auto consider = [&](const Timer *list) {
+    for (; list; list = list->_next) {
+      if (!found || before(list->_deadline, earliest)) earliest = list->_deadline;
+      found = true;
+    }
+  };
+
+  consider(_due);
+
+  // Each level's timers all come after the ones below it
+  uint64_t ahead = _occupied[0] & (~0ULL << digit(_now, 0));
+  if (ahead) {
+    consider(_slots[0][__builtin_ctzll(ahead)]);
+  } else {
+    bool wheel = false;
+    for (unsigned level = 1; level < TIMER_WHEEL_LEVELS && !wheel; level++) {
+      ahead = _occupied[level] & (~0ULL << digit(_now, level) << 1);
+      if (ahead) {
+        consider(_slots[level][__builtin_ctzll(ahead)]);
+        wheel = true;
+      }
+    }
+    if (!wheel) consider(_overflow);
+  }
+
+  if (found) deadlineMs = earliest;
+  return found;
+}
+
+unsigned long TimerWheel::timeUntilNext(unsigned long nowMs, unsigned long maxMs) const {
+  unsigned long deadline;
+  if (!nextDeadline(deadline)) return maxMs;
+  if (!before(nowMs, deadline)) return 0;
+  unsigned long wait = deadline - nowMs;
+  return wait < maxMs ? wait : maxMs;
+}
+
+// Into the lowest level where the deadline shares every higher digit
+// with the wheel's time, so a level's timers all come after those below
+void TimerWheel::place(Timer &timer) {
+  unsigned long deadline = timer._deadline;
+  if (before(deadline, _now)) {
+    link(timer, &_due, kNoLevel, 0);
+    return;
+  }
+
+  unsigned long differ = deadline ^ _now;
+  for (unsigned level = 0; level < TIMER_WHEEL_LEVELS; level++) {
+    if ((differ >> (TIMER_WHEEL_BITS * level) >> TIMER_WHEEL_BITS) == 0) {
+      uint8_t slot = digit(deadline, level);
+      link(timer, &_slots[level][slot], level, slot);
+      return;
+    }
+  }
+  link(timer, &_overflow, kNoLevel, 0);
+}
+
+void TimerWheel::link(Timer &timer, Timer **list, uint8_t level, uint8_t slot) {
+  timer._prev = nullptr;
+  timer._next = *list;
+  if (*list) (*list)->_prev = &timer;
+  *list = &timer;
+  timer._list = list;
+  timer._level = level;
+  timer._slot = slot;
+  if (level < TIMER_WHEEL_LEVELS) _occupied[level] |= 1ULL << slot;
+  _pending++;
+}
+
+void TimerWheel::unlink(Timer &timer) {
+  if (timer._prev) {
+    timer._prev->_next = timer._next;
+  } else {
+    *timer._list = timer._next;
+  }
+  if (timer._next) timer._next->_prev = timer._prev;
+  if (timer._level < TIMER_WHEEL_LEVELS && !*timer._list) {
+    _occupied[timer._level] &= ~(1ULL << timer._slot);
+  }
+
+  timer._next = nullptr;
+  timer._prev = nullptr;
+  timer._list = nullptr;
+  _pending--;
+}
+
+// Whole list at once; `to` must be empty
+void TimerWheel::moveAll(Timer **from, Timer **to) {
+  *to = *from;
+  *from = nullptr;
+  for (Timer *timer = *to; timer; timer = timer->_next) {
+    timer->_list = to;
+    timer->_level = kNoLevel;
+  }
+}
+
+void TimerWheel::fire(Timer &timer, unsigned long nowMs) {
+  unsigned long late = before(timer._deadline, nowMs) ? nowMs - timer._deadline : 0;
+  TimerStats &stats = timer._stats;
+  stats.fires++;
+  stats.totalLateMs += late;
+  if (late > stats.maxLateMs) stats.maxLateMs = late;
+  timer._callback(timer, nowMs);
+}
+
+// One at a time, so a callback can cancel a timer still on the list
+uint32_t TimerWheel::fireList(Timer **list, unsigned long nowMs) {
+  uint32_t fired = 0;
+  while (*list) {
+    Timer &timer = **list;
+    unlink(timer);
+    fire(timer, nowMs);
+    fired++;
+  }
+  return fired;
+}
+
+// Level 0 slots first to last, inclusive. Callbacks may fill slots
+// further on, so the occupied bits are read again after every slot.
+uint32_t TimerWheel::fireSlots(unsigned first, unsigned last, unsigned long nowMs) {
+  uint32_t fired = 0;
+  uint64_t range = (~0ULL << first) & (~0ULL >> (TIMER_WHEEL_SLOTS - 1 - last));
+  uint64_t ready;
+  while ((ready = _occupied[0] & range) != 0) {
+    unsigned slot = __builtin_ctzll(ready);
+    range &= ~0ULL << slot << 1;
+    _now = (_now & ~kSlotMask) | slot;
+
+    moveAll(&_slots[0][slot], &_firing);
+    _occupied[0] &= ~(1ULL << slot);
+    fired += fireList(&_firing, nowMs);
+  }
+  return fired;
+}
+
+// Start of the next slot above level 0 with timers in it, or of the next
+// span when only the overflow list has any
+bool TimerWheel::nextCascade(unsigned long &at) const {
+  for (unsigned level = 1; level < TIMER_WHEEL_LEVELS; level++) {
+    uint64_t ahead = _occupied[level] & (~0ULL << digit(_now, level) << 1);
+    if (ahead) {
+      unsigned shift = TIMER_WHEEL_BITS * level;
+      unsigned long block = _now >> shift >> TIMER_WHEEL_BITS << TIMER_WHEEL_BITS;
+      at = (block | __builtin_ctzll(ahead)) << shift;
+      return true;
+    }
+  }
+  if (_overflow) {
+    at = (_now | kSpanMask) + 1;
+    return true;
+  }
+  return false;
+}
+
+// Spreads the slots that start at `at` over the levels below
+void TimerWheel::cascade(unsigned long at) {
+  _now = at;
+  if ((at & kSpanMask) == 0) {
+    while (_overflow) {
+      Timer &timer = *_overflow;
+      unlink(timer);
+      place(timer);
+    }
+  }
+  for (unsigned level = TIMER_WHEEL_LEVELS - 1; level > 0; level--) {
+    unsigned shift = TIMER_WHEEL_BITS * level;
+    if (at & ((1UL << shift) - 1)) continue;
+    Timer **list = &_slots[level][digit(at, level)];
+    while (*list) {
+      Timer &timer = **list;
+      unlink(timer);
+      place(timer);
+    }
+  }
+}
@@ -0,0 +1,118 @@
+#ifndef TIMER_WHEEL_H
+#define TIMER_WHEEL_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+// 64 one-millisecond slots, then 64 slots of 64 ms, and so on: four
+// levels reach 64^4 ms, about 4.6 hours. Later deadlines wait in an
+// overflow list that is sorted out every time that span rolls over.
+#define TIMER_WHEEL_BITS 6
+#define TIMER_WHEEL_SLOTS (1 << TIMER_WHEEL_BITS)
+#define TIMER_WHEEL_LEVELS 4
+
+class Timer;
+
+// nowMs is the time run() was called with, not the deadline
+typedef void (*TimerCallback)(Timer &timer, unsigned long nowMs);
+
+// How late the callbacks ran: run()'s nowMs minus the deadline
+struct TimerStats {
+  uint32_t fires;
+  uint32_t maxLateMs;
+  uint64_t totalLateMs;
+};
+
+// A deadline and what to call at it. The caller owns it and the wheel
+// links it in while it is pending, so scheduling never allocates. Fires
+// once per schedule(); a periodic timer schedules itself again from its
+// callback.
+class Timer {
+public:
+  Timer(const char *name, TimerCallback callback, void *context = nullptr)
+      : _name(name), _callback(callback), _context(context), _deadline(0), _next(nullptr), _prev(nullptr),
+        _list(nullptr), _level(0), _slot(0), _stats() {}
+
+  const char *name() const { return _name; }
+  void *context() const { return _context; }
+  bool isPending() const { return _list != nullptr; }
+  unsigned long deadline() const { return _deadline; }
+
+  const TimerStats &stats() const { return _stats; }
+  void resetStats() { _stats = TimerStats(); }
+
+private:
+  friend class TimerWheel;
+
+  const char *_name;
+  TimerCallback _callback;
+  void *_context;
+  unsigned long _deadline;
+
+  // Whichever list the timer is on, and where that is in the wheel
+  Timer *_next;
+  Timer *_prev;
+  Timer **_list;
+  uint8_t _level;
+  uint8_t _slot;
+
+  TimerStats _stats;
+};
+
+// Hierarchical timing wheel over a millisecond clock it is handed, so the
+// same code runs against millis() or a simulated clock. schedule() and
+// cancel() are O(1). run() fires whatever is due in deadline order,
+// jumping straight over empty stretches of time, so the caller can sleep
+// until nextDeadline() instead of polling.
+//
+// Deadlines must be less than half the clock's range ahead. Timers due
+// in the same millisecond fire in no set order. A timer scheduled from a
+// callback for a time that has already come fires on the next run(), so
+// a callback can't keep run() from returning.
+class TimerWheel {
+public:
+  TimerWheel();
+
+  // Empties the wheel and starts its clock at nowMs
+  void begin(unsigned long nowMs);
+
+  // Arms the timer for deadlineMs, moving it if it was pending
+  void schedule(Timer &timer, unsigned long deadlineMs);
+  void cancel(Timer &timer);
+
+  // Fires every timer due by nowMs; returns how many fired
+  uint32_t run(unsigned long nowMs);
+
+  // Earliest pending deadline; false when nothing is pending
+  bool nextDeadline(unsigned long &deadlineMs) const;
+
+  // How long from nowMs until the earliest deadline: 0 if something is
+  // already due, maxMs if nothing is pending that soon
+  unsigned long timeUntilNext(unsigned long nowMs, unsigned long maxMs) const;
+
+  // Time the wheel has been run up to
+  unsigned long now() const { return _now; }
+  uint32_t pending() const { return _pending; }
+
+private:
+  void place(Timer &timer);
+  void link(Timer &timer, Timer **list, uint8_t level, uint8_t slot);
+  void unlink(Timer &timer);
+  void moveAll(Timer **from, Timer **to);
+  void fire(Timer &timer, unsigned long nowMs);
+  uint32_t fireList(Timer **list, unsigned long nowMs);
+  uint32_t fireSlots(unsigned first, unsigned last, unsigned long nowMs);
+  bool nextCascade(unsigned long &at) const;
+  void cascade(unsigned long at);
+
+  Timer *_slots[TIMER_WHEEL_LEVELS][TIMER_WHEEL_SLOTS];
+  uint64_t _occupied[TIMER_WHEEL_LEVELS]; // Bit per non-empty slot
+  Timer *_overflow;
+  Timer *_due;    // Deadline already past when scheduled
+  Timer *_firing; // Taken off the wheel by run(), not fired yet
+  unsigned long _now;
+  uint32_t _pending;
+  bool _running;
+};
+
+#endif // TIMER_WHEEL_H
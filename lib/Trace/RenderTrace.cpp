@@ -0,0 +1,133 @@
+#include "RenderTrace.h"
+
+#include <string.h>
+
+#if defined(RENDER_TRACE)
+
+#include <atomic>
+
+#if defined(ESP32)
+#include <freertos/FreeRTOS.h>
+#include <freertos/task.h>
+#endif
+
+namespace {
+
+struct TraceEvent {
+  uint32_t startUs;
+  uint32_t durationUs;
+  uint8_t name;
+  uint8_t track;
+};
+
+TraceEvent events[RENDER_TRACE_EVENTS];
+std::atomic<uint32_t> head(0);
+std::atomic<bool> paused(false);
+
+// The last slot collects the probes that didn't get one of their own
+const char *names[RENDER_TRACE_NAMES];
+std::atomic<uint8_t> nameCount(0);
+
+TraceStats stats;
+
+uint8_t currentTrack() {
+#if defined(ESP32)
+  return (uint8_t)xPortGetCoreID();
+#else
+  static std::atomic<uint8_t> threads(0);
+  static thread_local uint8_t track = threads.fetch_add(1);
+  return track;
+#endif
+}
+
+void put16(uint8_t *out, uint16_t value) {
+  out[0] = (uint8_t)value;
+  out[1] = (uint8_t)(value >> 8);
+}
+
+void put32(uint8_t *out, uint32_t value) {
+  put16(out, (uint16_t)value);
+  put16(out + 2, (uint16_t)(value >> 16));
+}
+
+} // namespace
+
+TraceName::TraceName(const char *name) {
+  uint8_t id = nameCount.fetch_add(1);
+  if (id >= RENDER_TRACE_NAMES - 1) {
+    id = RENDER_TRACE_NAMES - 1;
+    name = "(other)";
+    nameCount = RENDER_TRACE_NAMES;
+  }
+  names[id] = name;
+  _id = id;
+}
+
+void traceRecord(uint8_t name, uint32_t startUs, uint32_t durationUs) {
+  if (paused.load(std::memory_order_relaxed)) return;
+  TraceEvent &event = events[head.fetch_add(1, std::memory_order_relaxed) % RENDER_TRACE_EVENTS];
+  event.startUs = startUs;
+  event.durationUs = durationUs;
+  event.name = name;
+  event.track = currentTrack();
+}
+
+bool traceEnabled() { return true; }
+
+const TraceStats &traceStats() {
+  uint32_t recorded = head.load();
+  stats.recorded = recorded;
+  stats.overwritten = recorded > RENDER_TRACE_EVENTS ? recorded - RENDER_TRACE_EVENTS : 0;
+  stats.names = nameCount.load();
+  return stats;
+}
+
+void resetTrace() { head = 0; }
+
+// A probe that got its slot just before the pause may still be filling
+// it in; at worst one event in the dump is torn
+size_t traceDump(Print &out) {
+  paused = true;
+  uint32_t recorded = head.load();
+  uint32_t count = recorded < RENDER_TRACE_EVENTS ? recorded : RENDER_TRACE_EVENTS;
+  uint8_t nameTotal = nameCount.load();
+  if (nameTotal > RENDER_TRACE_NAMES) nameTotal = RENDER_TRACE_NAMES;
+
+  uint8_t header[12] = {'R', 'T', 'R', 'C', RENDER_TRACE_VERSION, nameTotal};
+  put16(header + 6, (uint16_t)count);
+  put32(header + 8, recorded - count);
+  size_t written = out.write(header, sizeof(header));
+
+  for (uint8_t i = 0; i < nameTotal; i++) {
+    uint8_t length = (uint8_t)strnlen(names[i], 255);
+    written += out.write(&length, 1);
+    written += out.write((const uint8_t *)names[i], length);
+  }
+
+  for (uint32_t i = 0; i < count; i++) {
+    const TraceEvent &event = events[(recorded - count + i) % RENDER_TRACE_EVENTS];
+    uint8_t record[10];
+    put32(record, event.startUs);
+    put32(record + 4, event.durationUs);
+    record[8] = event.name;
+    record[9] = event.track;
+    written += out.write(record, sizeof(record));
+  }
+
+  paused = false;
+  return written;
+}
+
+#else
+
+static TraceStats stats;
+
+bool traceEnabled() { return false; }
+
+const TraceStats &traceStats() { return stats; }
+
+void resetTrace() {}
+
+size_t traceDump(Print &) { return 0; }
+
+#endif // RENDER_TRACE
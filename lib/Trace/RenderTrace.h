@@ -0,0 +1,77 @@
+#ifndef RENDER_TRACE_H
+#define RENDER_TRACE_H
+
+#include <Arduino.h>
+#include <Print.h>
+#include <stdint.h>
+
+// Scoped timing probes. Built with RENDER_TRACE (the trace environment in
+// platformio.ini), TRACE_SCOPE("name") records when the enclosing block
+// started and how long it ran into a ring of RENDER_TRACE_EVENTS entries,
+// overwriting the oldest. traceDump() writes the ring out in the binary
+// form tools/trace2chrome.py turns into a Chrome trace. Without
+// RENDER_TRACE the probes compile to nothing.
+//
+// Dump format, little-endian:
+//   "RTRC" version:u8 name_count:u8 event_count:u16 overwritten:u32
+//   name_count x (length:u8 chars)
+//   event_count x (start_us:u32 duration_us:u32 name:u8 track:u8), oldest first
+// The track is the core on the ESP32 and the thread on the host.
+
+#define RENDER_TRACE_EVENTS 1024
+#define RENDER_TRACE_NAMES 64
+#define RENDER_TRACE_VERSION 1
+
+struct TraceStats {
+  uint32_t recorded;    // Since the last reset
+  uint32_t overwritten; // Recorded but pushed out of the ring
+  uint8_t names;
+};
+
+bool traceEnabled();
+const TraceStats &traceStats();
+void resetTrace();
+// Recording pauses while the ring is written out. Returns the bytes written.
+size_t traceDump(Print &out);
+
+#if defined(RENDER_TRACE)
+
+// A probe's name, registered on first use; names past RENDER_TRACE_NAMES
+// share the last entry
+class TraceName {
+public:
+  explicit TraceName(const char *name);
+  uint8_t id() const { return _id; }
+
+private:
+  uint8_t _id;
+};
+
+void traceRecord(uint8_t name, uint32_t startUs, uint32_t durationUs);
+
+class TraceScope {
+public:
+  explicit TraceScope(const TraceName &name) : _name(name.id()), _startUs(micros()) {}
+  ~TraceScope() { traceRecord(_name, _startUs, micros() - _startUs); }
+
+  TraceScope(const TraceScope &) = delete;
+  TraceScope &operator=(const TraceScope &) = delete;
+
+private:
+  uint8_t _name;
+  uint32_t _startUs;
+};
+
+#define TRACE_CONCAT_(a, b) a##b
+#define TRACE_CONCAT(a, b) TRACE_CONCAT_(a, b)
+#define TRACE_SCOPE(name)                                                                                      \
+  static const TraceName TRACE_CONCAT(traceName_, __LINE__)(name);                                             \
+  TraceScope TRACE_CONCAT(traceScope_, __LINE__)(TRACE_CONCAT(traceName_, __LINE__))
+
+#else
+
+#define TRACE_SCOPE(name) ((void)0)
+
+#endif // RENDER_TRACE
+
+#endif // RENDER_TRACE_H
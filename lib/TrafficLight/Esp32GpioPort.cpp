@@ -0,0 +1,21 @@
+#if defined(ESP32)
+
+#include "Esp32GpioPort.h"
+
+#include <Arduino.h>
+#include <soc/gpio_struct.h>
+
+void Esp32GpioPort::begin(uint32_t pins) {
+  GPIO.out_w1tc = pins;
+  resetLevels(pins);
+  for (uint8_t pin = 0; pin < 32; pin++) {
+    if (pins & (1UL << pin)) pinMode(pin, OUTPUT);
+  }
+}
+
+void Esp32GpioPort::writeRegisters(uint32_t set, uint32_t clear) {
+  if (set) GPIO.out_w1ts = set;
+  if (clear) GPIO.out_w1tc = clear;
+}
+
+#endif // ESP32
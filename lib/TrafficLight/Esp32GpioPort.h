@@ -0,0 +1,21 @@
+#ifndef ESP32_GPIO_PORT_H
+#define ESP32_GPIO_PORT_H
+
+#if defined(ESP32)
+
+#include "GpioPort.h"
+
+// Straight to the GPIO W1TS and W1TC registers. Each is a single store
+// that only touches the pins whose bits are set, so pins on other tasks
+// (the display's DC and CS) are safe without a lock.
+class Esp32GpioPort : public GpioPort {
+public:
+  void begin(uint32_t pins) override;
+
+protected:
+  void writeRegisters(uint32_t set, uint32_t clear) override;
+};
+
+#endif // ESP32
+
+#endif // ESP32_GPIO_PORT_H
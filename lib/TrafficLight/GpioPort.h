@@ -0,0 +1,75 @@
+#ifndef GPIO_PORT_H
+#define GPIO_PORT_H
+
+#include <stdint.h>
+
+// Output pins 0 to 31 driven as one mask. Each write() goes out as two
+// register writes, the pins going high first and then the pins going
+// low, so a lamp being switched on lights before the one it replaces
+// goes dark and a head is never blank. Between beginBatch() and
+// endBatch() writes are merged and go out together at the end: a whole
+// intersection changes in one set and one clear.
+class GpioPort {
+public:
+  GpioPort() : _levels(0), _set(0), _clear(0), _batch(0) {}
+  virtual ~GpioPort() {}
+
+  // Makes the pins outputs and drives them low
+  virtual void begin(uint32_t pins) = 0;
+
+  // Drives the pins in mask to their bits in levels
+  void write(uint32_t mask, uint32_t levels) {
+    _set = (_set & ~mask) | (mask & levels);
+    _clear = (_clear & ~mask) | (mask & ~levels);
+    if (_batch == 0) flush();
+  }
+
+  void beginBatch() { _batch++; }
+  void endBatch() {
+    if (_batch > 0 && --_batch == 0) flush();
+  }
+
+  // As last written out
+  uint32_t levels() const { return _levels; }
+
+protected:
+  // One write each for the pins going high and the pins going low, in
+  // that order; either mask may be 0
+  virtual void writeRegisters(uint32_t set, uint32_t clear) = 0;
+
+  // For begin(): the pins are low now
+  void resetLevels(uint32_t pins) { _levels &= ~pins; }
+
+private:
+  void flush() {
+    // Only what actually changes
+    uint32_t set = _set & ~_levels;
+    uint32_t clear = _clear & _levels;
+    _set = 0;
+    _clear = 0;
+    if (!(set | clear)) return;
+    _levels = (_levels | set) & ~clear;
+    writeRegisters(set, clear);
+  }
+
+  uint32_t _levels;
+  uint32_t _set;
+  uint32_t _clear;
+  uint8_t _batch;
+};
+
+// Batches the port's writes for the life of the scope; no-op on nullptr
+class GpioBatch {
+public:
+  explicit GpioBatch(GpioPort *port) : _port(port) {
+    if (_port) _port->beginBatch();
+  }
+  ~GpioBatch() {
+    if (_port) _port->endBatch();
+  }
+
+private:
+  GpioPort *_port;
+};
+
+#endif // GPIO_PORT_H
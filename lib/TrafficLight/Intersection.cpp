@@ -0,0 +1,117 @@
+#include "Intersection.h"
+
+// Intersection implementation
+
+Intersection::Intersection(TrafficLight *const *heads, uint8_t headCount, const IntersectionPhase *phases,
+                           uint8_t phaseCount, const uint32_t *conflicts, GpioPort *port)
+    : _heads(heads), _headCount(headCount), _phases(phases), _phaseCount(phaseCount), _conflicts(conflicts),
+      _port(port), _running(false), _phase(0), _interval(INTERVAL_ALL_RED), _intervalStart(0), _intervalLength(0), _green(0),
+      _yellow(0), _phasesRun(0) {}
+
+bool Intersection::begin(unsigned long nowMs) {
+  _running = false;
+  {
+    GpioBatch batch(_port);
+    for (uint8_t h = 0; h < _headCount; h++) {
+      _heads[h]->setLight(RED);
+    }
+  }
+  _green = 0;
+  _yellow = 0;
+  if (!validate()) return false;
+
+  _running = true;
+  _phase = 0;
+  _phasesRun = 1;
+  _interval = INTERVAL_GREEN;
+  _intervalStart = nowMs;
+  _intervalLength = _phases[0].greenMs;
+  show(_phases[0].green, 0);
+  return true;
+}
+
+bool Intersection::tick(unsigned long nowMs) {
+  if (nowMs - _intervalStart < _intervalLength || !_running) return false;
+
+  // Late ticks stretch the interval rather than shortening the next one,
+  // so a yellow always lasts its full time
+  _intervalStart = nowMs;
+  advance();
+  return true;
+}
+
+LightState Intersection::headState(uint8_t head) const {
+  uint32_t bit = 1UL << head;
+  if (_green & bit) return GREEN;
+  if (_yellow & bit) return YELLOW;
+  return RED;
+}
+
+bool Intersection::validate() const {
+  if (_headCount == 0 || _headCount > INTERSECTION_MAX_HEADS || _phaseCount == 0) return false;
+  uint32_t all = _headCount == 32 ? 0xFFFFFFFFUL : (1UL << _headCount) - 1;
+
+  // Conflicts go both ways
+  for (uint8_t h = 0; h < _headCount; h++) {
+    if (_conflicts[h] & ~all || _conflicts[h] & (1UL << h)) return false;
+    for (uint8_t g = 0; g < _headCount; g++) {
+      if (((_conflicts[h] >> g) & 1) != ((_conflicts[g] >> h) & 1)) return false;
+    }
+  }
+
+  for (uint8_t p = 0; p < _phaseCount; p++) {
+    const IntersectionPhase &phase = _phases[p];
+    if (phase.greenMs > INTERSECTION_MAX_INTERVAL_MS || phase.yellowMs > INTERSECTION_MAX_INTERVAL_MS ||
+        phase.allRedMs > INTERSECTION_MAX_INTERVAL_MS) {
+      return false;
+    }
+    uint32_t green = phase.green;
+    if (green & ~all) return false;
+    for (uint8_t h = 0; h < _headCount; h++) {
+      if ((green >> h & 1) && (_conflicts[h] & green)) return false;
+    }
+  }
+  return true;
+}
+
+void Intersection::advance() {
+  const IntersectionPhase &current = _phases[_phase];
+  uint8_t next = _phase + 1 < _phaseCount ? _phase + 1 : 0;
+  uint32_t carried = current.green & _phases[next].green;
+
+  switch (_interval) {
+    case INTERVAL_GREEN:
+      _interval = INTERVAL_YELLOW;
+      _intervalLength = current.yellowMs;
+      show(carried, current.green & ~carried);
+      break;
+
+    case INTERVAL_YELLOW:
+      _interval = INTERVAL_ALL_RED;
+      _intervalLength = current.allRedMs;
+      show(carried, 0);
+      break;
+
+    case INTERVAL_ALL_RED:
+      _phase = next;
+      _phasesRun++;
+      _interval = INTERVAL_GREEN;
+      _intervalLength = _phases[next].greenMs;
+      show(_phases[next].green, 0);
+      break;
+  }
+}
+
+// Writes only the heads whose color changes
+void Intersection::show(uint32_t green, uint32_t yellow) {
+  uint32_t changed = (green ^ _green) | (yellow ^ _yellow);
+  _green = green;
+  _yellow = yellow;
+
+  GpioBatch batch(_port);
+  while (changed) {
+    uint8_t h = __builtin_ctz(changed);
+    changed &= changed - 1;
+    _heads[h]->setLight(headState(h));
+  }
+}
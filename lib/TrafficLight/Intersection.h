@@ -0,0 +1,86 @@
+#ifndef INTERSECTION_H
+#define INTERSECTION_H
+
+#include "TrafficLight.h"
+
+// Heads per intersection, one bit each in the masks below
+#define INTERSECTION_MAX_HEADS 32
+
+// Longest green, yellow or all-red; begin() refuses a table with more
+#define INTERSECTION_MAX_INTERVAL_MS 3600000UL // An hour
+
+// One phase: the heads that get green together, and how long it runs.
+// After the green, heads that don't carry on into the next phase show
+// yellow, then everything that stops stays red for the clearance time
+// before the next phase starts. Times are in milliseconds.
+struct IntersectionPhase {
+  uint32_t green;
+  uint32_t greenMs;
+  uint32_t yellowMs;
+  uint32_t allRedMs;
+};
+
+enum IntersectionInterval {
+  INTERVAL_GREEN,
+  INTERVAL_YELLOW,
+  INTERVAL_ALL_RED
+};
+
+// Drives N TrafficLight heads through a phase table. conflicts[h] has a
+// bit set for every head that must never be green or yellow together
+// with head h. The table is checked once in begin(); tick() is a single
+// comparison until an interval ends, and then only the heads that change
+// are written. Heads' own update() must not be called. Nothing is
+// allocated: the heads, phases and conflict matrix stay with the caller.
+// Given the port the heads are on, every change goes out as one batch,
+// so the lamps never pass through a state between two intervals.
+class Intersection {
+public:
+  Intersection(TrafficLight *const *heads, uint8_t headCount, const IntersectionPhase *phases, uint8_t phaseCount,
+               const uint32_t *conflicts, GpioPort *port = nullptr);
+
+  // All red, then the first phase from nowMs. Returns false, and keeps
+  // everything red, if a phase has conflicting heads green together or
+  // an interval longer than INTERSECTION_MAX_INTERVAL_MS
+  bool begin(unsigned long nowMs);
+
+  // Call this in loop; true when the lights changed
+  bool tick(unsigned long nowMs);
+
+  // When the current interval ends
+  unsigned long nextChange() const { return _intervalStart + _intervalLength; }
+
+  uint8_t phase() const { return _phase; }
+  IntersectionInterval interval() const { return _interval; }
+  LightState headState(uint8_t head) const;
+
+  // Heads showing green and yellow
+  uint32_t greenMask() const { return _green; }
+  uint32_t yellowMask() const { return _yellow; }
+
+  // Phases started since begin()
+  uint32_t phaseCount() const { return _phasesRun; }
+
+private:
+  bool validate() const;
+  void advance();
+  void show(uint32_t green, uint32_t yellow);
+
+  TrafficLight *const *_heads;
+  uint8_t _headCount;
+  const IntersectionPhase *_phases;
+  uint8_t _phaseCount;
+  const uint32_t *_conflicts;
+  GpioPort *_port;
+
+  bool _running;
+  uint8_t _phase;
+  IntersectionInterval _interval;
+  unsigned long _intervalStart;
+  unsigned long _intervalLength;
+  uint32_t _green;
+  uint32_t _yellow;
+  uint32_t _phasesRun;
+};
+
+#endif // INTERSECTION_H
@@ -0,0 +1,43 @@
+#if !defined(ARDUINO)
+
+#include "RecordingGpioPort.h"
+
+#include <Arduino.h>
+
+RecordingGpioPort::RecordingGpioPort() : _dropped(0), _registerWrites(0) { clearHistory(); }
+
+void RecordingGpioPort::begin(uint32_t pins) {
+  resetLevels(pins);
+  for (uint8_t pin = 0; pin < 32; pin++) {
+    if (pins & (1UL << pin)) digitalWrite(pin, LOW);
+  }
+}
+
+void RecordingGpioPort::clearHistory() {
+  _first = 0;
+  _count = 0;
+  _dropped = 0;
+}
+
+void RecordingGpioPort::writeRegisters(uint32_t set, uint32_t clear) {
+  // levels() is already the end state
+  if (set) record(levels() | clear);
+  if (clear) record(levels());
+
+  for (uint8_t pin = 0; pin < 32; pin++) {
+    if ((set | clear) & (1UL << pin)) digitalWrite(pin, (set >> pin) & 1 ? HIGH : LOW);
+  }
+}
+
+void RecordingGpioPort::record(uint32_t levels) {
+  _registerWrites++;
+  if (_count == RECORDING_GPIO_HISTORY) {
+    _first = (_first + 1) % RECORDING_GPIO_HISTORY;
+    _count--;
+    _dropped++;
+  }
+  _history[(_first + _count) % RECORDING_GPIO_HISTORY] = levels;
+  _count++;
+}
+
+#endif // !ARDUINO
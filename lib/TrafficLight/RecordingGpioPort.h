@@ -0,0 +1,45 @@
+#ifndef RECORDING_GPIO_PORT_H
+#define RECORDING_GPIO_PORT_H
+
+#if !defined(ARDUINO)
+
+#include "GpioPort.h"
+
+// Register writes kept between clearHistory() calls
+#define RECORDING_GPIO_HISTORY 256
+
+// Host backend. Keeps the pin levels after every register write, which
+// is every state the LEDs pass through, however briefly, so a test can
+// check each one. Pins are mirrored to the host digitalRead().
+class RecordingGpioPort : public GpioPort {
+public:
+  RecordingGpioPort();
+
+  void begin(uint32_t pins) override;
+
+  // Levels after each register write since clearHistory(); once it is
+  // full the oldest are dropped and counted
+  uint16_t historySize() const { return _count; }
+  uint32_t history(uint16_t i) const { return _history[(_first + i) % RECORDING_GPIO_HISTORY]; }
+  uint32_t dropped() const { return _dropped; }
+  void clearHistory();
+
+  uint32_t registerWrites() const { return _registerWrites; }
+  void resetStats() { _registerWrites = 0; }
+
+protected:
+  void writeRegisters(uint32_t set, uint32_t clear) override;
+
+private:
+  void record(uint32_t levels);
+
+  uint32_t _history[RECORDING_GPIO_HISTORY];
+  uint16_t _first;
+  uint16_t _count;
+  uint32_t _dropped;
+  uint32_t _registerWrites;
+};
+
+#endif // !ARDUINO
+
+#endif // RECORDING_GPIO_PORT_H
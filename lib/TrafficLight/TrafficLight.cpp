@@ -2,27 +2,38 @@
 
 // TrafficLight implementation
 
-TrafficLight::TrafficLight(int redPin, int yellowPin, int greenPin) {
+TrafficLight::TrafficLight(int redPin, int yellowPin, int greenPin, GpioPort *port, Clock *clock) {
   _pins[0] = redPin;
   _pins[1] = yellowPin;
   _pins[2] = greenPin;
+  _port = port;
+  _clock = clock ? clock : &systemClock();
   
-  for (int i = 0; i < 3; i++) {
-    pinMode(_pins[i], OUTPUT);
-    digitalWrite(_pins[i], LOW);
+  if (_port) {
+    _port->begin(pinMask());
+  } else {
+    for (int i = 0; i < 3; i++) {
+      pinMode(_pins[i], OUTPUT);
+      digitalWrite(_pins[i], LOW);
+    }
   }
   
   _currentState = RED;
-  digitalWrite(_pins[0], HIGH); // Start with red
+  // Start with red
+  if (_port) {
+    _port->write(pinMask(), lampMask(RED));
+  } else {
+    digitalWrite(_pins[0], HIGH);
+  }
   
-  _lastChangeTime = millis();
+  _lastChangeTime = _clock->nowMs();
   _redTime = 5000;
   _yellowTime = 2000;
   _greenTime = 5000;
 }
 
 void TrafficLight::update() {
-  unsigned long currTime = millis();
+  unsigned long currTime = _clock->nowMs();
   unsigned long elapsedTime = currTime - _lastChangeTime;
   
   switch (_currentState) {
@@ -47,26 +58,20 @@ void TrafficLight::update() {
 }
 
 void TrafficLight::setLight(LightState state) {
-  // Reset lights
-  for (int i = 0; i < 3; i++) {
-    digitalWrite(_pins[i], LOW);
-  }
-  
-  // Activate selected light
-  switch (state) {
-    case RED:
-      digitalWrite(_pins[0], HIGH);
-      break;
-    case YELLOW:
-      digitalWrite(_pins[1], HIGH);
-      break;
-    case GREEN:
-      digitalWrite(_pins[2], HIGH);
-      break;
+  if (_port) {
+    // All three lamps in one write
+    _port->write(pinMask(), lampMask(state));
+  } else {
+    // Selected light on before the others go off, so the head is never
+    // dark in between
+    digitalWrite(_pins[state], HIGH);
+    for (int i = 0; i < 3; i++) {
+      if (i != state) digitalWrite(_pins[i], LOW);
+    }
   }
   
   _currentState = state;
-  _lastChangeTime = millis();
+  _lastChangeTime = _clock->nowMs();
 }
 
 void TrafficLight::setTiming(unsigned long redTime, unsigned long yellowTime, unsigned long greenTime) {
@@ -80,5 +85,9 @@ LightState TrafficLight::getCurrentState() {
 }
 
 unsigned long TrafficLight::getTimeInCurrentState() {
-  return millis() - _lastChangeTime;
+  return _clock->nowMs() - _lastChangeTime;
+}
+
+uint32_t TrafficLight::pinMask() const {
+  return lampMask(RED) | lampMask(YELLOW) | lampMask(GREEN);
 }
\ No newline at end of file
@@ -3,6 +3,9 @@
 
 #include <Arduino.h>
 
+#include "Clock.h"
+#include "GpioPort.h"
+
 // Light states
 enum LightState {
   RED,
@@ -12,8 +15,10 @@ enum LightState {
 
 class TrafficLight {
 public:
-  // Setup with RGB pins
-  TrafficLight(int redPin, int yellowPin, int greenPin);
+  // Setup with RGB pins. Through a port the pins must be below 32, and
+  // all three lamps change in one write. Timing is on the system clock
+  // unless given another.
+  TrafficLight(int redPin, int yellowPin, int greenPin, GpioPort *port = nullptr, Clock *clock = nullptr);
   
   // Call this in loop
   void update();
@@ -29,9 +34,15 @@ public:
   
   // Time in current state
   unsigned long getTimeInCurrentState();
+
+  // Port bits of the three lamps, and of the one lit in a state
+  uint32_t pinMask() const;
+  uint32_t lampMask(LightState state) const { return 1UL << _pins[state]; }
   
 private:
-  int _pins[3]; // RGB pin array
+  int _pins[3]; // RGB pin array, indexed by LightState
+  GpioPort *_port;
+  Clock *_clock;
   LightState _currentState;
   unsigned long _lastChangeTime;
   unsigned long _redTime;
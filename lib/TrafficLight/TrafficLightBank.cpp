@@ -0,0 +1,76 @@
+#include "TrafficLightBank.h"
+
+// TrafficLightBank implementation
+
+namespace {
+
+// No branches: every array is read and written for every light, and
+// each choice is a mask, all ones or all zeros. LightState counts RED,
+// YELLOW, GREEN, so a light steps down one, or from RED up two. The
+// native build adds -ftree-vectorize, without which -O2 leaves loops
+// with a remainder scalar.
+uint32_t step(size_t count, uint32_t now, uint32_t *__restrict states, uint32_t *__restrict lastChange,
+              uint32_t *__restrict durations, const uint32_t *__restrict redTimes,
+              const uint32_t *__restrict yellowTimes, const uint32_t *__restrict greenTimes) {
+  uint32_t changed = 0;
+  for (size_t i = 0; i < count; i++) {
+    uint32_t state = states[i];
+    uint32_t last = lastChange[i];
+    uint32_t due = 0u - (uint32_t)((uint32_t)(now - last) >= durations[i]);
+    uint32_t red = 0u - (uint32_t)(state == RED);
+    uint32_t next = state + (due & ((red & 3) - 1));
+    states[i] = next;
+    lastChange[i] = (last & ~due) | (now & due);
+    durations[i] = (redTimes[i] & (0u - (uint32_t)(next == RED))) |
+                   (yellowTimes[i] & (0u - (uint32_t)(next == YELLOW))) |
+                   (greenTimes[i] & (0u - (uint32_t)(next == GREEN)));
+    changed += due & 1;
+  }
+  return changed;
+}
+
+} // namespace
+
+TrafficLightBank::TrafficLightBank(uint32_t *states, uint32_t *lastChange, uint32_t *durations, uint32_t *redTimes,
+                                   uint32_t *yellowTimes, uint32_t *greenTimes, size_t capacity)
+    : _states(states), _lastChange(lastChange), _durations(durations), _redTimes(redTimes),
+      _yellowTimes(yellowTimes), _greenTimes(greenTimes), _capacity(capacity), _size(0) {}
+
+int TrafficLightBank::add(unsigned long nowMs) {
+  if (_size == _capacity) return -1;
+  size_t light = _size++;
+  _redTimes[light] = 5000;
+  _yellowTimes[light] = 2000;
+  _greenTimes[light] = 5000;
+  setLight(light, RED, nowMs);
+  return (int)light;
+}
+
+size_t TrafficLightBank::tick(unsigned long nowMs) {
+  return step(_size, nowMs, _states, _lastChange, _durations, _redTimes, _yellowTimes, _greenTimes);
+}
+
+void TrafficLightBank::setLight(size_t light, LightState state, unsigned long nowMs) {
+  _states[light] = state;
+  _lastChange[light] = nowMs;
+  _durations[light] = duration(light, state);
+}
+
+void TrafficLightBank::setTiming(size_t light, unsigned long redTime, unsigned long yellowTime,
+                                 unsigned long greenTime) {
+  _redTimes[light] = redTime;
+  _yellowTimes[light] = yellowTime;
+  _greenTimes[light] = greenTime;
+  _durations[light] = duration(light, _states[light]);
+}
+
+uint32_t TrafficLightBank::duration(size_t light, uint32_t state) const {
+  switch (state) {
+    case RED:
+      return _redTimes[light];
+    case YELLOW:
+      return _yellowTimes[light];
+    default:
+      return _greenTimes[light];
+  }
+}
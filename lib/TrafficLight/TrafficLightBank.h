@@ -0,0 +1,67 @@
+#ifndef TRAFFIC_LIGHT_BANK_H
+#define TRAFFIC_LIGHT_BANK_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include "TrafficLight.h"
+
+// Many free-running lights as a struct of arrays, for simulating a whole
+// corridor or city on the host. tick() moves every light on exactly as
+// TrafficLight::update() would at the same time: RED to GREEN after the
+// red time, GREEN to YELLOW after the green time, YELLOW to RED after the
+// yellow time, at most one step a tick, the new state timed from the
+// tick. The pass has no branches, so the compiler vectorizes it. Lights
+// only hold state: there are no pins. Times are 32-bit and wrap as
+// millis() does on the board. Nothing is allocated: the arrays belong to
+// the caller, or to a StaticTrafficLightBank.
+class TrafficLightBank {
+public:
+  // Each array holds capacity lights
+  TrafficLightBank(uint32_t *states, uint32_t *lastChange, uint32_t *durations, uint32_t *redTimes,
+                   uint32_t *yellowTimes, uint32_t *greenTimes, size_t capacity);
+
+  // A new light, red from nowMs, with TrafficLight's default timing
+  // unless set. Returns its index, or -1 when the bank is full
+  int add(unsigned long nowMs);
+  void clear() { _size = 0; }
+
+  // Moves every light on; returns how many changed
+  size_t tick(unsigned long nowMs);
+
+  void setLight(size_t light, LightState state, unsigned long nowMs);
+  void setTiming(size_t light, unsigned long redTime, unsigned long yellowTime, unsigned long greenTime);
+
+  LightState state(size_t light) const { return (LightState)_states[light]; }
+  unsigned long timeInState(size_t light, unsigned long nowMs) const {
+    return (uint32_t)((uint32_t)nowMs - _lastChange[light]);
+  }
+
+  size_t size() const { return _size; }
+  size_t capacity() const { return _capacity; }
+
+private:
+  uint32_t duration(size_t light, uint32_t state) const;
+
+  uint32_t *_states;     // LightState
+  uint32_t *_lastChange; // Start of the current state
+  uint32_t *_durations;  // Of the current state, so tick() needn't pick
+  uint32_t *_redTimes;
+  uint32_t *_yellowTimes;
+  uint32_t *_greenTimes;
+  size_t _capacity;
+  size_t _size;
+};
+
+// Bank with its own storage, for statics
+template <size_t N>
+class StaticTrafficLightBank : public TrafficLightBank {
+public:
+  StaticTrafficLightBank()
+      : TrafficLightBank(_storage[0], _storage[1], _storage[2], _storage[3], _storage[4], _storage[5], N) {}
+
+private:
+  uint32_t _storage[6][N];
+};
+
+#endif // TRAFFIC_LIGHT_BANK_H
@@ -0,0 +1,233 @@
+#include "TrafficSim.h"
+
+#include <math.h>
+
+// TrafficSim implementation
+
+namespace {
+
+bool reached(unsigned long nowMs, unsigned long ms) { return (long)(nowMs - ms) >= 0; }
+
+} // namespace
+
+TrafficSim::Approach::Approach()
+    : sim(nullptr), index(0), head(0), meanGapMs(0), green(false), dischargeFrom(0),
+      arrival("arrival", TrafficSim::onArrival, this), discharge("discharge", TrafficSim::onDischarge, this),
+      stats(), queueChanged(0), queueFirst(0) {}
+
+TrafficSim::TrafficSim(Intersection &intersection, ManualClock &clock, const SimApproach *approaches,
+                       uint8_t approachCount, SpeedDetector *detector, float sensorGapM, uint32_t seed)
+    : _intersection(intersection), _clock(clock), _detector(detector), _sensorGap(sensorGapM), _rng(seed ? seed : 1),
+      _signal("signal", onSignal, this), _sample("sample", onSample, this),
+      _approachCount(approachCount < TRAFFIC_SIM_MAX_APPROACHES ? approachCount : TRAFFIC_SIM_MAX_APPROACHES),
+      _passFirst(0), _passCount(0), _measuringKmh(0), _cycles(), _speed(), _cycleStart(0), _events(0) {
+  for (uint8_t a = 0; a < _approachCount; a++) {
+    Approach &approach = _approaches[a];
+    approach.sim = this;
+    approach.index = a;
+    approach.head = approaches[a].head;
+    approach.meanGapMs = approaches[a].vehiclesPerHour ? 3600000UL / approaches[a].vehiclesPerHour : 0;
+  }
+}
+
+bool TrafficSim::begin() {
+  unsigned long now = _clock.nowMs();
+  _wheel.begin(now);
+  if (!_intersection.begin(now)) return false;
+  _wheel.schedule(_signal, _intersection.nextChange());
+  _cycleStart = now;
+
+  for (uint8_t a = 0; a < _approachCount; a++) {
+    Approach &approach = _approaches[a];
+    approach.green = _intersection.headState(approach.head) == GREEN;
+    approach.dischargeFrom = now + TRAFFIC_SIM_STARTUP_MS;
+    approach.queueChanged = now;
+    if (approach.meanGapMs) _wheel.schedule(approach.arrival, now + randomGap(approach.meanGapMs));
+  }
+  return true;
+}
+
+void TrafficSim::run(unsigned long durationMs) {
+  unsigned long end = _clock.nowMs() + durationMs;
+
+  // Straight from one event to the next
+  unsigned long next;
+  while (_wheel.nextDeadline(next) && reached(end, next)) {
+    if (!reached(_clock.nowMs(), next)) _clock.set(next);
+    _events += _wheel.run(_clock.nowMs());
+  }
+  _clock.set(end);
+
+  // Queue lengths up to the end
+  for (uint8_t a = 0; a < _approachCount; a++) setQueue(_approaches[a], end, 0);
+}
+
+void TrafficSim::onArrival(Timer &timer, unsigned long nowMs) {
+  Approach &approach = *(Approach *)timer.context();
+  approach.sim->arrive(approach, nowMs);
+}
+
+void TrafficSim::onDischarge(Timer &timer, unsigned long nowMs) {
+  Approach &approach = *(Approach *)timer.context();
+  approach.sim->dischargeNext(approach, nowMs);
+}
+
+void TrafficSim::onSignal(Timer &timer, unsigned long nowMs) { ((TrafficSim *)timer.context())->signal(nowMs); }
+
+void TrafficSim::onSample(Timer &timer, unsigned long nowMs) { ((TrafficSim *)timer.context())->sample(nowMs); }
+
+void TrafficSim::arrive(Approach &approach, unsigned long nowMs) {
+  SimApproachStats &stats = approach.stats;
+  stats.arrivals++;
+  _wheel.schedule(approach.arrival, nowMs + randomGap(approach.meanGapMs));
+
+  // Green with nobody waiting: straight through
+  if (approach.green && stats.queue == 0 && reached(nowMs, approach.dischargeFrom)) {
+    depart(approach, nowMs, nowMs);
+    return;
+  }
+
+  if (stats.queue == TRAFFIC_SIM_MAX_QUEUE) {
+    stats.dropped++;
+    return;
+  }
+  approach.queue[(approach.queueFirst + stats.queue) % TRAFFIC_SIM_MAX_QUEUE] = nowMs;
+  setQueue(approach, nowMs, 1);
+  stats.stopped++;
+
+  if (approach.green && !approach.discharge.isPending()) {
+    _wheel.schedule(approach.discharge, reached(nowMs, approach.dischargeFrom) ? nowMs : approach.dischargeFrom);
+  }
+}
+
+// Front of the queue leaves, and the next one follows a headway later
+void TrafficSim::dischargeNext(Approach &approach, unsigned long nowMs) {
+  if (!approach.green || approach.stats.queue == 0) return;
+
+  unsigned long arrivedMs = approach.queue[approach.queueFirst];
+  approach.queueFirst = (approach.queueFirst + 1) % TRAFFIC_SIM_MAX_QUEUE;
+  setQueue(approach, nowMs, -1);
+  depart(approach, nowMs, arrivedMs);
+
+  approach.dischargeFrom = nowMs + TRAFFIC_SIM_HEADWAY_MS;
+  if (approach.stats.queue > 0) _wheel.schedule(approach.discharge, approach.dischargeFrom);
+}
+
+void TrafficSim::depart(Approach &approach, unsigned long nowMs, unsigned long arrivedMs) {
+  SimApproachStats &stats = approach.stats;
+  unsigned long wait = nowMs - arrivedMs;
+  stats.departures++;
+  stats.totalWaitMs += wait;
+  if (wait > stats.maxWaitMs) stats.maxWaitMs = wait;
+
+  if (approach.index == 0 && _detector) addPass(nowMs);
+}
+
+void TrafficSim::setQueue(Approach &approach, unsigned long nowMs, int change) {
+  SimApproachStats &stats = approach.stats;
+  stats.queueMs += (uint64_t)stats.queue * (nowMs - approach.queueChanged);
+  approach.queueChanged = nowMs;
+  stats.queue += change;
+  if (stats.queue > stats.maxQueue) stats.maxQueue = stats.queue;
+}
+
+void TrafficSim::addPass(unsigned long nowMs) {
+  _speed.vehicles++;
+  if (_passCount == TRAFFIC_SIM_MAX_PASSES) return;
+
+  float kmh = TRAFFIC_SIM_MIN_KMH + (TRAFFIC_SIM_MAX_KMH - TRAFFIC_SIM_MIN_KMH) * (random() / 16777216.0f);
+  float metresPerMs = kmh / 3600.0f;
+  Pass &pass = _passes[(_passFirst + _passCount++) % TRAFFIC_SIM_MAX_PASSES];
+  pass.sensor1 = nowMs;
+  pass.sensor2 = nowMs + (unsigned long)lroundf(_sensorGap / metresPerMs);
+  pass.lengthMs = (unsigned long)lroundf(TRAFFIC_SIM_VEHICLE_M / metresPerMs);
+  pass.kmh = kmh;
+
+  if (!_sample.isPending()) _wheel.schedule(_sample, nowMs);
+}
+
+void TrafficSim::signal(unsigned long nowMs) {
+  _intersection.tick(nowMs);
+  _wheel.schedule(_signal, _intersection.nextChange());
+
+  for (uint8_t a = 0; a < _approachCount; a++) {
+    Approach &approach = _approaches[a];
+    bool green = _intersection.headState(approach.head) == GREEN;
+    if (green && !approach.green) {
+      approach.green = true;
+      approach.dischargeFrom = nowMs + TRAFFIC_SIM_STARTUP_MS;
+      if (approach.stats.queue > 0) _wheel.schedule(approach.discharge, approach.dischargeFrom);
+    } else if (!green && approach.green) {
+      approach.green = false;
+      _wheel.cancel(approach.discharge);
+    }
+  }
+
+  if (_intersection.phase() == 0 && _intersection.interval() == INTERVAL_GREEN) {
+    uint32_t length = nowMs - _cycleStart;
+    if (_cycles.cycles == 0 || length < _cycles.minMs) _cycles.minMs = length;
+    if (length > _cycles.maxMs) _cycles.maxMs = length;
+    _cycles.totalMs += length;
+    _cycles.cycles++;
+    _cycleStart = nowMs;
+  }
+}
+
+// One reading of both sensors, as the firmware's speed timer takes it
+void TrafficSim::sample(unsigned long nowMs) {
+  while (_passCount > 0) {
+    const Pass &pass = _passes[_passFirst];
+    if (!reached(nowMs, pass.sensor2 + pass.lengthMs)) break;
+    _passFirst = (_passFirst + 1) % TRAFFIC_SIM_MAX_PASSES;
+    _passCount--;
+  }
+
+  int sensor1 = 0, sensor2 = 0;
+  float onSensor1 = 0;
+  for (uint8_t i = 0; i < _passCount; i++) {
+    const Pass &pass = _passes[(_passFirst + i) % TRAFFIC_SIM_MAX_PASSES];
+    if (reached(nowMs, pass.sensor1) && !reached(nowMs, pass.sensor1 + pass.lengthMs)) {
+      sensor1 = 4095;
+      if (onSensor1 == 0) onSensor1 = pass.kmh;
+    }
+    if (reached(nowMs, pass.sensor2) && !reached(nowMs, pass.sensor2 + pass.lengthMs)) sensor2 = 4095;
+  }
+
+  switch (_detector->update(sensor1, sensor2)) {
+    case SPEED_FIRST_SENSOR:
+      _measuringKmh = onSensor1;
+      break;
+    case SPEED_MEASURED: {
+      float error = fabsf(_detector->speed() * 3.6f - _measuringKmh);
+      _speed.measured++;
+      _speed.totalErrorKmh += error;
+      if (error > _speed.maxErrorKmh) _speed.maxErrorKmh = error;
+      break;
+    }
+    case SPEED_TIMED_OUT:
+      _speed.timedOut++;
+      break;
+    case SPEED_NO_EVENT:
+      break;
+  }
+
+  // Like the firmware, nothing is read through the cooldown; with
+  // nothing near the sensors the next departure starts sampling again
+  if (_detector->state() == COOLDOWN) {
+    _wheel.schedule(_sample, _detector->cooldownEnd());
+  } else if (_passCount > 0 || _detector->state() == WAITING_FOR_SECOND_SENSOR) {
+    _wheel.schedule(_sample, nowMs + TRAFFIC_SIM_SAMPLE_MS);
+  }
+}
+
+unsigned long TrafficSim::randomGap(unsigned long meanMs) {
+  // Exponential gaps: arrivals at random, meanMs apart on average
+  double u = (random() + 1.0) / 16777217.0;
+  unsigned long gap = (unsigned long)(-log(u) * meanMs);
+  return gap > 0 ? gap : 1;
+}
+
+uint32_t TrafficSim::random() {
+  _rng = _rng * 1664525u + 1013904223u;
+  return _rng >> 8;
+}
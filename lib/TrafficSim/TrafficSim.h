@@ -0,0 +1,148 @@
+#ifndef TRAFFIC_SIM_H
+#define TRAFFIC_SIM_H
+
+#include "Clock.h"
+#include "Intersection.h"
+#include "SpeedDetector.h"
+#include "TimerWheel.h"
+
+#define TRAFFIC_SIM_MAX_APPROACHES 8
+#define TRAFFIC_SIM_MAX_QUEUE 1024 // Vehicles waiting on one approach
+#define TRAFFIC_SIM_MAX_PASSES 16  // Vehicles over the speed sensors
+
+// Queue discharge: the first vehicle leaves this long after the green
+// starts, the rest one headway apart
+#define TRAFFIC_SIM_STARTUP_MS 2000
+#define TRAFFIC_SIM_HEADWAY_MS 2000
+
+// Vehicles leaving approach 0 drive over the speed sensors at a random
+// speed in this range
+#define TRAFFIC_SIM_MIN_KMH 30
+#define TRAFFIC_SIM_MAX_KMH 60
+#define TRAFFIC_SIM_VEHICLE_M 4.5f
+#define TRAFFIC_SIM_SAMPLE_MS 1 // As the firmware samples them
+
+// One road into the intersection: the head it waits at, and how many
+// vehicles turn up an hour, at random
+struct SimApproach {
+  uint8_t head;
+  uint32_t vehiclesPerHour;
+};
+
+struct SimApproachStats {
+  uint32_t arrivals;
+  uint32_t departures;
+  uint32_t stopped;     // Had to queue
+  uint64_t totalWaitMs; // Over every departure, queued or not
+  uint32_t maxWaitMs;
+  uint64_t queueMs;     // Queue length integrated over time
+  uint16_t maxQueue;
+  uint16_t queue;       // Right now
+  uint32_t dropped;     // Arrivals with the queue full
+};
+
+struct SimCycleStats {
+  uint32_t cycles; // Whole cycles, first phase green to first phase green
+  uint32_t minMs;
+  uint32_t maxMs;
+  uint64_t totalMs;
+};
+
+struct SimSpeedStats {
+  uint32_t vehicles; // Over the sensors
+  uint32_t measured;
+  uint32_t timedOut;
+  double totalErrorKmh; // Absolute, against the true speed
+  float maxErrorKmh;
+};
+
+// Discrete-event simulation around the firmware's own controller code.
+// The Intersection runs the lights and, if given, a SpeedDetector watches
+// approach 0; both read the ManualClock, which jumps from one event to
+// the next on a TimerWheel. Vehicles arrive at random, queue on red and
+// leave one headway apart on green, so an hour of traffic takes a few
+// milliseconds. The heads and the detector belong to the caller.
+class TrafficSim {
+public:
+  TrafficSim(Intersection &intersection, ManualClock &clock, const SimApproach *approaches, uint8_t approachCount,
+             SpeedDetector *detector = nullptr, float sensorGapM = 0.5f, uint32_t seed = 1);
+
+  // Starts the intersection at the clock's time; false if it refused
+  bool begin();
+
+  // Runs on for durationMs of simulated time
+  void run(unsigned long durationMs);
+
+  uint8_t approachCount() const { return _approachCount; }
+  const SimApproachStats &approachStats(uint8_t approach) const { return _approaches[approach].stats; }
+  const SimCycleStats &cycleStats() const { return _cycles; }
+  const SimSpeedStats &speedStats() const { return _speed; }
+  uint32_t events() const { return _events; }
+
+private:
+  struct Approach {
+    Approach();
+
+    TrafficSim *sim;
+    uint8_t index;
+    uint8_t head;
+    unsigned long meanGapMs;
+    bool green;
+    unsigned long dischargeFrom; // Earliest the next queued vehicle can go
+    Timer arrival;
+    Timer discharge;
+    SimApproachStats stats;
+    unsigned long queueChanged;
+    unsigned long queue[TRAFFIC_SIM_MAX_QUEUE]; // Arrival times, a ring
+    uint16_t queueFirst;
+  };
+
+  // A vehicle over the speed sensors: each reads high from its start for
+  // the time the vehicle takes to pass
+  struct Pass {
+    unsigned long sensor1;
+    unsigned long sensor2;
+    unsigned long lengthMs;
+    float kmh;
+  };
+
+  static void onArrival(Timer &timer, unsigned long nowMs);
+  static void onDischarge(Timer &timer, unsigned long nowMs);
+  static void onSignal(Timer &timer, unsigned long nowMs);
+  static void onSample(Timer &timer, unsigned long nowMs);
+
+  void arrive(Approach &approach, unsigned long nowMs);
+  void depart(Approach &approach, unsigned long nowMs, unsigned long arrivedMs);
+  void dischargeNext(Approach &approach, unsigned long nowMs);
+  void setQueue(Approach &approach, unsigned long nowMs, int change);
+  void addPass(unsigned long nowMs);
+  void signal(unsigned long nowMs);
+  void sample(unsigned long nowMs);
+
+  unsigned long randomGap(unsigned long meanMs);
+  uint32_t random();
+
+  Intersection &_intersection;
+  ManualClock &_clock;
+  SpeedDetector *_detector;
+  float _sensorGap;
+  uint32_t _rng;
+
+  TimerWheel _wheel;
+  Timer _signal;
+  Timer _sample;
+
+  Approach _approaches[TRAFFIC_SIM_MAX_APPROACHES];
+  uint8_t _approachCount;
+
+  Pass _passes[TRAFFIC_SIM_MAX_PASSES];
+  uint8_t _passFirst, _passCount;
+  float _measuringKmh; // True speed of what the detector is timing
+
+  SimCycleStats _cycles;
+  SimSpeedStats _speed;
+  unsigned long _cycleStart;
+  uint32_t _events;
+};
+
+#endif // TRAFFIC_SIM_H
@@ -0,0 +1,45 @@
+#ifndef TRIPLE_BUFFER_H
+#define TRIPLE_BUFFER_H
+
+#include <atomic>
+#include <stdint.h>
+#include <type_traits>
+
+// Lock-free handoff of the latest value from one producer to one consumer,
+// e.g. between tasks on the two ESP32 cores. The producer owns one slot,
+// the consumer another, and the third sits between them: publishing swaps
+// the producer's slot into the middle, consuming swaps the middle out if
+// it is newer. Neither side waits, neither sees a half-written value, and
+// values the consumer is too slow for are dropped, not queued.
+template <typename T>
+class TripleBuffer {
+  static_assert(std::is_trivially_copyable<T>::value, "slots are copied while the other side runs");
+
+public:
+  TripleBuffer() : _write(0), _middle(1), _read(2) {}
+
+  // Producer side
+  void publish(const T &value) {
+    _slots[_write] = value;
+    _write = _middle.exchange(_write | kFresh, std::memory_order_acq_rel) & kIndex;
+  }
+
+  // Consumer side; false if nothing was published since the last call
+  bool consume(T &out) {
+    if (!(_middle.load(std::memory_order_relaxed) & kFresh)) return false;
+    _read = _middle.exchange(_read, std::memory_order_acq_rel) & kIndex;
+    out = _slots[_read];
+    return true;
+  }
+
+private:
+  static const uint32_t kIndex = 3;
+  static const uint32_t kFresh = 4; // Middle slot holds an unread value
+
+  T _slots[3];
+  uint32_t _write;               // Producer only
+  std::atomic<uint32_t> _middle; // 32 bits: lock-free on Xtensa
+  uint32_t _read;                // Consumer only
+};
+
+#endif // TRIPLE_BUFFER_H
@@ -1,202 +1,363 @@
 #include "displayFunctions.h"
 
-// Software-defined SPI
-Adafruit_ILI9341 tft = Adafruit_ILI9341(TFT_CS, TFT_DC, TFT_MOSI, TFT_CLK, TFT_RST, TFT_MISO);
+#include <type_traits>
+
+#include "RenderTrace.h"
+
+// Hardware SPI with DMA. Write-only, so MISO stays free (GPIO19 drives
+// red light 1); host builds record the byte stream instead.
+#if defined(ESP32)
+Esp32SpiBus displayBus(TFT_CS, TFT_DC, TFT_MOSI, TFT_CLK, -1, TFT_SPI_FREQ);
+#else
+RecordingBus displayBus;
+#endif
+Ili9341Panel tft(displayBus, TFT_RST);
+
+// Double buffered in PSRAM, or direct with damage clearing
+Compositor compositor(tft);
+
+// Current frame's render target
+static Surface *gfx = &tft;
+
+// Screen on the glass, for the in-place updates
+enum ShownScreen { SCREEN_NONE, SCREEN_WEATHER, SCREEN_TIME, SCREEN_POPULATION, SCREEN_SPEED };
+static ShownScreen shownScreen = SCREEN_NONE;
+
+// Pre-scaled glyphs for the large text; colors vary, so give it room
+#define GLYPH_ATLAS_BYTES (96 * 1024)
+static GlyphAtlas glyphs(GLYPH_ATLAS_BYTES, DISPLAY_MEMORY_PSRAM);
+
+static void drawDemoTag(Surface &s) {
+  TRACE_SCOPE("drawDemoTag");
+  s.setTextSize(1);
+  s.setTextColor(ILI9341_YELLOW);
+  s.setCursor(s.width() - 45, 15);
+  s.print("[DEMO]");
+}
+
+static void drawTitle(Surface &s, int16_t x, const char *title, bool demoTag) {
+  TRACE_SCOPE("drawTitle");
+  s.setTextSize(3);
+  s.setTextColor(TITLE_COLOR);
+  s.setCursor(x, 10);
+  s.print(title);
+  if (demoTag) drawDemoTag(s);
+  s.drawLine(20, 50, s.width() - 20, 50, TITLE_COLOR);
+}
+
+static void drawLabel(Surface &s, int16_t x, int16_t y, const char *text) {
+  TRACE_SCOPE("drawLabel");
+  s.setTextSize(2);
+  s.setTextColor(TEXT_COLOR);
+  s.setCursor(x, y);
+  s.print(text);
+}
+
+// Parts of the screens that never change, cached in PSRAM. Only the
+// small ones are: the title bands and the growth label are full-width
+// sprites of 20 KB and more, almost all background, for a few
+// microseconds a mode change (see the layers benchmark). The clock face
+// is one circle, no faster as a sprite.
+static StaticLayer populationLabel(20, 70, 204, 16,
+                                   [](Surface &s) { drawLabel(s, 20, 70, "World Population:"); });
+
+// Sprites only pay off in the frame buffer, where a blit is a memcpy.
+// Straight to the panel it would send every background pixel too.
+static void drawLayer(StaticLayer &layer) {
+  TRACE_SCOPE("drawLayer");
+  if (compositor.hasFrameBuffer() && enableLayerCache) {
+    layer.draw(*gfx, BACKGROUND_COLOR);
+  } else {
+    layer.drawUncached(*gfx);
+  }
+}
 
 // Animation tracking
 float lastHourAngle = 0;
 float lastMinuteAngle = 0;
 float lastSecondAngle = 0;
-float lastSpeedNeedleAngle = -60.0 * PI / 180.0; // Min speed position
+FixedAngle lastSpeedNeedleAngle = degreesToFixedAngle(-60); // Min speed position
 float lastSpeedValue = 0;
 
 // Animation config
 bool enableSmoothAnimations = true;
 
+// Keep static screen parts as sprites when double buffered
+bool enableLayerCache = true;
+
+// Slide screens in on mode changes
+bool enableSlideTransitions = true;
+
+// What the shown screen was drawn from, to draw it again strip by strip
+// while it slides in
+static WeatherData shownWeather;
+static time_t shownTimeValue;
+static unsigned long shownPopulation;
+static unsigned long lastTransitionFrameMs = 0;
+
+static void drawShownScreen(Surface &s);
+
+// A slide in progress runs to the end before the screen changes again
+static void finishTransition() {
+  if (compositor.isSliding()) compositor.slide(BACKGROUND_COLOR, tft.width(), drawShownScreen);
+}
+
+// Slides the new screen in when it replaces another, else draws it in
+// one go; the next animateTransition() calls move it along
+static void showScreen(ShownScreen screen) {
+  bool slide = enableSlideTransitions && shownScreen != SCREEN_NONE && shownScreen != screen;
+  shownScreen = screen;
+  if (slide && compositor.beginSlide()) return;
+  compositor.render(BACKGROUND_COLOR, drawShownScreen);
+}
+
 // Legacy function - kept for compatibility
 void resetDrawFlags() {
   // Retained for API compatibility
 }
 
+// Label and icon of each condition, in WeatherCondition order
+struct WeatherConditionInfo
+{
+  const char *label;
+  void (*drawIcon)(int x, int y);
+};
+
+static constexpr WeatherConditionInfo weatherConditions[] = {
+    {"Sunny", drawSunIcon},
+    {"Cloudy", drawCloudIcon},
+    {"Rain", drawRainIcon},
+};
+static_assert(sizeof(weatherConditions) / sizeof(weatherConditions[0]) == WEATHER_CONDITION_COUNT,
+              "one entry per WeatherCondition");
+static_assert(std::is_trivially_copyable<WeatherData>::value, "WeatherData is copied around freely");
+
+const char *weatherConditionLabel(WeatherCondition condition) {
+  return condition < WEATHER_CONDITION_COUNT ? weatherConditions[condition].label : "?";
+}
+
 // Shows current weather with temp, humidity and condition
-void displayWeather(WeatherData weather) {
-  // Clear screen
-  tft.fillScreen(BACKGROUND_COLOR);
-  
-  // Draw title
-  tft.setTextSize(3);
-  tft.setTextColor(TITLE_COLOR);
-  tft.setCursor(20, 10);
-  tft.println("Weather Info");
+static void drawWeatherScreen(const WeatherData &weather) {
+  // Title and underline
+  drawTitle(*gfx, 20, "Weather Info", false);
   
   // Add demo tag if needed
-  if (weather.condition.indexOf("DEMO") >= 0) {
-    tft.setTextSize(1);
-    tft.setTextColor(ILI9341_YELLOW);
-    tft.setCursor(tft.width() - 45, 15);
-    tft.print("[DEMO]");
-    weather.condition.replace("DEMO ", "");
+  if (weather.demo) {
+    drawDemoTag(*gfx);
   }
   
-  // Title underline
-  tft.drawLine(20, 50, tft.width() - 20, 50, TITLE_COLOR);
-  
   // Temp reading
-  tft.setTextSize(2);
-  tft.setTextColor(TEXT_COLOR);
-  tft.setCursor(30, 70);
-  tft.print("Temperature: ");
-  tft.print(weather.temperature, 1);
-  tft.print(" C");
+  char reading[16];
+  formatDecimal(reading, sizeof(reading), weather.temperature, 1, " C");
+  gfx->setTextSize(2);
+  gfx->setTextColor(TEXT_COLOR);
+  gfx->setCursor(30, 70);
+  gfx->print("Temperature: ");
+  gfx->print(reading);
   
   // Humidity reading
-  tft.setCursor(30, 100);
-  tft.print("Humidity: ");
-  tft.print(weather.humidity, 1);
-  tft.print(" %");
+  formatDecimal(reading, sizeof(reading), weather.humidity, 1, " %");
+  gfx->setCursor(30, 100);
+  gfx->print("Humidity: ");
+  gfx->print(reading);
   
   // Weather condition
-  tft.setCursor(30, 130);
-  tft.print("Condition: ");
-  tft.print(weather.condition);
+  gfx->setCursor(30, 130);
+  gfx->print("Condition: ");
+  gfx->print(weatherConditionLabel(weather.condition));
   
   // Weather icon
-  int iconX = tft.width() / 2;
-  int iconY = tft.height() - 50;
-  
-  if (weather.condition.indexOf("Sunny") >= 0) {
-    drawSunIcon(iconX, iconY);
-  } else if (weather.condition.indexOf("Cloudy") >= 0) {
-    drawCloudIcon(iconX, iconY);
-  } else if (weather.condition.indexOf("Rain") >= 0) {
-    drawRainIcon(iconX, iconY);
+  int iconX = gfx->width() / 2;
+  int iconY = gfx->height() - 50;
+  
+  if (weather.condition < WEATHER_CONDITION_COUNT) {
+    weatherConditions[weather.condition].drawIcon(iconX, iconY);
+  }
+}
+
+void displayWeather(const WeatherData &weather) {
+  TRACE_SCOPE("displayWeather");
+  finishTransition();
+  shownWeather = weather;
+  showScreen(SCREEN_WEATHER);
+}
+
+// Analog clock geometry
+#define CLOCK_CENTER_X 100
+#define CLOCK_CENTER_Y 160
+#define CLOCK_RADIUS 55
+
+// Clock readout as it is on the glass
+static char shownTime[8];
+static char shownAmPm[4];
+static char shownDate[12];
+static bool shownDemoTag = false;
+
+static void formatClock(time_t t, char *timeString, char *amPm, char *dateString) {
+  // 12-hour format time
+  int hourValue = hourFormat12(t);
+  if (hourValue == 0) hourValue = 12;
+  size_t n = formatUnsigned(timeString, sizeof(shownTime), hourValue, 2, ' ');
+  n += formatText(timeString + n, sizeof(shownTime) - n, ":");
+  formatUnsigned(timeString + n, sizeof(shownTime) - n, minute(t), 2);
+  formatText(amPm, sizeof(shownAmPm), isPM(t) ? "PM" : "AM");
+  n = formatUnsigned(dateString, sizeof(shownDate), month(t), 2);
+  n += formatText(dateString + n, sizeof(shownDate) - n, "/");
+  n += formatUnsigned(dateString + n, sizeof(shownDate) - n, day(t), 2);
+  n += formatText(dateString + n, sizeof(shownDate) - n, "/");
+  formatUnsigned(dateString + n, sizeof(shownDate) - n, year(t), 4);
+}
+
+static void formatClock(time_t t) { formatClock(t, shownTime, shownAmPm, shownDate); }
+
+static void clockHandAngles(time_t t, float &hourAngle, float &minuteAngle, float &secondAngle) {
+  hourAngle = (hour(t) % 12) * 30 + minute(t) * 0.5;
+  minuteAngle = minute(t) * 6;
+  secondAngle = second(t) * 6;
+}
+
+// All three hands, hour first so the second hand ends up on top. Erasing
+// paints the same triangles in the background color.
+static void drawClockHands(float hourAngle, float minuteAngle, float secondAngle, bool erase) {
+  TRACE_SCOPE("drawClockHands");
+  uint16_t white = erase ? BACKGROUND_COLOR : ILI9341_WHITE;
+  uint16_t red = erase ? BACKGROUND_COLOR : ILI9341_RED;
+  drawClockHand(CLOCK_CENTER_X, CLOCK_CENTER_Y, CLOCK_RADIUS * 0.6, hourAngle, 3, white);
+  drawClockHand(CLOCK_CENTER_X, CLOCK_CENTER_Y, CLOCK_RADIUS * 0.8, minuteAngle, 2, white);
+  drawClockHand(CLOCK_CENTER_X, CLOCK_CENTER_Y, CLOCK_RADIUS * 0.9, secondAngle, 1, red);
+}
+
+// Redraws only the character cells that differ from what is shown
+static void updateText(int16_t x, int16_t y, uint8_t size, const char *text, char *shown) {
+  TRACE_SCOPE("updateText");
+  for (int i = 0; text[i] != '\0'; i++) {
+    if (text[i] != shown[i]) {
+      glyphs.drawChar(*gfx, x + i * 6 * size, y, text[i], size, TEXT_COLOR, BACKGROUND_COLOR);
+      shown[i] = text[i];
+    }
   }
 }
 
 // Shows digital time and analog clock
-void displayTime(time_t t) {
-  // Clear screen
-  tft.fillScreen(BACKGROUND_COLOR);
-  
-  // Draw title
-  tft.setTextSize(3);
-  tft.setTextColor(TITLE_COLOR);
-  tft.setCursor(65, 10);
-  tft.println("Current Time");
+static void drawTimeScreen(time_t t) {
+  // Title and underline
+  drawTitle(*gfx, 65, "Current Time", false);
   
   // Add demo tag if needed
-  if (year(t) == 2023) {
-    tft.setTextSize(1);
-    tft.setTextColor(ILI9341_YELLOW);
-    tft.setCursor(tft.width() - 45, 15);
-    tft.print("[DEMO]");
+  shownDemoTag = year(t) == 2023;
+  if (shownDemoTag) {
+    drawDemoTag(*gfx);
   }
   
-  // Title underline
-  tft.drawLine(20, 50, tft.width() - 20, 50, TITLE_COLOR);
+  // Digital clock, AM/PM and date
+  formatClock(t);
+  gfx->setTextColor(TEXT_COLOR);
+  glyphs.drawText(*gfx, gfx->width() - 140, 70, shownTime, 4, TEXT_COLOR, BACKGROUND_COLOR);
+  gfx->setTextSize(2);
+  gfx->setCursor(gfx->width() - 140, 105);
+  gfx->print(shownAmPm);
+  gfx->setCursor(gfx->width() - 140, 130);
+  gfx->print(shownDate);
   
-  // Clear time area
-  tft.fillRect(tft.width() - 170, 60, 170, 140, BACKGROUND_COLOR);
+  // Analog clock
+  gfx->drawCircle(CLOCK_CENTER_X, CLOCK_CENTER_Y, CLOCK_RADIUS, TITLE_COLOR);
+  clockHandAngles(t, lastHourAngle, lastMinuteAngle, lastSecondAngle);
+  drawClockHands(lastHourAngle, lastMinuteAngle, lastSecondAngle, false);
+}
+
+void displayTime(time_t t) {
+  TRACE_SCOPE("displayTime");
+  finishTransition();
+  shownTimeValue = t;
+  showScreen(SCREEN_TIME);
+}
+
+// Ticks the time screen in place: erases the old hands, draws the new
+// ones and rewrites only the readout characters that changed. In bands
+// there is nothing on the glass to draw over, so the bands from the
+// readout down to the bottom of the dial are redrawn instead.
+void updateTime(time_t t) {
+  TRACE_SCOPE("updateTime");
+  // Ticks resume once the screen has slid in
+  if (compositor.isSliding()) return;
+  if (shownScreen != SCREEN_TIME || (year(t) == 2023) != shownDemoTag) {
+    displayTime(t);
+    return;
+  }
   
-  // Digital clock
-  tft.setTextSize(4);
-  tft.setTextColor(TEXT_COLOR);
-  tft.setCursor(tft.width() - 140, 70);
+  if (compositor.isBanded()) {
+    compositor.renderRows(BACKGROUND_COLOR, 70, CLOCK_CENTER_Y + CLOCK_RADIUS + 1, [&](Surface &s) {
+      gfx = &s;
+      drawTimeScreen(t);
+    });
+    return;
+  }
   
-  // 12-hour format time
-  int hourValue = hourFormat12(t);
-  if (hourValue == 0) hourValue = 12;
-  char timeString[12];
-  sprintf(timeString, "%2d:%02d", hourValue, minute(t));
-  tft.print(timeString);
-  
-  // AM/PM indicator
-  tft.setTextSize(2);
-  tft.setCursor(tft.width() - 140, 105);
-  tft.print(isPM(t) ? "PM" : "AM");
-  
-  // Calendar date
-  tft.setTextSize(2);
-  tft.setCursor(tft.width() - 140, 130);
+  float hourAngle, minuteAngle, secondAngle;
+  clockHandAngles(t, hourAngle, minuteAngle, secondAngle);
+  
+  char timeString[8];
+  char amPm[4];
   char dateString[12];
-  sprintf(dateString, "%02d/%02d/%04d", month(t), day(t), year(t));
-  tft.print(dateString);
+  formatClock(t, timeString, amPm, dateString);
   
-  // Analog clock
-  int clockCenterX = 100;
-  int clockCenterY = 160;
-  int clockRadius = 55;
+  gfx = &compositor.beginUpdate();
   
-  tft.drawCircle(clockCenterX, clockCenterY, clockRadius, TITLE_COLOR);
+  if (hourAngle != lastHourAngle || minuteAngle != lastMinuteAngle || secondAngle != lastSecondAngle) {
+    drawClockHands(lastHourAngle, lastMinuteAngle, lastSecondAngle, true);
+    drawClockHands(hourAngle, minuteAngle, secondAngle, false);
+    lastHourAngle = hourAngle;
+    lastMinuteAngle = minuteAngle;
+    lastSecondAngle = secondAngle;
+  }
   
-  // Hand angles
-  float hourAngle = (hour(t) % 12) * 30 + minute(t) * 0.5;
-  float minuteAngle = minute(t) * 6;
-  float secondAngle = second(t) * 6;
+  updateText(gfx->width() - 140, 70, 4, timeString, shownTime);
+  updateText(gfx->width() - 140, 105, 2, amPm, shownAmPm);
+  updateText(gfx->width() - 140, 130, 2, dateString, shownDate);
   
-  // Clock hands
-  drawClockHand(clockCenterX, clockCenterY, clockRadius * 0.6, hourAngle, 3, ILI9341_WHITE);
-  drawClockHand(clockCenterX, clockCenterY, clockRadius * 0.8, minuteAngle, 2, ILI9341_WHITE);
-  drawClockHand(clockCenterX, clockCenterY, clockRadius * 0.9, secondAngle, 1, ILI9341_RED);
+  compositor.endFrame();
 }
 
 // Shows population stats with growth indicators
-void displayPopulation(unsigned long population) {
-  // Clear screen
-  tft.fillScreen(BACKGROUND_COLOR);
-  
-  // Draw title
-  tft.setTextSize(3);
-  tft.setTextColor(TITLE_COLOR);
-  tft.setCursor(40, 10);
-  tft.println("Population");
-  
-  // Add demo tag
-  tft.setTextSize(1);
-  tft.setTextColor(ILI9341_YELLOW);
-  tft.setCursor(tft.width() - 45, 15);
-  tft.print("[DEMO]");
-  
-  // Title underline
-  tft.drawLine(20, 50, tft.width() - 20, 50, TITLE_COLOR);
+static void drawPopulationScreen(unsigned long population) {
+  // Title, demo tag and underline
+  drawTitle(*gfx, 40, "Population", true);
   
   // Format with commas
-  String popStr = formatLargeNumber(population);
+  char popStr[16];
+  formatLargeNumber(population, popStr, sizeof(popStr));
   
-  // Population label
-  tft.setTextSize(2);
-  tft.setTextColor(TEXT_COLOR);
-  tft.setCursor(20, 70);
-  tft.println("World Population:");
+  // Labels
+  drawLayer(populationLabel);
+  // Wraps its last two letters onto the next line, as it always has
+  drawLabel(*gfx, 20, 150, "Growth Rate: +1.1% per year");
   
   // Population count
-  tft.setTextSize(3);
-  tft.setCursor((tft.width() - popStr.length() * 18) / 2, 100);
-  tft.print(popStr);
-  
-  // Growth stats
-  tft.setTextSize(2);
-  tft.setCursor(20, 150);
-  tft.print("Growth Rate: +1.1% per year");
+  glyphs.drawText(*gfx, (gfx->width() - (int)strlen(popStr) * 18) / 2, 100, popStr, 3, TEXT_COLOR,
+                  BACKGROUND_COLOR);
   
   // Progress bar
   int graphX = 50;
   int graphY = 190;
-  int graphWidth = tft.width() - 100;
+  int graphWidth = gfx->width() - 100;
   int graphHeight = 30;
   
-  tft.drawRect(graphX, graphY, graphWidth, graphHeight, TEXT_COLOR);
-  tft.fillRect(graphX, graphY, graphWidth * 0.8, graphHeight, ILI9341_BLUE);
+  gfx->drawRect(graphX, graphY, graphWidth, graphHeight, TEXT_COLOR);
+  gfx->fillRect(graphX, graphY, graphWidth * 0.8, graphHeight, ILI9341_BLUE);
+}
+
+void displayPopulation(unsigned long population) {
+  TRACE_SCOPE("displayPopulation");
+  finishTransition();
+  shownPopulation = population;
+  showScreen(SCREEN_POPULATION);
 }
 
 // Shows speed with color-coded warnings
-void displaySpeed(float speed) {
-  // Clear screen
-  tft.fillScreen(BACKGROUND_COLOR);
-  
+static void drawSpeedScreen(float speed) {
   // Set warning level
   uint16_t speedColor;
-  String warningText;
+  const char *warningText;
   
   if (speed > 100) {
     speedColor = WARNING_COLOR;
@@ -209,75 +370,72 @@ void displaySpeed(float speed) {
     warningText = "Speed OK";
   }
   
-  // Draw title
-  tft.setTextSize(3);
-  tft.setTextColor(TITLE_COLOR);
-  tft.setCursor(40, 10);
-  tft.println("Speed Monitor");
-  
-  // Add demo tag
-  tft.setTextSize(1);
-  tft.setTextColor(ILI9341_YELLOW);
-  tft.setCursor(tft.width() - 45, 15);
-  tft.print("[DEMO]");
-  
-  // Title underline
-  tft.drawLine(20, 50, tft.width() - 20, 50, TITLE_COLOR);
+  // Title, demo tag and underline
+  drawTitle(*gfx, 40, "Speed Monitor", true);
   
   // Speed value
-  tft.setTextSize(5);
-  tft.setTextColor(speedColor);
-  tft.setCursor(60, 80);
-  tft.print(speed, 1);
+  char speedString[16];
+  formatDecimal(speedString, sizeof(speedString), speed, 1);
+  glyphs.drawText(*gfx, 60, 80, speedString, 5, speedColor, BACKGROUND_COLOR);
   
   // Speed unit
-  tft.setTextSize(3);
-  tft.setCursor(220, 95);
-  tft.print("km/h");
+  glyphs.drawText(*gfx, 220, 95, "km/h", 3, speedColor, BACKGROUND_COLOR);
   
   // Warning message
-  tft.setTextSize(2);
-  tft.setTextColor(speedColor);
+  gfx->setTextSize(2);
+  gfx->setTextColor(speedColor);
   
   // Center text
   int16_t x1, y1;
   uint16_t w, h;
-  tft.getTextBounds(warningText, 0, 0, &x1, &y1, &w, &h);
-  tft.setCursor((tft.width() - w) / 2, 140);
-  tft.print(warningText);
+  gfx->getTextBounds(warningText, 0, 0, &x1, &y1, &w, &h);
+  gfx->setCursor((gfx->width() - w) / 2, 140);
+  gfx->print(warningText);
   
   // Speedometer
   drawSpeedometer(speed);
 }
 
+void displaySpeed(float speed) {
+  TRACE_SCOPE("displaySpeed");
+  finishTransition();
+  lastSpeedValue = speed;
+  showScreen(SCREEN_SPEED);
+}
+
 // Graphics helpers
 
+void setDrawTarget(Surface &surface) {
+  gfx = &surface;
+}
+
 void drawSunIcon(int x, int y) {
+  TRACE_SCOPE("drawSunIcon");
   int radius = 30;
-  tft.fillCircle(x, y, radius, ILI9341_YELLOW);
+  gfx->fillDisc(x, y, radius, ILI9341_YELLOW);
   
   // Rays
   for (int i = 0; i < 12; i++) {
-    float angle = i * 30 * PI / 180;
-    int startX = x + (radius + 5) * cos(angle);
-    int startY = y + (radius + 5) * sin(angle);
-    int endX = x + (radius + 20) * cos(angle);
-    int endY = y + (radius + 20) * sin(angle);
-    tft.drawLine(startX, startY, endX, endY, ILI9341_YELLOW);
+    FixedAngle angle = degreesToFixedAngle(i * 30);
+    FixedPoint start = fixedPolar(x, y, radius + 5, angle);
+    FixedPoint end = fixedPolar(x, y, radius + 20, angle);
+    gfx->drawLine(start.x, start.y, end.x, end.y, ILI9341_YELLOW);
   }
 }
 
 void drawCloudIcon(int x, int y) {
+  TRACE_SCOPE("drawCloudIcon");
   // Cloud body
-  tft.fillRoundRect(x - 30, y, 90, 45, 20, ILI9341_WHITE);
+  gfx->fillRoundRect(x - 30, y, 90, 45, 20, ILI9341_WHITE);
   
   // Puffs
-  tft.fillCircle(x - 15, y, 30, ILI9341_WHITE);
-  tft.fillCircle(x + 20, y - 10, 35, ILI9341_WHITE);
-  tft.fillCircle(x + 50, y + 5, 25, ILI9341_WHITE);
+  gfx->fillDisc(x - 15, y, 30, ILI9341_WHITE);
+  gfx->fillDisc(x + 20, y - 10, 35, ILI9341_WHITE);
+  gfx->fillDisc(x + 50, y + 5, 25, ILI9341_WHITE);
 }
 
 void drawRainIcon(int x, int y) {
+  TRACE_SCOPE("drawRainIcon");
   // Cloud
   drawCloudIcon(x, y - 15);
   
@@ -285,22 +443,21 @@ void drawRainIcon(int x, int y) {
   for (int i = 0; i < 7; i++) {
     int dropX = x - 25 + i * 15;
     int dropY = y + 35;
-    tft.fillRoundRect(dropX, dropY, 4, 15, 2, ILI9341_BLUE);
+    gfx->fillRoundRect(dropX, dropY, 4, 15, 2, ILI9341_BLUE);
     dropY += 20;
-    tft.fillRoundRect(dropX + 8, dropY, 4, 15, 2, ILI9341_BLUE);
+    gfx->fillRoundRect(dropX + 8, dropY, 4, 15, 2, ILI9341_BLUE);
   }
 }
 
 void drawClockHand(int centerX, int centerY, float length, float angle, int width, uint16_t color) {
-  // Convert to radians
-  float radians = (angle - 90) * PI / 180.0;
-  
-  int endX = centerX + length * cos(radians);
-  int endY = centerY + length * sin(radians);
+  TRACE_SCOPE("drawClockHand");
+  // 12 o'clock is up
+  FixedAngle hand = degreesToFixedAngle(angle - 90);
+  FixedPoint end = fixedPolarQ4(centerX, centerY, pixelsToQ4(length), hand);
   
   // Triangle coords
-  int xOffset = sin(radians) * (width / 2);
-  int yOffset = -cos(radians) * (width / 2);
+  int xOffset = fixedMulSin(width / 2, hand);
+  int yOffset = -fixedMulCos(width / 2, hand);
   
   // Draw as triangle
   int x1 = centerX + xOffset;
@@ -308,51 +465,41 @@ void drawClockHand(int centerX, int centerY, float length, float angle, int widt
   int x2 = centerX - xOffset;
   int y2 = centerY - yOffset;
   
-  tft.fillTriangle(x1, y1, x2, y2, endX, endY, color);
+  gfx->fillTriangleSpans(x1, y1, x2, y2, end.x, end.y, color);
   
   // Extra line for thin hands
   if (width <= 1) {
-    tft.drawLine(centerX, centerY, endX, endY, color);
+    gfx->drawLine(centerX, centerY, end.x, end.y, color);
   }
   
   // Center hub
-  tft.fillCircle(centerX, centerY, width + 1, color);
+  gfx->fillDisc(centerX, centerY, width + 1, color);
 }
 
-String formatLargeNumber(unsigned long number) {
-  String result = "";
-  String numStr = String(number);
-  
-  int len = numStr.length();
-  int commaPos = len % 3;
-  if (commaPos == 0) commaPos = 3;
-  
-  for (int i = 0; i < len; i++) {
-    result += numStr[i];
-    if ((i + 1) == commaPos && (i + 1) < len) {
-      result += ",";
-      commaPos += 3;
-    }
-  }
-  
-  return result;
+// Digits grouped in threes
+size_t formatLargeNumber(unsigned long number, char *out, size_t size) {
+  return formatGrouped(out, size, number);
 }
 
-void drawSpeedometer(float speed) {
-  int centerX = tft.width() / 2;
-  int centerY = 210;
-  int radius = 45;
+// Speedometer geometry
+#define GAUGE_CENTER_X 160
+#define GAUGE_CENTER_Y 210
+#define GAUGE_RADIUS 45
+
+static void drawSpeedDial(Surface &s) {
+  TRACE_SCOPE("drawSpeedDial");
+  int centerX = GAUGE_CENTER_X;
+  int centerY = GAUGE_CENTER_Y;
+  int radius = GAUGE_RADIUS;
   
   // Draw arc
-  tft.drawCircle(centerX, centerY, radius, TITLE_COLOR);
+  s.drawCircle(centerX, centerY, radius, TITLE_COLOR);
   
   // Speed range ticks
   for (int i = -60; i <= 60; i += 5) {
-    float angle = i * PI / 180.0;
-    int x1 = centerX + (radius - 2) * cos(angle);
-    int y1 = centerY + (radius - 2) * sin(angle);
-    int x2 = centerX + radius * cos(angle);
-    int y2 = centerY + radius * sin(angle);
+    FixedAngle angle = degreesToFixedAngle(i);
+    FixedPoint inner = fixedPolar(centerX, centerY, radius - 2, angle);
+    FixedPoint outer = fixedPolar(centerX, centerY, radius, angle);
     
     // Color zones
     uint16_t tickColor;
@@ -360,34 +507,171 @@ void drawSpeedometer(float speed) {
     else if (i < 20) tickColor = CAUTION_COLOR;
     else tickColor = WARNING_COLOR;
     
-    tft.drawLine(x1, y1, x2, y2, tickColor);
+    s.drawLine(inner.x, inner.y, outer.x, outer.y, tickColor);
   }
+}
+
+static StaticLayer speedDial(GAUGE_CENTER_X - GAUGE_RADIUS, GAUGE_CENTER_Y - GAUGE_RADIUS,
+                             2 * GAUGE_RADIUS + 1, 2 * GAUGE_RADIUS + 1, drawSpeedDial);
+
+static const NamedLayer staticLayers[] = {
+    {"population_label", &populationLabel},
+    {"speed_dial", &speedDial},
+};
+
+const NamedLayer *displayLayers(size_t &count) {
+  count = sizeof(staticLayers) / sizeof(staticLayers[0]);
+  return staticLayers;
+}
+
+size_t cachedLayerBytes() {
+  size_t bytes = 0;
+  for (const NamedLayer &layer : staticLayers) {
+    if (layer.layer->isCached()) bytes += layer.layer->bytes();
+  }
+  return bytes;
+}
+
+void releaseLayerCache() {
+  for (const NamedLayer &layer : staticLayers) layer.layer->release();
+}
+
+void prepareDisplayCaches() {
+  glyphs.reserve();
+  if (!compositor.hasFrameBuffer() || !enableLayerCache) return;
   
-  // Map speed to angle
-  float targetAngle = map(speed, 0, 160, -60, 60) * PI / 180.0;
-  float speedAngle = targetAngle;
+  for (const NamedLayer &layer : staticLayers) layer.layer->prepare(tft, BACKGROUND_COLOR);
+}
+
+static FixedAngle speedNeedleAngle(float speed) {
+  return degreesToFixedAngle((int32_t)map(speed, 0, 160, -60, 60));
+}
+
+static void drawSpeedNeedle(FixedAngle angle, uint16_t color) {
+  TRACE_SCOPE("drawSpeedNeedle");
+  int centerX = gfx->width() / 2;
+  int centerY = GAUGE_CENTER_Y;
+  int needleLength = GAUGE_RADIUS - 5;
+  int needleWidth = 3;
+  
+  // The needle pointing along +x, tip and base across the hub, turned
+  FixedPoint tip = fixedRotate(needleLength, 0, angle);
+  FixedPoint base1 = fixedRotate(0, needleWidth, angle);
+  FixedPoint base2 = fixedRotate(0, -needleWidth, angle);
   
-  // Set position directly
-  speedAngle = targetAngle;
-  lastSpeedNeedleAngle = targetAngle;
+  gfx->fillTriangleSpans(centerX + base1.x, centerY + base1.y, centerX + base2.x, centerY + base2.y,
+                         centerX + tip.x, centerY + tip.y, color);
+}
+
+static void drawSpeedHub() {
+  TRACE_SCOPE("drawSpeedHub");
+  gfx->fillDisc(gfx->width() / 2, GAUGE_CENTER_Y, 6, ILI9341_WHITE);
+  gfx->fillDisc(gfx->width() / 2, GAUGE_CENTER_Y, 4, ILI9341_RED);
+}
+
+void drawSpeedometer(float speed) {
+  TRACE_SCOPE("drawSpeedometer");
+  // Arc and speed range ticks
+  drawLayer(speedDial);
+  
+  // Animated: start where the needle was, animateSpeedNeedle() sweeps it
   lastSpeedValue = speed;
+  if (!enableSmoothAnimations) {
+    lastSpeedNeedleAngle = speedNeedleAngle(speed);
+  }
   
-  // Draw needle
-  int needleLength = radius - 5;
-  int needleWidth = 3;
-  int endX = centerX + needleLength * cos(speedAngle);
-  int endY = centerY + needleLength * sin(speedAngle);
-  
-  // Needle points
-  float perpAngle = speedAngle + PI/2;
-  int x1 = centerX + needleWidth * cos(perpAngle);
-  int y1 = centerY + needleWidth * sin(perpAngle);
-  int x2 = centerX - needleWidth * cos(perpAngle);
-  int y2 = centerY - needleWidth * sin(perpAngle);
-  
-  tft.fillTriangle(x1, y1, x2, y2, endX, endY, ILI9341_WHITE);
-  
-  // Draw hub
-  tft.fillCircle(centerX, centerY, 6, ILI9341_WHITE);
-  tft.fillCircle(centerX, centerY, 4, ILI9341_RED);
-}
\ No newline at end of file
+  drawSpeedNeedle(lastSpeedNeedleAngle, ILI9341_WHITE);
+  drawSpeedHub();
+}
+
+static NeedleAnimatorStats needleStats;
+static unsigned long lastNeedleFrameMs = 0;
+static unsigned long needleFrameInterval = NEEDLE_FRAME_MS;
+
+// Moves the needle toward lastSpeedValue at NEEDLE_DEG_PER_SEC, at most
+// one frame per NEEDLE_FRAME_MS. Each frame paints the old needle out,
+// draws the new one and the hub; nothing else on the screen is touched.
+bool animateSpeedNeedle(unsigned long nowMs) {
+  TRACE_SCOPE("animateSpeedNeedle");
+  if (shownScreen != SCREEN_SPEED || !enableSmoothAnimations || compositor.isSliding()) return false;
+  
+  FixedAngle target = speedNeedleAngle(lastSpeedValue);
+  if (lastSpeedNeedleAngle == target) return false;
+  
+  unsigned long elapsedMs = nowMs - lastNeedleFrameMs;
+  if (elapsedMs < needleFrameInterval) return false;
+  lastNeedleFrameMs = nowMs;
+  
+  // First frame of a sweep: one frame's worth, not the whole pause
+  if (elapsedMs > 4 * NEEDLE_FRAME_MS) elapsedMs = NEEDLE_FRAME_MS;
+  
+  // Step in 1/4096 turns, rounded; 45 for one frame
+  int32_t step = (NEEDLE_DEG_PER_SEC * kFixedAngleTurn * (int32_t)elapsedMs + 180000) / 360000;
+  int16_t remaining = fixedAngleDelta(target, lastSpeedNeedleAngle);
+  if (abs(remaining) < step) step = abs(remaining);
+  FixedAngle angle = (lastSpeedNeedleAngle + (remaining > 0 ? step : -step)) & (kFixedAngleTurn - 1);
+  
+  unsigned long startUs = micros();
+  if (compositor.isBanded()) {
+    // Redraw the bands under the dial with the needle where it now is
+    lastSpeedNeedleAngle = angle;
+    compositor.renderRows(BACKGROUND_COLOR, GAUGE_CENTER_Y - GAUGE_RADIUS, GAUGE_CENTER_Y + GAUGE_RADIUS + 1,
+                          [&](Surface &s) {
+                            gfx = &s;
+                            drawSpeedScreen(lastSpeedValue);
+                          });
+  } else {
+    gfx = &compositor.beginUpdate();
+    drawSpeedNeedle(lastSpeedNeedleAngle, BACKGROUND_COLOR);
+    drawSpeedNeedle(angle, ILI9341_WHITE);
+    drawSpeedHub();
+    compositor.endFrame();
+    lastSpeedNeedleAngle = angle;
+  }
+  uint32_t frameUs = micros() - startUs;
+  
+  // Over budget: stretch the frame interval; the step grows with it,
+  // so the sweep keeps its speed with fewer frames
+  if (frameUs > NEEDLE_FRAME_BUDGET_US) {
+    needleStats.overBudget++;
+    needleFrameInterval = NEEDLE_FRAME_MS * 2;
+  } else {
+    needleFrameInterval = NEEDLE_FRAME_MS;
+  }
+  needleStats.frames++;
+  needleStats.totalUs += frameUs;
+  if (frameUs > needleStats.maxUs) needleStats.maxUs = frameUs;
+  
+  return true;
+}
+
+const NeedleAnimatorStats &needleAnimatorStats() {
+  return needleStats;
+}
+
+void resetNeedleAnimatorStats() {
+  needleStats = NeedleAnimatorStats();
+}
+
+static void drawShownScreen(Surface &s) {
+  gfx = &s;
+  switch (shownScreen) {
+  case SCREEN_WEATHER: drawWeatherScreen(shownWeather); break;
+  case SCREEN_TIME: drawTimeScreen(shownTimeValue); break;
+  case SCREEN_POPULATION: drawPopulationScreen(shownPopulation); break;
+  case SCREEN_SPEED: drawSpeedScreen(lastSpeedValue); break;
+  case SCREEN_NONE: break;
+  }
+}
+
+// Brings TRANSITION_COLUMNS_PER_FRAME more columns of a sliding screen
+// into view, at most one frame per TRANSITION_FRAME_MS
+bool animateTransition(unsigned long nowMs) {
+  TRACE_SCOPE("animateTransition");
+  if (!compositor.isSliding()) return false;
+  if (nowMs - lastTransitionFrameMs < TRANSITION_FRAME_MS) return false;
+  lastTransitionFrameMs = nowMs;
+  
+  compositor.slide(BACKGROUND_COLOR, TRANSITION_COLUMNS_PER_FRAME, drawShownScreen);
+  return true;
+}
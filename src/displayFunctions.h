@@ -1,35 +1,103 @@
 #ifndef DISPLAY_FUNCTIONS_H
 #define DISPLAY_FUNCTIONS_H
 
-#include <SPI.h>
 #include <Adafruit_GFX.h>
 #include <Adafruit_ILI9341.h>
 #include <TimeLib.h>
 #include <math.h>
 
+#include "Compositor.h"
+#include "FixedTrig.h"
+#include "GlyphAtlas.h"
+#include "Ili9341Panel.h"
+#include "NumberFormat.h"
+#include "StaticLayer.h"
+#if defined(ESP32)
+#include "Esp32SpiBus.h"
+#else
+#include "RecordingBus.h"
+#endif
+
+// Weather states, each with a label and an icon
+enum WeatherCondition : uint8_t
+{
+  WEATHER_SUNNY,
+  WEATHER_CLOUDY,
+  WEATHER_RAIN,
+  WEATHER_CONDITION_COUNT
+};
+
 // Weather info container
 struct WeatherData
 {
-  float temperature; // celsius
-  float humidity;    // percent
-  String condition;  // weather state
+  float temperature;          // celsius
+  float humidity;             // percent
+  WeatherCondition condition; // weather state
+  bool demo;                  // Show the [DEMO] tag
 };
 
 // Main display functions
-void displayWeather(WeatherData weather);
+void displayWeather(const WeatherData &weather);
+const char *weatherConditionLabel(WeatherCondition condition);
 void displayTime(time_t t);
+void updateTime(time_t t); // In place, once the time screen is up
 void displayPopulation(unsigned long population);
 void displaySpeed(float speed);
 void resetDrawFlags(); // Legacy function
 
-// Drawing helpers
+// Drawing helpers, on the current frame's surface; the screens set it,
+// setDrawTarget() is for drawing them elsewhere
+void setDrawTarget(Surface &surface);
 void drawSunIcon(int x, int y);
 void drawCloudIcon(int x, int y);
 void drawRainIcon(int x, int y);
 void drawClockHand(int centerX, int centerY, float length, float angle, int width, uint16_t color);
-String formatLargeNumber(unsigned long number);
+size_t formatLargeNumber(unsigned long number, char *out, size_t size);
 void drawSpeedometer(float speed);
 
+// Speedometer needle animation
+#define NEEDLE_FRAME_MS 33            // ~30 fps
+#define NEEDLE_DEG_PER_SEC 120        // Sweep rate
+#define NEEDLE_FRAME_BUDGET_US 3000   // Max loop() time per frame
+
+struct NeedleAnimatorStats
+{
+  uint32_t frames;
+  uint32_t overBudget; // Frames slower than NEEDLE_FRAME_BUDGET_US
+  uint32_t maxUs;
+  uint64_t totalUs;
+};
+
+bool animateSpeedNeedle(unsigned long nowMs); // Call every loop()
+const NeedleAnimatorStats &needleAnimatorStats();
+void resetNeedleAnimatorStats();
+
+extern bool enableSmoothAnimations;
+
+// Slide transitions between screens, on the panel's hardware scroll
+#define TRANSITION_FRAME_MS 16
+#define TRANSITION_COLUMNS_PER_FRAME 16 // 20 frames across 320 columns
+
+bool animateTransition(unsigned long nowMs); // Call every loop()
+
+extern bool enableSlideTransitions;
+
+// Static layer sprites (titles, labels, speedometer dial)
+extern bool enableLayerCache;
+size_t cachedLayerBytes();
+void releaseLayerCache();
+
+// Every static layer, for the layers benchmark
+struct NamedLayer {
+  const char *name;
+  StaticLayer *layer;
+};
+const NamedLayer *displayLayers(size_t &count);
+
+// Allocates the sprites and glyph atlas up front, so nothing touches the
+// heap once setup() is done
+void prepareDisplayCaches();
+
 // Display pin config
 #define TFT_CS 15
 #define TFT_DC 2
@@ -37,6 +105,7 @@ void drawSpeedometer(float speed);
 #define TFT_MOSI 23
 #define TFT_CLK 18
 #define TFT_MISO 19
+#define TFT_SPI_FREQ 40000000
 
 // Display colors
 #define BACKGROUND_COLOR ILI9341_BLACK
@@ -46,7 +115,13 @@ void drawSpeedometer(float speed);
 #define CAUTION_COLOR ILI9341_YELLOW
 #define SAFE_COLOR ILI9341_GREEN
 
-// External reference to the display object (defined in displayFunctions.cpp)
-extern Adafruit_ILI9341 tft;
+// External reference to the display objects (defined in displayFunctions.cpp)
+#if defined(ESP32)
+extern Esp32SpiBus displayBus;
+#else
+extern RecordingBus displayBus;
+#endif
+extern Ili9341Panel tft;
+extern Compositor compositor;
 
 #endif // DISPLAY_FUNCTIONS_H
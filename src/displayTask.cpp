@@ -0,0 +1,94 @@
+#include "displayTask.h"
+
+#include <string.h>
+
+#include "HeapGuard.h"
+#include "RenderTrace.h"
+#include "TripleBuffer.h"
+
+#if defined(ESP32)
+#include <freertos/FreeRTOS.h>
+#include <freertos/task.h>
+#endif
+
+static TripleBuffer<DisplaySnapshot> snapshots;
+static DisplaySnapshot shown; // Last snapshot drawn
+static DisplayTaskStats stats;
+
+void publishDisplaySnapshot(const DisplaySnapshot &snapshot) {
+  DisplaySnapshot stamped = snapshot;
+  stamped.publishedUs = micros();
+  snapshots.publish(stamped);
+  stats.published++;
+}
+
+// Full repaint on a mode change; otherwise only the clock ticks in place
+static void drawSnapshot(const DisplaySnapshot &snapshot) {
+  if (snapshot.modeSequence == shown.modeSequence) {
+    if (snapshot.mode == TIME_DISPLAY && snapshot.time != shown.time) {
+      updateTime(snapshot.time);
+    }
+    return;
+  }
+
+  stats.repaints++;
+  switch (snapshot.mode) {
+  case WEATHER_DISPLAY: displayWeather(snapshot.weather); break;
+  case TIME_DISPLAY: displayTime(snapshot.time); break;
+  case POPULATION_DISPLAY: displayPopulation(snapshot.population); break;
+  case SPEED_DISPLAY: displaySpeed(snapshot.speed); break;
+  }
+}
+
+bool renderDisplay(unsigned long nowMs) {
+  TRACE_SCOPE("renderDisplay");
+  bool drew = false;
+
+  DisplaySnapshot snapshot;
+  if (snapshots.consume(snapshot) && snapshot.modeSequence != 0) {
+    uint32_t startUs = micros();
+    uint32_t handoffUs = startUs - snapshot.publishedUs;
+    stats.consumed++;
+    stats.totalHandoffUs += handoffUs;
+    if (handoffUs > stats.maxHandoffUs) stats.maxHandoffUs = handoffUs;
+
+    drawSnapshot(snapshot);
+    shown = snapshot;
+    drew = true;
+
+    uint32_t renderUs = micros() - startUs;
+    if (renderUs > stats.maxRenderUs) stats.maxRenderUs = renderUs;
+  }
+
+  // Move a slide transition along
+  drew |= animateTransition(nowMs);
+
+  // Sweep the speedometer needle toward the new reading
+  if (shown.modeSequence != 0 && shown.mode == SPEED_DISPLAY) {
+    drew |= animateSpeedNeedle(nowMs);
+  }
+  return drew;
+}
+
+#if defined(ESP32)
+
+#define DISPLAY_TASK_STACK 8192
+#define DISPLAY_TASK_PRIORITY 1
+
+static void displayTask(void *) {
+  for (;;) {
+    renderDisplay(millis());
+    vTaskDelay(1); // Let the idle task feed the watchdog
+  }
+}
+
+bool startDisplayTask(int core, TaskHandle_t *task) {
+  return xTaskCreatePinnedToCore(displayTask, "display", DISPLAY_TASK_STACK, nullptr, DISPLAY_TASK_PRIORITY,
+                                 task, core) == pdPASS;
+}
+
+#endif
+
+const DisplayTaskStats &displayTaskStats() { return stats; }
+
+void resetDisplayTaskStats() { memset(&stats, 0, sizeof(stats)); }
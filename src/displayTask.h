@@ -0,0 +1,59 @@
+#ifndef DISPLAY_TASK_H
+#define DISPLAY_TASK_H
+
+#include "displayFunctions.h"
+
+// Display modes
+enum DisplayMode
+{
+  WEATHER_DISPLAY,
+  TIME_DISPLAY,
+  POPULATION_DISPLAY,
+  SPEED_DISPLAY
+};
+
+// What the screens show, copied out of the control loop's state. The
+// control loop publishes one whenever it changes; the renderer only ever
+// sees whole snapshots.
+struct DisplaySnapshot
+{
+  DisplayMode mode;
+  uint32_t modeSequence; // Bumped on every mode change; 0: nothing to show yet
+  WeatherData weather;
+  unsigned long population;
+  float speed;
+  time_t time;
+  uint32_t publishedUs; // micros() when published
+};
+
+struct DisplayTaskStats
+{
+  uint32_t published; // Control side
+  uint32_t consumed;  // Renderer side from here on
+  uint32_t repaints;
+  uint32_t maxHandoffUs; // Publish to render start
+  uint64_t totalHandoffUs;
+  uint32_t maxRenderUs;
+};
+
+// Control side: never blocks
+void publishDisplaySnapshot(const DisplaySnapshot &snapshot);
+
+// Renderer side: draws the newest snapshot, if there is one, and steps the
+// needle animation. Called by the display task, or from loop() on builds
+// without one. Returns true if anything was drawn.
+bool renderDisplay(unsigned long nowMs);
+
+#if defined(ESP32)
+#include <freertos/FreeRTOS.h>
+#include <freertos/task.h>
+
+// Runs renderDisplay() in its own task pinned to core, and hands back
+// the task
+bool startDisplayTask(int core, TaskHandle_t *task);
+#endif
+
+const DisplayTaskStats &displayTaskStats();
+void resetDisplayTaskStats();
+
+#endif // DISPLAY_TASK_H
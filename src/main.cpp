@@ -5,43 +5,89 @@
 
 // Display functions
 #include "displayFunctions.h"
+#include "displayTask.h"
+#include "HeapGuard.h"
+#include "Clock.h"
+#include "Intersection.h"
+#if defined(ESP32)
+#include "Esp32GpioPort.h"
+#else
+#include "RecordingGpioPort.h"
+#endif
+#include "RenderTrace.h"
+#include "SpeedDetector.h"
+#include "TimerWheel.h"
+
+// Everything below tells time by this; host tests swap in a ManualClock
+Clock &controlClock = systemClock();
 
 // Global data
-WeatherData currentWeather = {19.5, 35.0, "Sunny"};
+WeatherData currentWeather = {19.5, 35.0, WEATHER_SUNNY, false};
 long long currentPopulation = 10000; // Population count
 float currentSpeed = 75.0;           // Speed in km/h
 
-// Display modes
-enum DisplayMode
-{
-  WEATHER_DISPLAY,
-  TIME_DISPLAY,
-  POPULATION_DISPLAY,
-  SPEED_DISPLAY
-};
-
 DisplayMode currentMode = WEATHER_DISPLAY;
-unsigned long lastModeChange = 0;
+uint32_t modeSequence = 0;                      // Mode changes so far
 const unsigned long modeChangeInterval = 10000; // 10s rotation
-
-// Traffic light setup
-int ledPins[] = {19, 14, 13, 5, 26, 12}; // R Y G R2 Y2 G2
-int waitTime[] = {
-    2000,
-    5000,
-    1000,
-    2000,
-    5000,
-    1000,
+time_t lastClockTick = 0;                        // Last second published
+const unsigned long clockCheckInterval = 20;    // Looking for a new second
+
+// A full trace dump is about 11 KB: 10 bytes for each of the 1024
+// events, plus the probe names
+#if defined(RENDER_TRACE)
+#define SERIAL_BAUD 921600
+#else
+#define SERIAL_BAUD 9600
+#endif
+
+// Display rendering runs in its own task on core 1 and the control loop
+// in another on core 0; if either can't be started, loop() does both
+#define DISPLAY_CORE 1
+#define CONTROL_CORE 0
+#define CONTROL_TASK_STACK 8192
+bool renderInControlLoop = true;
+bool controlTaskRunning = false;
+
+#if defined(ESP32)
+void controlTask(void *);
+#endif
+
+// Longest the control loop sleeps, even with nothing due
+#define CONTROL_MAX_SLEEP_MS 1000
+
+// Control loop wake-up times, to check redraws don't hold it up
+struct ControlLoopStats
+{
+  uint32_t iterations;
+  uint32_t maxUs;
+  uint64_t totalUs;
 };
 
-const int numPins = sizeof(ledPins) / sizeof(ledPins[0]);
+ControlLoopStats controlStats;
+const unsigned long latencyReportInterval = 10000; // 10s
+
+// Traffic lights: two heads (R Y G pins) on crossing roads, taking turns.
+// Both go through one port, so a change is one set and one clear.
+#if defined(ESP32)
+Esp32GpioPort trafficPort;
+#else
+RecordingGpioPort trafficPort;
+#endif
+TrafficLight trafficLight1(19, 14, 13, &trafficPort, &controlClock);
+TrafficLight trafficLight2(5, 26, 12, &trafficPort, &controlClock);
+TrafficLight *const trafficHeads[] = {&trafficLight1, &trafficLight2};
+
+// Head 1 and head 2 must never run together
+const uint32_t trafficConflicts[] = {1 << 1, 1 << 0};
+
+// Green 5s, yellow 2s, 1s all red between
+const IntersectionPhase trafficPhases[] = {
+    {1 << 0, 5000, 2000, 1000},
+    {1 << 1, 5000, 2000, 1000},
+};
 
-// Non-blocking variables
-unsigned long prevMillis = 0;    // Last light update time
-unsigned long currInterval = 0;  // Current wait interval
-int currStep = 0;                // Current traffic sequence
-bool lightIsOn = false;          // Light status
+Intersection intersection(trafficHeads, sizeof(trafficHeads) / sizeof(trafficHeads[0]), trafficPhases,
+                          sizeof(trafficPhases) / sizeof(trafficPhases[0]), trafficConflicts, &trafficPort);
 
 // Light sensors
 
@@ -53,32 +99,37 @@ const int speedSensor2Pin = 35;   // Speed detection 2
 
 // Sensor config
 const float distance = 0.5;       // Meters between sensors
+const int speedSampleInterval = 1; // ms between speed sensor readings
 
 // Thresholds
 const int darknessThreshold = 4050;    // Darkness trigger level
 const int speedSensorThreshold = 2000; // Speed trigger level
 
-// Speed detection states
-enum SpeedDetectorState
-{
-  WAITING_FOR_FIRST_SENSOR,
-  WAITING_FOR_SECOND_SENSOR,
-  COOLDOWN
-};
-
-// Speed detector config
-struct SpeedDetector
-{
-  SpeedDetectorState state;
-  unsigned long startTime;
-  unsigned long cooldownEndTime;
-  unsigned long cooldownDuration;
-};
-
-SpeedDetector speedDetector;
+// 5s for the second sensor, then 1s cooldown after a reading
+SpeedDetector speedDetector(distance, speedSensorThreshold, 5000, 1000, &controlClock);
+
+// Everything the control loop does waits on a timer here; between them
+// the loop sleeps until the earliest deadline
+void onTrafficTimer(Timer &timer, unsigned long nowMs);
+void onDarknessTimer(Timer &timer, unsigned long nowMs);
+void onSpeedTimer(Timer &timer, unsigned long nowMs);
+void onModeTimer(Timer &timer, unsigned long nowMs);
+void onClockTimer(Timer &timer, unsigned long nowMs);
+void onRenderTimer(Timer &timer, unsigned long nowMs);
+void onLatencyTimer(Timer &timer, unsigned long nowMs);
+
+TimerWheel controlTimers;
+Timer trafficTimer("traffic", onTrafficTimer);
+Timer darknessTimer("darkness", onDarknessTimer);
+Timer speedTimer("speed", onSpeedTimer);
+Timer modeTimer("mode", onModeTimer);
+Timer clockTimer("clock", onClockTimer); // Only on the time screen
+Timer renderTimer("render", onRenderTimer); // Only without a display task
+Timer latencyTimer("latency", onLatencyTimer);
+Timer *const lateTimers[] = {&trafficTimer, &darknessTimer, &speedTimer, &modeTimer, &clockTimer, &renderTimer};
 
 // Display value setters
-void setWeather(float temp, float humidity, String condition)
+void setWeather(float temp, float humidity, WeatherCondition condition)
 {
   currentWeather.temperature = temp;
   currentWeather.humidity = humidity;
@@ -97,6 +148,7 @@ void setSpeed(float speed)
 
 void updateDisplayValues()
 {
+  TRACE_SCOPE("updateDisplayValues");
   // Update based on current screen
   switch (currentMode)
   {
@@ -108,13 +160,13 @@ void updateDisplayValues()
     switch (weatherState)
     {
     case 0:
-      setWeather(23.5, 67.0, "Sunny");
+      setWeather(23.5, 67.0, WEATHER_SUNNY);
       break;
     case 1:
-      setWeather(18.2, 82.5, "Cloudy");
+      setWeather(18.2, 82.5, WEATHER_CLOUDY);
       break;
     case 2:
-      setWeather(15.8, 91.0, "Rain");
+      setWeather(15.8, 91.0, WEATHER_RAIN);
       break;
     }
     break;
@@ -152,244 +204,354 @@ void updateDisplayValues()
   }
 }
 
-void updateTrafficLights()
+void updateTrafficLights(unsigned long currentMillis)
 {
-  unsigned long currentMillis = millis();
-
-  // Time to change state?
-  if (currentMillis - prevMillis >= currInterval)
+  TRACE_SCOPE("updateTrafficLights");
+  if (intersection.tick(currentMillis) && intersection.interval() == INTERVAL_GREEN)
   {
-    prevMillis = currentMillis;
-
-    int i = currStep % numPins;
-
-    if (!lightIsOn)
-    {
-      // Activate light
-      if (i >= 3)
-      {
-        digitalWrite(ledPins[0], HIGH); // red1
-        digitalWrite(ledPins[3], LOW);  // red2
-      }
-      else
-      {
-        digitalWrite(ledPins[3], HIGH); // red2
-        digitalWrite(ledPins[0], LOW);  // red1
-      }
-
-      digitalWrite(ledPins[i], HIGH);
-      lightIsOn = true;
-      currInterval = waitTime[i];
-
-      Serial.print("Turning ON light at pin ");
-      Serial.println(ledPins[i]);
-    }
-    else
-    {
-      // Deactivate light
-      digitalWrite(ledPins[i], LOW);
-      lightIsOn = false;
-      currStep++;
-      currInterval = 10; // Brief pause between changes
-
-      Serial.print("Turning OFF light at pin ");
-      Serial.println(ledPins[i]);
-    }
+    Serial.print("Traffic phase ");
+    Serial.println(intersection.phase());
   }
 }
 
-unsigned long lastReadTime = 0;
+void onTrafficTimer(Timer &timer, unsigned long nowMs)
+{
+  updateTrafficLights(nowMs);
+  controlTimers.schedule(timer, intersection.nextChange());
+}
+
 const int readInterval = 100; // 100ms sampling rate
 
+bool darkOutput = false; // Light on
+
 void checkDarkness()
 {
-  // Throttle readings
-  unsigned long currentTime = millis();
-  if (currentTime - lastReadTime >= readInterval)
+  TRACE_SCOPE("checkDarkness");
+  // Get sensor reading
+  int darknessValue = analogRead(darknessSensorPin);
+  bool dark = darknessValue < darknessThreshold;
+
+  // Control light based on reading, printing only when it switches
+  digitalWrite(outputPin, dark ? HIGH : LOW);
+  if (dark != darkOutput)
   {
-    // Get sensor reading
-    int darknessValue = analogRead(darknessSensorPin);
+    darkOutput = dark;
+    Serial.print(dark ? "Dark, light on at " : "Bright, light off at ");
     Serial.println(darknessValue);
-
-    // Control light based on reading
-    if (darknessValue < darknessThreshold)
-    {
-      digitalWrite(outputPin, HIGH); // Dark - light on
-      Serial.print("Turning on the light on peak brightness");
-    }
-    else
-    {
-      digitalWrite(outputPin, LOW); // Bright - light off
-    }
-
-    lastReadTime = currentTime;
   }
 }
 
+void onDarknessTimer(Timer &timer, unsigned long nowMs)
+{
+  checkDarkness();
+  controlTimers.schedule(timer, timer.deadline() + readInterval);
+}
+
 void updateSpeedDetection()
 {
+  TRACE_SCOPE("updateSpeedDetection");
   // Get sensor readings
   int sensor1Value = analogRead(speedSensor1Pin);
   int sensor2Value = analogRead(speedSensor2Pin);
 
-  Serial.println("sensor 2 go brr");
+#if defined(SPEED_SENSOR_DEBUG)
+  // Every sample: at 9600 baud this fills the UART FIFO and the control
+  // loop blocks on it, so samples end up tens of ms apart
+  Serial.print("sensors ");
+  Serial.print(sensor1Value);
+  Serial.print(' ');
   Serial.println(sensor2Value);
-  Serial.println("sensor 1 go brr");
-  Serial.println(sensor1Value);
+#endif
 
   // Speed detection state machine
-  switch (speedDetector.state)
+  switch (speedDetector.update(sensor1Value, sensor2Value))
   {
-  case WAITING_FOR_FIRST_SENSOR:
-    // First sensor check
-    if (sensor1Value > speedSensorThreshold)
-    {
-      speedDetector.startTime = millis();
-      speedDetector.state = WAITING_FOR_SECOND_SENSOR;
-      Serial.println("Object detected at first sensor");
-    }
+  case SPEED_FIRST_SENSOR:
+    Serial.println("Object detected at first sensor");
     break;
 
-  case WAITING_FOR_SECOND_SENSOR:
-    // Timeout check
-    if (millis() - speedDetector.startTime > 5000)
-    { // 5s timeout
-      Serial.println("Object missed second sensor or timeout occurred");
-      speedDetector.state = WAITING_FOR_FIRST_SENSOR;
-    }
-    // Second sensor check
-    else if (sensor2Value > speedSensorThreshold)
-    {
-      unsigned long endTime = millis();
-      float timeDiff = (endTime - speedDetector.startTime) / 1000.0;
-
-      if (timeDiff > 0)
-      {
-        float speed = distance / timeDiff;
-
-        Serial.print("Time: ");
-        Serial.print(timeDiff, 4);
-        Serial.println(" seconds");
-
-        Serial.print("Speed: ");
-        Serial.print(speed, 2);
-        Serial.print(" m/s (");
-        Serial.print(speed * 3.6, 2);
-        Serial.println(" km/h)");
-      }
-
-      // Start cooldown
-      speedDetector.cooldownEndTime = millis() + speedDetector.cooldownDuration;
-      speedDetector.state = COOLDOWN;
-    }
+  case SPEED_TIMED_OUT:
+    Serial.println("Object missed second sensor or timeout occurred");
     break;
 
-  case COOLDOWN:
-    // Wait for cooldown
-    if (millis() >= speedDetector.cooldownEndTime)
+  case SPEED_MEASURED:
+    if (speedDetector.transitMs() > 0)
     {
-      speedDetector.state = WAITING_FOR_FIRST_SENSOR;
+      float speed = speedDetector.speed();
+
+      Serial.print("Time: ");
+      Serial.print(speedDetector.transitMs() / 1000.0, 4);
+      Serial.println(" seconds");
+
+      Serial.print("Speed: ");
+      Serial.print(speed, 2);
+      Serial.print(" m/s (");
+      Serial.print(speed * 3.6, 2);
+      Serial.println(" km/h)");
     }
     break;
+
+  case SPEED_NO_EVENT:
+    break;
   }
 }
 
+void onSpeedTimer(Timer &timer, unsigned long nowMs)
+{
+  updateSpeedDetection();
+  // Nothing to sample through the cooldown
+  controlTimers.schedule(timer, speedDetector.state() == COOLDOWN ? speedDetector.cooldownEnd()
+                                                                  : nowMs + speedSampleInterval);
+}
+
 void setup()
 {
-  Serial.begin(9600);
+  Serial.begin(SERIAL_BAUD);
   Serial.println("Display Main Program Starting");
 
   // Init display
   tft.begin();
   tft.setRotation(3); // Landscape
-  tft.fillScreen(BACKGROUND_COLOR);
- 
+  compositor.begin();
+  if (compositor.isIndexed())
+  {
+    Serial.println("No PSRAM frame buffer, double buffering indexed colors in SRAM");
+  }
+  else if (!compositor.hasFrameBuffer())
+  {
+    Serial.println(compositor.isBanded() ? "No PSRAM frame buffer, drawing in bands"
+                                         : "No PSRAM frame buffer, drawing direct");
+  }
+  prepareDisplayCaches();
+
   // Set default time
   setTime(8, 50, 0, 16, 6, 2025);
 
   // Welcome message
-  tft.setTextSize(3);
-  tft.setTextColor(TITLE_COLOR);
-  tft.setCursor(20, 100);
-  tft.println("Display System Ready");
-
-  // Setup traffic lights
-  for (int i = 0; i < numPins; i++)
+  compositor.render(BACKGROUND_COLOR, [](Surface &screen)
+  {
+    screen.setTextSize(3);
+    screen.setTextColor(TITLE_COLOR);
+    screen.setCursor(20, 100);
+    screen.println("Display System Ready");
+  });
+
+  // Start the traffic lights on the first phase
+  unsigned long startMs = controlClock.nowMs();
+  controlTimers.begin(startMs);
+  if (intersection.begin(startMs))
   {
-    pinMode(ledPins[i], OUTPUT);
-    digitalWrite(ledPins[i], LOW);
+    controlTimers.schedule(trafficTimer, intersection.nextChange());
+  }
+  else
+  {
+    Serial.println("Traffic phase table has conflicting greens, holding all red");
   }
-
-  // Start with red lights
-  digitalWrite(ledPins[0], HIGH); // red1
-  digitalWrite(ledPins[3], HIGH); // red2
-
-  // Init timers
-  prevMillis = millis();
 
   // Setup sensors
   pinMode(speedSensor1Pin, INPUT);
   pinMode(speedSensor2Pin, INPUT);
   pinMode(outputPin, OUTPUT);
 
-  // Config speed detector
-  speedDetector.state = WAITING_FOR_FIRST_SENSOR;
-  speedDetector.cooldownDuration = 1000; // 1s cooldown
-
   Serial.println("ESP32 Speed detection system is running.");
+
+  // The first analogRead() sets up the ADC driver; get it done now
+  analogRead(darknessSensorPin);
+  analogRead(speedSensor1Pin);
+  analogRead(speedSensor2Pin);
+
+  controlTimers.schedule(darknessTimer, startMs);
+  controlTimers.schedule(speedTimer, startMs);
+  controlTimers.schedule(modeTimer, startMs + modeChangeInterval);
+  controlTimers.schedule(latencyTimer, startMs + latencyReportInterval);
+
+#if defined(ESP32)
+  TaskHandle_t displayTaskHandle = nullptr;
+  renderInControlLoop = !startDisplayTask(DISPLAY_CORE, &displayTaskHandle);
+#endif
+  if (renderInControlLoop)
+  {
+    Serial.println("No display task, rendering from the control loop");
+    controlTimers.schedule(renderTimer, startMs);
+  }
+
+#if defined(ESP32)
+  TaskHandle_t controlTaskHandle = nullptr;
+  controlTaskRunning = xTaskCreatePinnedToCore(controlTask, "control", CONTROL_TASK_STACK, nullptr, 1,
+                                               &controlTaskHandle, CONTROL_CORE) == pdPASS;
+
+  // Both tasks are added here, from one task, before the guard is armed
+  if (!renderInControlLoop)
+  {
+    heapGuardAddTask(displayTaskHandle);
+  }
+  if (controlTaskRunning)
+  {
+    heapGuardAddTask(controlTaskHandle);
+  }
+#endif
+
+  // From here on neither loop() nor the tasks may allocate
+  heapGuardArm();
 }
 
-void loop()
+// Hands the display task a copy of everything it shows
+void publishDisplayState(time_t t)
 {
-  unsigned long currentMillis = millis();
-  updateTrafficLights();
-  checkDarkness();
-  updateSpeedDetection();
+  TRACE_SCOPE("publishDisplayState");
+  DisplaySnapshot snapshot;
+  snapshot.mode = currentMode;
+  snapshot.modeSequence = modeSequence;
+  snapshot.weather = currentWeather;
+  snapshot.population = currentPopulation;
+  snapshot.speed = currentSpeed;
+  snapshot.time = t;
+  publishDisplaySnapshot(snapshot);
+
+  // Draw it straight away rather than at the next frame
+  if (renderInControlLoop)
+  {
+    controlTimers.schedule(renderTimer, controlClock.nowMs());
+  }
+}
 
-  // Rotate display modes
-  if (currentMillis - lastModeChange > modeChangeInterval)
+void reportLatency()
+{
+  TRACE_SCOPE("reportLatency");
+  const DisplayTaskStats &display = displayTaskStats();
+  Serial.print("Control loop max ");
+  Serial.print(controlStats.maxUs);
+  Serial.print(" us, mean ");
+  Serial.print(controlStats.iterations ? (unsigned long)(controlStats.totalUs / controlStats.iterations) : 0UL);
+  Serial.print(" us; since boot render max ");
+  Serial.print(display.maxRenderUs);
+  Serial.print(" us, handoff max ");
+  Serial.print(display.maxHandoffUs);
+  Serial.println(" us");
+
+  Serial.print("Timers late max");
+  for (Timer *timer : lateTimers)
   {
-    // Next display mode
-    currentMode = (DisplayMode)((currentMode + 1) % 4);
-    lastModeChange = currentMillis;
+    Serial.print(' ');
+    Serial.print(timer->name());
+    Serial.print(' ');
+    Serial.print(timer->stats().maxLateMs);
+    timer->resetStats();
+  }
+  Serial.println(" ms");
 
-    // Update values
-    updateDisplayValues();
+  controlStats = ControlLoopStats();
+}
 
-    // Update screen
-    switch (currentMode)
-    {
-    case WEATHER_DISPLAY:
-      displayWeather(currentWeather);
-      break;
+void onLatencyTimer(Timer &timer, unsigned long nowMs)
+{
+  reportLatency();
+  controlTimers.schedule(timer, timer.deadline() + latencyReportInterval);
+}
 
-    case TIME_DISPLAY:
-    {
-      // Increment time
-      int h = hour();
-      int m = minute() + 1;
-      if (m >= 60)
-      {
-        m = 0;
-        h = (h + 1) % 24;
-      }
-      setTime(h, m, 0, day(), month(), year());
-      displayTime(now());
-    }
-    break;
+void onModeTimer(Timer &timer, unsigned long nowMs)
+{
+  TRACE_SCOPE("modeRotation");
+  controlTimers.schedule(timer, nowMs + modeChangeInterval);
 
-    case POPULATION_DISPLAY:
-      displayPopulation(currentPopulation);
-      break;
+  // Next display mode
+  currentMode = (DisplayMode)((currentMode + 1) % 4);
+  modeSequence++;
 
-    case SPEED_DISPLAY:
-      displaySpeed(currentSpeed);
-      break;
-    }
+  // Update values
+  updateDisplayValues();
 
-    Serial.print("Changed display mode to: ");
-    Serial.println(currentMode);
+  if (currentMode == TIME_DISPLAY)
+  {
+    // Increment time to the next whole minute. Plain arithmetic: the
+    // TimeLib field getters share a cache with the display task.
+    time_t t = now();
+    setTime(t - t % 60 + 60);
+    controlTimers.schedule(clockTimer, nowMs + clockCheckInterval);
+  }
+  else
+  {
+    controlTimers.cancel(clockTimer);
+  }
+
+  Serial.print("Changed display mode to: ");
+  Serial.println(currentMode);
+#if defined(HEAP_GUARD)
+  printHeapReport(Serial);
+#endif
+
+  lastClockTick = now();
+  publishDisplayState(lastClockTick);
+}
+
+// Tick the clock in place every second
+void onClockTimer(Timer &timer, unsigned long nowMs)
+{
+  controlTimers.schedule(timer, nowMs + clockCheckInterval);
+  time_t t = now();
+  if (t != lastClockTick)
+  {
+    lastClockTick = t;
+    publishDisplayState(t);
+  }
+}
+
+void onRenderTimer(Timer &timer, unsigned long nowMs)
+{
+  renderDisplay(nowMs);
+  controlTimers.schedule(timer, nowMs + TRANSITION_FRAME_MS);
+}
+
+// Runs whatever is due and returns how long the loop may sleep
+unsigned long controlStep()
+{
+  TRACE_SCOPE("controlStep");
+  unsigned long startUs = micros();
+  controlTimers.run(controlClock.nowMs());
+
+  uint32_t elapsedUs = micros() - startUs;
+  controlStats.iterations++;
+  controlStats.totalUs += elapsedUs;
+  if (elapsedUs > controlStats.maxUs)
+  {
+    controlStats.maxUs = elapsedUs;
+  }
+
+#if defined(RENDER_TRACE)
+  // 't' on the serial port dumps the trace ring (tools/trace2chrome.py).
+  // Everything the firmware prints after setup() comes from this task, so
+  // no text can land inside the dump
+  if (Serial.available() > 0 && Serial.read() == 't')
+  {
+    traceDump(Serial);
+  }
+#endif
+
+  return controlTimers.timeUntilNext(controlClock.nowMs(), CONTROL_MAX_SLEEP_MS);
+}
+
+#if defined(ESP32)
+void controlTask(void *)
+{
+  for (;;)
+  {
+    // Sleeping also lets the idle task feed the watchdog
+    unsigned long sleepMs = controlStep();
+    vTaskDelay(sleepMs ? pdMS_TO_TICKS(sleepMs) : 1);
+  }
+}
+#endif
+
+void loop()
+{
+#if defined(ESP32)
+  if (controlTaskRunning)
+  {
+    // Nothing left for the Arduino loop task
+    vTaskDelete(nullptr);
   }
+#endif
+  delay(controlStep());
 }
 
 // Additional helper functions can be added here
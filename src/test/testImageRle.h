@@ -0,0 +1,2259 @@
+// Generated by tools/rgb565_to_rle.py from testImage.h
+// 240x320, 35941 bytes (raw RGB565: 153600 bytes)
+
+#ifndef TESTIMAGERLE_H
+#define TESTIMAGERLE_H
+
+#include <Arduino.h>
+
+const uint8_t testImageRle[35941] PROGMEM = {
+  0x52, 0x49, 0x01, 0x00, 0xF0, 0x00, 0x40, 0x01, 0x00, 0x01, 0x78, 0xE7, 0x7A, 0xC7, 0x26, 0x8D,
+  0x79, 0xD7, 0x7A, 0xBF, 0x2D, 0x24, 0x79, 0xCF, 0x8D, 0x1B, 0x17, 0x8F, 0x79, 0xDF, 0x8A, 0xC6,
+  0x78, 0xDF, 0x84, 0x3B, 0xC7, 0x09, 0x7A, 0xCF, 0x75, 0x66, 0xD0, 0x3C, 0x86, 0x01, 0x98, 0xDF,
+  0x08, 0x0A, 0x08, 0x02, 0x29, 0x02, 0x87, 0x9D, 0x79, 0xC7, 0x78, 0xEF, 0xFC, 0xFF, 0x8C, 0x1B,
+  0x89, 0xC6, 0x85, 0x64, 0x87, 0x01, 0x99, 0xDF, 0xA7, 0x9D, 0xD0, 0x34, 0x98, 0xE7, 0x85, 0x3B,
+  0x65, 0x64, 0x0D, 0x24, 0x77, 0xEF, 0x99, 0xD7, 0x06, 0x8D, 0xFC, 0xF7, 0x09, 0x0A, 0xE7, 0x09,
+  0x29, 0x0A, 0x25, 0x8D, 0xC7, 0x11, 0x6C, 0x1B, 0xFD, 0xEF, 0xFD, 0xF7, 0x65, 0x6C, 0x97, 0xEF,
+  0x09, 0x02, 0xA7, 0xA5, 0xE8, 0x09, 0x17, 0x87, 0x07, 0x0A, 0xB0, 0x34, 0x26, 0x85, 0x86, 0x9D,
+  0x55, 0x66, 0x75, 0x6E, 0x85, 0x6C, 0xE8, 0x01, 0x6D, 0x1B, 0x2A, 0x0A, 0x99, 0xCF, 0x98, 0xEF,
+  0x64, 0x3B, 0x66, 0x01, 0xED, 0x23, 0x69, 0xC6, 0x77, 0xE7, 0x07, 0x02, 0xF7, 0x8E, 0xCD, 0x23,
+  0x76, 0x6E, 0x89, 0xCE, 0x6A, 0xC6, 0x87, 0x09, 0x06, 0x85, 0x05, 0x8D, 0x76, 0x66, 0x35, 0x66,
+  0xF0, 0x3C, 0x8A, 0xCE, 0x2E, 0x2C, 0xB0, 0x3C, 0x0D, 0x2C, 0xF7, 0x86, 0x48, 0x0A, 0x69, 0xBE,
+  0x78, 0xD7, 0x49, 0xBE, 0x2D, 0x2C, 0xC6, 0x11, 0x0A, 0x0A, 0x18, 0x8F, 0xC6, 0x09, 0xE8, 0xAD,
+  0x87, 0xA5, 0x8C, 0x23, 0x64, 0x64, 0x4C, 0x1B, 0xF4, 0x5D, 0x28, 0x02, 0x17, 0x97, 0x11, 0x45,
+  0xFD, 0xE7, 0x67, 0x95, 0xAD, 0x1B, 0x28, 0x0A, 0x49, 0x02, 0xEB, 0x12, 0x46, 0x8D, 0xAA, 0xCE,
+  0x17, 0x9F, 0x07, 0x85, 0x86, 0x09, 0x2E, 0x24, 0x2B, 0x1B, 0xE6, 0x7C, 0x65, 0x3B, 0x8A, 0x0A,
+  0xE7, 0x01, 0x31, 0x45, 0x37, 0x8F, 0xD1, 0x3C, 0x0B, 0x13, 0xF4, 0x65, 0x08, 0xB6, 0x89, 0x0A,
+  0x11, 0x3D, 0x4B, 0x1B, 0x14, 0x5E, 0xA6, 0x01, 0x95, 0x66, 0xA5, 0x74, 0xA4, 0x43, 0x57, 0xBF,
+  0xAC, 0x23, 0xDD, 0xF7, 0xAA, 0xC6, 0x37, 0xAF, 0xCA, 0x12, 0xF1, 0x3C, 0x52, 0x4D, 0xAC, 0x1B,
+  0x16, 0x8F, 0x64, 0x33, 0x25, 0x5C, 0x72, 0x55, 0x72, 0x4D, 0xCC, 0x23, 0x0E, 0x2C, 0x37, 0xA7,
+  0xC7, 0xA5, 0x93, 0x55, 0xC4, 0x4B, 0x37, 0xB7, 0xED, 0x2B, 0x16, 0x97, 0x0E, 0x24, 0xD7, 0x86,
+  0x46, 0x95, 0x0A, 0x02, 0xA9, 0x12, 0x08, 0xAE, 0x2C, 0x1B, 0x8D, 0x13, 0x38, 0x8F, 0xD4, 0x5D,
+  0x6A, 0xBE, 0x55, 0x6E, 0x27, 0x85, 0x7A, 0xD7, 0xE6, 0x11, 0xD1, 0x34, 0xAA, 0x0A, 0x45, 0x64,
+  0x27, 0x12, 0x52, 0x45, 0xB3, 0x55, 0x17, 0xA7, 0x6C, 0x13, 0x47, 0x8D, 0x67, 0x9D, 0x86, 0x22,
+  0xA9, 0xCE, 0x57, 0xB7, 0x84, 0x33, 0x86, 0xA5, 0xEA, 0x12, 0x0A, 0x13, 0x68, 0x0A, 0xAD, 0x23,
+  0xB3, 0x5D, 0x29, 0xB6, 0x46, 0x1A, 0xC7, 0xAD, 0x69, 0x0A, 0xC6, 0x7C, 0xD3, 0x55, 0x6B, 0x1B,
+  0x14, 0x66, 0x26, 0x12, 0xC6, 0x74, 0xA6, 0x74, 0x78, 0xC7, 0xC5, 0x74, 0x27, 0x8D, 0x48, 0x12,
+  0x89, 0x12, 0x78, 0xCF, 0x84, 0x64, 0x28, 0x12, 0xF6, 0x8E, 0xB6, 0x7E, 0x57, 0xC7, 0xA7, 0x74,
+  0x2C, 0x13, 0xDB, 0xEF, 0xDC, 0xE7, 0x84, 0x43, 0xCD, 0x1B, 0x06, 0x12, 0xCB, 0x12, 0x87, 0x95,
+  0x64, 0x6C, 0x58, 0xC7, 0x98, 0xD7, 0xF0, 0x44, 0x28, 0xB6, 0x9A, 0xE7, 0x79, 0xE7, 0x0C, 0x13,
+  0x4E, 0x34, 0x45, 0x5C, 0xC7, 0x01, 0xE6, 0x84, 0x87, 0x22, 0x6C, 0x23, 0xA9, 0xC6, 0xE4, 0x4B,
+  0x0B, 0x1B, 0x4C, 0x13, 0x32, 0x45, 0xA9, 0x0A, 0x8C, 0x13, 0x66, 0x64, 0x66, 0x95, 0x96, 0x7E,
+  0x92, 0x5D, 0xE7, 0x7C, 0x2A, 0x02, 0x47, 0x64, 0xDB, 0xF7, 0x0E, 0x04, 0x10, 0x01, 0x01, 0x17,
+  0x02, 0x06, 0x02, 0x0E, 0x09, 0x06, 0x11, 0x03, 0x80, 0x26, 0x07, 0x09, 0x80, 0x1E, 0x05, 0x12,
+  0x05, 0x0B, 0x14, 0x00, 0x01, 0x18, 0x81, 0x42, 0xCF, 0x05, 0x08, 0x80, 0x58, 0xC0, 0x51, 0x4D,
+  0x81, 0x38, 0x7E, 0x05, 0x10, 0x81, 0x20, 0x53, 0xC0, 0xF4, 0x55, 0x80, 0x51, 0x02, 0x0F, 0x80,
+  0x51, 0xC0, 0xB4, 0x55, 0x80, 0x6D, 0x06, 0x07, 0x83, 0x70, 0x15, 0x2B, 0x33, 0x02, 0x15, 0x80,
+  0x5F, 0xC0, 0x0B, 0x0A, 0xC0, 0x68, 0x22, 0xC0, 0xCA, 0xA5, 0xC0, 0x48, 0xB6, 0x80, 0x3A, 0x02,
+  0x16, 0x8A, 0x6C, 0x88, 0x23, 0x1C, 0x1C, 0x23, 0x23, 0x1C, 0x95, 0xDE, 0x79, 0x05, 0x22, 0x0B,
+  0x0C, 0x80, 0x22, 0xC0, 0xC6, 0x2A, 0x80, 0xAF, 0x02, 0x2D, 0x06, 0x0D, 0x81, 0x2A, 0x13, 0x02,
+  0x14, 0x81, 0x13, 0x35, 0x02, 0x1D, 0x17, 0x11, 0x0E, 0x04, 0x10, 0x01, 0x01, 0x17, 0x02, 0x06,
+  0x02, 0x0E, 0x09, 0x06, 0x11, 0x03, 0x80, 0x26, 0x07, 0x09, 0x80, 0x1E, 0x05, 0x12, 0x05, 0x0B,
+  0x14, 0x00, 0x01, 0x18, 0x81, 0x42, 0xCF, 0x05, 0x08, 0x83, 0x58, 0x96, 0x38, 0x7E, 0x05, 0x10,
+  0x81, 0x20, 0x53, 0xC0, 0xF4, 0x55, 0x80, 0x51, 0x02, 0x0F, 0x80, 0x51, 0xC0, 0xB4, 0x55, 0x80,
+  0x6D, 0x06, 0x07, 0x80, 0x7F, 0x05, 0x15, 0x81, 0x2B, 0x5F, 0xC0, 0xE8, 0x32, 0xC0, 0x2A, 0xB6,
+  0x81, 0x5C, 0x63, 0x02, 0x16, 0x81, 0xB8, 0x3D, 0x05, 0x1C, 0xC0, 0x04, 0x54, 0x81, 0x43, 0x79,
+  0x0E, 0x22, 0x82, 0x79, 0x43, 0x0C, 0xC0, 0x45, 0x33, 0xC0, 0x26, 0x1A, 0x80, 0x0D, 0x03, 0x2D,
+  0x05, 0x0D, 0x80, 0x2A, 0x04, 0x13, 0x83, 0x35, 0x1D, 0x44, 0x44, 0x17, 0x11, 0x0E, 0x04, 0x10,
+  0x01, 0x01, 0x17, 0x02, 0x06, 0x02, 0x0E, 0x09, 0x06, 0x11, 0x03, 0x80, 0x26, 0x07, 0x09, 0x80,
+  0x1E, 0x05, 0x12, 0x05, 0x0B, 0x14, 0x00, 0x83, 0x18, 0x00, 0x42, 0xCF, 0x05, 0x08, 0x83, 0x49,
+  0x9C, 0x38, 0x7E, 0x05, 0x10, 0x81, 0x20, 0x53, 0xC0, 0xF4, 0x55, 0x80, 0x51, 0x02, 0x0F, 0x82,
+  0x4B, 0xAA, 0xDF, 0x05, 0x07, 0x81, 0x6D, 0x7F, 0x05, 0x15, 0x81, 0x5F, 0x29, 0xC0, 0x69, 0x43,
+  0x82, 0xAB, 0x5C, 0x34, 0x02, 0x16, 0xC0, 0x06, 0x7D, 0x06, 0x1C, 0xC0, 0xE5, 0x53, 0x81, 0x43,
+  0x79, 0x0D, 0x0C, 0x83, 0x22, 0x79, 0x43, 0x0C, 0xC0, 0xC6, 0x22, 0x80, 0xAF, 0x04, 0x2D, 0x05,
+  0x0D, 0x80, 0x2A, 0x04, 0x13, 0x80, 0x35, 0xC0, 0xA7, 0x01, 0x01, 0x44, 0x17, 0x11, 0x0E, 0x04,
+  0x10, 0x01, 0x01, 0x17, 0x02, 0x06, 0x02, 0x0E, 0x09, 0x06, 0x11, 0x03, 0x80, 0x26, 0x07, 0x09,
+  0x80, 0x1E, 0x05, 0x12, 0x05, 0x0B, 0x14, 0x00, 0x83, 0x18, 0x00, 0x42, 0xCF, 0x06, 0x08, 0x82,
+  0xC3, 0x38, 0x7E, 0x05, 0x10, 0x81, 0x20, 0x53, 0xC0, 0xF4, 0x55, 0x80, 0x51, 0x02, 0x0F, 0x82,
+  0x4B, 0xAA, 0x4A, 0x05, 0x07, 0x83, 0x6D, 0x7F, 0x15, 0x2B, 0x03, 0x15, 0x01, 0x29, 0xC0, 0x0A,
+  0x5C, 0x81, 0x0A, 0x46, 0xC0, 0xA7, 0xAD, 0x02, 0x16, 0x80, 0xD0, 0x06, 0x1C, 0x81, 0x9D, 0x43,
+  0x0F, 0x0C, 0x81, 0x43, 0x0C, 0xC0, 0x46, 0x33, 0x81, 0xE0, 0x0D, 0x04, 0x2D, 0x04, 0x0D, 0x81,
+  0x2A, 0x35, 0x03, 0x13, 0x84, 0x14, 0x13, 0x0D, 0x44, 0x44, 0x17, 0x11, 0x0E, 0x04, 0x10, 0x01,
+  0x01, 0x17, 0x02, 0x06, 0x02, 0x0E, 0x09, 0x06, 0x11, 0x03, 0x80, 0x26, 0x07, 0x09, 0x80, 0x1E,
+  0x05, 0x12, 0x05, 0x0B, 0x14, 0x00, 0x83, 0x18, 0x00, 0x42, 0xCF, 0x06, 0x08, 0x82, 0xAA, 0x38,
+  0x7E, 0x05, 0x10, 0x81, 0x20, 0x53, 0xC0, 0xF4, 0x55, 0x80, 0x51, 0x02, 0x0F, 0x82, 0x4B, 0x67,
+  0x45, 0x06, 0x07, 0x82, 0x7F, 0x15, 0x2B, 0x03, 0x15, 0x80, 0x2B, 0xC0, 0x08, 0x12, 0xC0, 0xAA,
+  0x74, 0x81, 0x0A, 0x46, 0xC0, 0xC8, 0xAD, 0x02, 0x16, 0x81, 0x88, 0x23, 0x03, 0x1C, 0x83, 0x3D,
+  0x23, 0x9D, 0x43, 0x10, 0x0C, 0x80, 0x22, 0xC0, 0xA6, 0x22, 0xC0, 0xA6, 0x09, 0x80, 0x0D, 0x04,
+  0x2D, 0x04, 0x0D, 0x82, 0x2A, 0x13, 0x14, 0x02, 0x13, 0x84, 0x14, 0x13, 0x35, 0x1D, 0x44, 0x17,
+  0x11, 0x0E, 0x04, 0x10, 0x01, 0x01, 0x17, 0x02, 0x06, 0x02, 0x0E, 0x09, 0x06, 0x11, 0x03, 0x80,
+  0x26, 0x07, 0x09, 0x80, 0x1E, 0x05, 0x12, 0x05, 0x0B, 0x14, 0x00, 0x83, 0x18, 0x00, 0x42, 0xCF,
+  0x04, 0x08, 0x84, 0x49, 0x08, 0x80, 0x38, 0xB0, 0x06, 0x10, 0x80, 0x53, 0xC0, 0xD4, 0x55, 0x03,
+  0x0F, 0x82, 0x4B, 0x67, 0x45, 0x06, 0x07, 0x82, 0x70, 0x15, 0x2B, 0x03, 0x15, 0x80, 0x40, 0xC0,
+  0x48, 0x1A, 0xC0, 0x4A, 0x8D, 0x81, 0x8D, 0x1B, 0xC0, 0xE8, 0xB5, 0x84, 0x16, 0x34, 0xB9, 0x88,
+  0x23, 0x04, 0x1C, 0x82, 0x23, 0x89, 0x43, 0x10, 0x0C, 0xC0, 0x46, 0x33, 0x82, 0xAF, 0x0D, 0x0D,
+  0x03, 0x2D, 0x05, 0x0D, 0x81, 0x2A, 0x13, 0x05, 0x14, 0x83, 0x35, 0x1D, 0x44, 0x44, 0x16, 0x11,
+  0x0E, 0x04, 0x10, 0x01, 0x01, 0x17, 0x02, 0x06, 0x02, 0x0E, 0x09, 0x06, 0x11, 0x03, 0x80, 0x26,
+  0x07, 0x09, 0x80, 0x1E, 0x05, 0x12, 0x05, 0x0B, 0x14, 0x00, 0x82, 0x18, 0x00, 0x42, 0xC0, 0x78,
+  0xBF, 0x06, 0x08, 0x82, 0x80, 0x38, 0xB0, 0x06, 0x10, 0x80, 0x53, 0xC0, 0xD4, 0x55, 0x03, 0x0F,
+  0x82, 0x4B, 0x67, 0x4A, 0x06, 0x07, 0x82, 0xE1, 0x15, 0x2B, 0x03, 0x15, 0x80, 0x40, 0xC0, 0x67,
+  0x22, 0xC0, 0xCA, 0xA5, 0x87, 0x54, 0x0A, 0x81, 0x16, 0x34, 0x6C, 0x88, 0x23, 0x03, 0x1C, 0x83,
+  0x3D, 0x23, 0xDE, 0x43, 0x10, 0x0C, 0x80, 0xBA, 0x02, 0x0D, 0x03, 0x2D, 0x04, 0x0D, 0x82, 0x2A,
+  0x35, 0x13, 0x05, 0x14, 0x80, 0x35, 0xC0, 0xA7, 0x01, 0x01, 0x44, 0x16, 0x11, 0x0E, 0x04, 0x10,
+  0x01, 0x01, 0x17, 0x02, 0x06, 0x02, 0x0E, 0x09, 0x06, 0x11, 0x03, 0x80, 0x26, 0x07, 0x09, 0x80,
+  0x1E, 0x05, 0x12, 0x05, 0x0B, 0x14, 0x00, 0x83, 0x18, 0x00, 0x42, 0x8A, 0x06, 0x08, 0x82, 0x80,
+  0x38, 0xB0, 0x07, 0x10, 0xC0, 0xF4, 0x55, 0x80, 0x51, 0x02, 0x0F, 0x82, 0x51, 0xAA, 0x4A, 0x03,
+  0x07, 0x01, 0x1A, 0x84, 0x07, 0xB1, 0x15, 0x15, 0x33, 0x02, 0x15, 0x80, 0x40, 0xC0, 0xC8, 0x32,
+  0x82, 0xC4, 0x4C, 0x1B, 0xC0, 0x28, 0xBE, 0x84, 0x63, 0x16, 0x6C, 0x3D, 0x23, 0x03, 0x1C, 0x83,
+  0x3D, 0xB2, 0xDE, 0x43, 0x0E, 0x0C, 0x80, 0x22, 0xC0, 0x45, 0x33, 0x82, 0xE0, 0x2D, 0x0D, 0x04,
+  0x2D, 0x04, 0x0D, 0x81, 0x2A, 0x13, 0x07, 0x14, 0xC0, 0xA7, 0x01, 0x02, 0x44, 0x15, 0x11, 0x0E,
+  0x04, 0x10, 0x01, 0x01, 0x17, 0x02, 0x06, 0x02, 0x0E, 0x09, 0x06, 0x11, 0x03, 0x80, 0x26, 0x07,
+  0x09, 0x80, 0x1E, 0x05, 0x12, 0x05, 0x0B, 0x14, 0x00, 0x84, 0x18, 0x00, 0x42, 0x8A, 0x36, 0x05,
+  0x08, 0xC0, 0xD3, 0x5D, 0x81, 0x38, 0xB0, 0x06, 0x10, 0x82, 0x53, 0x67, 0x51, 0x02, 0x0F, 0x80,
+  0x4B, 0xC0, 0xD4, 0x55, 0x80, 0xDF, 0x03, 0x07, 0x01, 0x1A, 0x83, 0x07, 0xB1, 0x15, 0x15, 0x02,
+  0x33, 0x81, 0x15, 0x13, 0xC0, 0xC9, 0x53, 0x82, 0x1B, 0x4C, 0x4C, 0xC0, 0x29, 0xBE, 0x83, 0x63,
+  0x16, 0x71, 0x3D, 0x04, 0x1C, 0x81, 0x3D, 0xEC, 0xC0, 0x85, 0x43, 0x0F, 0x0C, 0x80, 0x79, 0xC0,
+  0xC6, 0x2A, 0x83, 0xAF, 0x2D, 0x2D, 0x0D, 0x03, 0x2D, 0x04, 0x0D, 0x81, 0x2A, 0x13, 0x05, 0x14,
+  0x01, 0x13, 0x80, 0xED, 0x02, 0x44, 0x15, 0x11, 0x0E, 0x04, 0x10, 0x01, 0x01, 0x17, 0x02, 0x06,
+  0x02, 0x0E, 0x09, 0x06, 0x11, 0x03, 0x80, 0x26, 0x07, 0x09, 0x80, 0x1E, 0x05, 0x12, 0x05, 0x0B,
+  0x14, 0x00, 0x82, 0x18, 0x00, 0x42, 0xC0, 0x37, 0xBF, 0x80, 0x36, 0x04, 0x08, 0x83, 0x58, 0x9C,
+  0x38, 0xB0, 0x06, 0x10, 0x81, 0x83, 0x52, 0x03, 0x0F, 0x80, 0x4B, 0xC0, 0xB4, 0x55, 0x80, 0x6D,
+  0x04, 0x07, 0x84, 0x1A, 0x07, 0x7A, 0x15, 0x15, 0x02, 0x33, 0x81, 0x2B, 0xB3, 0xC0, 0xEA, 0x84,
+  0x88, 0xBB, 0x1B, 0x4C, 0x5C, 0xBE, 0x16, 0xEE, 0x31, 0x23, 0x03, 0x1C, 0x81, 0x3D, 0xEC, 0x10,
+  0x0C, 0xC0, 0x45, 0x33, 0x83, 0xC5, 0x61, 0x2D, 0x2D, 0x09, 0x0D, 0x80, 0x2A, 0x06, 0x14, 0x85,
+  0x13, 0x35, 0x3E, 0x1D, 0x44, 0x44, 0x15, 0x11, 0x0E, 0x04, 0x10, 0x01, 0x01, 0x17, 0x02, 0x06,
+  0x02, 0x0E, 0x09, 0x06, 0x11, 0x03, 0x80, 0x26, 0x07, 0x09, 0x80, 0x1E, 0x05, 0x12, 0x05, 0x0B,
+  0x16, 0x00, 0x81, 0x47, 0x9E, 0x04, 0x08, 0x84, 0x49, 0x58, 0x96, 0x38, 0x7E, 0x05, 0x10, 0x82,
+  0x20, 0xB4, 0x3B, 0x03, 0x0F, 0x82, 0x51, 0xAA, 0x6D, 0x05, 0x07, 0x88, 0x3F, 0xB1, 0x15, 0x2B,
+  0x33, 0x29, 0x33, 0x29, 0xEF, 0xC0, 0xCB, 0xA5, 0x82, 0xBB, 0x1B, 0x4C, 0xC0, 0x49, 0xC6, 0x83,
+  0x34, 0x6C, 0x88, 0x23, 0x04, 0x1C, 0x82, 0x3D, 0xEC, 0x22, 0x0E, 0x0C, 0x80, 0x79, 0xC0, 0xC6,
+  0x2A, 0x80, 0xAF, 0x02, 0x2D, 0x08, 0x0D, 0x01, 0x2A, 0x04, 0x14, 0x02, 0x13, 0x84, 0x3E, 0x2B,
+  0x35, 0x44, 0x44, 0x15, 0x11, 0x0E, 0x04, 0x10, 0x01, 0x01, 0x17, 0x02, 0x06, 0x02, 0x0E, 0x09,
+  0x06, 0x11, 0x03, 0x80, 0x26, 0x07, 0x09, 0x80, 0x1E, 0x05, 0x12, 0x05, 0x0B, 0x15, 0x00, 0x83,
+  0x18, 0x47, 0x8E, 0x36, 0x03, 0x08, 0x01, 0x49, 0x82, 0x96, 0x38, 0x7E, 0x05, 0x10, 0x82, 0x20,
+  0x97, 0x51, 0x03, 0x0F, 0x82, 0x51, 0xAA, 0x6D, 0x05, 0x07, 0x84, 0x3F, 0xB1, 0x15, 0x2B, 0x33,
+  0x02, 0x29, 0xC0, 0xE7, 0x32, 0xC0, 0x6B, 0xBE, 0x82, 0x4C, 0x1B, 0x4C, 0xC0, 0x49, 0xC6, 0xC0,
+  0xA6, 0xA5, 0x80, 0xB8, 0xC0, 0x84, 0x6C, 0x80, 0x23, 0x04, 0x1C, 0x81, 0x3D, 0xEC, 0xC0, 0x85,
+  0x43, 0x0D, 0x0C, 0x80, 0x22, 0xC0, 0x45, 0x33, 0x81, 0xC5, 0x61, 0x02, 0x2D, 0x08, 0x0D, 0x81,
+  0x2A, 0x13, 0x04, 0x14, 0x02, 0x13, 0x81, 0x14, 0x8F, 0xC0, 0x8A, 0x12, 0x81, 0x44, 0x1D, 0x15,
+  0x11, 0x0E, 0x04, 0x10, 0x01, 0x01, 0x17, 0x02, 0x06, 0x02, 0x0E, 0x09, 0x06, 0x11, 0x03, 0x80,
+  0x26, 0x07, 0x09, 0x80, 0x1E, 0x05, 0x12, 0x05, 0x0B, 0x15, 0x00, 0x80, 0x18, 0xC0, 0x77, 0xDF,
+  0xC0, 0x17, 0xAF, 0x80, 0x36, 0x03, 0x08, 0x01, 0x49, 0x82, 0x96, 0x38, 0x7E, 0x05, 0x10, 0x80,
+  0x20, 0xC0, 0x93, 0x4D, 0x80, 0x51, 0x03, 0x0F, 0x82, 0x51, 0xAA, 0x6D, 0x05, 0x07, 0x87, 0x3F,
+  0xB1, 0x15, 0x2B, 0x33, 0x29, 0x29, 0x33, 0xC0, 0x68, 0x43, 0x88, 0x8D, 0x1B, 0x0A, 0x4C, 0x46,
+  0x34, 0x71, 0x65, 0x23, 0x04, 0x1C, 0x81, 0x3D, 0xB2, 0xC0, 0x85, 0x43, 0x80, 0x43, 0x0C, 0x0C,
+  0x80, 0x22, 0xC0, 0x06, 0x2B, 0x81, 0xAF, 0x0D, 0x02, 0x2D, 0x08, 0x0D, 0x81, 0x2A, 0x13, 0x06,
+  0x14, 0x84, 0x13, 0x14, 0x2E, 0x77, 0x11, 0xC0, 0x67, 0x01, 0x80, 0x44, 0x14, 0x11, 0x0E, 0x04,
+  0x10, 0x01, 0x01, 0x17, 0x02, 0x06, 0x02, 0x0E, 0x09, 0x06, 0x11, 0x03, 0x80, 0x26, 0x07, 0x09,
+  0x80, 0x1E, 0x05, 0x12, 0x05, 0x0B, 0x15, 0x00, 0x81, 0x18, 0x47, 0xC0, 0x16, 0xAF, 0x80, 0x36,
+  0x03, 0x08, 0x01, 0x49, 0x82, 0x96, 0x38, 0x7E, 0x05, 0x10, 0x80, 0x20, 0xC0, 0x93, 0x4D, 0x80,
+  0x4B, 0x03, 0x0F, 0x82, 0x51, 0xAA, 0x6D, 0x05, 0x07, 0x86, 0x3F, 0xB1, 0x15, 0x2B, 0x33, 0x29,
+  0x29, 0xC0, 0xE9, 0x01, 0xC0, 0x2A, 0x5C, 0x87, 0x8D, 0x46, 0x0A, 0x4C, 0x46, 0xC6, 0xD1, 0x65,
+  0x05, 0x1C, 0x81, 0x3D, 0xB2, 0xC0, 0xA5, 0x43, 0x80, 0x43, 0x0C, 0x0C, 0x82, 0x79, 0xBA, 0x61,
+  0x0C, 0x0D, 0x81, 0x2A, 0x13, 0x06, 0x14, 0x86, 0x35, 0x6E, 0x4A, 0x98, 0xED, 0x44, 0x44, 0x14,
+  0x11, 0x0E, 0x04, 0x10, 0x01, 0x01, 0x17, 0x02, 0x06, 0x02, 0x0E, 0x09, 0x06, 0x11, 0x03, 0x80,
+  0x26, 0x07, 0x09, 0x80, 0x1E, 0x05, 0x12, 0x05, 0x0B, 0x15, 0x00, 0x81, 0x18, 0x00, 0xC0, 0x36,
+  0xB7, 0x80, 0x36, 0x03, 0x08, 0x01, 0x49, 0x82, 0x96, 0x38, 0x7E, 0x05, 0x10, 0x82, 0x20, 0xB5,
+  0x4B, 0x03, 0x0F, 0x82, 0x4B, 0xAA, 0x6D, 0x06, 0x07, 0xC0, 0xCA, 0x0A, 0x01, 0x15, 0x83, 0x14,
+  0x33, 0x5F, 0x0D, 0xC0, 0xAA, 0x74, 0x87, 0x72, 0x46, 0x0A, 0x1B, 0x46, 0x62, 0x4F, 0x65, 0x05,
+  0x1C, 0x81, 0x3D, 0x23, 0xC0, 0xA5, 0x43, 0x80, 0x43, 0x0B, 0x0C, 0x80, 0x22, 0xC0, 0x26, 0x33,
+  0x80, 0xE0, 0x0D, 0x0D, 0x80, 0x2A, 0x06, 0x14, 0x87, 0x13, 0x14, 0xA5, 0x24, 0x24, 0x6E, 0x44,
+  0x44, 0x14, 0x11, 0x0E, 0x04, 0x10, 0x01, 0x01, 0x17, 0x02, 0x06, 0x02, 0x0E, 0x09, 0x06, 0x11,
+  0x03, 0x80, 0x26, 0x07, 0x09, 0x80, 0x1E, 0x05, 0x12, 0x05, 0x0B, 0x15, 0x00, 0x81, 0x18, 0x21,
+  0xC0, 0x36, 0xB7, 0x80, 0x36, 0x03, 0x08, 0x01, 0x49, 0xC0, 0x92, 0x55, 0x81, 0x38, 0x7E, 0x06,
+  0x10, 0xC0, 0xF4, 0x55, 0x80, 0x51, 0x03, 0x0F, 0x80, 0x51, 0xC0, 0xB4, 0x55, 0x80, 0x6D, 0x06,
+  0x07, 0xC0, 0xCA, 0x0A, 0x01, 0x15, 0x82, 0x14, 0x29, 0x5F, 0xC0, 0x07, 0x12, 0xC0, 0x6B, 0x8D,
+  0x87, 0x72, 0x4D, 0x0A, 0x1B, 0x1B, 0xA6, 0x78, 0x65, 0x05, 0x1C, 0x81, 0x3D, 0x23, 0xC0, 0xA5,
+  0x43, 0x80, 0x43, 0x0B, 0x0C, 0x81, 0x79, 0xBA, 0x0E, 0x0D, 0x80, 0x35, 0x06, 0x14, 0x87, 0x13,
+  0x14, 0x84, 0x05, 0x24, 0x8F, 0x44, 0x1D, 0x14, 0x11, 0x0E, 0x04, 0x10, 0x01, 0x01, 0x17, 0x02,
+  0x06, 0x02, 0x0E, 0x09, 0x06, 0x11, 0x03, 0x80, 0x26, 0x07, 0x09, 0x80, 0x1E, 0x05, 0x12, 0x05,
+  0x0B, 0x15, 0x00, 0x81, 0x18, 0x00, 0xC0, 0x16, 0xAF, 0x80, 0x36, 0x03, 0x08, 0x01, 0x49, 0x82,
+  0x9C, 0x38, 0x7E, 0x04, 0x10, 0x83, 0x20, 0x53, 0x85, 0x51, 0x03, 0x0F, 0x82, 0x51, 0x9C, 0x6D,
+  0x06, 0x07, 0xC0, 0xCA, 0x0A, 0x84, 0x68, 0x15, 0x14, 0x29, 0x5F, 0xC0, 0xA7, 0x2A, 0xC0, 0x0B,
+  0xAE, 0x01, 0x0A, 0x01, 0x1B, 0x80, 0x4C, 0xC0, 0x09, 0xAE, 0x81, 0x88, 0x65, 0x05, 0x1C, 0x81,
+  0x3D, 0x23, 0xC0, 0xA5, 0x43, 0x80, 0x43, 0x05, 0x22, 0x04, 0x0C, 0x80, 0x22, 0xC0, 0x25, 0x33,
+  0x80, 0xE0, 0x0D, 0x0D, 0x81, 0x2A, 0x35, 0x07, 0x14, 0x87, 0x59, 0x8B, 0x05, 0x24, 0xF0, 0x11,
+  0x11, 0x1D, 0x13, 0x11, 0x0E, 0x04, 0x10, 0x01, 0x01, 0x17, 0x02, 0x06, 0x02, 0x0E, 0x09, 0x06,
+  0x11, 0x03, 0x80, 0x26, 0x07, 0x09, 0x80, 0x1E, 0x05, 0x12, 0x05, 0x0B, 0x15, 0x00, 0x81, 0x18,
+  0x0B, 0xC0, 0x16, 0xA7, 0x80, 0x36, 0x03, 0x08, 0x84, 0x49, 0x08, 0xB5, 0x38, 0x7E, 0x04, 0x10,
+  0x81, 0x20, 0x53, 0xC0, 0x15, 0x5E, 0x04, 0x0F, 0x82, 0x4B, 0x9C, 0x6D, 0x06, 0x07, 0x85, 0x70,
+  0x15, 0x15, 0x33, 0x2B, 0x29, 0xC0, 0xC9, 0x5B, 0x81, 0x0A, 0x46, 0x02, 0x1B, 0x80, 0x4C, 0xC0,
+  0x09, 0xAE, 0x81, 0x3D, 0x65, 0x06, 0x1C, 0x80, 0x23, 0xC0, 0xC5, 0x4B, 0x80, 0x43, 0x05, 0x22,
+  0x04, 0x0C, 0x80, 0x79, 0xC0, 0x85, 0x22, 0x80, 0x61, 0x0D, 0x0D, 0x81, 0x2A, 0x13, 0x06, 0x14,
+  0x88, 0x7B, 0xA5, 0x45, 0x24, 0x24, 0x4A, 0x2A, 0x44, 0x1D, 0x13, 0x11, 0x0E, 0x04, 0x10, 0x01,
+  0x01, 0x17, 0x02, 0x06, 0x02, 0x0E, 0x09, 0x06, 0x11, 0x03, 0x80, 0x26, 0x07, 0x09, 0x80, 0x1E,
+  0x05, 0x12, 0x05, 0x0B, 0x15, 0x00, 0x82, 0x18, 0x5B, 0x73, 0x06, 0x08, 0x81, 0xC3, 0x38, 0x05,
+  0x10, 0x82, 0x20, 0x90, 0x52, 0x04, 0x0F, 0x82, 0x4B, 0x9C, 0x6D, 0x06, 0x07, 0x85, 0x70, 0x15,
+  0x2B, 0x29, 0x2B, 0xD2, 0xC0, 0x0B, 0x85, 0x81, 0xF1, 0x46, 0x02, 0x1B, 0x80, 0x54, 0xC0, 0xE9,
+  0xA5, 0x83, 0x3D, 0x23, 0x1C, 0x1C, 0x02, 0x31, 0x02, 0x1C, 0xC0, 0xC5, 0x4B, 0x80, 0x43, 0x06,
+  0x22, 0x02, 0x0C, 0x80, 0x43, 0xC0, 0x25, 0x33, 0x80, 0xAF, 0x0E, 0x0D, 0x80, 0x2A, 0x05, 0x14,
+  0x01, 0x13, 0x88, 0x14, 0x77, 0x24, 0x24, 0x05, 0x24, 0xD3, 0x44, 0x1D, 0x13, 0x11, 0x0E, 0x04,
+  0x10, 0x01, 0x01, 0x17, 0x02, 0x06, 0x02, 0x0E, 0x09, 0x06, 0x11, 0x03, 0x80, 0x26, 0x07, 0x09,
+  0x80, 0x1E, 0x05, 0x12, 0x05, 0x0B, 0x15, 0x00, 0x82, 0x18, 0xD4, 0x69, 0x06, 0x08, 0x81, 0xC3,
+  0x38, 0x05, 0x10, 0x82, 0x20, 0x7C, 0x3B, 0x04, 0x0F, 0x80, 0x51, 0xC0, 0x73, 0x4D, 0x80, 0x6D,
+  0x05, 0x07, 0xC0, 0x8D, 0x23, 0x85, 0x7F, 0x15, 0x2B, 0x29, 0x2B, 0xEF, 0xC0, 0xCB, 0x9D, 0x81,
+  0xBB, 0x0A, 0x02, 0x1B, 0x82, 0x0A, 0xE2, 0xE3, 0x02, 0x1C, 0x02, 0x31, 0x02, 0x1C, 0x81, 0xF2,
+  0x43, 0x06, 0x22, 0x02, 0x0C, 0x80, 0x79, 0xC0, 0xA5, 0x22, 0x80, 0x61, 0x0E, 0x0D, 0x80, 0x2A,
+  0x05, 0x14, 0x01, 0x13, 0x89, 0x68, 0x64, 0x24, 0x05, 0x24, 0x24, 0xF3, 0x11, 0x1D, 0x44, 0x12,
+  0x11, 0x0E, 0x04, 0x10, 0x01, 0x01, 0x17, 0x02, 0x06, 0x02, 0x0E, 0x09, 0x06, 0x11, 0x03, 0x80,
+  0x26, 0x07, 0x09, 0x80, 0x1E, 0x05, 0x12, 0x05, 0x0B, 0x15, 0x00, 0x81, 0x18, 0x8A, 0x06, 0x08,
+  0x82, 0x49, 0x9C, 0x38, 0x05, 0x10, 0x82, 0x20, 0xB4, 0x3B, 0x04, 0x0F, 0x80, 0x4B, 0xC0, 0x53,
+  0x4D, 0x06, 0x07, 0xC0, 0x8D, 0x23, 0x84, 0x7F, 0x6F, 0x2B, 0x29, 0x29, 0xC0, 0xE7, 0x32, 0xC0,
+  0x2A, 0xAE, 0x81, 0x4C, 0x0A, 0x02, 0x1B, 0x82, 0x0A, 0x02, 0x65, 0x02, 0x1C, 0x02, 0x31, 0x02,
+  0x1C, 0x81, 0xF2, 0x43, 0x05, 0x22, 0x03, 0x0C, 0xC0, 0x45, 0x33, 0xC0, 0x26, 0x1A, 0x80, 0x61,
+  0x0E, 0x0D, 0x80, 0x35, 0x05, 0x14, 0x01, 0x13, 0x89, 0xC7, 0x4A, 0x24, 0x05, 0x05, 0x24, 0xF0,
+  0xED, 0x1D, 0x44, 0x12, 0x11, 0x0E, 0x04, 0x10, 0x01, 0x01, 0x17, 0x02, 0x06, 0x02, 0x0E, 0x09,
+  0x06, 0x11, 0x03, 0x80, 0x26, 0x07, 0x09, 0x80, 0x1E, 0x05, 0x12, 0x05, 0x0B, 0x16, 0x00, 0x80,
+  0x9E, 0x06, 0x08, 0x80, 0x58, 0xC0, 0x92, 0x55, 0x80, 0x38, 0x05, 0x10, 0x81, 0x38, 0x97, 0x05,
+  0x0F, 0xC0, 0x56, 0x6E, 0x81, 0x91, 0x1A, 0x05, 0x07, 0xC0, 0x8D, 0x23, 0x84, 0x7F, 0x15, 0x2B,
+  0x29, 0x5F, 0xC0, 0x47, 0x43, 0x82, 0xAB, 0x4C, 0x0A, 0x02, 0x1B, 0x82, 0x4D, 0x4F, 0xE3, 0x02,
+  0x1C, 0x02, 0x31, 0x02, 0x1C, 0x81, 0xF2, 0x43, 0x05, 0x22, 0x03, 0x0C, 0xC0, 0xE5, 0x2A, 0x80,
+  0xAF, 0x0E, 0x0D, 0x81, 0x2A, 0x13, 0x04, 0x14, 0x01, 0x13, 0x89, 0x48, 0xBF, 0x9F, 0x24, 0x05,
+  0x05, 0x24, 0x4A, 0x37, 0x1D, 0x13, 0x11, 0x0E, 0x04, 0x10, 0x01, 0x01, 0x17, 0x02, 0x06, 0x02,
+  0x0E, 0x09, 0x06, 0x11, 0x03, 0x80, 0x26, 0x07, 0x09, 0x80, 0x1E, 0x05, 0x12, 0x05, 0x0B, 0x15,
+  0x00, 0x82, 0x0B, 0xB6, 0x36, 0x05, 0x08, 0x82, 0x58, 0x96, 0x38, 0x05, 0x10, 0x80, 0x38, 0xC0,
+  0x93, 0x4D, 0x80, 0x51, 0x04, 0x0F, 0xC0, 0x56, 0x6E, 0xC0, 0x12, 0x4D, 0x80, 0x1A, 0x06, 0x07,
+  0x84, 0x77, 0x6F, 0x2B, 0x29, 0x5F, 0xC0, 0xC8, 0x53, 0x82, 0x0A, 0x1B, 0x0A, 0x02, 0x1B, 0x82,
+  0x5A, 0x78, 0x65, 0x02, 0x1C, 0x02, 0x31, 0x02, 0x1C, 0x81, 0xF2, 0x43, 0x05, 0x22, 0x02, 0x0C,
+  0x80, 0x22, 0xC0, 0x65, 0x1A, 0x80, 0x61, 0x0E, 0x0D, 0x81, 0x2A, 0x13, 0x04, 0x14, 0x01, 0x13,
+  0x82, 0x14, 0x84, 0x24, 0x02, 0x05, 0x81, 0x24, 0x57, 0xC0, 0x69, 0x12, 0x80, 0x1D, 0x13, 0x11,
+  0x0E, 0x04, 0x10, 0x01, 0x01, 0x17, 0x02, 0x06, 0x02, 0x0E, 0x09, 0x06, 0x11, 0x03, 0x80, 0x26,
+  0x07, 0x09, 0x80, 0x1E, 0x05, 0x12, 0x05, 0x0B, 0x15, 0x00, 0x81, 0x5B, 0x73, 0x06, 0x08, 0x82,
+  0x58, 0x91, 0x38, 0x05, 0x10, 0x82, 0x38, 0xB5, 0x51, 0x04, 0x0F, 0xC0, 0x56, 0x6E, 0xC0, 0xD1,
+  0x44, 0x80, 0x2E, 0x06, 0x07, 0x84, 0xA7, 0x6F, 0x2B, 0x5F, 0x29, 0xC0, 0x8A, 0x74, 0x82, 0x8D,
+  0x0A, 0x0A, 0x02, 0x1B, 0x85, 0xAB, 0x78, 0x65, 0xD5, 0x23, 0x1C, 0x02, 0x31, 0x02, 0x1C, 0x81,
+  0xF2, 0x43, 0x05, 0x22, 0x02, 0x0C, 0xC0, 0x45, 0x33, 0x80, 0xE0, 0x0F, 0x0D, 0x80, 0x2A, 0x05,
+  0x14, 0x01, 0x13, 0x82, 0x68, 0x92, 0x24, 0x04, 0x05, 0xC0, 0x0A, 0x1B, 0x81, 0x86, 0x1D, 0x12,
+  0x11, 0x0E, 0x04, 0x10, 0x01, 0x01, 0x17, 0x02, 0x06, 0x02, 0x0E, 0x09, 0x06, 0x11, 0x03, 0x80,
+  0x26, 0x07, 0x09, 0x80, 0x1E, 0x05, 0x12, 0x05, 0x0B, 0x15, 0x00, 0xC0, 0x58, 0xCF, 0x80, 0x69,
+  0x06, 0x08, 0x82, 0x58, 0x91, 0x38, 0x04, 0x10, 0x01, 0x20, 0xC0, 0xD4, 0x55, 0x80, 0x51, 0x04,
+  0x0F, 0xC0, 0x56, 0x6E, 0xC0, 0x70, 0x34, 0x80, 0xF4, 0x06, 0x07, 0x83, 0xA7, 0x6F, 0x15, 0x40,
+  0xC0, 0x48, 0x1A, 0xC0, 0x4B, 0x8D, 0x82, 0x54, 0x4D, 0x0A, 0x02, 0x1B, 0x85, 0x4D, 0x4F, 0x65,
+  0xD5, 0x23, 0x1C, 0x02, 0x31, 0x02, 0x1C, 0x81, 0xF2, 0x43, 0x04, 0x0C, 0x01, 0x22, 0x81, 0x0C,
+  0x22, 0xC0, 0xC5, 0x2A, 0x80, 0x61, 0x0E, 0x0D, 0x81, 0x2A, 0x13, 0x05, 0x14, 0x01, 0x13, 0x81,
+  0x59, 0x98, 0x05, 0x05, 0x81, 0xF0, 0x86, 0x13, 0x11, 0x0E, 0x04, 0x10, 0x01, 0x01, 0x17, 0x02,
+  0x06, 0x02, 0x0E, 0x09, 0x06, 0x11, 0x03, 0x80, 0x26, 0x07, 0x09, 0x80, 0x1E, 0x05, 0x12, 0x05,
+  0x0B, 0x15, 0x00, 0x81, 0xE4, 0x69, 0x06, 0x08, 0x82, 0x58, 0x91, 0x38, 0x04, 0x10, 0x83, 0x20,
+  0x53, 0x85, 0x51, 0x04, 0x0F, 0x80, 0x3B, 0xC0, 0x4F, 0x2C, 0x80, 0xF4, 0x05, 0x07, 0xC0, 0x8D,
+  0x23, 0x83, 0x66, 0x6F, 0x15, 0x40, 0xC0, 0xC7, 0x32, 0xC0, 0x0B, 0xAE, 0x82, 0x54, 0x0A, 0x0A,
+  0x02, 0x1B, 0x85, 0xAB, 0x74, 0x65, 0xD5, 0x23, 0x1C, 0x02, 0x31, 0x02, 0x1C, 0x81, 0xF2, 0x43,
+  0x04, 0x0C, 0x01, 0x22, 0x81, 0x0C, 0x79, 0xC0, 0x45, 0x1A, 0xC0, 0xA7, 0x09, 0x0E, 0x0D, 0x81,
+  0x2A, 0x13, 0x05, 0x14, 0x01, 0x13, 0x81, 0xC7, 0x45, 0x05, 0x05, 0x82, 0x4A, 0x37, 0x44, 0x12,
+  0x11, 0x0E, 0x04, 0x10, 0x01, 0x01, 0x17, 0x02, 0x06, 0x02, 0x0E, 0x09, 0x06, 0x11, 0x03, 0x80,
+  0x26, 0x07, 0x09, 0x80, 0x1E, 0x05, 0x12, 0x05, 0x0B, 0x15, 0x00, 0xC0, 0x37, 0xBF, 0x07, 0x08,
+  0x82, 0x58, 0x91, 0x38, 0x04, 0x10, 0x82, 0x20, 0x83, 0x52, 0x05, 0x0F, 0x80, 0x52, 0xC0, 0x2F,
+  0x2C, 0x80, 0xB7, 0x06, 0x07, 0x80, 0x66, 0xC0, 0x48, 0x02, 0xC0, 0x49, 0x0A, 0x80, 0x29, 0xC0,
+  0xE8, 0x5B, 0x83, 0x8D, 0x0A, 0x54, 0x0A, 0x02, 0x1B, 0x83, 0xAB, 0x74, 0x65, 0xD5, 0x02, 0x23,
+  0x01, 0x31, 0x01, 0x23, 0x82, 0x1C, 0xF2, 0x43, 0x07, 0x0C, 0xC0, 0x05, 0x33, 0x80, 0xAF, 0xC0,
+  0xA7, 0x09, 0x0E, 0x0D, 0x81, 0x2A, 0x13, 0x07, 0x14, 0x82, 0xA5, 0x24, 0x24, 0x04, 0x05, 0x80,
+  0x5D, 0xC0, 0x69, 0x12, 0x80, 0x44, 0x12, 0x11, 0x0E, 0x04, 0x10, 0x01, 0x01, 0x17, 0x02, 0x06,
+  0x02, 0x0E, 0x09, 0x06, 0x11, 0x03, 0x80, 0x26, 0x07, 0x09, 0x80, 0x1E, 0x05, 0x12, 0x05, 0x0B,
+  0x0B, 0x00, 0x80, 0x21, 0x06, 0x00, 0x82, 0x47, 0x21, 0x9E, 0x07, 0x08, 0x80, 0x58, 0xC0, 0x32,
+  0x4D, 0x80, 0x38, 0x04, 0x10, 0x82, 0x20, 0xF5, 0x3B, 0x05, 0x0F, 0x80, 0x52, 0xC0, 0x2F, 0x2C,
+  0x80, 0x2E, 0x06, 0x07, 0x80, 0x66, 0xC0, 0x48, 0x02, 0x80, 0x2B, 0xC0, 0x68, 0x1A, 0xC0, 0xAC,
+  0x9D, 0x83, 0x72, 0x0A, 0x54, 0x0A, 0x02, 0x1B, 0x83, 0x5C, 0xC8, 0x65, 0xD5, 0x03, 0x23, 0x02,
+  0x31, 0x80, 0x3D, 0xC0, 0xE4, 0x53, 0x80, 0x43, 0x06, 0x0C, 0x80, 0x79, 0xC0, 0x65, 0x22, 0x10,
+  0x0D, 0x81, 0x2A, 0x13, 0x07, 0x14, 0x82, 0xC0, 0x05, 0x24, 0x05, 0x05, 0xC0, 0xEA, 0x1A, 0x80,
+  0x44, 0x02, 0x75, 0x0F, 0x11, 0x0E, 0x04, 0x10, 0x01, 0x01, 0x17, 0x02, 0x06, 0x02, 0x0E, 0x09,
+  0x06, 0x11, 0x03, 0x80, 0x26, 0x07, 0x09, 0x80, 0x1E, 0x05, 0x12, 0x05, 0x0B, 0x0B, 0x00, 0x80,
+  0x21, 0x07, 0x00, 0x80, 0x12, 0xC0, 0x17, 0xAF, 0x07, 0x08, 0x82, 0x58, 0xF5, 0x38, 0x04, 0x10,
+  0x80, 0x20, 0xC0, 0x92, 0x4D, 0x06, 0x0F, 0x82, 0x52, 0x99, 0x2E, 0x06, 0x07, 0x81, 0x66, 0xC7,
+  0xC0, 0xE9, 0x09, 0xC0, 0xA9, 0x53, 0xC0, 0x6B, 0xBE, 0x83, 0x4C, 0x54, 0x54, 0x0A, 0x02, 0x1B,
+  0x83, 0xC4, 0x88, 0xD5, 0xD5, 0x03, 0x23, 0x02, 0x31, 0x80, 0x3D, 0xC0, 0x04, 0x54, 0x80, 0x43,
+  0x06, 0x0C, 0xC0, 0x25, 0x33, 0xC0, 0x06, 0x1A, 0x80, 0x2D, 0x0F, 0x0D, 0x80, 0x13, 0x07, 0x14,
+  0x82, 0x48, 0x84, 0x5D, 0x06, 0x05, 0x84, 0xF0, 0x86, 0x44, 0x75, 0x75, 0x0F, 0x11, 0x0E, 0x04,
+  0x10, 0x01, 0x01, 0x17, 0x02, 0x06, 0x02, 0x0E, 0x09, 0x06, 0x11, 0x03, 0x80, 0x26, 0x07, 0x09,
+  0x80, 0x1E, 0x05, 0x12, 0x05, 0x0B, 0x0B, 0x00, 0x80, 0x21, 0x05, 0x00, 0x01, 0x47, 0x81, 0xE5,
+  0xB6, 0x07, 0x08, 0xC0, 0xD6, 0x86, 0x81, 0x7C, 0x38, 0x05, 0x10, 0x81, 0xC9, 0x51, 0x04, 0x0F,
+  0x80, 0x3C, 0xC0, 0x15, 0x66, 0xC0, 0xEE, 0x23, 0x80, 0x2E, 0x06, 0x07, 0x82, 0x66, 0xC7, 0xD6,
+  0xC0, 0x2B, 0x8D, 0x83, 0x0A, 0x4C, 0x54, 0x54, 0x03, 0x0A, 0x83, 0x62, 0x3D, 0x1C, 0x1C, 0x03,
+  0x23, 0x02, 0x31, 0x80, 0x3D, 0xC0, 0x04, 0x54, 0xC0, 0x63, 0x3B, 0x06, 0x0C, 0xC0, 0xA5, 0x2A,
+  0x80, 0x2D, 0x0F, 0x0D, 0x81, 0x2A, 0x13, 0x07, 0x14, 0x82, 0x68, 0x64, 0x5D, 0x06, 0x05, 0xC0,
+  0xCD, 0x2B, 0x83, 0x37, 0x44, 0x75, 0x75, 0x0F, 0x11, 0x0E, 0x04, 0x10, 0x01, 0x01, 0x17, 0x02,
+  0x06, 0x02, 0x0E, 0x09, 0x06, 0x11, 0x03, 0x80, 0x26, 0x07, 0x09, 0x80, 0x1E, 0x05, 0x12, 0x05,
+  0x0B, 0x0B, 0x00, 0x80, 0x21, 0x05, 0x00, 0x82, 0x47, 0x18, 0xD4, 0xC0, 0xF6, 0x9E, 0x07, 0x08,
+  0xC0, 0xD6, 0x86, 0x81, 0x7C, 0x38, 0x04, 0x10, 0x82, 0x53, 0x85, 0x51, 0x04, 0x0F, 0x80, 0x3C,
+  0xC0, 0x15, 0x66, 0x81, 0x45, 0x2E, 0x06, 0x07, 0x81, 0x66, 0x2B, 0xC0, 0xC8, 0x32, 0xC0, 0x0C,
+  0xAE, 0x01, 0x4C, 0x01, 0x54, 0x03, 0x0A, 0xC0, 0xC8, 0xA5, 0x82, 0x31, 0x1C, 0x1C, 0x03, 0x23,
+  0x02, 0x31, 0x80, 0x3D, 0xC0, 0x04, 0x54, 0xC0, 0x83, 0x3B, 0x05, 0x0C, 0xC0, 0x45, 0x3B, 0x81,
+  0xC5, 0x2D, 0x0F, 0x0D, 0x81, 0x2A, 0x13, 0x06, 0x14, 0x83, 0x3E, 0x68, 0x45, 0x5D, 0x06, 0x05,
+  0x84, 0x57, 0xC7, 0x44, 0x75, 0x75, 0x0F, 0x11, 0x0E, 0x04, 0x10, 0x01, 0x01, 0x17, 0x02, 0x06,
+  0x02, 0x0E, 0x09, 0x06, 0x11, 0x03, 0x80, 0x26, 0x07, 0x09, 0x80, 0x1E, 0x05, 0x12, 0x05, 0x0B,
+  0x0B, 0x00, 0x80, 0x21, 0x05, 0x00, 0x82, 0x47, 0x18, 0xD4, 0xC0, 0xF6, 0x96, 0x07, 0x08, 0xC0,
+  0xD6, 0x86, 0x81, 0x6A, 0x38, 0x04, 0x10, 0xC0, 0x31, 0x3D, 0x80, 0x3B, 0x05, 0x0F, 0x83, 0x3C,
+  0x67, 0xDF, 0x1A, 0x06, 0x07, 0x80, 0xB7, 0xC0, 0x4A, 0x0A, 0xC0, 0xC8, 0x53, 0xC0, 0x6B, 0xBE,
+  0x01, 0x1B, 0x05, 0x0A, 0xC0, 0xC8, 0xA5, 0xC0, 0x84, 0x6C, 0x81, 0x23, 0x1C, 0x05, 0x23, 0x81,
+  0x31, 0x3D, 0xC0, 0x24, 0x54, 0x06, 0x0C, 0xC0, 0x06, 0x33, 0xC0, 0xE7, 0x11, 0x10, 0x0D, 0x81,
+  0x2A, 0x13, 0x06, 0x14, 0x82, 0x3E, 0xC1, 0x24, 0x06, 0x05, 0x81, 0x24, 0x55, 0xC0, 0xEA, 0x1A,
+  0x80, 0x11, 0x02, 0x75, 0x0E, 0x11, 0x0E, 0x04, 0x10, 0x01, 0x01, 0x17, 0x02, 0x06, 0x02, 0x0E,
+  0x09, 0x06, 0x11, 0x03, 0x80, 0x26, 0x07, 0x09, 0x80, 0x1E, 0x05, 0x12, 0x05, 0x0B, 0x0B, 0x00,
+  0x80, 0x21, 0x05, 0x00, 0x83, 0x47, 0x42, 0xCF, 0xD7, 0x07, 0x08, 0xC0, 0x95, 0x7E, 0x81, 0xE6,
+  0x20, 0x03, 0x10, 0x82, 0x20, 0x7C, 0x3B, 0x05, 0x0F, 0x82, 0x4B, 0xAA, 0x92, 0x06, 0x07, 0x81,
+  0x1A, 0xB7, 0xC0, 0x6A, 0x12, 0xC0, 0x89, 0x7C, 0x81, 0x0A, 0x1B, 0x06, 0x0A, 0xC0, 0xA8, 0xA5,
+  0x82, 0xE3, 0x23, 0x1C, 0x06, 0x23, 0x81, 0x3D, 0x95, 0x05, 0x0C, 0x80, 0x79, 0xC0, 0x86, 0x2A,
+  0x11, 0x0D, 0x80, 0x2A, 0x07, 0x14, 0x82, 0x7B, 0xF6, 0x24, 0x06, 0x05, 0x81, 0x24, 0x05, 0xC0,
+  0x4B, 0x23, 0x80, 0x75, 0xC0, 0x66, 0x09, 0x01, 0x75, 0x0E, 0x11, 0x0E, 0x04, 0x10, 0x01, 0x01,
+  0x17, 0x02, 0x06, 0x02, 0x0E, 0x09, 0x06, 0x11, 0x03, 0x80, 0x26, 0x07, 0x09, 0x80, 0x1E, 0x05,
+  0x12, 0x05, 0x0B, 0x0B, 0x00, 0x80, 0x21, 0x05, 0x00, 0x81, 0x47, 0x42, 0xC0, 0x58, 0xBF, 0x80,
+  0x49, 0x07, 0x08, 0xC0, 0x75, 0x76, 0x81, 0x10, 0x20, 0x03, 0x10, 0x80, 0x20, 0xC0, 0x51, 0x45,
+  0x80, 0x3B, 0x05, 0x0F, 0x82, 0x4B, 0x9C, 0xF7, 0x06, 0x07, 0x01, 0x1A, 0xC0, 0xA9, 0x1A, 0xC0,
+  0x6A, 0x9D, 0x80, 0x4C, 0x06, 0x0A, 0x80, 0x4D, 0xC0, 0xA8, 0x9D, 0x82, 0xE3, 0x23, 0x1C, 0x06,
+  0x23, 0x81, 0x31, 0xEC, 0x05, 0x0C, 0xC0, 0x45, 0x3B, 0xC0, 0x26, 0x1A, 0x11, 0x0D, 0x81, 0x2A,
+  0x48, 0x06, 0x14, 0x81, 0x7B, 0x8F, 0x07, 0x05, 0x85, 0x24, 0x05, 0x64, 0x61, 0x44, 0x75, 0x0F,
+  0x11, 0x0E, 0x04, 0x10, 0x01, 0x01, 0x17, 0x02, 0x06, 0x02, 0x0E, 0x09, 0x06, 0x11, 0x03, 0x80,
+  0x26, 0x07, 0x09, 0x80, 0x1E, 0x05, 0x12, 0x05, 0x0B, 0x0B, 0x00, 0x80, 0x21, 0x05, 0x00, 0x83,
+  0x47, 0x42, 0xBC, 0x49, 0x06, 0x08, 0x80, 0x7D, 0xC0, 0x54, 0x6E, 0x05, 0x10, 0x82, 0x20, 0xB4,
+  0x3B, 0x05, 0x0F, 0x81, 0x4B, 0x91, 0xC0, 0x6B, 0x13, 0x06, 0x07, 0x01, 0x1A, 0xC0, 0x08, 0x2B,
+  0xC0, 0x0B, 0xAE, 0x80, 0x4C, 0x07, 0x0A, 0xC0, 0x88, 0x9D, 0x01, 0x23, 0x80, 0x1C, 0x07, 0x23,
+  0x81, 0xB2, 0xDE, 0x04, 0x0C, 0xC0, 0xE5, 0x2A, 0x80, 0x5E, 0x10, 0x0D, 0x01, 0x2A, 0x07, 0x14,
+  0x81, 0x7B, 0xBF, 0x08, 0x05, 0x84, 0x24, 0x9F, 0x37, 0x44, 0x4E, 0x0F, 0x11, 0x0E, 0x04, 0x10,
+  0x01, 0x01, 0x17, 0x02, 0x06, 0x02, 0x0E, 0x09, 0x06, 0x11, 0x03, 0x80, 0x26, 0x07, 0x09, 0x80,
+  0x1E, 0x05, 0x12, 0x05, 0x0B, 0x0B, 0x00, 0x80, 0x21, 0x05, 0x00, 0x83, 0x47, 0x21, 0x8E, 0x36,
+  0x07, 0x08, 0x81, 0x80, 0x38, 0x05, 0x10, 0x81, 0x97, 0x3B, 0x05, 0x0F, 0x80, 0x4B, 0xC0, 0x12,
+  0x45, 0x80, 0xB7, 0x07, 0x07, 0x80, 0x2E, 0xC0, 0xC8, 0x43, 0xC0, 0x6B, 0xBE, 0x80, 0x54, 0x07,
+  0x0A, 0x83, 0xE2, 0x23, 0x23, 0x1C, 0x08, 0x23, 0x80, 0x89, 0x03, 0x0C, 0x81, 0x43, 0xBA, 0xC0,
+  0xA7, 0x09, 0x80, 0x61, 0x0D, 0x0D, 0x84, 0x2D, 0x0D, 0x2A, 0x2A, 0x13, 0x06, 0x14, 0x81, 0x7B,
+  0x7F, 0x09, 0x05, 0x83, 0x57, 0xD3, 0x44, 0x1D, 0x0F, 0x11, 0x0E, 0x04, 0x10, 0x01, 0x01, 0x17,
+  0x02, 0x06, 0x02, 0x0E, 0x09, 0x06, 0x11, 0x03, 0x80, 0x26, 0x07, 0x09, 0x80, 0x1E, 0x05, 0x12,
+  0x05, 0x0B, 0x0B, 0x00, 0x80, 0x21, 0x05, 0x00, 0x83, 0x47, 0x21, 0x9A, 0x36, 0x07, 0x08, 0x81,
+  0x9C, 0x38, 0x05, 0x10, 0xC0, 0xB3, 0x4D, 0x80, 0x51, 0x04, 0x0F, 0x83, 0x3C, 0x4B, 0x10, 0xB7,
+  0x06, 0x07, 0x81, 0xA8, 0x2E, 0xC0, 0xE9, 0x6C, 0xC0, 0xAB, 0xC6, 0x08, 0x0A, 0x82, 0xE2, 0x23,
+  0x23, 0x08, 0x1C, 0x81, 0x23, 0x89, 0x03, 0x0C, 0xC0, 0x45, 0x3B, 0xC0, 0x26, 0x1A, 0x11, 0x0D,
+  0x81, 0x2A, 0x13, 0x07, 0x14, 0x82, 0x7B, 0x77, 0x76, 0x09, 0x05, 0xC0, 0xEA, 0x1A, 0x01, 0x11,
+  0x80, 0x1D, 0x0E, 0x11, 0x0E, 0x04, 0x10, 0x01, 0x01, 0x17, 0x02, 0x06, 0x02, 0x0E, 0x09, 0x06,
+  0x11, 0x03, 0x80, 0x26, 0x07, 0x09, 0x80, 0x1E, 0x05, 0x12, 0x05, 0x0B, 0x0B, 0x00, 0x80, 0x21,
+  0x04, 0x00, 0x84, 0x18, 0x00, 0x0B, 0x73, 0x36, 0x06, 0x08, 0x82, 0x36, 0x91, 0x56, 0x04, 0x10,
+  0x80, 0x53, 0xC0, 0xD4, 0x55, 0x80, 0x51, 0x04, 0x0F, 0x81, 0x3C, 0x4B, 0xC0, 0x6F, 0x34, 0x80,
+  0xB7, 0x06, 0x07, 0x80, 0xA8, 0xC0, 0xAB, 0x23, 0xC0, 0xAA, 0x95, 0x81, 0x72, 0x4D, 0x06, 0x0A,
+  0x83, 0x4D, 0xE2, 0x65, 0x23, 0x08, 0x1C, 0x80, 0x23, 0xC0, 0xC4, 0x43, 0x03, 0x0C, 0xC0, 0x26,
+  0x33, 0xC0, 0xE5, 0x11, 0x11, 0x0D, 0x81, 0x2A, 0x13, 0x07, 0x14, 0x82, 0x7B, 0x2E, 0x76, 0x09,
+  0x05, 0x83, 0x84, 0x86, 0x1D, 0x1D, 0x0E, 0x11, 0x0E, 0x04, 0x10, 0x01, 0x01, 0x17, 0x02, 0x06,
+  0x02, 0x0E, 0x09, 0x06, 0x11, 0x03, 0x80, 0x26, 0x07, 0x09, 0x80, 0x1E, 0x05, 0x12, 0x05, 0x0B,
+  0x0B, 0x00, 0x80, 0x21, 0x04, 0x00, 0x84, 0x18, 0x00, 0xD4, 0xA0, 0x36, 0x06, 0x08, 0x80, 0x58,
+  0xC0, 0x31, 0x4D, 0x80, 0x56, 0x04, 0x10, 0x82, 0x83, 0x85, 0x51, 0x05, 0x0F, 0x82, 0x3B, 0x55,
+  0x2E, 0x06, 0x07, 0x80, 0x2E, 0xC0, 0x6A, 0x4C, 0xC0, 0x6B, 0xB6, 0x81, 0x4C, 0x1B, 0x06, 0x0A,
+  0x83, 0x4D, 0x6C, 0x65, 0x23, 0x08, 0x1C, 0x81, 0x23, 0x9D, 0x03, 0x0C, 0xC0, 0xC6, 0x2A, 0x80,
+  0x5E, 0x11, 0x0D, 0x81, 0x2A, 0x13, 0x07, 0x14, 0x82, 0x68, 0x8B, 0x76, 0x09, 0x05, 0x83, 0x8B,
+  0x0D, 0x1D, 0x1D, 0x0E, 0x11, 0x0E, 0x04, 0x10, 0x01, 0x01, 0x17, 0x02, 0x06, 0x02, 0x0E, 0x09,
+  0x06, 0x11, 0x03, 0x80, 0x26, 0x07, 0x09, 0x80, 0x1E, 0x05, 0x12, 0x05, 0x0B, 0x0B, 0x00, 0x80,
+  0x21, 0x04, 0x00, 0x83, 0x25, 0x00, 0xCF, 0x69, 0x07, 0x08, 0x81, 0x58, 0x6A, 0x05, 0x10, 0x81,
+  0x7C, 0x52, 0x06, 0x0F, 0xC0, 0x15, 0x66, 0x81, 0x24, 0x1A, 0x06, 0x07, 0x80, 0x64, 0xC0, 0x8B,
+  0x8D, 0x82, 0x72, 0x1B, 0x1B, 0x06, 0x0A, 0x83, 0x4D, 0xB9, 0x65, 0x23, 0x08, 0x1C, 0x80, 0x23,
+  0xC0, 0xE5, 0x4B, 0x02, 0x0C, 0x82, 0x79, 0xC5, 0x2D, 0x11, 0x0D, 0x81, 0x2A, 0x13, 0x07, 0x14,
+  0x81, 0x82, 0x45, 0x0A, 0x05, 0x83, 0x9F, 0x37, 0x11, 0x1D, 0x0E, 0x11, 0x0E, 0x04, 0x10, 0x01,
+  0x01, 0x17, 0x02, 0x06, 0x02, 0x0E, 0x09, 0x06, 0x11, 0x03, 0x80, 0x26, 0x07, 0x09, 0x80, 0x1E,
+  0x05, 0x12, 0x05, 0x0B, 0x0B, 0x00, 0x80, 0x21, 0x04, 0x00, 0x82, 0x25, 0x00, 0xBC, 0x08, 0x08,
+  0xC0, 0xD6, 0x7E, 0x80, 0x6A, 0x04, 0x10, 0x82, 0x20, 0x97, 0x51, 0x06, 0x0F, 0x82, 0xAA, 0x4A,
+  0x1A, 0x05, 0x07, 0x80, 0x2E, 0xC0, 0x0C, 0x44, 0xC0, 0x2B, 0xB6, 0x82, 0x4C, 0x1B, 0x1B, 0x07,
+  0x0A, 0x82, 0x16, 0xE3, 0x23, 0x08, 0x1C, 0x80, 0x23, 0xC0, 0xE5, 0x4B, 0x02, 0x0C, 0xC0, 0x25,
+  0x33, 0x80, 0xE0, 0x12, 0x0D, 0x81, 0x2A, 0x13, 0x06, 0x14, 0x83, 0x48, 0x8F, 0x24, 0x24, 0x09,
+  0x05, 0x83, 0x57, 0xC1, 0x11, 0x4E, 0x0E, 0x11, 0x0E, 0x04, 0x10, 0x01, 0x01, 0x17, 0x02, 0x06,
+  0x02, 0x0E, 0x09, 0x06, 0x11, 0x03, 0x80, 0x26, 0x07, 0x09, 0x80, 0x1E, 0x05, 0x12, 0x05, 0x0B,
+  0x0B, 0x00, 0x80, 0x21, 0x04, 0x00, 0x82, 0x25, 0x00, 0x8E, 0x08, 0x08, 0xC0, 0x76, 0x76, 0xC0,
+  0xF1, 0x44, 0x04, 0x10, 0x80, 0x20, 0xC0, 0x93, 0x4D, 0x80, 0x4B, 0x05, 0x0F, 0x80, 0x3C, 0xC0,
+  0x73, 0x55, 0x80, 0x92, 0x06, 0x07, 0x80, 0x2E, 0xC0, 0x4C, 0x54, 0xC0, 0x6B, 0xBE, 0xC0, 0x88,
+  0xCE, 0x01, 0x1B, 0x07, 0x0A, 0x83, 0x1F, 0xE3, 0x23, 0x23, 0x07, 0x1C, 0x80, 0x23, 0xC0, 0x05,
+  0x54, 0x02, 0x0C, 0xC0, 0xE6, 0x32, 0x80, 0xAF, 0x12, 0x0D, 0x81, 0x37, 0x13, 0x06, 0x14, 0x83,
+  0x48, 0x84, 0xA1, 0x24, 0x09, 0x05, 0x83, 0x5D, 0xA5, 0x44, 0x4E, 0x0E, 0x11, 0x0E, 0x04, 0x10,
+  0x01, 0x01, 0x17, 0x02, 0x06, 0x02, 0x0E, 0x09, 0x06, 0x11, 0x03, 0x80, 0x26, 0x07, 0x09, 0x80,
+  0x1E, 0x05, 0x12, 0x05, 0x0B, 0x0B, 0x00, 0x80, 0x21, 0x04, 0x00, 0x82, 0x25, 0x00, 0x9A, 0x08,
+  0x08, 0xC0, 0x15, 0x6E, 0x05, 0x10, 0x82, 0x20, 0xB5, 0x4B, 0x05, 0x0F, 0x80, 0x3C, 0xC0, 0x32,
+  0x4D, 0x80, 0x1A, 0x06, 0x07, 0x80, 0x2E, 0xC0, 0xAB, 0x64, 0xC0, 0x8B, 0xC6, 0xC0, 0x88, 0xCE,
+  0x01, 0x1B, 0x07, 0x0A, 0xC0, 0xA8, 0xA5, 0x82, 0x3D, 0x23, 0x23, 0x08, 0x1C, 0xC0, 0x25, 0x54,
+  0x01, 0x0C, 0x82, 0x79, 0xBA, 0x5E, 0x02, 0x61, 0x0E, 0x0D, 0x82, 0x2A, 0x37, 0x13, 0x06, 0x14,
+  0x82, 0x68, 0x64, 0x5D, 0x0A, 0x05, 0x80, 0x5D, 0xC0, 0x2A, 0x1B, 0x81, 0x11, 0x1D, 0x0E, 0x11,
+  0x0E, 0x04, 0x10, 0x01, 0x01, 0x17, 0x02, 0x06, 0x02, 0x0E, 0x09, 0x06, 0x11, 0x03, 0x80, 0x26,
+  0x07, 0x09, 0x80, 0x1E, 0x05, 0x12, 0x05, 0x0B, 0x0B, 0x00, 0x80, 0x21, 0x03, 0x00, 0x83, 0x18,
+  0x25, 0x0B, 0x73, 0x08, 0x08, 0x81, 0xC3, 0x56, 0x03, 0x10, 0x81, 0x20, 0x10, 0xC0, 0xD4, 0x55,
+  0x80, 0x4B, 0x05, 0x0F, 0x84, 0x3C, 0x6A, 0x1A, 0x07, 0x1A, 0x02, 0x07, 0x82, 0x1A, 0x07, 0x1A,
+  0xC0, 0x2B, 0x7D, 0x80, 0x0A, 0x02, 0x1B, 0x07, 0x0A, 0xC0, 0xC8, 0xA5, 0x82, 0x3D, 0x23, 0x23,
+  0x08, 0x1C, 0x83, 0x95, 0x0C, 0x0C, 0x79, 0xC0, 0x66, 0x22, 0x80, 0x5E, 0x02, 0x61, 0x0E, 0x0D,
+  0x82, 0x2A, 0x37, 0x13, 0x06, 0x14, 0xC0, 0x48, 0x02, 0x80, 0x4A, 0x0A, 0x05, 0x83, 0x24, 0x05,
+  0x64, 0xED, 0x0F, 0x11, 0x0E, 0x04, 0x10, 0x01, 0x01, 0x17, 0x02, 0x06, 0x02, 0x0E, 0x09, 0x06,
+  0x11, 0x03, 0x80, 0x26, 0x07, 0x09, 0x80, 0x1E, 0x05, 0x12, 0x05, 0x0B, 0x0B, 0x00, 0x80, 0x21,
+  0x03, 0x00, 0x01, 0x18, 0x80, 0xD4, 0xC0, 0x37, 0x97, 0x07, 0x08, 0x80, 0x36, 0xC0, 0x73, 0x55,
+  0x80, 0x56, 0x03, 0x10, 0x83, 0x20, 0x10, 0x67, 0x3C, 0x05, 0x0F, 0x81, 0x87, 0x53, 0x03, 0x1A,
+  0x83, 0x07, 0x1A, 0x1A, 0x07, 0xC0, 0xAC, 0x2B, 0xC0, 0xEA, 0xA5, 0x80, 0x4C, 0x02, 0x1B, 0x07,
+  0x0A, 0xC0, 0xC8, 0xA5, 0x82, 0x3D, 0x23, 0x23, 0x08, 0x1C, 0x82, 0xEC, 0x0C, 0x79, 0xC0, 0x26,
+  0x33, 0xC0, 0x06, 0x1A, 0x01, 0x61, 0x10, 0x0D, 0x81, 0x2A, 0x37, 0x03, 0x13, 0x03, 0x14, 0x82,
+  0x59, 0x4A, 0x24, 0x0B, 0x05, 0x81, 0x98, 0x2A, 0x0F, 0x11, 0x0E, 0x04, 0x10, 0x01, 0x01, 0x17,
+  0x02, 0x06, 0x02, 0x0E, 0x09, 0x06, 0x11, 0x03, 0x80, 0x26, 0x07, 0x09, 0x80, 0x1E, 0x05, 0x12,
+  0x05, 0x0B, 0x0B, 0x00, 0x80, 0x21, 0x03, 0x00, 0x01, 0x18, 0x81, 0xE4, 0x69, 0x07, 0x08, 0x80,
+  0x58, 0xC0, 0x31, 0x4D, 0x80, 0x56, 0x03, 0x10, 0x83, 0x20, 0x90, 0x85, 0x3C, 0x06, 0x0F, 0xC0,
+  0xAF, 0x34, 0x06, 0x1A, 0x80, 0x2E, 0xC0, 0x2B, 0x4C, 0xC0, 0x4A, 0xBE, 0x80, 0x4C, 0x07, 0x0A,
+  0x01, 0x1B, 0x80, 0x0A, 0xC0, 0xC8, 0xA5, 0x82, 0x3D, 0x23, 0x23, 0x08, 0x1C, 0xC0, 0x44, 0x5C,
+  0x81, 0xDE, 0x79, 0xC0, 0x06, 0x33, 0x80, 0xAF, 0x12, 0x0D, 0x81, 0x2A, 0x37, 0x03, 0x13, 0x03,
+  0x14, 0x82, 0x59, 0x45, 0x24, 0x09, 0x05, 0x01, 0x24, 0x83, 0x9F, 0x6E, 0x11, 0x1D, 0x0D, 0x11,
+  0x0E, 0x04, 0x10, 0x01, 0x01, 0x17, 0x02, 0x06, 0x02, 0x0E, 0x09, 0x06, 0x11, 0x03, 0x80, 0x26,
+  0x07, 0x09, 0x80, 0x1E, 0x05, 0x12, 0x05, 0x0B, 0x0B, 0x00, 0x80, 0x21, 0x03, 0x00, 0xC1, 0x58,
+  0xEF, 0xC0, 0x58, 0xB7, 0x07, 0x08, 0x82, 0x60, 0xD8, 0xE6, 0x04, 0x10, 0x82, 0x20, 0x6A, 0x52,
+  0x06, 0x0F, 0x80, 0x3B, 0xC0, 0x4E, 0x2C, 0x80, 0x2E, 0x04, 0x1A, 0x81, 0x07, 0xF0, 0xC0, 0x0B,
+  0x75, 0x81, 0x0A, 0x1B, 0x07, 0x0A, 0x01, 0x1B, 0x80, 0x0A, 0xC0, 0xA8, 0xA5, 0x82, 0x3D, 0x23,
+  0x23, 0x08, 0x1C, 0xC0, 0x44, 0x64, 0x81, 0x89, 0x22, 0xC0, 0xC6, 0x2A, 0x80, 0x5E, 0x11, 0x0D,
+  0x01, 0x2A, 0x04, 0x13, 0x03, 0x14, 0x82, 0xC7, 0x45, 0x24, 0x09, 0x05, 0x01, 0x24, 0x83, 0x57,
+  0xD3, 0x44, 0x1D, 0x0D, 0x11, 0x0E, 0x04, 0x10, 0x01, 0x01, 0x17, 0x02, 0x06, 0x02, 0x0E, 0x09,
+  0x06, 0x11, 0x03, 0x80, 0x26, 0x07, 0x09, 0x80, 0x1E, 0x05, 0x12, 0x05, 0x0B, 0x0B, 0x00, 0x80,
+  0x21, 0x03, 0x00, 0xC0, 0x58, 0xEF, 0x82, 0x00, 0x9A, 0x36, 0x06, 0x08, 0x80, 0x60, 0xC0, 0x76,
+  0x76, 0x81, 0x10, 0x20, 0x03, 0x10, 0x82, 0x20, 0x7C, 0x3B, 0x06, 0x0F, 0x82, 0x52, 0x99, 0x2E,
+  0x04, 0x1A, 0x80, 0x07, 0xC0, 0x8C, 0x2B, 0xC0, 0xCB, 0xA5, 0x81, 0x54, 0x1B, 0x07, 0x0A, 0x01,
+  0x1B, 0x84, 0x0A, 0x1F, 0x3D, 0x23, 0x23, 0x08, 0x1C, 0x84, 0x65, 0x89, 0x79, 0xBA, 0x61, 0x11,
+  0x0D, 0x01, 0x2A, 0x04, 0x13, 0x02, 0x14, 0x83, 0x13, 0x82, 0x45, 0x24, 0x0B, 0x05, 0x81, 0x24,
+  0xBF, 0x0F, 0x11, 0x0E, 0x04, 0x10, 0x01, 0x01, 0x17, 0x02, 0x06, 0x02, 0x0E, 0x09, 0x06, 0x11,
+  0x03, 0x80, 0x26, 0x07, 0x09, 0x80, 0x1E, 0x05, 0x12, 0x05, 0x0B, 0x0B, 0x00, 0x80, 0x21, 0x03,
+  0x00, 0xC0, 0x58, 0xEF, 0x80, 0x00, 0xC0, 0x37, 0x9F, 0x80, 0x36, 0x06, 0x08, 0x80, 0x60, 0xC0,
+  0xD4, 0x65, 0x82, 0x56, 0x20, 0x20, 0x02, 0x10, 0x82, 0x20, 0x91, 0x3C, 0x06, 0x0F, 0x82, 0x85,
+  0x4A, 0x2E, 0x05, 0x1A, 0xC0, 0x4C, 0x4C, 0xC0, 0x6B, 0xBE, 0x80, 0x1B, 0x07, 0x0A, 0x02, 0x1B,
+  0x84, 0x0A, 0x16, 0x3D, 0x23, 0x23, 0x08, 0x1C, 0x81, 0x65, 0x89, 0xC0, 0x45, 0x33, 0x80, 0xC5,
+  0x12, 0x0D, 0x83, 0x2A, 0x37, 0x13, 0x14, 0x02, 0x13, 0x02, 0x14, 0x83, 0x13, 0xF6, 0x24, 0x24,
+  0x0C, 0x05, 0x81, 0x84, 0x86, 0x0E, 0x11, 0x0E, 0x04, 0x10, 0x01, 0x01, 0x17, 0x02, 0x06, 0x02,
+  0x0E, 0x09, 0x06, 0x11, 0x03, 0x80, 0x26, 0x07, 0x09, 0x80, 0x1E, 0x05, 0x12, 0x05, 0x0B, 0x0B,
+  0x00, 0x80, 0x21, 0x03, 0x00, 0x83, 0x18, 0x0B, 0x69, 0x36, 0x06, 0x08, 0x80, 0xA2, 0xC0, 0x31,
+  0x4D, 0x82, 0x38, 0x20, 0x20, 0x02, 0x10, 0x80, 0x20, 0xC0, 0x92, 0x4D, 0x80, 0x3C, 0x06, 0x0F,
+  0x82, 0xC9, 0x1A, 0x2E, 0x03, 0x1A, 0x81, 0x07, 0xCA, 0xC0, 0xCB, 0x64, 0xC0, 0xAB, 0xC6, 0x80,
+  0x1B, 0x07, 0x0A, 0x02, 0x1B, 0x84, 0x46, 0x16, 0x3D, 0x23, 0x23, 0x08, 0x1C, 0x80, 0x65, 0xC0,
+  0xC4, 0x43, 0xC0, 0x25, 0x33, 0xC0, 0x05, 0x12, 0x12, 0x0D, 0x81, 0x2A, 0x37, 0x07, 0x14, 0x80,
+  0x48, 0xC0, 0xC9, 0x12, 0x01, 0x24, 0x0C, 0x05, 0x81, 0x92, 0xED, 0x0E, 0x11, 0x0E, 0x04, 0x10,
+  0x01, 0x01, 0x17, 0x02, 0x06, 0x02, 0x0E, 0x09, 0x06, 0x11, 0x03, 0x80, 0x26, 0x07, 0x09, 0x80,
+  0x1E, 0x05, 0x12, 0x05, 0x0B, 0x0B, 0x00, 0x80, 0x21, 0x03, 0x00, 0x80, 0x18, 0xC0, 0x58, 0xD7,
+  0x81, 0x69, 0x36, 0x06, 0x08, 0xC0, 0x75, 0x76, 0x06, 0x10, 0x82, 0x20, 0xB5, 0x3C, 0x06, 0x0F,
+  0x80, 0x97, 0x04, 0x1A, 0x01, 0x07, 0xC0, 0x6A, 0x23, 0xC0, 0x2B, 0x75, 0xC0, 0xAB, 0xCE, 0x80,
+  0x1B, 0x07, 0x0A, 0x02, 0x1B, 0x84, 0x5A, 0xB9, 0x3D, 0x23, 0x23, 0x08, 0x1C, 0x80, 0xD5, 0xC0,
+  0xE5, 0x4B, 0xC0, 0x25, 0x33, 0xC0, 0xE5, 0x11, 0x11, 0x0D, 0x01, 0x2A, 0x80, 0x13, 0x07, 0x14,
+  0x83, 0x48, 0xBF, 0xA1, 0x24, 0x0C, 0x05, 0x81, 0x4A, 0x2A, 0x0E, 0x11, 0x0E, 0x04, 0x10, 0x01,
+  0x01, 0x17, 0x02, 0x06, 0x02, 0x0E, 0x09, 0x06, 0x11, 0x03, 0x80, 0x26, 0x07, 0x09, 0x80, 0x1E,
+  0x05, 0x12, 0x05, 0x0B, 0x0B, 0x00, 0x02, 0x21, 0x83, 0x00, 0x18, 0x00, 0xE4, 0xC0, 0xF7, 0x96,
+  0x06, 0x08, 0x82, 0x60, 0x80, 0x56, 0x06, 0x10, 0x81, 0xC9, 0x3C, 0x06, 0x0F, 0x81, 0x6A, 0x2E,
+  0x03, 0x1A, 0x81, 0x07, 0xA8, 0xC0, 0x6B, 0x23, 0xC0, 0x4B, 0x85, 0x81, 0x72, 0x1B, 0x07, 0x0A,
+  0x01, 0x1B, 0x84, 0x0A, 0x5C, 0xB9, 0x3D, 0x23, 0x09, 0x1C, 0x80, 0xD5, 0xC0, 0x05, 0x54, 0xC0,
+  0x05, 0x2B, 0xC0, 0xE5, 0x11, 0x11, 0x0D, 0x01, 0x2A, 0x80, 0x13, 0x05, 0x14, 0x01, 0x13, 0x83,
+  0x48, 0xF3, 0xA1, 0x24, 0x0C, 0x05, 0x81, 0x45, 0xD2, 0x0E, 0x11, 0x0E, 0x04, 0x10, 0x01, 0x01,
+  0x17, 0x02, 0x06, 0x02, 0x0E, 0x09, 0x06, 0x11, 0x03, 0x80, 0x26, 0x07, 0x09, 0x80, 0x1E, 0x05,
+  0x12, 0x05, 0x0B, 0x0B, 0x00, 0x02, 0x21, 0x82, 0x00, 0x18, 0x00, 0xC0, 0x58, 0xBF, 0x80, 0x49,
+  0x06, 0x08, 0x81, 0x58, 0x91, 0x07, 0x10, 0x81, 0x67, 0x3C, 0x05, 0x0F, 0x82, 0x3B, 0x56, 0x2E,
+  0x03, 0x1A, 0x82, 0x07, 0xA8, 0xCA, 0xC0, 0x4B, 0x85, 0x81, 0x72, 0x1B, 0x06, 0x0A, 0x02, 0x1B,
+  0x84, 0x0A, 0xC4, 0x6C, 0x3D, 0x23, 0x09, 0x1C, 0x81, 0xD5, 0x95, 0xC0, 0xC5, 0x2A, 0x80, 0x61,
+  0x11, 0x0D, 0x81, 0x2A, 0x37, 0x05, 0x14, 0x02, 0x13, 0x83, 0x48, 0x84, 0xA1, 0x24, 0x0C, 0x05,
+  0x81, 0x24, 0xA5, 0x0E, 0x11, 0x0E, 0x04, 0x10, 0x01, 0x01, 0x17, 0x02, 0x06, 0x02, 0x0E, 0x09,
+  0x06, 0x11, 0x03, 0x80, 0x26, 0x07, 0x09, 0x80, 0x1E, 0x05, 0x12, 0x05, 0x0B, 0x0B, 0x00, 0x02,
+  0x21, 0x82, 0x00, 0x18, 0x00, 0xC0, 0x38, 0xB7, 0x80, 0x49, 0x06, 0x08, 0x82, 0xD8, 0x6A, 0x20,
+  0x05, 0x10, 0x81, 0x53, 0x67, 0x06, 0x0F, 0x80, 0x3B, 0xC0, 0x4F, 0x34, 0x80, 0x2E, 0x04, 0x1A,
+  0x80, 0xA8, 0xC0, 0x8B, 0x23, 0xC0, 0x8B, 0x85, 0x81, 0x72, 0x1B, 0x06, 0x0A, 0x02, 0x1B, 0x82,
+  0x0A, 0xC4, 0x6C, 0xC0, 0xA5, 0x6C, 0x82, 0x23, 0x1C, 0x23, 0x08, 0x1C, 0x80, 0xF8, 0xC0, 0xA6,
+  0x2A, 0x81, 0x61, 0x2D, 0x10, 0x0D, 0x81, 0x2A, 0x13, 0x05, 0x14, 0x02, 0x13, 0x82, 0x6E, 0x64,
+  0x24, 0x0C, 0x05, 0x81, 0x24, 0x55, 0xC0, 0x0A, 0x1B, 0x03, 0x11, 0x04, 0x1D, 0x03, 0x11, 0x01,
+  0x1D, 0x0E, 0x04, 0x10, 0x01, 0x01, 0x17, 0x02, 0x06, 0x02, 0x0E, 0x09, 0x06, 0x11, 0x03, 0x80,
+  0x26, 0x07, 0x09, 0x80, 0x1E, 0x05, 0x12, 0x05, 0x0B, 0x0B, 0x00, 0x02, 0x21, 0x80, 0x00, 0xC0,
+  0x58, 0xEF, 0x80, 0x00, 0xC0, 0x38, 0xAF, 0x80, 0x49, 0x05, 0x08, 0x80, 0xA9, 0xC0, 0x35, 0x6E,
+  0x07, 0x10, 0xC0, 0x10, 0x3D, 0xC0, 0x34, 0x5E, 0x05, 0x0F, 0x83, 0x87, 0x52, 0x99, 0x2E, 0x03,
+  0x1A, 0x81, 0x07, 0xA8, 0xC0, 0x8B, 0x23, 0xC0, 0xCB, 0x9D, 0x81, 0x72, 0x1B, 0x06, 0x0A, 0x02,
+  0x1B, 0x80, 0x0A, 0xC0, 0x09, 0xB6, 0x82, 0xB9, 0x88, 0x23, 0x09, 0x1C, 0x81, 0xD5, 0xF8, 0xC0,
+  0xA6, 0x2A, 0x81, 0x61, 0x2D, 0x10, 0x0D, 0x81, 0x2A, 0x13, 0x03, 0x14, 0x03, 0x13, 0x83, 0x35,
+  0x59, 0x4A, 0x24, 0x0C, 0x05, 0x83, 0x24, 0x55, 0x84, 0x86, 0x02, 0x11, 0x04, 0x1D, 0x03, 0x11,
+  0x01, 0x1D, 0x0E, 0x04, 0x10, 0x01, 0x01, 0x17, 0x02, 0x06, 0x02, 0x0E, 0x09, 0x06, 0x11, 0x03,
+  0x80, 0x26, 0x07, 0x09, 0x80, 0x1E, 0x05, 0x12, 0x05, 0x0B, 0x0B, 0x00, 0x02, 0x21, 0x02, 0x00,
+  0x80, 0x8E, 0x06, 0x08, 0x80, 0x60, 0xC0, 0xD3, 0x5D, 0x80, 0x56, 0x05, 0x10, 0x82, 0x20, 0x6A,
+  0x3B, 0x05, 0x0F, 0x83, 0x87, 0x85, 0x45, 0x2E, 0x03, 0x1A, 0x81, 0x07, 0xA8, 0xC0, 0xEB, 0x33,
+  0xC0, 0x2A, 0xAE, 0x01, 0x1B, 0x06, 0x0A, 0x02, 0x1B, 0x80, 0x0A, 0xC0, 0x09, 0xAE, 0x82, 0x16,
+  0xD0, 0x23, 0x09, 0x1C, 0x81, 0xD5, 0xF8, 0xC0, 0x86, 0x2A, 0x11, 0x0D, 0x81, 0x2A, 0x37, 0x04,
+  0x14, 0x03, 0x13, 0x82, 0x35, 0x82, 0x45, 0x0D, 0x05, 0x83, 0x24, 0x76, 0x64, 0x0D, 0x02, 0x11,
+  0x04, 0x1D, 0x03, 0x11, 0x01, 0x1D, 0x0E, 0x04, 0x10, 0x01, 0x01, 0x17, 0x02, 0x06, 0x02, 0x0E,
+  0x09, 0x06, 0x11, 0x03, 0x80, 0x26, 0x07, 0x09, 0x80, 0x1E, 0x05, 0x12, 0x05, 0x0B, 0x0B, 0x00,
+  0x02, 0x21, 0x02, 0x00, 0x81, 0x73, 0x36, 0x05, 0x08, 0x82, 0x58, 0x91, 0x56, 0x05, 0x10, 0x80,
+  0x20, 0xC0, 0x51, 0x45, 0x06, 0x0F, 0x83, 0x87, 0x67, 0xDF, 0x2E, 0x03, 0x1A, 0x81, 0x07, 0xF7,
+  0xC0, 0x8B, 0x54, 0xC0, 0x8A, 0xBE, 0x80, 0x1B, 0x07, 0x0A, 0x02, 0x1B, 0x82, 0x0A, 0xA6, 0x16,
+  0xC0, 0xC5, 0x7C, 0x80, 0x23, 0x09, 0x1C, 0x80, 0x3D, 0xC0, 0x26, 0x5C, 0xC0, 0x26, 0x1A, 0x80,
+  0x2D, 0x10, 0x0D, 0x81, 0x2A, 0x37, 0x04, 0x14, 0x03, 0x13, 0x81, 0x35, 0x8F, 0x0F, 0x05, 0x82,
+  0x24, 0x4A, 0x2A, 0x02, 0x11, 0x04, 0x1D, 0x03, 0x11, 0x01, 0x1D, 0x0E, 0x04, 0x10, 0x01, 0x01,
+  0x17, 0x02, 0x06, 0x02, 0x0E, 0x09, 0x06, 0x11, 0x03, 0x80, 0x26, 0x07, 0x09, 0x80, 0x1E, 0x05,
+  0x12, 0x05, 0x0B, 0x0B, 0x00, 0x02, 0x21, 0x01, 0x00, 0x82, 0x0B, 0xA0, 0x36, 0x05, 0x08, 0xC0,
+  0xB7, 0x7E, 0x80, 0x6A, 0x07, 0x10, 0xC0, 0x92, 0x4D, 0x06, 0x0F, 0x83, 0x87, 0xC9, 0x92, 0x2E,
+  0x03, 0x1A, 0x80, 0x07, 0xC0, 0x8B, 0x1B, 0xC0, 0x4B, 0x75, 0x81, 0xF1, 0x1B, 0x07, 0x0A, 0x02,
+  0x1B, 0x84, 0x0A, 0xA6, 0x16, 0x78, 0x31, 0x09, 0x1C, 0x80, 0x3D, 0xC0, 0xC5, 0x53, 0x81, 0xAF,
+  0x2D, 0x10, 0x0D, 0x81, 0x2A, 0x37, 0x04, 0x14, 0x03, 0x13, 0x81, 0x3E, 0xC0, 0x10, 0x05, 0x84,
+  0x9F, 0x6E, 0x11, 0x1D, 0x11, 0x04, 0x1D, 0x03, 0x11, 0x01, 0x1D, 0x0E, 0x04, 0x10, 0x01, 0x01,
+  0x17, 0x02, 0x06, 0x02, 0x0E, 0x09, 0x06, 0x11, 0x03, 0x80, 0x26, 0x07, 0x09, 0x80, 0x1E, 0x05,
+  0x12, 0x05, 0x0B, 0x0B, 0x00, 0x02, 0x21, 0x01, 0x00, 0x82, 0x0B, 0xA0, 0x36, 0x04, 0x08, 0x81,
+  0x60, 0xAC, 0x06, 0x10, 0x82, 0x20, 0x10, 0xB5, 0x06, 0x0F, 0x80, 0x87, 0xC0, 0x51, 0x45, 0x80,
+  0xF7, 0x04, 0x1A, 0x80, 0x07, 0xC0, 0xAB, 0x23, 0xC0, 0xCB, 0x95, 0x81, 0x1B, 0x46, 0x0B, 0x0A,
+  0x83, 0x62, 0x16, 0x4F, 0x31, 0x0A, 0x1C, 0xC0, 0x66, 0x43, 0x81, 0xAF, 0x2D, 0x10, 0x0D, 0x81,
+  0x2A, 0x13, 0x04, 0x14, 0x03, 0x13, 0x81, 0x14, 0x77, 0x10, 0x05, 0x84, 0x99, 0xD3, 0x11, 0x1D,
+  0x11, 0x04, 0x1D, 0x03, 0x11, 0x01, 0x1D, 0x0E, 0x04, 0x10, 0x01, 0x01, 0x17, 0x02, 0x06, 0x02,
+  0x0E, 0x09, 0x06, 0x11, 0x03, 0x80, 0x26, 0x07, 0x09, 0x80, 0x1E, 0x05, 0x12, 0x05, 0x0B, 0x0B,
+  0x00, 0x80, 0x21, 0x03, 0x00, 0xC0, 0x58, 0xCF, 0x81, 0xA0, 0x36, 0x04, 0x08, 0x81, 0x58, 0x9C,
+  0x07, 0x10, 0x81, 0x53, 0x67, 0x06, 0x0F, 0x82, 0x87, 0x10, 0xB7, 0x04, 0x1A, 0x80, 0x3F, 0xC0,
+  0x0B, 0x34, 0xC0, 0x4A, 0xAE, 0x02, 0x1B, 0x0A, 0x0A, 0x83, 0x62, 0x16, 0x02, 0x31, 0x0A, 0x1C,
+  0xC0, 0x26, 0x3B, 0x81, 0xAF, 0x2D, 0x10, 0x0D, 0x81, 0x2A, 0x13, 0x06, 0x14, 0x01, 0x13, 0x81,
+  0x14, 0x84, 0x0F, 0x05, 0x81, 0x24, 0x57, 0xC0, 0x0A, 0x1B, 0x81, 0x1D, 0x4E, 0x05, 0x1D, 0x03,
+  0x11, 0x01, 0x1D, 0x0E, 0x04, 0x10, 0x01, 0x01, 0x17, 0x02, 0x06, 0x02, 0x0E, 0x09, 0x06, 0x11,
+  0x03, 0x80, 0x26, 0x07, 0x09, 0x80, 0x1E, 0x05, 0x12, 0x05, 0x0B, 0x0B, 0x00, 0x80, 0x21, 0x03,
+  0x00, 0x80, 0xE4, 0x06, 0x08, 0xC0, 0x76, 0x76, 0xC0, 0xF1, 0x44, 0x07, 0x10, 0xC0, 0x10, 0x3D,
+  0x80, 0x85, 0x07, 0x0F, 0xC0, 0x4E, 0x2C, 0x80, 0x2E, 0x04, 0x1A, 0x80, 0x2E, 0xC0, 0x6B, 0x4C,
+  0xC0, 0x89, 0xBE, 0x02, 0x1B, 0x09, 0x0A, 0x80, 0x4D, 0xC0, 0xC8, 0xA5, 0x82, 0x16, 0x71, 0x3D,
+  0x0A, 0x1C, 0xC0, 0xE6, 0x32, 0x81, 0x5E, 0x2D, 0x10, 0x0D, 0x81, 0x2A, 0x13, 0x06, 0x14, 0x01,
+  0x13, 0x81, 0x14, 0x2E, 0x0F, 0x05, 0x81, 0x24, 0x5D, 0xC0, 0x6B, 0x23, 0xC0, 0xA7, 0x01, 0x80,
+  0x4E, 0x05, 0x1D, 0x03, 0x11, 0x01, 0x1D, 0x0E, 0x04, 0x10, 0x01, 0x01, 0x17, 0x02, 0x06, 0x02,
+  0x0E, 0x09, 0x06, 0x11, 0x03, 0x80, 0x26, 0x07, 0x09, 0x80, 0x1E, 0x05, 0x12, 0x05, 0x0B, 0x0B,
+  0x00, 0x02, 0x21, 0x83, 0x00, 0x21, 0x9E, 0x49, 0x04, 0x08, 0x80, 0x60, 0xC0, 0xD3, 0x5D, 0x80,
+  0x38, 0x06, 0x10, 0x82, 0x20, 0x7C, 0x3B, 0x05, 0x0F, 0x82, 0x3C, 0x85, 0x45, 0x05, 0x1A, 0xC0,
+  0x8B, 0x23, 0xC0, 0xEB, 0x6C, 0x01, 0x1B, 0x0B, 0x0A, 0x83, 0x4D, 0x34, 0x1F, 0xF9, 0xC0, 0x84,
+  0x6C, 0x09, 0x1C, 0x80, 0xF8, 0xC0, 0xA6, 0x2A, 0x81, 0x61, 0x2D, 0x0F, 0x0D, 0x01, 0x2A, 0x07,
+  0x14, 0x01, 0x13, 0x81, 0x48, 0x64, 0x0F, 0x05, 0x83, 0x24, 0x05, 0x98, 0x2A, 0x06, 0x1D, 0x03,
+  0x11, 0x01, 0x1D, 0x0E, 0x04, 0x10, 0x01, 0x01, 0x17, 0x02, 0x06, 0x02, 0x0E, 0x09, 0x06, 0x11,
+  0x03, 0x80, 0x26, 0x07, 0x09, 0x80, 0x1E, 0x05, 0x12, 0x05, 0x0B, 0x0B, 0x00, 0x02, 0x21, 0x82,
+  0x00, 0x21, 0xB6, 0x05, 0x08, 0x82, 0x49, 0x96, 0x38, 0x06, 0x10, 0x82, 0x20, 0xB4, 0x3B, 0x05,
+  0x0F, 0x88, 0x4B, 0x91, 0x1A, 0x07, 0x1A, 0x07, 0x1A, 0x1A, 0x07, 0xC0, 0x8B, 0x2B, 0xC0, 0x6B,
+  0x85, 0x81, 0x0A, 0x1B, 0x0B, 0x0A, 0x85, 0x4D, 0x34, 0x1F, 0xF9, 0x3D, 0x23, 0x08, 0x1C, 0x80,
+  0xF8, 0xC0, 0x87, 0x2A, 0xC0, 0xA7, 0x09, 0x80, 0x2D, 0x0F, 0x0D, 0x81, 0x2A, 0x37, 0x07, 0x14,
+  0x01, 0x13, 0x82, 0x48, 0x1A, 0x5D, 0x10, 0x05, 0x82, 0x57, 0x6E, 0x44, 0x05, 0x1D, 0x03, 0x11,
+  0x01, 0x1D, 0x0E, 0x04, 0x10, 0x01, 0x01, 0x17, 0x02, 0x06, 0x02, 0x0E, 0x09, 0x06, 0x11, 0x03,
+  0x80, 0x26, 0x07, 0x09, 0x80, 0x1E, 0x05, 0x12, 0x05, 0x0B, 0x0B, 0x00, 0x85, 0x21, 0x00, 0x21,
+  0x21, 0x5B, 0x69, 0x05, 0x08, 0x83, 0xA2, 0x7C, 0x10, 0x20, 0x05, 0x10, 0x82, 0x20, 0xB5, 0x4B,
+  0x05, 0x0F, 0x82, 0xAC, 0x56, 0xB7, 0x02, 0x07, 0x01, 0x1A, 0x80, 0x07, 0xC0, 0xAA, 0x33, 0xC0,
+  0xCB, 0x9D, 0x01, 0x1B, 0x0B, 0x0A, 0x82, 0x4D, 0x34, 0x1F, 0xC0, 0x86, 0x95, 0xC0, 0xA5, 0x6C,
+  0x80, 0x23, 0x08, 0x1C, 0xC0, 0x46, 0x64, 0xC0, 0x67, 0x22, 0x80, 0x2D, 0x10, 0x0D, 0x81, 0x2A,
+  0x37, 0x08, 0x14, 0x83, 0x13, 0x48, 0x1A, 0x5D, 0x10, 0x05, 0x80, 0x5D, 0xC0, 0x69, 0x12, 0x80,
+  0x44, 0x05, 0x1D, 0x03, 0x11, 0x01, 0x1D, 0x0E, 0x04, 0x10, 0x01, 0x01, 0x17, 0x02, 0x06, 0x02,
+  0x0E, 0x09, 0x06, 0x11, 0x03, 0x80, 0x26, 0x07, 0x09, 0x80, 0x1E, 0x05, 0x12, 0x05, 0x0B, 0x0B,
+  0x00, 0x84, 0x21, 0x00, 0x18, 0x21, 0xD9, 0xC0, 0xF7, 0x96, 0x05, 0x08, 0x83, 0xFA, 0xE6, 0x10,
+  0x20, 0x06, 0x10, 0x81, 0x67, 0x3C, 0x05, 0x0F, 0x80, 0x3B, 0xC0, 0x8F, 0x34, 0x82, 0xB7, 0x07,
+  0x07, 0x02, 0x1A, 0x80, 0x07, 0xC0, 0xEA, 0x33, 0xC0, 0x2A, 0xAE, 0x01, 0x1B, 0x0B, 0x0A, 0x82,
+  0x4D, 0x34, 0x1F, 0xC0, 0x86, 0x95, 0xC0, 0xA5, 0x6C, 0x80, 0x23, 0x08, 0x1C, 0xC0, 0x46, 0x64,
+  0xC0, 0x47, 0x22, 0x80, 0x2D, 0x10, 0x0D, 0x81, 0x2A, 0x13, 0x09, 0x14, 0x82, 0x48, 0x64, 0x5D,
+  0x10, 0x05, 0x82, 0x55, 0x8F, 0x44, 0x05, 0x1D, 0x03, 0x11, 0x01, 0x1D, 0x0E, 0x04, 0x10, 0x01,
+  0x01, 0x17, 0x02, 0x06, 0x02, 0x0E, 0x09, 0x06, 0x11, 0x03, 0x80, 0x26, 0x07, 0x09, 0x80, 0x1E,
+  0x05, 0x12, 0x05, 0x0B, 0x0B, 0x00, 0x85, 0x21, 0x00, 0x18, 0x21, 0x9E, 0x49, 0x04, 0x08, 0x81,
+  0xA9, 0xAC, 0x06, 0x10, 0x01, 0x20, 0x82, 0x53, 0x52, 0x3C, 0x05, 0x0F, 0x88, 0xAC, 0x56, 0x2E,
+  0x07, 0x07, 0x1A, 0x1A, 0x2E, 0x07, 0xC0, 0x0A, 0x3C, 0xC0, 0x4A, 0xB6, 0x01, 0x1B, 0x0B, 0x0A,
+  0x85, 0x5A, 0x16, 0x1F, 0x16, 0x88, 0x23, 0x08, 0x1C, 0xC0, 0x46, 0x5C, 0xC0, 0x47, 0x22, 0x80,
+  0x2D, 0x10, 0x0D, 0x81, 0x2A, 0x13, 0x09, 0x14, 0x82, 0x48, 0x8B, 0x5D, 0x10, 0x05, 0x82, 0x5D,
+  0x77, 0x44, 0x05, 0x1D, 0x03, 0x11, 0x01, 0x1D, 0x0E, 0x04, 0x10, 0x01, 0x01, 0x17, 0x02, 0x06,
+  0x02, 0x0E, 0x09, 0x06, 0x11, 0x03, 0x80, 0x26, 0x07, 0x09, 0x80, 0x1E, 0x05, 0x12, 0x05, 0x0B,
+  0x0B, 0x00, 0x85, 0x21, 0x00, 0x18, 0x12, 0x9A, 0x49, 0x05, 0x08, 0x81, 0x80, 0x56, 0x04, 0x10,
+  0x84, 0x20, 0xB0, 0x20, 0x83, 0x3B, 0x06, 0x0F, 0x88, 0xAC, 0x56, 0x2E, 0x07, 0x07, 0x1A, 0x2E,
+  0x2E, 0x3F, 0xC0, 0x2A, 0x44, 0x81, 0x5A, 0x1B, 0x0C, 0x0A, 0x85, 0x5A, 0x63, 0x3A, 0x1F, 0xD0,
+  0x23, 0x08, 0x1C, 0xC0, 0x26, 0x5C, 0xC0, 0x07, 0x1A, 0x80, 0x2D, 0x10, 0x0D, 0x81, 0x2A, 0x13,
+  0x09, 0x14, 0x82, 0x68, 0xC2, 0x5D, 0x10, 0x05, 0xC0, 0x4D, 0x24, 0x81, 0xCA, 0x11, 0x05, 0x1D,
+  0x03, 0x11, 0x01, 0x1D, 0x0E, 0x04, 0x10, 0x01, 0x01, 0x17, 0x02, 0x06, 0x02, 0x0E, 0x09, 0x06,
+  0x11, 0x03, 0x80, 0x26, 0x07, 0x09, 0x80, 0x1E, 0x05, 0x12, 0x05, 0x0B, 0x0B, 0x00, 0x84, 0x21,
+  0x00, 0x18, 0x5B, 0x69, 0x05, 0x08, 0x82, 0x49, 0x96, 0x56, 0x04, 0x10, 0x84, 0x20, 0xB0, 0x20,
+  0x7C, 0x3B, 0x06, 0x0F, 0x80, 0xAC, 0xC0, 0x8F, 0x34, 0x86, 0x2E, 0x07, 0x07, 0x1A, 0x1A, 0x2E,
+  0xA8, 0xC0, 0x4A, 0x44, 0x81, 0x5A, 0x1B, 0x0C, 0x0A, 0x83, 0x46, 0x34, 0x1F, 0x1F, 0xC0, 0xE5,
+  0x7C, 0x80, 0x65, 0x07, 0x1C, 0x81, 0x3D, 0x95, 0xC0, 0xE6, 0x19, 0x80, 0x2D, 0x10, 0x0D, 0x81,
+  0x2A, 0x13, 0x08, 0x14, 0x80, 0x3E, 0xC0, 0x68, 0x02, 0x80, 0x4A, 0x12, 0x05, 0x81, 0x8B, 0xED,
+  0x05, 0x1D, 0x03, 0x11, 0x01, 0x1D, 0x0E, 0x04, 0x10, 0x01, 0x01, 0x17, 0x02, 0x06, 0x02, 0x0E,
+  0x09, 0x06, 0x11, 0x03, 0x80, 0x26, 0x07, 0x09, 0x80, 0x1E, 0x05, 0x12, 0x05, 0x0B, 0x0B, 0x00,
+  0x83, 0x21, 0x00, 0x42, 0x5B, 0x06, 0x08, 0x81, 0xFA, 0x6A, 0x05, 0x10, 0x84, 0x20, 0xB0, 0x20,
+  0xB4, 0x3B, 0x06, 0x0F, 0x80, 0x3B, 0xC0, 0x6F, 0x34, 0x82, 0x2E, 0x07, 0x07, 0x02, 0x1A, 0x80,
+  0xA8, 0xC0, 0x6B, 0x4C, 0x01, 0x1B, 0x0C, 0x0A, 0x81, 0x46, 0x34, 0xC0, 0xA6, 0x9D, 0x83, 0x1F,
+  0x4F, 0x65, 0x23, 0x07, 0x1C, 0xC0, 0xE5, 0x53, 0xC0, 0xE6, 0x19, 0x80, 0x2D, 0x10, 0x0D, 0x80,
+  0x2A, 0x09, 0x14, 0x82, 0x3E, 0x82, 0x45, 0x12, 0x05, 0x81, 0x4A, 0x13, 0x05, 0x1D, 0x03, 0x11,
+  0x01, 0x1D, 0x0E, 0x04, 0x10, 0x01, 0x01, 0x17, 0x02, 0x06, 0x02, 0x0E, 0x09, 0x06, 0x11, 0x03,
+  0x80, 0x26, 0x07, 0x09, 0x80, 0x1E, 0x05, 0x12, 0x05, 0x0B, 0x0B, 0x00, 0x82, 0x21, 0x18, 0x42,
+  0xC0, 0x58, 0xCF, 0x06, 0x08, 0xC0, 0x14, 0x6E, 0x06, 0x10, 0x83, 0x20, 0xB0, 0x20, 0x97, 0x07,
+  0x0F, 0x84, 0x52, 0x55, 0x2E, 0x07, 0x07, 0x02, 0x1A, 0x80, 0xA8, 0xC0, 0xAB, 0x54, 0x81, 0x0A,
+  0x1B, 0x09, 0x0A, 0x02, 0x1B, 0x86, 0x46, 0x34, 0x3A, 0x1F, 0x39, 0x65, 0x23, 0x03, 0x1C, 0x02,
+  0x23, 0x80, 0x3D, 0xC0, 0xC5, 0x53, 0x81, 0x5E, 0x2D, 0x10, 0x0D, 0x80, 0x2A, 0x09, 0x14, 0x83,
+  0x3E, 0x8F, 0x57, 0x24, 0x11, 0x05, 0x82, 0x45, 0xD2, 0x11, 0x04, 0x1D, 0x03, 0x11, 0x01, 0x1D,
+  0x0E, 0x04, 0x10, 0x01, 0x01, 0x17, 0x02, 0x06, 0x02, 0x0E, 0x09, 0x06, 0x11, 0x03, 0x80, 0x26,
+  0x07, 0x09, 0x80, 0x1E, 0x05, 0x12, 0x06, 0x0B, 0x0B, 0x00, 0x82, 0x18, 0x21, 0xE4, 0x06, 0x08,
+  0x80, 0xFB, 0x06, 0x10, 0x82, 0x20, 0xB0, 0x38, 0xC0, 0xB3, 0x4D, 0x80, 0x51, 0x05, 0x0F, 0x83,
+  0x3C, 0x67, 0x45, 0x1A, 0x04, 0x07, 0x80, 0x3F, 0xC0, 0xCC, 0x5C, 0x81, 0x0A, 0x1B, 0x09, 0x0A,
+  0x02, 0x1B, 0x86, 0x46, 0x9B, 0x3A, 0x16, 0x6C, 0x3D, 0x23, 0x02, 0x1C, 0x80, 0x3D, 0x03, 0x31,
+  0xC0, 0xA5, 0x4B, 0x81, 0x5E, 0x2D, 0x10, 0x0D, 0x80, 0x2A, 0x09, 0x14, 0x83, 0x3E, 0xC0, 0x57,
+  0x24, 0x11, 0x05, 0x80, 0x24, 0xC0, 0x69, 0x12, 0x05, 0x1D, 0x03, 0x11, 0x01, 0x1D, 0x0E, 0x04,
+  0x10, 0x01, 0x01, 0x17, 0x02, 0x06, 0x02, 0x0E, 0x09, 0x06, 0x11, 0x03, 0x80, 0x26, 0x07, 0x09,
+  0x80, 0x1E, 0x05, 0x12, 0x05, 0x0B, 0x80, 0x12, 0x0B, 0x00, 0x81, 0x18, 0x21, 0xC0, 0x58, 0xBF,
+  0x05, 0x08, 0x82, 0x49, 0x96, 0x20, 0x05, 0x10, 0x84, 0x20, 0xB0, 0xB0, 0x67, 0x4B, 0x05, 0x0F,
+  0x82, 0x3C, 0xAA, 0x4A, 0x04, 0x07, 0x01, 0x3F, 0xC0, 0xCC, 0x64, 0x01, 0x1B, 0x09, 0x0A, 0x02,
+  0x1B, 0x86, 0x46, 0x9B, 0x3A, 0x16, 0x16, 0xD0, 0x23, 0x02, 0x1C, 0x80, 0x3D, 0x02, 0x31, 0x80,
+  0x3D, 0xC0, 0x86, 0x4B, 0x80, 0x5E, 0x10, 0x0D, 0x81, 0x2A, 0x37, 0x0A, 0x14, 0xC0, 0x2B, 0x13,
+  0x01, 0x24, 0x11, 0x05, 0x80, 0x57, 0xC0, 0xAA, 0x1A, 0x80, 0x11, 0x04, 0x1D, 0x03, 0x11, 0x01,
+  0x1D, 0x0E, 0x04, 0x10, 0x01, 0x01, 0x17, 0x02, 0x06, 0x02, 0x0E, 0x09, 0x06, 0x11, 0x03, 0x80,
+  0x26, 0x07, 0x09, 0x80, 0x1E, 0x06, 0x12, 0x04, 0x0B, 0x80, 0x12, 0x0B, 0x00, 0x81, 0x18, 0x21,
+  0xC0, 0x58, 0xBF, 0x05, 0x08, 0x80, 0xA2, 0xC0, 0x32, 0x4D, 0x80, 0x20, 0x05, 0x10, 0x83, 0x20,
+  0x38, 0x83, 0x52, 0x06, 0x0F, 0x80, 0x3C, 0xC0, 0x73, 0x55, 0x81, 0xC2, 0x1A, 0x03, 0x07, 0x81,
+  0x1A, 0x3F, 0xC0, 0xCC, 0x64, 0x01, 0x1B, 0x09, 0x0A, 0x02, 0x1B, 0x80, 0x46, 0xC0, 0xC8, 0xA5,
+  0x82, 0x3A, 0x16, 0x16, 0xC0, 0x06, 0x7D, 0x80, 0x23, 0x02, 0x1C, 0x80, 0x3D, 0x02, 0x31, 0x80,
+  0x23, 0xC0, 0x66, 0x43, 0x81, 0x5E, 0x2D, 0x0F, 0x0D, 0x81, 0x2A, 0x37, 0x0A, 0x14, 0x82, 0x77,
+  0x24, 0x24, 0x11, 0x05, 0x80, 0x24, 0xC0, 0xEA, 0x1A, 0x80, 0x86, 0x04, 0x1D, 0x03, 0x11, 0x01,
+  0x1D, 0x0E, 0x04, 0x10, 0x01, 0x01, 0x17, 0x02, 0x06, 0x02, 0x0E, 0x09, 0x06, 0x11, 0x03, 0x80,
+  0x26, 0x07, 0x09, 0x80, 0x1E, 0x06, 0x12, 0x04, 0x0B, 0x80, 0x12, 0x0B, 0x00, 0x84, 0x18, 0x21,
+  0x9E, 0x93, 0x7D, 0x03, 0x08, 0xC0, 0x96, 0x76, 0x81, 0x90, 0x20, 0x05, 0x10, 0x81, 0x20, 0x38,
+  0xC0, 0x73, 0x4D, 0x80, 0x3B, 0x06, 0x0F, 0x83, 0x3C, 0x6A, 0x07, 0x1A, 0x04, 0x07, 0x80, 0x3F,
+  0xC0, 0xCC, 0x5C, 0x81, 0x8D, 0x1B, 0x09, 0x0A, 0x03, 0x1B, 0x84, 0x62, 0x16, 0x16, 0x1F, 0x71,
+  0xC0, 0x84, 0x6C, 0x02, 0x1C, 0x80, 0x3D, 0x02, 0x31, 0x80, 0xF8, 0xC0, 0x46, 0x43, 0x80, 0x5E,
+  0x10, 0x0D, 0x81, 0x2A, 0x35, 0x0A, 0x14, 0x82, 0x77, 0x5D, 0x24, 0x12, 0x05, 0x80, 0xF3, 0xC0,
+  0xA7, 0x01, 0x04, 0x1D, 0x03, 0x11, 0x01, 0x1D, 0x0E, 0x04, 0x10, 0x01, 0x01, 0x17, 0x02, 0x06,
+  0x02, 0x0E, 0x09, 0x06, 0x11, 0x03, 0x80, 0x26, 0x07, 0x09, 0x80, 0x1E, 0x06, 0x12, 0x04, 0x0B,
+  0x80, 0x12, 0x0B, 0x00, 0x84, 0x18, 0x21, 0x9E, 0x93, 0x7D, 0x03, 0x08, 0x81, 0x80, 0x56, 0x06,
+  0x10, 0x01, 0x20, 0xC0, 0xD4, 0x55, 0x07, 0x0F, 0x80, 0xAC, 0xC0, 0x90, 0x3C, 0x80, 0x2E, 0x05,
+  0x07, 0x80, 0x3F, 0xC0, 0xCC, 0x5C, 0x81, 0x8D, 0x1B, 0x09, 0x0A, 0x03, 0x1B, 0x88, 0x62, 0x3A,
+  0x16, 0x16, 0x6C, 0x3D, 0x1C, 0x1C, 0x23, 0x03, 0x31, 0x80, 0xF8, 0xC0, 0x27, 0x3B, 0x80, 0x5E,
+  0x10, 0x0D, 0x81, 0x2A, 0x13, 0x0A, 0x14, 0x82, 0x77, 0x5D, 0x24, 0x12, 0x05, 0x80, 0x77, 0xC0,
+  0xA7, 0x01, 0x04, 0x1D, 0x03, 0x11, 0x01, 0x1D, 0x0E, 0x04, 0x10, 0x01, 0x01, 0x17, 0x02, 0x06,
+  0x02, 0x0E, 0x09, 0x06, 0x11, 0x03, 0x80, 0x26, 0x07, 0x09, 0x80, 0x1E, 0x06, 0x12, 0x04, 0x0B,
+  0x80, 0x12, 0x0B, 0x00, 0x81, 0x18, 0x12, 0xC0, 0x36, 0xA7, 0x80, 0x93, 0x03, 0x08, 0x82, 0x58,
+  0x96, 0x38, 0x06, 0x10, 0x83, 0x20, 0x90, 0x85, 0x3C, 0x06, 0x0F, 0xC0, 0x35, 0x6E, 0xC0, 0x4F,
+  0x34, 0x80, 0x2E, 0x03, 0x07, 0x82, 0x1A, 0x07, 0x3F, 0xC0, 0xAC, 0x5C, 0x82, 0xF1, 0x1B, 0x1B,
+  0x08, 0x0A, 0x03, 0x1B, 0x81, 0x62, 0x3A, 0x02, 0x16, 0x82, 0x88, 0x23, 0x1C, 0x03, 0x31, 0x81,
+  0xE3, 0x23, 0xC0, 0x07, 0x3B, 0x80, 0x5E, 0x10, 0x0D, 0x81, 0x2A, 0x13, 0x09, 0x14, 0x80, 0x7B,
+  0xC0, 0x2B, 0x13, 0x81, 0x5D, 0x24, 0x12, 0x05, 0x80, 0x84, 0xC0, 0xA7, 0x01, 0x04, 0x1D, 0x03,
+  0x11, 0x01, 0x1D, 0x0E, 0x04, 0x10, 0x01, 0x01, 0x17, 0x02, 0x06, 0x02, 0x0E, 0x09, 0x06, 0x11,
+  0x03, 0x80, 0x26, 0x07, 0x09, 0x80, 0x1E, 0x06, 0x12, 0x04, 0x0B, 0x80, 0x12, 0x0B, 0x00, 0x83,
+  0x18, 0x5B, 0xA0, 0x93, 0x03, 0x08, 0xC0, 0x96, 0x76, 0x80, 0x53, 0x07, 0x10, 0x82, 0x20, 0x83,
+  0x52, 0x07, 0x0F, 0x82, 0x52, 0x55, 0x2E, 0x03, 0x07, 0x82, 0x1A, 0x07, 0x3F, 0xC0, 0x8C, 0x5C,
+  0x02, 0x1B, 0x08, 0x0A, 0x03, 0x1B, 0x80, 0x62, 0x03, 0x16, 0x80, 0x78, 0x02, 0x23, 0x02, 0x31,
+  0x81, 0xE3, 0x23, 0xC0, 0xE7, 0x3A, 0x80, 0x5E, 0x10, 0x0D, 0x80, 0x2A, 0x0B, 0x14, 0x82, 0x77,
+  0x05, 0x24, 0x12, 0x05, 0x81, 0x1A, 0xED, 0x04, 0x1D, 0x03, 0x11, 0x01, 0x1D, 0x0E, 0x04, 0x10,
+  0x01, 0x01, 0x17, 0x02, 0x06, 0x02, 0x0E, 0x09, 0x06, 0x11, 0x03, 0x80, 0x26, 0x07, 0x09, 0x80,
+  0x1E, 0x06, 0x12, 0x04, 0x0B, 0x80, 0x12, 0x0B, 0x00, 0x80, 0x18, 0xC0, 0x57, 0xCF, 0x80, 0x93,
+  0x03, 0x08, 0x80, 0x60, 0xC0, 0x14, 0x6E, 0xC0, 0xAF, 0x34, 0x07, 0x10, 0x82, 0x20, 0xF5, 0x3B,
+  0x07, 0x0F, 0x80, 0xCB, 0xC0, 0xEE, 0x2B, 0x80, 0x2E, 0x04, 0x07, 0x81, 0x1A, 0x3F, 0xC0, 0x6C,
+  0x54, 0x81, 0x0A, 0x1B, 0x09, 0x0A, 0x03, 0x1B, 0x88, 0xA6, 0x3A, 0x16, 0x16, 0x1F, 0x39, 0x3D,
+  0x1C, 0x23, 0x02, 0x31, 0x81, 0xE3, 0x23, 0xC0, 0xC6, 0x32, 0xC0, 0xA6, 0x09, 0x10, 0x0D, 0x80,
+  0x2A, 0x08, 0x14, 0x85, 0x13, 0x14, 0x14, 0xCA, 0x05, 0x24, 0x11, 0x05, 0x82, 0x24, 0x8B, 0x0D,
+  0x04, 0x1D, 0x03, 0x11, 0x01, 0x1D, 0x0E, 0x04, 0x10, 0x01, 0x01, 0x17, 0x02, 0x06, 0x02, 0x0E,
+  0x09, 0x06, 0x11, 0x03, 0x80, 0x26, 0x07, 0x09, 0x80, 0x1E, 0x06, 0x12, 0x04, 0x0B, 0x80, 0x12,
+  0x0A, 0x00, 0x83, 0x18, 0x00, 0x9E, 0x93, 0x02, 0x08, 0x82, 0x49, 0x60, 0xC3, 0xC0, 0xAF, 0x34,
+  0x07, 0x10, 0x82, 0x20, 0x97, 0x51, 0x07, 0x0F, 0x82, 0x67, 0x4A, 0x2E, 0x04, 0x07, 0x80, 0x1A,
+  0xC0, 0x6D, 0x13, 0xC0, 0x4B, 0x4C, 0xC0, 0x8A, 0xBE, 0x0A, 0x0A, 0x02, 0x1B, 0x82, 0x0A, 0xA6,
+  0x3A, 0x02, 0x16, 0xC0, 0x47, 0x95, 0x80, 0x3D, 0x02, 0x23, 0x02, 0x31, 0x80, 0x23, 0xC0, 0xC6,
+  0x32, 0xC0, 0xA6, 0x09, 0x0F, 0x0D, 0x81, 0x2A, 0x37, 0x08, 0x14, 0x85, 0x13, 0x14, 0x68, 0x64,
+  0x05, 0x24, 0x12, 0x05, 0x81, 0x98, 0x37, 0x03, 0x1D, 0x04, 0x11, 0x01, 0x1D, 0x0E, 0x04, 0x10,
+  0x01, 0x01, 0x17, 0x02, 0x06, 0x02, 0x0E, 0x09, 0x06, 0x11, 0x03, 0x80, 0x26, 0x07, 0x09, 0x80,
+  0x1E, 0x06, 0x12, 0x04, 0x0B, 0x80, 0x12, 0x0A, 0x00, 0x82, 0x18, 0x12, 0x8E, 0x04, 0x08, 0xC0,
+  0xB7, 0x7E, 0xC0, 0x31, 0x4D, 0x80, 0x38, 0x05, 0x10, 0x02, 0x20, 0x80, 0xB5, 0xC0, 0x95, 0x6E,
+  0x07, 0x0F, 0x82, 0x67, 0x4A, 0x2E, 0x04, 0x07, 0x81, 0x1A, 0xA8, 0xC0, 0x2B, 0x44, 0x80, 0xAB,
+  0x0A, 0x0A, 0x02, 0x1B, 0x82, 0x0A, 0xA6, 0x3A, 0x02, 0x1F, 0x81, 0x16, 0x88, 0x02, 0x23, 0x83,
+  0x1C, 0x23, 0x31, 0x23, 0xC0, 0xC6, 0x32, 0xC0, 0xA6, 0x09, 0x0F, 0x0D, 0x81, 0x2A, 0x37, 0x08,
+  0x14, 0x01, 0x13, 0x83, 0x68, 0x8B, 0x5D, 0x24, 0x12, 0x05, 0x81, 0x45, 0x6E, 0xC0, 0xA7, 0x01,
+  0x07, 0x11, 0x01, 0x1D, 0x0E, 0x04, 0x10, 0x01, 0x01, 0x17, 0x02, 0x06, 0x02, 0x0E, 0x09, 0x06,
+  0x11, 0x03, 0x80, 0x26, 0x07, 0x09, 0x80, 0x1E, 0x06, 0x12, 0x04, 0x0B, 0x80, 0x12, 0x0A, 0x00,
+  0x82, 0x18, 0x12, 0x9A, 0x03, 0x08, 0x80, 0x60, 0xC0, 0x14, 0x6E, 0x82, 0x53, 0x20, 0x20, 0x04,
+  0x10, 0x02, 0x20, 0xC0, 0xF3, 0x55, 0xC0, 0x95, 0x6E, 0x07, 0x0F, 0x82, 0x67, 0x4A, 0x2E, 0x03,
+  0x07, 0x82, 0x3F, 0x07, 0xA8, 0xC0, 0x0B, 0x3C, 0xC0, 0x4A, 0xB6, 0x0A, 0x0A, 0x02, 0x1B, 0x87,
+  0x0A, 0xA6, 0x3A, 0x1F, 0x1F, 0x16, 0x63, 0x4F, 0x02, 0x23, 0x83, 0x1C, 0x23, 0x31, 0x23, 0xC0,
+  0xC6, 0x32, 0xC0, 0xA6, 0x09, 0x0F, 0x0D, 0x81, 0x2A, 0x13, 0x09, 0x14, 0x83, 0x13, 0x59, 0x8B,
+  0x5D, 0x13, 0x05, 0x80, 0x24, 0xC0, 0x68, 0x12, 0x81, 0x11, 0x1D, 0x06, 0x11, 0x01, 0x1D, 0x0E,
+  0x04, 0x10, 0x01, 0x01, 0x17, 0x02, 0x06, 0x02, 0x0E, 0x09, 0x06, 0x11, 0x03, 0x80, 0x26, 0x07,
+  0x09, 0x80, 0x1E, 0x06, 0x12, 0x04, 0x0B, 0x80, 0x12, 0x0A, 0x00, 0x82, 0x18, 0x0B, 0x9A, 0x03,
+  0x08, 0xC0, 0xF8, 0x86, 0x80, 0x96, 0x07, 0x10, 0x01, 0x20, 0x81, 0x53, 0x85, 0x08, 0x0F, 0x82,
+  0x85, 0x45, 0x2E, 0x03, 0x07, 0x82, 0x3F, 0x1A, 0xA8, 0xC0, 0xEB, 0x33, 0xC0, 0x2B, 0xAE, 0x0A,
+  0x0A, 0x02, 0x1B, 0x8E, 0x0A, 0xA6, 0x3A, 0x1F, 0x1F, 0x16, 0x63, 0x71, 0x31, 0x23, 0x23, 0x1C,
+  0x23, 0x31, 0x23, 0xC0, 0xE6, 0x32, 0x80, 0x61, 0x0F, 0x0D, 0x80, 0x2A, 0x0A, 0x14, 0x82, 0x13,
+  0x59, 0x4A, 0x15, 0x05, 0x82, 0xD3, 0x11, 0x1D, 0x06, 0x11, 0x01, 0x1D, 0x0E, 0x04, 0x10, 0x01,
+  0x01, 0x17, 0x02, 0x06, 0x02, 0x0E, 0x09, 0x06, 0x11, 0x03, 0x80, 0x26, 0x07, 0x09, 0x80, 0x1E,
+  0x06, 0x12, 0x04, 0x0B, 0x80, 0x12, 0x0A, 0x00, 0x82, 0x18, 0x0B, 0x73, 0x03, 0x08, 0x81, 0xA2,
+  0x6A, 0x07, 0x10, 0x01, 0x20, 0x80, 0x83, 0xC0, 0x35, 0x5E, 0x08, 0x0F, 0x82, 0xCB, 0x45, 0x2E,
+  0x03, 0x07, 0x82, 0x3F, 0x07, 0xA8, 0xC0, 0xCB, 0x33, 0xC0, 0x0B, 0xA6, 0x01, 0x1B, 0x08, 0x0A,
+  0x02, 0x1B, 0x8A, 0x0A, 0xA6, 0x3A, 0x1F, 0x1F, 0x16, 0x16, 0x6C, 0x88, 0x23, 0x23, 0x02, 0x31,
+  0x80, 0x23, 0xC0, 0xE5, 0x32, 0x80, 0x5E, 0x0F, 0x0D, 0x81, 0x2A, 0x13, 0x09, 0x14, 0x82, 0x13,
+  0xC1, 0x4A, 0x15, 0x05, 0xC0, 0xEA, 0x1A, 0x81, 0x86, 0x1D, 0x06, 0x11, 0x01, 0x1D, 0x0E, 0x04,
+  0x10, 0x01, 0x01, 0x17, 0x02, 0x06, 0x02, 0x0E, 0x09, 0x06, 0x11, 0x03, 0x80, 0x26, 0x07, 0x09,
+  0x80, 0x1E, 0x06, 0x12, 0x04, 0x0B, 0x80, 0x12, 0x0A, 0x00, 0x82, 0x18, 0x12, 0x73, 0x02, 0x08,
+  0x80, 0x60, 0xC0, 0xB7, 0x7E, 0x80, 0x6A, 0x08, 0x10, 0x82, 0x20, 0x83, 0x3B, 0x08, 0x0F, 0x80,
+  0xCB, 0xC0, 0xEE, 0x23, 0x80, 0x2E, 0x06, 0x07, 0xC0, 0xCB, 0x33, 0xC0, 0xCB, 0x9D, 0x01, 0x1B,
+  0x08, 0x0A, 0x02, 0x1B, 0x84, 0x0A, 0xA6, 0x3A, 0x1F, 0x1F, 0x02, 0x16, 0xC0, 0xC5, 0x7C, 0x01,
+  0x23, 0x02, 0x31, 0x80, 0x23, 0xC0, 0xE5, 0x3A, 0x80, 0x5E, 0x0F, 0x0D, 0x80, 0x2A, 0x0A, 0x14,
+  0x82, 0x13, 0xC1, 0x45, 0x15, 0x05, 0x82, 0x84, 0x86, 0x1D, 0x06, 0x11, 0x01, 0x1D, 0x0E, 0x04,
+  0x10, 0x01, 0x01, 0x17, 0x02, 0x06, 0x02, 0x0E, 0x09, 0x06, 0x11, 0x03, 0x80, 0x26, 0x07, 0x09,
+  0x80, 0x1E, 0x06, 0x12, 0x04, 0x0B, 0x80, 0x12, 0x0A, 0x00, 0x82, 0x18, 0x12, 0x73, 0x02, 0x08,
+  0x80, 0x60, 0xC0, 0x76, 0x76, 0x80, 0x53, 0x08, 0x10, 0x82, 0x20, 0x7C, 0x3B, 0x08, 0x0F, 0x82,
+  0x67, 0x4A, 0x2E, 0x06, 0x07, 0xC0, 0xAB, 0x2B, 0xC0, 0x8C, 0x95, 0x81, 0x0A, 0x1B, 0x08, 0x0A,
+  0x02, 0x1B, 0x83, 0x0A, 0xA6, 0x3A, 0x1F, 0x03, 0x16, 0x80, 0x4F, 0x02, 0x23, 0x01, 0x31, 0x80,
+  0x23, 0xC0, 0x05, 0x3B, 0x80, 0x5E, 0x0F, 0x0D, 0x80, 0x2A, 0x0A, 0x14, 0x82, 0x13, 0x82, 0x45,
+  0x15, 0x05, 0x82, 0x64, 0x0D, 0x1D, 0x06, 0x11, 0x01, 0x1D, 0x0E, 0x04, 0x10, 0x01, 0x01, 0x17,
+  0x02, 0x06, 0x02, 0x0E, 0x09, 0x06, 0x11, 0x03, 0x80, 0x26, 0x07, 0x09, 0x80, 0x1E, 0x06, 0x12,
+  0x04, 0x0B, 0x80, 0x12, 0x0A, 0x00, 0x82, 0x18, 0x12, 0x73, 0x02, 0x08, 0x80, 0x60, 0xC0, 0x35,
+  0x6E, 0x09, 0x10, 0x82, 0x20, 0x7C, 0x3B, 0x08, 0x0F, 0x82, 0xAA, 0xC2, 0x2E, 0x06, 0x07, 0xC0,
+  0x8B, 0x23, 0xC0, 0x4C, 0x7D, 0x81, 0x0A, 0x1B, 0x08, 0x0A, 0x02, 0x1B, 0x82, 0x0A, 0xA6, 0x3A,
+  0x02, 0x1F, 0x01, 0x16, 0xC0, 0x47, 0x95, 0x85, 0x3D, 0x23, 0x23, 0x31, 0x31, 0x23, 0xC0, 0x05,
+  0x3B, 0x80, 0x5E, 0x0E, 0x0D, 0x81, 0x2A, 0x37, 0x0A, 0x14, 0x82, 0x13, 0xF6, 0x24, 0x15, 0x05,
+  0x81, 0x4A, 0x37, 0x07, 0x11, 0x01, 0x1D, 0x0E, 0x04, 0x10, 0x01, 0x01, 0x17, 0x02, 0x06, 0x02,
+  0x0E, 0x09, 0x06, 0x11, 0x03, 0x80, 0x26, 0x07, 0x09, 0x80, 0x1E, 0x06, 0x12, 0x04, 0x0B, 0x80,
+  0x12, 0x0A, 0x00, 0x82, 0x18, 0x12, 0x73, 0x02, 0x08, 0x81, 0x60, 0x67, 0x09, 0x10, 0x82, 0x38,
+  0xB4, 0x51, 0x08, 0x0F, 0x82, 0xC3, 0xC2, 0x3F, 0x06, 0x07, 0x80, 0x2E, 0xC0, 0x0C, 0x6D, 0x81,
+  0x0A, 0x1B, 0x08, 0x0A, 0x03, 0x1B, 0x81, 0xE7, 0x3A, 0x05, 0x16, 0x81, 0x88, 0x23, 0x02, 0x31,
+  0x80, 0x23, 0xC0, 0x05, 0x3B, 0x80, 0x5E, 0x0E, 0x0D, 0x01, 0x2A, 0x0A, 0x14, 0x82, 0x13, 0xA5,
+  0x57, 0x15, 0x05, 0x83, 0x9F, 0x59, 0x11, 0x1D, 0x05, 0x11, 0x01, 0x1D, 0x0E, 0x04, 0x10, 0x01,
+  0x01, 0x17, 0x02, 0x06, 0x02, 0x0E, 0x09, 0x06, 0x11, 0x03, 0x80, 0x26, 0x07, 0x09, 0x80, 0x1E,
+  0x06, 0x12, 0x04, 0x0B, 0x80, 0x12, 0x0A, 0x00, 0x82, 0x18, 0x12, 0x73, 0x02, 0x08, 0x82, 0x60,
+  0xC3, 0x20, 0x08, 0x10, 0x82, 0x38, 0xB4, 0x51, 0x08, 0x0F, 0x82, 0x9C, 0x07, 0x3F, 0x06, 0x07,
+  0x80, 0x1A, 0xC0, 0xAC, 0x5C, 0x84, 0x0A, 0x46, 0x0A, 0x1B, 0x1B, 0x05, 0x0A, 0x03, 0x1B, 0x81,
+  0xE7, 0x3A, 0x05, 0x16, 0x80, 0x78, 0x04, 0x23, 0xC0, 0x26, 0x43, 0x80, 0x5E, 0x0E, 0x0D, 0x81,
+  0x2A, 0x35, 0x0A, 0x14, 0x82, 0x13, 0xA5, 0x24, 0x14, 0x05, 0x84, 0x24, 0x99, 0xD3, 0x11, 0x1D,
+  0x05, 0x11, 0x01, 0x1D, 0x0E, 0x04, 0x10, 0x01, 0x01, 0x17, 0x02, 0x06, 0x02, 0x0E, 0x09, 0x06,
+  0x11, 0x03, 0x80, 0x26, 0x07, 0x09, 0x80, 0x1E, 0x06, 0x12, 0x04, 0x0B, 0x80, 0x12, 0x0A, 0x00,
+  0x82, 0x18, 0x12, 0x73, 0x02, 0x08, 0xC0, 0xF8, 0x86, 0xC0, 0x73, 0x55, 0x80, 0x20, 0x08, 0x10,
+  0x82, 0x38, 0xB4, 0x51, 0x08, 0x0F, 0x81, 0x9C, 0x1A, 0x08, 0x07, 0xC0, 0x4B, 0x4C, 0x84, 0xAB,
+  0x1B, 0x0A, 0x1B, 0x1B, 0x07, 0x0A, 0x01, 0x1B, 0xC0, 0x28, 0xBE, 0x80, 0xBE, 0x05, 0x16, 0x85,
+  0x02, 0x31, 0x23, 0x1C, 0x1C, 0x23, 0xC0, 0x66, 0x43, 0x80, 0x5E, 0x0E, 0x0D, 0x82, 0x2A, 0x35,
+  0x13, 0x09, 0x14, 0x82, 0x13, 0x8F, 0x24, 0x15, 0x05, 0x80, 0x55, 0xC0, 0xCA, 0x1A, 0x81, 0x11,
+  0x1D, 0x05, 0x11, 0x01, 0x1D, 0x0E, 0x04, 0x10, 0x01, 0x01, 0x17, 0x02, 0x06, 0x02, 0x0E, 0x09,
+  0x06, 0x11, 0x03, 0x80, 0x26, 0x07, 0x09, 0x80, 0x1E, 0x06, 0x12, 0x04, 0x0B, 0x80, 0x12, 0x0A,
+  0x00, 0x82, 0x18, 0x12, 0x73, 0x02, 0x08, 0x82, 0xA2, 0x91, 0x20, 0x08, 0x10, 0x81, 0x38, 0x7C,
+  0x09, 0x0F, 0x81, 0x9C, 0x1A, 0x07, 0x07, 0x80, 0xA8, 0xC0, 0x0B, 0x3C, 0xC0, 0x4B, 0xB6, 0x01,
+  0x0A, 0x80, 0x1B, 0x08, 0x0A, 0x81, 0x1B, 0x0A, 0xC0, 0x29, 0xBE, 0x80, 0xBE, 0x04, 0x16, 0x81,
+  0x1F, 0x6C, 0xC0, 0x85, 0x74, 0x83, 0x31, 0x1C, 0x1C, 0x23, 0xC0, 0x86, 0x43, 0x80, 0x5E, 0x0E,
+  0x0D, 0x82, 0x2A, 0x35, 0x13, 0x08, 0x14, 0x83, 0x13, 0x35, 0xBF, 0x24, 0x15, 0x05, 0x83, 0x55,
+  0xF3, 0x11, 0x1D, 0x05, 0x11, 0x01, 0x1D, 0x0E, 0x04, 0x10, 0x01, 0x01, 0x17, 0x02, 0x06, 0x02,
+  0x0E, 0x09, 0x06, 0x11, 0x03, 0x80, 0x26, 0x07, 0x09, 0x80, 0x1E, 0x06, 0x12, 0x04, 0x0B, 0x80,
+  0x12, 0x0A, 0x00, 0x82, 0x18, 0x12, 0x73, 0x02, 0x08, 0x82, 0xA2, 0x6A, 0x20, 0x08, 0x10, 0x82,
+  0x20, 0x7C, 0x3B, 0x08, 0x0F, 0xC0, 0x92, 0x55, 0x80, 0x1A, 0x07, 0x07, 0x80, 0xA8, 0xC0, 0xCB,
+  0x2B, 0xC0, 0x0B, 0xA6, 0x81, 0x0A, 0x1B, 0x09, 0x0A, 0x8A, 0x1B, 0x0A, 0x5C, 0xBE, 0x16, 0x1F,
+  0x1F, 0x16, 0x16, 0x1F, 0x16, 0xC0, 0xC5, 0x7C, 0x80, 0x23, 0x02, 0x1C, 0xC0, 0xA5, 0x4B, 0x81,
+  0x5E, 0x2D, 0x0D, 0x0D, 0x01, 0x2A, 0x80, 0x13, 0x08, 0x14, 0x01, 0x13, 0x80, 0x77, 0x15, 0x05,
+  0x81, 0x24, 0x55, 0xC0, 0x4B, 0x23, 0x81, 0x86, 0x4E, 0x05, 0x11, 0x01, 0x1D, 0x0E, 0x04, 0x10,
+  0x01, 0x01, 0x17, 0x02, 0x06, 0x02, 0x0E, 0x09, 0x06, 0x11, 0x03, 0x80, 0x26, 0x07, 0x09, 0x80,
+  0x1E, 0x06, 0x12, 0x04, 0x0B, 0x80, 0x12, 0x0A, 0x00, 0x82, 0x18, 0x12, 0x73, 0x02, 0x08, 0x82,
+  0xFA, 0xE6, 0x20, 0x08, 0x10, 0x82, 0x38, 0x7C, 0x3B, 0x07, 0x0F, 0x82, 0x3C, 0x96, 0x1A, 0x08,
+  0x07, 0xC0, 0xAB, 0x23, 0xC0, 0xCC, 0x95, 0x81, 0x0A, 0x1B, 0x0B, 0x0A, 0x84, 0x5A, 0x34, 0x16,
+  0x1F, 0x1F, 0x02, 0x16, 0x80, 0x1F, 0xC0, 0x05, 0x85, 0x80, 0x23, 0x02, 0x1C, 0xC0, 0xC5, 0x53,
+  0x81, 0x5E, 0x2D, 0x0D, 0x0D, 0x01, 0x2A, 0x80, 0x13, 0x09, 0x14, 0x81, 0x13, 0xCA, 0x15, 0x05,
+  0x83, 0x24, 0x5D, 0x8B, 0x86, 0x06, 0x11, 0x01, 0x1D, 0x0E, 0x04, 0x10, 0x01, 0x01, 0x17, 0x02,
+  0x06, 0x02, 0x0E, 0x09, 0x06, 0x11, 0x03, 0x80, 0x26, 0x07, 0x09, 0x80, 0x1E, 0x06, 0x12, 0x04,
+  0x0B, 0x80, 0x12, 0x0A, 0x00, 0x82, 0x18, 0x12, 0x73, 0x02, 0x08, 0xC0, 0x76, 0x76, 0x80, 0xE6,
+  0x09, 0x10, 0x82, 0x38, 0x83, 0x3B, 0x08, 0x0F, 0xC0, 0x92, 0x4D, 0x80, 0x1A, 0x08, 0x07, 0xC0,
+  0x8B, 0x1B, 0xC0, 0x6C, 0x7D, 0x81, 0x0A, 0x46, 0x0B, 0x0A, 0x8A, 0x46, 0x34, 0x16, 0x1F, 0x1F,
+  0x16, 0x1F, 0x16, 0x1F, 0x02, 0x23, 0x02, 0x1C, 0xC0, 0xE5, 0x53, 0x81, 0xAF, 0x2D, 0x0D, 0x0D,
+  0x01, 0x2A, 0x80, 0x13, 0x09, 0x14, 0x81, 0x6E, 0x64, 0x15, 0x05, 0x84, 0x24, 0x05, 0x98, 0x2A,
+  0x44, 0x05, 0x11, 0x01, 0x1D, 0x0E, 0x04, 0x10, 0x01, 0x01, 0x17, 0x02, 0x06, 0x02, 0x0E, 0x09,
+  0x06, 0x11, 0x03, 0x80, 0x26, 0x07, 0x09, 0x80, 0x1E, 0x06, 0x12, 0x04, 0x0B, 0x80, 0x12, 0x0A,
+  0x00, 0x82, 0x18, 0x12, 0x73, 0x02, 0x08, 0xC0, 0x75, 0x76, 0x81, 0x53, 0x20, 0x08, 0x10, 0x83,
+  0x20, 0x83, 0x3B, 0x3C, 0x07, 0x0F, 0xC0, 0x92, 0x4D, 0x80, 0x1A, 0x08, 0x07, 0x80, 0x2E, 0xC0,
+  0xEC, 0x64, 0xC0, 0x8A, 0xBE, 0x80, 0x46, 0x0B, 0x0A, 0x8D, 0x46, 0x9B, 0x16, 0x1F, 0x1F, 0x16,
+  0x1F, 0x16, 0x1F, 0xB8, 0x3D, 0x23, 0x1C, 0x1C, 0xC0, 0x05, 0x54, 0xC0, 0x06, 0x1A, 0x80, 0x2D,
+  0x0D, 0x0D, 0x01, 0x2A, 0x0A, 0x14, 0x81, 0x6E, 0x8B, 0x17, 0x05, 0x82, 0x45, 0x6E, 0x44, 0x05,
+  0x11, 0x01, 0x1D, 0x0E, 0x04, 0x10, 0x01, 0x01, 0x17, 0x02, 0x06, 0x02, 0x0E, 0x09, 0x06, 0x11,
+  0x03, 0x80, 0x26, 0x07, 0x09, 0x80, 0x1E, 0x06, 0x12, 0x04, 0x0B, 0x80, 0x12, 0x0A, 0x00, 0x81,
+  0x18, 0xE5, 0xC0, 0x37, 0x9F, 0x02, 0x08, 0xC0, 0x55, 0x76, 0x81, 0x10, 0x20, 0x08, 0x10, 0x83,
+  0x38, 0x83, 0x52, 0x3C, 0x07, 0x0F, 0xC0, 0x92, 0x4D, 0x80, 0x1A, 0x08, 0x07, 0xC0, 0x6D, 0x13,
+  0xC0, 0x6C, 0x4C, 0x81, 0xAB, 0x46, 0x0B, 0x0A, 0x85, 0x4D, 0xC6, 0x16, 0x1F, 0x1F, 0x16, 0x02,
+  0x1F, 0x85, 0xE2, 0x88, 0x23, 0x1C, 0x1C, 0x95, 0xC0, 0x26, 0x1A, 0x80, 0x2D, 0x0B, 0x0D, 0x82,
+  0x2D, 0x2A, 0x2A, 0x0B, 0x14, 0x81, 0x59, 0x4A, 0x17, 0x05, 0x81, 0x24, 0xC1, 0x06, 0x11, 0x01,
+  0x1D, 0x0E, 0x04, 0x10, 0x01, 0x01, 0x17, 0x02, 0x06, 0x02, 0x0E, 0x09, 0x06, 0x11, 0x03, 0x80,
+  0x26, 0x07, 0x09, 0x80, 0x1E, 0x06, 0x12, 0x04, 0x0B, 0x80, 0x12, 0x0A, 0x00, 0x81, 0x18, 0xE5,
+  0xC0, 0x37, 0x9F, 0x82, 0x36, 0x08, 0x08, 0xC0, 0x55, 0x76, 0x81, 0x10, 0x20, 0x08, 0x10, 0x83,
+  0x20, 0x90, 0x52, 0x3C, 0x07, 0x0F, 0xC0, 0x92, 0x55, 0x80, 0x1A, 0x08, 0x07, 0x80, 0xA8, 0xC0,
+  0xEB, 0x33, 0xC0, 0x4A, 0xAE, 0x80, 0x1B, 0x0B, 0x0A, 0x84, 0x4D, 0x62, 0x16, 0x16, 0x1F, 0x04,
+  0x16, 0x84, 0xC8, 0x23, 0x23, 0x1C, 0xEC, 0xC0, 0x46, 0x22, 0x0B, 0x0D, 0x01, 0x2D, 0x01, 0x2A,
+  0x0B, 0x14, 0x81, 0x59, 0x4A, 0x16, 0x05, 0x01, 0x24, 0x80, 0xA5, 0x06, 0x11, 0x01, 0x1D, 0x0E,
+  0x04, 0x10, 0x01, 0x01, 0x17, 0x02, 0x06, 0x02, 0x0E, 0x09, 0x06, 0x11, 0x03, 0x80, 0x26, 0x07,
+  0x09, 0x80, 0x1E, 0x06, 0x12, 0x04, 0x0B, 0x80, 0x12, 0x0A, 0x00, 0x85, 0x18, 0x1E, 0x9A, 0x36,
+  0x08, 0x08, 0xC0, 0x35, 0x76, 0x0A, 0x10, 0x83, 0x20, 0x90, 0x52, 0x3C, 0x07, 0x0F, 0x81, 0xC9,
+  0x6D, 0x08, 0x07, 0xC0, 0x8E, 0x13, 0xC0, 0xAB, 0x2B, 0xC0, 0xEA, 0xA5, 0x81, 0xBB, 0x1B, 0x0B,
+  0x0A, 0x83, 0x81, 0x16, 0x16, 0x1F, 0x04, 0x16, 0x84, 0xEE, 0x31, 0x31, 0x1C, 0xB2, 0xC0, 0x66,
+  0x22, 0x0B, 0x0D, 0x01, 0x2D, 0x82, 0x2A, 0x48, 0x48, 0x06, 0x14, 0x03, 0x13, 0x81, 0x59, 0x9F,
+  0x17, 0x05, 0x80, 0x5D, 0xC0, 0x0A, 0x1B, 0x06, 0x11, 0x01, 0x1D, 0x0E, 0x04, 0x10, 0x01, 0x01,
+  0x17, 0x02, 0x06, 0x02, 0x0E, 0x09, 0x06, 0x11, 0x03, 0x80, 0x26, 0x07, 0x09, 0x80, 0x1E, 0x06,
+  0x12, 0x04, 0x0B, 0x80, 0x12, 0x0A, 0x00, 0x85, 0x18, 0x1E, 0x9A, 0x36, 0x08, 0x08, 0xC0, 0x35,
+  0x76, 0x0A, 0x10, 0x83, 0x20, 0x53, 0x52, 0x3C, 0x07, 0x0F, 0xC0, 0xF3, 0x5D, 0x80, 0x4A, 0x08,
+  0x07, 0xC0, 0x8E, 0x1B, 0xC0, 0x6B, 0x23, 0xC0, 0x8A, 0x85, 0x81, 0x72, 0x1B, 0x0B, 0x0A, 0x83,
+  0xC4, 0x16, 0x16, 0x1F, 0x04, 0x16, 0x80, 0xD1, 0x02, 0x31, 0x80, 0x23, 0xC0, 0xA6, 0x2A, 0x80,
+  0x61, 0x09, 0x0D, 0x02, 0x2D, 0x81, 0x2A, 0x48, 0x07, 0x14, 0x03, 0x13, 0x81, 0x59, 0x45, 0x17,
+  0x05, 0x80, 0x5D, 0xC0, 0x4B, 0x23, 0x81, 0x86, 0x75, 0x04, 0x11, 0x01, 0x1D, 0x0E, 0x04, 0x10,
+  0x01, 0x01, 0x17, 0x02, 0x06, 0x02, 0x0E, 0x02, 0x06, 0x80, 0x41, 0x05, 0x06, 0x11, 0x03, 0x80,
+  0x26, 0x07, 0x09, 0x80, 0x1E, 0x06, 0x12, 0x04, 0x0B, 0x80, 0x12, 0x0A, 0x00, 0x80, 0x18, 0xC0,
+  0x99, 0xE7, 0x83, 0x8E, 0x58, 0x08, 0x08, 0xC0, 0x35, 0x76, 0x0A, 0x10, 0x83, 0x20, 0x53, 0xCB,
+  0x3C, 0x07, 0x0F, 0x81, 0x85, 0x4A, 0x09, 0x07, 0x80, 0x2E, 0xC0, 0xEB, 0x6C, 0x81, 0x8D, 0x1B,
+  0x0B, 0x0A, 0x83, 0x5C, 0x34, 0x16, 0x1F, 0x04, 0x16, 0x80, 0xB8, 0x02, 0x31, 0x80, 0x23, 0xC0,
+  0xE6, 0x32, 0x81, 0x5E, 0x2D, 0x08, 0x0D, 0x02, 0x2D, 0x81, 0x2A, 0x48, 0x07, 0x14, 0x03, 0x13,
+  0x81, 0x59, 0x4A, 0x17, 0x05, 0x83, 0x5D, 0x64, 0xED, 0x75, 0x04, 0x11, 0x01, 0x1D, 0x0E, 0x04,
+  0x10, 0x01, 0x01, 0x17, 0x02, 0x06, 0x02, 0x0E, 0x02, 0x06, 0x03, 0x41, 0x02, 0x06, 0x11, 0x03,
+  0x80, 0x26, 0x07, 0x09, 0x80, 0x1E, 0x06, 0x12, 0x04, 0x0B, 0x80, 0x12, 0x0A, 0x00, 0x85, 0x18,
+  0x21, 0x9E, 0xD7, 0x08, 0x08, 0xC0, 0x35, 0x76, 0x0B, 0x10, 0x82, 0x53, 0xCB, 0x4B, 0x07, 0x0F,
+  0x80, 0x85, 0xC0, 0xEE, 0x2B, 0x07, 0x07, 0x82, 0x1A, 0x07, 0x2E, 0xC0, 0x8C, 0x54, 0x81, 0x0A,
+  0x1B, 0x0B, 0x0A, 0x83, 0xAB, 0x34, 0x16, 0x1F, 0x04, 0x16, 0x80, 0x6C, 0xC0, 0x85, 0x74, 0x01,
+  0x31, 0x80, 0x23, 0xC0, 0x25, 0x3B, 0x81, 0x5E, 0x2D, 0x08, 0x0D, 0x02, 0x2D, 0x81, 0x2A, 0x48,
+  0x07, 0x14, 0x03, 0x13, 0x81, 0x59, 0x45, 0x17, 0x05, 0x83, 0x57, 0x98, 0x37, 0x75, 0x04, 0x11,
+  0x01, 0x1D, 0x0E, 0x04, 0x10, 0x01, 0x01, 0x17, 0x02, 0x06, 0x02, 0x0E, 0x02, 0x06, 0x04, 0x41,
+  0x02, 0x06, 0x10, 0x03, 0x80, 0x26, 0x07, 0x09, 0x80, 0x1E, 0x06, 0x12, 0x04, 0x0B, 0x80, 0x12,
+  0x0B, 0x00, 0x80, 0x21, 0xC0, 0x37, 0xBF, 0x82, 0xD7, 0x08, 0x08, 0xC0, 0x35, 0x6E, 0x81, 0x10,
+  0x20, 0x09, 0x10, 0x82, 0x53, 0xCB, 0x4B, 0x07, 0x0F, 0xC0, 0x34, 0x66, 0x80, 0x99, 0x07, 0x07,
+  0x82, 0x1A, 0x07, 0x3F, 0xC0, 0x0C, 0x3C, 0xC0, 0x4A, 0xB6, 0x80, 0x1B, 0x0C, 0x0A, 0x82, 0xC6,
+  0x16, 0x1F, 0x05, 0x16, 0x83, 0x88, 0x31, 0x31, 0x1C, 0xC0, 0xA5, 0x4B, 0x81, 0x5E, 0x2D, 0x08,
+  0x0D, 0x02, 0x2D, 0x82, 0x2A, 0x48, 0x48, 0x06, 0x14, 0x02, 0x13, 0x82, 0x14, 0x59, 0x45, 0x17,
+  0x05, 0x83, 0x24, 0x57, 0xD2, 0x75, 0x04, 0x11, 0x01, 0x1D, 0x0E, 0x04, 0x10, 0x01, 0x01, 0x17,
+  0x02, 0x06, 0x02, 0x0E, 0x02, 0x06, 0x04, 0x41, 0x02, 0x06, 0x10, 0x03, 0x80, 0x26, 0x07, 0x09,
+  0x80, 0x1E, 0x06, 0x12, 0x04, 0x0B, 0x80, 0x12, 0x0B, 0x00, 0x80, 0x42, 0xC0, 0x37, 0xC7, 0x82,
+  0xD7, 0x08, 0x60, 0xC0, 0x35, 0x6E, 0x81, 0x56, 0x20, 0x09, 0x10, 0x82, 0x53, 0xCB, 0x4B, 0x07,
+  0x0F, 0x80, 0x52, 0xC0, 0x2F, 0x2C, 0x07, 0x07, 0x01, 0x1A, 0xC0, 0x8E, 0x1B, 0xC0, 0xAC, 0x2B,
+  0xC0, 0x0B, 0xAE, 0x80, 0x54, 0x0C, 0x0A, 0x82, 0x62, 0x16, 0x1F, 0x05, 0x16, 0x83, 0xC8, 0x31,
+  0x31, 0xD5, 0xC0, 0xE5, 0x53, 0x82, 0xAF, 0x2D, 0x61, 0x07, 0x0D, 0x02, 0x2D, 0x82, 0x2A, 0x48,
+  0x48, 0x06, 0x14, 0x02, 0x13, 0x82, 0x14, 0xC1, 0x45, 0x17, 0x05, 0x81, 0x24, 0x57, 0xC0, 0xC9,
+  0x1A, 0x05, 0x11, 0x01, 0x1D, 0x0E, 0x04, 0x10, 0x01, 0x01, 0x17, 0x02, 0x06, 0x02, 0x0E, 0x02,
+  0x06, 0x04, 0x41, 0x02, 0x06, 0x10, 0x03, 0x80, 0x26, 0x07, 0x09, 0x80, 0x1E, 0x06, 0x12, 0x04,
+  0x0B, 0x80, 0x12, 0x0B, 0x00, 0x84, 0x18, 0xD9, 0x93, 0x08, 0xA9, 0xC0, 0x55, 0x76, 0x80, 0x56,
+  0x09, 0x10, 0x83, 0x20, 0x53, 0xCB, 0x4B, 0x07, 0x0F, 0x80, 0x52, 0xC0, 0x2F, 0x34, 0x80, 0x3F,
+  0x06, 0x07, 0x01, 0x1A, 0x81, 0x6D, 0x64, 0xC0, 0xAB, 0x95, 0x80, 0x8D, 0x0C, 0x0A, 0x80, 0x81,
+  0x07, 0x16, 0x84, 0x4F, 0x31, 0x31, 0xE3, 0x95, 0xC0, 0x26, 0x1A, 0x80, 0x2D, 0x08, 0x0D, 0x02,
+  0x2D, 0x81, 0x2A, 0x48, 0x07, 0x14, 0x02, 0x13, 0x80, 0x14, 0xC0, 0x88, 0x0A, 0x80, 0x24, 0x18,
+  0x05, 0x80, 0x5D, 0xC0, 0x2B, 0x23, 0x05, 0x11, 0x01, 0x1D, 0x0E, 0x04, 0x10, 0x01, 0x01, 0x17,
+  0x02, 0x06, 0x02, 0x0E, 0x02, 0x06, 0x04, 0x41, 0x02, 0x06, 0x10, 0x03, 0x80, 0x26, 0x07, 0x09,
+  0x80, 0x1E, 0x05, 0x12, 0x05, 0x0B, 0x80, 0x12, 0x0B, 0x00, 0x80, 0x18, 0xC0, 0x57, 0xCF, 0x82,
+  0x93, 0x08, 0x08, 0xC0, 0x55, 0x76, 0x81, 0x56, 0x20, 0x08, 0x10, 0x83, 0x20, 0x90, 0x52, 0x4B,
+  0x07, 0x0F, 0x80, 0x52, 0xC0, 0x2F, 0x34, 0x80, 0x3F, 0x07, 0x07, 0x82, 0x1A, 0x6D, 0x64, 0xC0,
+  0x0B, 0x75, 0xC0, 0x8B, 0xC6, 0x80, 0x1B, 0x0B, 0x0A, 0xC0, 0x29, 0xBE, 0x80, 0x63, 0x05, 0x16,
+  0x85, 0x1F, 0xD1, 0x31, 0x31, 0xE3, 0x23, 0xC0, 0x87, 0x2A, 0x01, 0x61, 0x07, 0x0D, 0x01, 0x2D,
+  0x82, 0x5E, 0xB3, 0x37, 0x07, 0x14, 0x02, 0x13, 0x82, 0x14, 0x82, 0x24, 0x18, 0x05, 0x83, 0x5D,
+  0x64, 0x86, 0x75, 0x03, 0x11, 0x01, 0x1D, 0x0E, 0x04, 0x10, 0x01, 0x01, 0x17, 0x02, 0x06, 0x02,
+  0x0E, 0x02, 0x06, 0x04, 0x41, 0x02, 0x06, 0x10, 0x03, 0x80, 0x26, 0x07, 0x09, 0x80, 0x1E, 0x05,
+  0x12, 0x05, 0x0B, 0x0C, 0x00, 0x84, 0x18, 0xD4, 0x93, 0x36, 0x08, 0xC0, 0x55, 0x76, 0x81, 0x56,
+  0x20, 0x08, 0x10, 0x83, 0x20, 0x90, 0x52, 0x4B, 0x07, 0x0F, 0x80, 0x52, 0xC0, 0x2F, 0x2C, 0x80,
+  0x3F, 0x07, 0x07, 0x01, 0x1A, 0x80, 0x2E, 0xC0, 0x4B, 0x54, 0xC0, 0x6B, 0xBE, 0x02, 0x1B, 0x07,
+  0x0A, 0x84, 0x1B, 0x0A, 0x5A, 0x34, 0x3A, 0x05, 0x16, 0xC0, 0x47, 0x95, 0x01, 0x31, 0x81, 0x65,
+  0x23, 0xC0, 0x06, 0x33, 0x81, 0x5E, 0x2D, 0x08, 0x0D, 0xC0, 0xA7, 0x11, 0x80, 0x5E, 0xC0, 0x08,
+  0x3B, 0xC0, 0x06, 0x0A, 0x07, 0x14, 0x02, 0x13, 0x82, 0x14, 0x82, 0x24, 0x19, 0x05, 0x81, 0x98,
+  0x2A, 0x04, 0x11, 0x01, 0x1D, 0x0E, 0x04, 0x10, 0x01, 0x01, 0x17, 0x02, 0x06, 0x02, 0x0E, 0x02,
+  0x06, 0x04, 0x41, 0x02, 0x06, 0x10, 0x03, 0x80, 0x26, 0x07, 0x09, 0x80, 0x1E, 0x05, 0x12, 0x02,
+  0x0B, 0x80, 0x12, 0x0E, 0x00, 0x84, 0x18, 0xE5, 0x69, 0x58, 0x08, 0xC0, 0x75, 0x76, 0x81, 0x10,
+  0x20, 0x08, 0x10, 0x85, 0x20, 0x83, 0x52, 0x4B, 0x3C, 0x3C, 0x05, 0x0F, 0x80, 0x52, 0xC0, 0x2F,
+  0x2C, 0x80, 0x2E, 0x08, 0x07, 0x81, 0x1A, 0x3F, 0xC0, 0xEC, 0x3B, 0xC0, 0x4B, 0xB6, 0x01, 0x1B,
+  0x80, 0x4C, 0x03, 0x54, 0x03, 0x0A, 0x01, 0x1B, 0x83, 0x46, 0x9B, 0x3A, 0x16, 0x02, 0x1F, 0x01,
+  0x16, 0x80, 0x6C, 0xC0, 0x85, 0x74, 0x82, 0x31, 0x65, 0x3D, 0xC0, 0x86, 0x43, 0xC0, 0xC5, 0x11,
+  0x06, 0x0D, 0x82, 0x2D, 0x0D, 0x0D, 0xC0, 0xA7, 0x11, 0xC0, 0x46, 0x22, 0xC0, 0x88, 0x4B, 0xC0,
+  0xE5, 0x09, 0x07, 0x14, 0x02, 0x13, 0x82, 0x14, 0xC1, 0x24, 0x19, 0x05, 0x81, 0x24, 0x59, 0x04,
+  0x11, 0x01, 0x1D, 0x0E, 0x04, 0x10, 0x01, 0x01, 0x17, 0x02, 0x06, 0x02, 0x0E, 0x02, 0x06, 0x04,
+  0x41, 0x02, 0x06, 0x10, 0x03, 0x80, 0x26, 0x07, 0x09, 0x80, 0x1E, 0x05, 0x12, 0x02, 0x0B, 0x80,
+  0x21, 0x0F, 0x00, 0x86, 0x12, 0x9A, 0x49, 0x08, 0xFA, 0x53, 0x20, 0x08, 0x10, 0x85, 0x20, 0x83,
+  0x52, 0x4B, 0x3C, 0x3C, 0x05, 0x0F, 0x80, 0x3B, 0xC0, 0x4F, 0x34, 0x80, 0x2E, 0x08, 0x07, 0x81,
+  0x1A, 0x07, 0xC0, 0x8C, 0x2B, 0xC0, 0xEA, 0xA5, 0x82, 0x1B, 0x0A, 0x4C, 0x03, 0x54, 0x03, 0x0A,
+  0x01, 0x1B, 0x83, 0x0A, 0x62, 0x3A, 0x16, 0x03, 0x1F, 0x01, 0x16, 0x83, 0x88, 0x31, 0x23, 0x3D,
+  0xC0, 0x06, 0x54, 0xC0, 0xE5, 0x11, 0x06, 0x0D, 0x82, 0x2D, 0x0D, 0x2D, 0xC0, 0xA6, 0x11, 0xC0,
+  0x06, 0x3B, 0xC0, 0xE8, 0x5B, 0xC0, 0xE6, 0x09, 0x07, 0x14, 0x02, 0x13, 0x82, 0x14, 0xC1, 0x45,
+  0x19, 0x05, 0x80, 0x57, 0xC0, 0xAA, 0x12, 0x04, 0x11, 0x01, 0x1D, 0x0E, 0x04, 0x10, 0x01, 0x01,
+  0x17, 0x02, 0x06, 0x02, 0x0E, 0x02, 0x06, 0x04, 0x41, 0x02, 0x06, 0x10, 0x03, 0x80, 0x26, 0x07,
+  0x09, 0x80, 0x1E, 0x05, 0x12, 0x02, 0x0B, 0x80, 0x21, 0x0F, 0x00, 0x86, 0x12, 0x9E, 0xD7, 0x08,
+  0xD8, 0xE6, 0x20, 0x08, 0x10, 0x85, 0x20, 0x83, 0x52, 0x4B, 0x3C, 0x3C, 0x05, 0x0F, 0x80, 0x3B,
+  0xC0, 0x8F, 0x34, 0x80, 0x2E, 0x08, 0x07, 0x82, 0x1A, 0x07, 0xF0, 0xC0, 0x6A, 0x85, 0x82, 0x0A,
+  0x1B, 0x0A, 0x03, 0x54, 0x03, 0x0A, 0x01, 0x1B, 0x83, 0x54, 0xE7, 0x3A, 0x16, 0x03, 0x1F, 0x01,
+  0x16, 0x83, 0xC8, 0x31, 0x23, 0x23, 0xC0, 0x46, 0x64, 0xC0, 0x46, 0x22, 0xC0, 0xA7, 0x09, 0x05,
+  0x0D, 0x01, 0x2D, 0x80, 0x0D, 0xC0, 0xA7, 0x11, 0xC0, 0xE6, 0x5B, 0xC0, 0x07, 0x64, 0xC0, 0xE6,
+  0x09, 0x07, 0x14, 0x03, 0x13, 0x81, 0xC1, 0x45, 0x1A, 0x05, 0x82, 0x77, 0x86, 0x1D, 0x02, 0x11,
+  0x01, 0x1D, 0x0E, 0x04, 0x10, 0x01, 0x01, 0x17, 0x02, 0x06, 0x02, 0x0E, 0x02, 0x06, 0x04, 0x41,
+  0x02, 0x06, 0x10, 0x03, 0x80, 0x26, 0x07, 0x09, 0x80, 0x1E, 0x05, 0x12, 0x02, 0x0B, 0x80, 0x21,
+  0x0F, 0x00, 0x83, 0x21, 0xD9, 0x49, 0x08, 0xC0, 0xD6, 0x86, 0x81, 0x90, 0x20, 0x08, 0x10, 0x84,
+  0x20, 0x83, 0x52, 0x4B, 0x3C, 0x06, 0x0F, 0x82, 0x3B, 0x10, 0x1A, 0x08, 0x07, 0x82, 0x1A, 0x07,
+  0x3F, 0xC0, 0xAB, 0x5C, 0xC0, 0x8A, 0xBE, 0x82, 0x1B, 0x0A, 0x4C, 0x02, 0x54, 0x03, 0x0A, 0x02,
+  0x1B, 0x82, 0x5C, 0xBE, 0x16, 0x03, 0x1F, 0x86, 0x16, 0x1F, 0x4F, 0x31, 0x23, 0x65, 0x23, 0xC0,
+  0xE6, 0x32, 0xC0, 0xA6, 0x09, 0x05, 0x0D, 0x81, 0x2D, 0x0D, 0xC0, 0xA7, 0x09, 0xC0, 0x07, 0x1A,
+  0xC0, 0x86, 0x74, 0xC0, 0x27, 0x64, 0xC0, 0xE6, 0x09, 0x07, 0x14, 0x03, 0x13, 0x81, 0xC7, 0x9F,
+  0x1A, 0x05, 0x80, 0x64, 0xC0, 0xC6, 0x01, 0x03, 0x11, 0x01, 0x1D, 0x0E, 0x04, 0x10, 0x01, 0x01,
+  0x17, 0x02, 0x06, 0x02, 0x0E, 0x02, 0x06, 0x04, 0x41, 0x02, 0x06, 0x10, 0x03, 0x80, 0x26, 0x07,
+  0x09, 0x80, 0x1E, 0x05, 0x12, 0x02, 0x0B, 0x80, 0x21, 0x0F, 0x00, 0x81, 0x21, 0xD4, 0xC0, 0xF6,
+  0x96, 0x83, 0x08, 0xA2, 0x6A, 0x20, 0x08, 0x10, 0x83, 0x20, 0x90, 0x52, 0x4B, 0x08, 0x0F, 0x81,
+  0x6A, 0x1A, 0x08, 0x07, 0x82, 0x1A, 0x07, 0x3F, 0xC0, 0xEC, 0x33, 0xC0, 0x2B, 0xAE, 0x80, 0x1B,
+  0x08, 0x0A, 0x02, 0x1B, 0x82, 0x46, 0x34, 0x3A, 0x03, 0x1F, 0x01, 0x16, 0x84, 0xD1, 0x3D, 0x23,
+  0x65, 0x23, 0xC0, 0x47, 0x3B, 0xC0, 0xA6, 0x09, 0x05, 0x0D, 0x81, 0x2D, 0x0D, 0xC0, 0xA7, 0x11,
+  0xC0, 0xA6, 0x32, 0x80, 0x4F, 0xC0, 0x46, 0x6C, 0x82, 0xE0, 0x14, 0x3E, 0x09, 0x13, 0x81, 0x59,
+  0x9F, 0x1A, 0x05, 0x80, 0x45, 0xC0, 0x27, 0x02, 0x04, 0x11, 0x80, 0x1D, 0x0E, 0x04, 0x10, 0x01,
+  0x01, 0x17, 0x02, 0x06, 0x02, 0x0E, 0x02, 0x06, 0x04, 0x41, 0x02, 0x06, 0x10, 0x03, 0x80, 0x26,
+  0x07, 0x09, 0x80, 0x1E, 0x05, 0x12, 0x02, 0x0B, 0x80, 0x21, 0x0E, 0x00, 0x85, 0x21, 0x00, 0x5B,
+  0x73, 0x08, 0xA2, 0xC0, 0x51, 0x4D, 0x80, 0x20, 0x08, 0x10, 0x83, 0x20, 0x90, 0x52, 0x4B, 0x08,
+  0x0F, 0x83, 0x91, 0x6D, 0x3F, 0x3F, 0x09, 0x07, 0x80, 0x2E, 0xC0, 0x8B, 0x85, 0x81, 0x8D, 0x1B,
+  0x07, 0x0A, 0x02, 0x1B, 0x80, 0x46, 0xC0, 0xE7, 0xAD, 0x80, 0x3A, 0x03, 0x1F, 0x01, 0x16, 0x84,
+  0x6C, 0x3D, 0x23, 0x65, 0x23, 0xC0, 0xA7, 0x4B, 0xC0, 0xC5, 0x11, 0x05, 0x0D, 0x82, 0x5E, 0x2D,
+  0x2D, 0xC0, 0x66, 0x4B, 0x80, 0x39, 0xC0, 0x66, 0x6C, 0x82, 0xCC, 0x3E, 0x3E, 0x09, 0x13, 0x81,
+  0x59, 0x4A, 0x19, 0x05, 0x01, 0x24, 0x80, 0x59, 0x04, 0x11, 0x80, 0x1D, 0x0E, 0x04, 0x10, 0x01,
+  0x01, 0x17, 0x02, 0x06, 0x02, 0x0E, 0x02, 0x06, 0x02, 0x41, 0x04, 0x06, 0x10, 0x03, 0x80, 0x26,
+  0x07, 0x09, 0x80, 0x1E, 0x05, 0x12, 0x02, 0x0B, 0x80, 0x21, 0x10, 0x00, 0x85, 0x0B, 0x9A, 0x49,
+  0x49, 0x96, 0x20, 0x08, 0x10, 0x81, 0x20, 0x90, 0xC0, 0x15, 0x5E, 0x80, 0x4B, 0x08, 0x0F, 0xC0,
+  0x92, 0x55, 0x81, 0x6D, 0x3F, 0x0A, 0x07, 0x80, 0xB7, 0xC0, 0xAB, 0x5C, 0xC0, 0x8B, 0xBE, 0x80,
+  0x1B, 0x07, 0x0A, 0x03, 0x1B, 0x82, 0xE7, 0xBE, 0x16, 0x02, 0x1F, 0x01, 0x16, 0x84, 0xE2, 0x88,
+  0x65, 0x65, 0x23, 0xC0, 0xE6, 0x53, 0xC0, 0x05, 0x12, 0x05, 0x0D, 0x81, 0x5E, 0x2D, 0xC0, 0xE7,
+  0x11, 0xC0, 0x05, 0x5C, 0x84, 0x71, 0xDA, 0xC5, 0x3E, 0x3E, 0x09, 0x13, 0x81, 0x6E, 0xC2, 0x19,
+  0x05, 0x82, 0x24, 0xA1, 0xA5, 0xC0, 0x65, 0x01, 0x03, 0x11, 0x80, 0x1D, 0x0E, 0x04, 0x10, 0x01,
+  0x01, 0x17, 0x02, 0x06, 0x02, 0x0E, 0x02, 0x06, 0x02, 0x41, 0x04, 0x06, 0x10, 0x03, 0x80, 0x26,
+  0x07, 0x09, 0x80, 0x1E, 0x05, 0x12, 0x02, 0x0B, 0x80, 0x21, 0x10, 0x00, 0x84, 0x21, 0x9E, 0x49,
+  0x08, 0xC3, 0x09, 0x10, 0x83, 0x20, 0x10, 0x67, 0x4B, 0x07, 0x0F, 0x82, 0x3C, 0xB5, 0xDF, 0x0C,
+  0x07, 0xC0, 0x0B, 0x34, 0xC0, 0x2B, 0xA6, 0x08, 0x0A, 0x03, 0x1B, 0x81, 0x5C, 0x34, 0x06, 0x16,
+  0x83, 0xC8, 0x65, 0x23, 0x23, 0xC0, 0x26, 0x5C, 0xC0, 0x45, 0x22, 0x05, 0x0D, 0x81, 0x5E, 0x2D,
+  0xC0, 0x07, 0x1A, 0x81, 0x31, 0x2C, 0xC0, 0xA7, 0x7C, 0xC0, 0x66, 0x1A, 0x01, 0x3E, 0x09, 0x13,
+  0x81, 0x68, 0x8B, 0x19, 0x05, 0x81, 0x24, 0xA1, 0xC0, 0x0A, 0x1B, 0xC0, 0x85, 0x01, 0x03, 0x11,
+  0x80, 0x1D, 0x0E, 0x04, 0x10, 0x01, 0x01, 0x17, 0x02, 0x06, 0x02, 0x0E, 0x03, 0x06, 0x01, 0x41,
+  0x04, 0x06, 0x10, 0x03, 0x80, 0x26, 0x07, 0x09, 0x80, 0x1E, 0x05, 0x12, 0x02, 0x0B, 0x80, 0x21,
+  0x0F, 0x00, 0x81, 0x47, 0x21, 0xC0, 0x77, 0xCF, 0x82, 0xA0, 0x7D, 0xCB, 0x0B, 0x10, 0x83, 0xAA,
+  0x4B, 0x3C, 0x3C, 0x05, 0x0F, 0x82, 0x3C, 0x67, 0x45, 0x0C, 0x07, 0x80, 0x8B, 0xC0, 0x6A, 0x85,
+  0x81, 0x0A, 0x1B, 0x07, 0x0A, 0x02, 0x1B, 0x82, 0x46, 0xC6, 0x34, 0x04, 0x16, 0x81, 0x1F, 0x4F,
+  0xC0, 0x84, 0x6C, 0x82, 0x1C, 0x65, 0x23, 0xC0, 0xA6, 0x2A, 0x82, 0x0D, 0x61, 0x2D, 0x02, 0x0D,
+  0x80, 0x5E, 0xC0, 0xA6, 0x11, 0xC0, 0x46, 0x2A, 0x85, 0xC8, 0x2C, 0xC8, 0xBA, 0x3E, 0x3E, 0x09,
+  0x13, 0x81, 0x68, 0x64, 0x19, 0x05, 0x01, 0x24, 0x81, 0xF0, 0x75, 0x02, 0x11, 0x01, 0x1D, 0x0E,
+  0x04, 0x10, 0x01, 0x01, 0x17, 0x02, 0x06, 0x02, 0x0E, 0x0A, 0x06, 0x10, 0x03, 0x80, 0x26, 0x07,
+  0x09, 0x80, 0x1E, 0x05, 0x12, 0x02, 0x0B, 0x80, 0x21, 0x0F, 0x00, 0x81, 0x47, 0x25, 0xC0, 0x77,
+  0xD7, 0x80, 0xA0, 0xC0, 0x37, 0x87, 0x82, 0xAC, 0x7E, 0x7E, 0x08, 0x10, 0x84, 0x20, 0xB5, 0x4B,
+  0x3C, 0x3C, 0x05, 0x0F, 0x82, 0x3C, 0x52, 0xA1, 0x0A, 0x07, 0x82, 0x1A, 0x92, 0x1A, 0xC0, 0x8A,
+  0x5C, 0xC0, 0x8B, 0xBE, 0x80, 0x1B, 0x0B, 0x0A, 0xC0, 0xC8, 0xAD, 0x80, 0x34, 0x04, 0x16, 0x81,
+  0x1F, 0x02, 0xC0, 0x84, 0x6C, 0x82, 0x1C, 0x65, 0x23, 0xC0, 0x07, 0x3B, 0x82, 0x61, 0xAF, 0x5E,
+  0x02, 0x0D, 0x80, 0x2D, 0xC0, 0xA6, 0x11, 0xC0, 0xC6, 0x3A, 0x82, 0x74, 0x2C, 0xEE, 0xC0, 0xA6,
+  0x22, 0x01, 0x3E, 0x09, 0x13, 0x81, 0x68, 0x1A, 0x1A, 0x05, 0x83, 0x24, 0x64, 0x0D, 0x11, 0x03,
+  0x1D, 0x0E, 0x04, 0x10, 0x01, 0x01, 0x17, 0x02, 0x06, 0x02, 0x0E, 0x0A, 0x06, 0x10, 0x03, 0x80,
+  0x26, 0x07, 0x09, 0x80, 0x1E, 0x05, 0x12, 0x02, 0x0B, 0x80, 0x21, 0x10, 0x00, 0x82, 0x47, 0x12,
+  0x9A, 0xC0, 0x36, 0x87, 0xC0, 0x95, 0x76, 0x82, 0x90, 0x7E, 0x7E, 0x07, 0x10, 0x80, 0x38, 0xC0,
+  0x93, 0x4D, 0x82, 0x4B, 0x3C, 0x3C, 0x06, 0x0F, 0x80, 0x52, 0xC0, 0x4F, 0x2C, 0x0B, 0x07, 0x81,
+  0x92, 0x1A, 0xC0, 0xCB, 0x33, 0xC0, 0x0B, 0xA6, 0x80, 0x1B, 0x0B, 0x0A, 0x81, 0x81, 0x63, 0x05,
+  0x16, 0x80, 0xA3, 0xC0, 0x84, 0x6C, 0x02, 0x23, 0xC0, 0x67, 0x43, 0x80, 0x61, 0xC0, 0xE7, 0x11,
+  0x80, 0x5E, 0x03, 0x2D, 0xC0, 0xA5, 0x11, 0xC0, 0x86, 0x53, 0x82, 0x02, 0x2C, 0xEE, 0xC0, 0xC7,
+  0x2A, 0x81, 0x3E, 0x14, 0x09, 0x13, 0x81, 0x68, 0x2E, 0x1A, 0x05, 0x83, 0x24, 0x98, 0x37, 0x11,
+  0x03, 0x1D, 0x0E, 0x04, 0x10, 0x01, 0x01, 0x17, 0x02, 0x06, 0x02, 0x0E, 0x0A, 0x06, 0x10, 0x03,
+  0x80, 0x26, 0x07, 0x09, 0x80, 0x1E, 0x05, 0x12, 0x02, 0x0B, 0x80, 0x21, 0x10, 0x00, 0x82, 0x47,
+  0x21, 0x8A, 0xC0, 0x36, 0x8F, 0xC0, 0xD6, 0x7E, 0x81, 0x7C, 0x7E, 0x08, 0x10, 0x84, 0x38, 0x97,
+  0x4B, 0x3C, 0x3C, 0x06, 0x0F, 0x82, 0x3B, 0x10, 0x1A, 0x0A, 0x07, 0x01, 0x1A, 0x80, 0x07, 0xC0,
+  0x4A, 0x7D, 0x0C, 0x0A, 0x82, 0x5C, 0x34, 0x63, 0x04, 0x16, 0x84, 0x6C, 0x88, 0x23, 0x23, 0x1C,
+  0xC0, 0xA6, 0x4B, 0xC0, 0xE5, 0x11, 0x81, 0x2D, 0x5E, 0x03, 0x2D, 0xC0, 0x05, 0x1A, 0xC0, 0x66,
+  0x74, 0x82, 0x02, 0x2C, 0x4F, 0xC0, 0x07, 0x33, 0x81, 0x3E, 0x14, 0x0A, 0x13, 0x80, 0x84, 0x1A,
+  0x05, 0x83, 0x24, 0x45, 0x59, 0x11, 0x03, 0x1D, 0x0E, 0x04, 0x10, 0x01, 0x01, 0x17, 0x02, 0x06,
+  0x02, 0x0E, 0x0A, 0x06, 0x10, 0x03, 0x80, 0x26, 0x07, 0x09, 0x80, 0x1E, 0x05, 0x12, 0x02, 0x0B,
+  0x80, 0x21, 0x12, 0x00, 0x80, 0xE5, 0xC0, 0x36, 0x97, 0xC0, 0x16, 0x7F, 0x82, 0x91, 0x7E, 0x7E,
+  0x07, 0x10, 0x81, 0x20, 0xF5, 0xC0, 0x56, 0x6E, 0x80, 0x3C, 0x07, 0x0F, 0x82, 0x4B, 0x91, 0x1A,
+  0x0B, 0x07, 0x81, 0x1A, 0x07, 0xC0, 0x6B, 0x54, 0xC0, 0x6B, 0xB6, 0x02, 0x0A, 0x01, 0x1B, 0x06,
+  0x0A, 0x80, 0x4D, 0xC0, 0xA7, 0xAD, 0x80, 0x63, 0x05, 0x16, 0x80, 0xC8, 0x02, 0x23, 0xC0, 0x06,
+  0x5C, 0xC0, 0x05, 0x1A, 0x03, 0x2D, 0x80, 0x0D, 0xC0, 0xA5, 0x09, 0xC0, 0xC6, 0x32, 0xC0, 0xE7,
+  0x84, 0x82, 0x50, 0x2C, 0x4F, 0xC0, 0x68, 0x3B, 0x0C, 0x13, 0x81, 0x77, 0x24, 0x19, 0x05, 0x01,
+  0x24, 0x81, 0xD3, 0x11, 0x03, 0x1D, 0x0E, 0x04, 0x10, 0x01, 0x01, 0x17, 0x02, 0x06, 0x02, 0x0E,
+  0x0A, 0x06, 0x10, 0x03, 0x80, 0x26, 0x07, 0x09, 0x80, 0x1E, 0x05, 0x12, 0x02, 0x0B, 0x80, 0x21,
+  0x12, 0x00, 0x80, 0x12, 0xC0, 0x57, 0xA7, 0xC0, 0x16, 0x87, 0xC0, 0x92, 0x55, 0x82, 0x7E, 0xB0,
+  0x20, 0x06, 0x10, 0x82, 0x38, 0x6A, 0x3B, 0x09, 0x0F, 0xC0, 0xD4, 0x55, 0x82, 0x6D, 0x3F, 0x3F,
+  0x0B, 0x07, 0xC0, 0xAB, 0x2B, 0xC0, 0xEC, 0x9D, 0x03, 0x0A, 0x80, 0x1B, 0x07, 0x0A, 0xC0, 0xE8,
+  0xB5, 0x80, 0x63, 0x05, 0x16, 0x84, 0xEE, 0x31, 0x23, 0x23, 0xB2, 0xC0, 0x65, 0x22, 0x03, 0x2D,
+  0x80, 0x0D, 0xC0, 0xC5, 0x11, 0xC0, 0xE6, 0x5B, 0x82, 0xAD, 0x27, 0x2C, 0xC0, 0x25, 0x85, 0xC0,
+  0xA8, 0x4B, 0x83, 0x37, 0x6E, 0x13, 0x37, 0x07, 0x13, 0x82, 0x35, 0x77, 0x5D, 0x19, 0x05, 0x01,
+  0x24, 0xC0, 0xC9, 0x12, 0x80, 0x11, 0x03, 0x1D, 0x0E, 0x04, 0x10, 0x01, 0x01, 0x17, 0x02, 0x06,
+  0x02, 0x0E, 0x0A, 0x06, 0x10, 0x03, 0x80, 0x26, 0x07, 0x09, 0x80, 0x1E, 0x05, 0x12, 0x02, 0x0B,
+  0x80, 0x21, 0x12, 0x00, 0x80, 0x21, 0xC0, 0x78, 0xBF, 0x80, 0x93, 0xC0, 0xD3, 0x5D, 0x82, 0x10,
+  0xB0, 0x20, 0x06, 0x10, 0x83, 0x38, 0x90, 0x52, 0x3C, 0x08, 0x0F, 0x83, 0x52, 0x55, 0x2E, 0x3F,
+  0x0B, 0x07, 0x80, 0x2E, 0xC0, 0x2B, 0x75, 0xC0, 0xAB, 0xC6, 0x81, 0x0A, 0x54, 0x09, 0x0A, 0xC0,
+  0x09, 0xB6, 0x80, 0x63, 0x05, 0x16, 0x81, 0x02, 0x31, 0x02, 0x23, 0xC0, 0xA6, 0x32, 0xC0, 0xA7,
+  0x11, 0x01, 0x2D, 0x81, 0x0D, 0x61, 0xC0, 0x66, 0x22, 0xC0, 0xC7, 0x74, 0x82, 0x02, 0x27, 0x2C,
+  0xC0, 0x25, 0x85, 0xC0, 0xC8, 0x53, 0x80, 0x37, 0x0A, 0x13, 0x82, 0x35, 0xF3, 0x57, 0x1A, 0x05,
+  0x80, 0x24, 0xC0, 0xEA, 0x1A, 0x01, 0x11, 0x02, 0x1D, 0x0E, 0x04, 0x10, 0x01, 0x01, 0x17, 0x02,
+  0x06, 0x02, 0x0E, 0x0A, 0x06, 0x10, 0x03, 0x80, 0x26, 0x07, 0x09, 0x80, 0x1E, 0x05, 0x12, 0x02,
+  0x0B, 0x80, 0x21, 0x13, 0x00, 0x80, 0x5B, 0xC0, 0x37, 0x9F, 0xC0, 0x34, 0x66, 0x82, 0x53, 0xB0,
+  0x20, 0x06, 0x10, 0x83, 0x20, 0x90, 0x85, 0x3C, 0x08, 0x0F, 0x83, 0x51, 0x10, 0xB7, 0x3F, 0x0B,
+  0x07, 0x80, 0x1A, 0xC0, 0x0B, 0x44, 0xC0, 0x6C, 0xAE, 0x80, 0xBB, 0x08, 0x0A, 0x83, 0x1B, 0x0A,
+  0x5C, 0x63, 0x05, 0x16, 0xC0, 0x47, 0x95, 0x83, 0x3D, 0x23, 0x23, 0x3D, 0xC0, 0x06, 0x3B, 0x83,
+  0x5E, 0x2D, 0x0D, 0x0D, 0xC0, 0xA5, 0x09, 0xC0, 0x47, 0x43, 0x84, 0x74, 0x39, 0x02, 0x2C, 0x39,
+  0xC0, 0x08, 0x5C, 0xC0, 0x06, 0x0A, 0x0A, 0x13, 0x82, 0x35, 0xC0, 0x24, 0x1A, 0x05, 0x83, 0x24,
+  0x77, 0x86, 0x11, 0x02, 0x1D, 0x0E, 0x04, 0x10, 0x01, 0x01, 0x17, 0x02, 0x06, 0x02, 0x0E, 0x0A,
+  0x06, 0x10, 0x03, 0x80, 0x26, 0x07, 0x09, 0x80, 0x1E, 0x05, 0x12, 0x02, 0x0B, 0x80, 0x21, 0x14,
+  0x00, 0xC0, 0x57, 0xAF, 0x82, 0x3C, 0x90, 0xB0, 0x09, 0x10, 0x81, 0xAA, 0x3C, 0x09, 0x0F, 0x82,
+  0x91, 0xB7, 0x2E, 0x0C, 0x07, 0x80, 0x2E, 0xC0, 0x4C, 0x7D, 0xC0, 0xCA, 0xCE, 0x81, 0x1B, 0x4C,
+  0x08, 0x0A, 0x81, 0x4D, 0x34, 0x05, 0x16, 0x84, 0xB9, 0x88, 0x23, 0x23, 0x3D, 0xC0, 0x87, 0x4B,
+  0x83, 0x5E, 0x2D, 0x0D, 0x0D, 0xC0, 0xC5, 0x11, 0xC0, 0xE7, 0x53, 0x01, 0x39, 0x01, 0x02, 0x80,
+  0x39, 0xC0, 0x48, 0x64, 0x80, 0xCC, 0x0A, 0x13, 0x82, 0x35, 0xBF, 0x24, 0x1A, 0x05, 0x80, 0x24,
+  0xC0, 0x4B, 0x23, 0x84, 0x86, 0x11, 0x11, 0x1D, 0x1D, 0x0E, 0x04, 0x10, 0x01, 0x01, 0x17, 0x02,
+  0x06, 0x02, 0x0E, 0x0A, 0x06, 0x10, 0x03, 0x80, 0x26, 0x07, 0x09, 0x80, 0x1E, 0x05, 0x12, 0x02,
+  0x0B, 0x80, 0x21, 0x14, 0x00, 0xC0, 0x77, 0xCF, 0xC0, 0xB5, 0x86, 0x81, 0x83, 0xB0, 0x09, 0x10,
+  0x81, 0x9C, 0x3C, 0x08, 0x0F, 0x83, 0x87, 0xB5, 0x1A, 0x2E, 0x0C, 0x07, 0x80, 0xA8, 0xC0, 0x2B,
+  0x4C, 0xC0, 0x6B, 0xBE, 0x01, 0x4C, 0x09, 0x0A, 0x82, 0xC6, 0x3A, 0x16, 0x03, 0x1F, 0x84, 0x16,
+  0x78, 0x23, 0x23, 0x3D, 0xC0, 0xE6, 0x53, 0xC0, 0x05, 0x12, 0x83, 0x2D, 0x0D, 0x0D, 0xE0, 0xC0,
+  0x87, 0x6C, 0x80, 0x39, 0x02, 0x02, 0x80, 0x39, 0xC0, 0x87, 0x6C, 0xC0, 0x46, 0x12, 0x80, 0x14,
+  0x0A, 0x13, 0x84, 0xBF, 0x24, 0x05, 0x05, 0x24, 0x18, 0x05, 0x85, 0xF0, 0x86, 0x11, 0x11, 0x1D,
+  0x1D, 0x0E, 0x04, 0x10, 0x01, 0x01, 0x17, 0x02, 0x06, 0x02, 0x0E, 0x0A, 0x06, 0x10, 0x03, 0x80,
+  0x26, 0x07, 0x09, 0x80, 0x1E, 0x05, 0x12, 0x02, 0x0B, 0x80, 0x21, 0x13, 0x00, 0x81, 0x42, 0x0B,
+  0xC0, 0xF6, 0x9E, 0x80, 0x91, 0xC0, 0xB1, 0x34, 0x07, 0x10, 0x83, 0x20, 0x38, 0x97, 0x3C, 0x09,
+  0x0F, 0x82, 0x85, 0x4A, 0x2E, 0x0B, 0x07, 0x01, 0x1A, 0xC0, 0x8B, 0x2B, 0xC0, 0x8B, 0x8D, 0x81,
+  0xBB, 0x54, 0x07, 0x0A, 0x01, 0x1B, 0x82, 0xA6, 0x3A, 0x16, 0x04, 0x1F, 0x83, 0x4F, 0x31, 0x23,
+  0x23, 0xC0, 0x26, 0x5C, 0xC0, 0x45, 0x1A, 0xC0, 0xA7, 0x09, 0x81, 0x2D, 0x0D, 0xC0, 0x86, 0x2A,
+  0x80, 0xEE, 0x04, 0x02, 0xC0, 0xC7, 0x74, 0xC0, 0x66, 0x1A, 0x80, 0x14, 0x0A, 0x13, 0x84, 0xA5,
+  0x24, 0x05, 0x24, 0x24, 0x17, 0x05, 0x86, 0x24, 0xF0, 0x86, 0x11, 0x11, 0x1D, 0x1D, 0x0E, 0x04,
+  0x10, 0x01, 0x01, 0x17, 0x02, 0x06, 0x02, 0x0E, 0x0A, 0x06, 0x10, 0x03, 0x80, 0x26, 0x07, 0x09,
+  0x80, 0x1E, 0x05, 0x12, 0x02, 0x0B, 0x80, 0x21, 0x13, 0x00, 0x01, 0x21, 0x81, 0xBC, 0x96, 0xC0,
+  0xB1, 0x34, 0x08, 0x10, 0x83, 0x38, 0xB4, 0x3B, 0x3C, 0x08, 0x0F, 0x80, 0x3B, 0xC0, 0x4F, 0x2C,
+  0x80, 0x2E, 0x0C, 0x07, 0x81, 0x64, 0x3F, 0xC0, 0x4B, 0x4C, 0xC0, 0x6B, 0xB6, 0x81, 0x4C, 0x1B,
+  0x06, 0x0A, 0x84, 0x1B, 0x0A, 0xE7, 0x3A, 0x16, 0x04, 0x1F, 0x86, 0xB8, 0x31, 0x23, 0x23, 0xF8,
+  0xBA, 0x4E, 0xC0, 0xE7, 0x11, 0x80, 0x61, 0xC0, 0x67, 0x43, 0x81, 0x02, 0x2C, 0x03, 0x02, 0x80,
+  0x78, 0xC0, 0xA6, 0x22, 0x80, 0x14, 0x09, 0x13, 0x85, 0x35, 0x82, 0x45, 0x05, 0x24, 0x24, 0x17,
+  0x05, 0x86, 0x24, 0x64, 0x86, 0x75, 0x11, 0x1D, 0x1D, 0x0E, 0x04, 0x10, 0x01, 0x01, 0x17, 0x02,
+  0x06, 0x02, 0x0E, 0x0A, 0x06, 0x10, 0x03, 0x80, 0x26, 0x07, 0x09, 0x80, 0x1E, 0x05, 0x12, 0x02,
+  0x0B, 0x80, 0x21, 0x13, 0x00, 0xC1, 0x97, 0xE7, 0x80, 0xE5, 0xC0, 0xB3, 0x6D, 0xC0, 0xB0, 0x2C,
+  0x08, 0x10, 0x83, 0x20, 0x6A, 0x52, 0x3C, 0x09, 0x0F, 0x81, 0x10, 0x2E, 0x0C, 0x07, 0x81, 0x1A,
+  0x07, 0xC0, 0xAB, 0x23, 0xC0, 0x6B, 0x8D, 0x82, 0x0A, 0x1B, 0x1B, 0x07, 0x0A, 0x82, 0x5C, 0x34,
+  0x16, 0x04, 0x1F, 0x81, 0x6C, 0x3D, 0x02, 0x23, 0xC0, 0x06, 0x33, 0x80, 0x75, 0xC0, 0xE8, 0x11,
+  0xC0, 0x05, 0x12, 0xC0, 0x27, 0x64, 0x81, 0x02, 0x2C, 0x03, 0x02, 0x80, 0x4F, 0xC0, 0xC6, 0x2A,
+  0x80, 0x14, 0x09, 0x13, 0x82, 0x35, 0xC7, 0x45, 0x1B, 0x05, 0x85, 0x64, 0x86, 0x75, 0x11, 0x11,
+  0x1D, 0x0E, 0x04, 0x10, 0x01, 0x01, 0x17, 0x02, 0x06, 0x02, 0x0E, 0x0A, 0x06, 0x10, 0x03, 0x80,
+  0x26, 0x07, 0x09, 0x80, 0x1E, 0x05, 0x12, 0x02, 0x0B, 0x80, 0x21, 0x13, 0x00, 0x81, 0x32, 0x47,
+  0xC0, 0xB8, 0xE7, 0xC0, 0x35, 0x86, 0xC0, 0x90, 0x34, 0x08, 0x10, 0x83, 0x20, 0x83, 0x52, 0x3C,
+  0x09, 0x0F, 0x81, 0xB4, 0x1A, 0x0E, 0x07, 0x80, 0x3F, 0xC0, 0x0A, 0x4C, 0xC0, 0x4A, 0xB6, 0x01,
+  0x1B, 0x06, 0x0A, 0x83, 0x1B, 0x5A, 0x9B, 0x16, 0x04, 0x1F, 0x81, 0x16, 0x88, 0x02, 0x23, 0xC0,
+  0x87, 0x4B, 0x80, 0x61, 0xC0, 0xC8, 0x09, 0xC0, 0x25, 0x1A, 0xC0, 0x67, 0x74, 0x05, 0x02, 0x80,
+  0x39, 0xC0, 0x26, 0x3B, 0x80, 0x37, 0x0A, 0x13, 0x84, 0x59, 0x4A, 0x05, 0x24, 0x24, 0x18, 0x05,
+  0x85, 0x8B, 0x61, 0x4E, 0x11, 0x11, 0x1D, 0x0E, 0x04, 0x10, 0x01, 0x01, 0x17, 0x02, 0x06, 0x02,
+  0x0E, 0x0A, 0x06, 0x10, 0x03, 0x80, 0x26, 0x07, 0x09, 0x80, 0x1E, 0x05, 0x12, 0x02, 0x0B, 0x80,
+  0x21, 0x13, 0x00, 0x01, 0x25, 0x80, 0x42, 0xC0, 0x96, 0xA6, 0x81, 0x56, 0x20, 0x08, 0x10, 0x82,
+  0x90, 0x67, 0x3C, 0x09, 0x0F, 0x81, 0xC9, 0xC2, 0x0F, 0x07, 0xC0, 0x4B, 0x23, 0xC0, 0xAA, 0x6C,
+  0x82, 0x8D, 0x1B, 0x1B, 0x05, 0x0A, 0x01, 0x1B, 0x81, 0x62, 0x16, 0x05, 0x1F, 0x80, 0x78, 0x02,
+  0x23, 0xC0, 0xE7, 0x53, 0xC0, 0x05, 0x1A, 0xC0, 0xC8, 0x09, 0xC0, 0x46, 0x22, 0xC0, 0xC7, 0x7C,
+  0x06, 0x02, 0xC0, 0xA7, 0x4B, 0x80, 0x37, 0x0A, 0x13, 0x81, 0x6E, 0x8B, 0x02, 0x24, 0x18, 0x05,
+  0x85, 0x8B, 0x61, 0x4E, 0x11, 0x11, 0x1D, 0x0E, 0x04, 0x10, 0x01, 0x01, 0x17, 0x02, 0x06, 0x02,
+  0x0E, 0x0A, 0x06, 0x10, 0x03, 0x80, 0x26, 0x07, 0x09, 0x80, 0x1E, 0x05, 0x12, 0x02, 0x0B, 0x80,
+  0x21, 0x13, 0x00, 0x01, 0x25, 0x80, 0x42, 0xC0, 0x38, 0xC7, 0xC0, 0x11, 0x4D, 0x01, 0x20, 0x08,
+  0x10, 0x82, 0xC9, 0x3C, 0x3C, 0x07, 0x0F, 0x80, 0x87, 0xC0, 0x55, 0x5E, 0x81, 0x55, 0x1A, 0x0F,
+  0x07, 0xC0, 0x69, 0x2B, 0xC0, 0x8B, 0x95, 0x81, 0x0A, 0x46, 0x04, 0x0A, 0x02, 0x1B, 0x82, 0xE7,
+  0x16, 0x16, 0x04, 0x1F, 0x83, 0x4F, 0x31, 0x23, 0x65, 0xC0, 0x46, 0x5C, 0xC0, 0x65, 0x22, 0xC0,
+  0xA7, 0x09, 0xC0, 0xA6, 0x32, 0x01, 0x27, 0x04, 0x02, 0x80, 0x2C, 0xC0, 0x07, 0x5C, 0x80, 0xE0,
+  0x09, 0x13, 0x84, 0x35, 0x13, 0x2E, 0x24, 0x24, 0x19, 0x05, 0x85, 0x98, 0x0D, 0x4E, 0x11, 0x11,
+  0x1D, 0x0E, 0x04, 0x10, 0x01, 0x01, 0x17, 0x02, 0x06, 0x03, 0x0E, 0x09, 0x06, 0x10, 0x03, 0x80,
+  0x26, 0x07, 0x09, 0x80, 0x1E, 0x05, 0x12, 0x02, 0x0B, 0x80, 0x21, 0x13, 0x00, 0x01, 0x25, 0x81,
+  0x47, 0x0B, 0xC0, 0x93, 0x6D, 0xC0, 0xD1, 0x2C, 0x80, 0x20, 0x07, 0x10, 0x80, 0x20, 0xC0, 0x93,
+  0x4D, 0x80, 0x3C, 0x0A, 0x0F, 0x81, 0x53, 0x1A, 0x0F, 0x07, 0x80, 0xF3, 0xC0, 0x48, 0x43, 0xC0,
+  0x4B, 0xBE, 0x81, 0x54, 0x1B, 0x03, 0x0A, 0x02, 0x1B, 0x82, 0x5C, 0x34, 0x16, 0x02, 0x1F, 0x83,
+  0x16, 0x1F, 0xB8, 0x31, 0x02, 0x23, 0xC0, 0xE6, 0x32, 0x80, 0x75, 0xC0, 0x67, 0x4B, 0x81, 0x02,
+  0x27, 0x03, 0x02, 0x01, 0x2C, 0xC0, 0x67, 0x6C, 0x81, 0xC5, 0x35, 0x09, 0x13, 0x83, 0x35, 0x84,
+  0x24, 0x24, 0x19, 0x05, 0x85, 0x98, 0x0D, 0x4E, 0x11, 0x11, 0x1D, 0x0E, 0x04, 0x10, 0x01, 0x01,
+  0x17, 0x02, 0x06, 0x03, 0x0E, 0x09, 0x06, 0x10, 0x03, 0x80, 0x26, 0x07, 0x09, 0x80, 0x1E, 0x05,
+  0x12, 0x02, 0x0B, 0x80, 0x21, 0x13, 0x00, 0x01, 0x18, 0x81, 0x47, 0x21, 0xC0, 0x34, 0x8E, 0x01,
+  0x20, 0x08, 0x10, 0x80, 0x91, 0xC0, 0x56, 0x66, 0x0A, 0x0F, 0x81, 0xC9, 0xDF, 0x0F, 0x07, 0xC0,
+  0x4D, 0x23, 0xC0, 0x68, 0x12, 0xC0, 0xCB, 0x7C, 0xC0, 0xAB, 0xC6, 0x02, 0x1B, 0x01, 0x0A, 0x02,
+  0x1B, 0x81, 0x46, 0x9B, 0x03, 0x1F, 0x01, 0x16, 0x84, 0x6C, 0x3D, 0x23, 0x23, 0x1C, 0xC0, 0x66,
+  0x43, 0xC0, 0xC4, 0x11, 0xC0, 0x28, 0x64, 0x81, 0x02, 0x27, 0x05, 0x02, 0xC0, 0xC7, 0x74, 0x81,
+  0xBA, 0x29, 0x08, 0x13, 0x84, 0x35, 0x7B, 0x77, 0x24, 0x24, 0x19, 0x05, 0x81, 0x98, 0x2A, 0x02,
+  0x11, 0x80, 0x1D, 0x0E, 0x04, 0x10, 0x01, 0x01, 0x17, 0x02, 0x06, 0x04, 0x0E, 0x08, 0x06, 0x10,
+  0x03, 0x80, 0x26, 0x07, 0x09, 0x80, 0x1E, 0x05, 0x12, 0x02, 0x0B, 0x80, 0x21, 0x13, 0x00, 0x01,
+  0x18, 0x81, 0x00, 0x21, 0xC0, 0x95, 0xAE, 0xC0, 0xD0, 0x44, 0x82, 0x20, 0x56, 0x56, 0x06, 0x10,
+  0x80, 0x7C, 0xC0, 0x56, 0x66, 0x80, 0x51, 0x09, 0x0F, 0x80, 0x3B, 0xC0, 0x6F, 0x34, 0x80, 0x1A,
+  0x0E, 0x07, 0xC0, 0x6D, 0x23, 0xC0, 0xAB, 0x12, 0xC0, 0xA8, 0x2A, 0xC0, 0xCB, 0xA5, 0x84, 0x0A,
+  0x1B, 0x1B, 0x0A, 0x0A, 0x03, 0x1B, 0x81, 0xC6, 0x16, 0x02, 0x1F, 0x01, 0x16, 0x84, 0xB9, 0x88,
+  0x23, 0x1C, 0x1C, 0xC0, 0xE7, 0x53, 0xC0, 0x03, 0x1A, 0xC0, 0x67, 0x6C, 0x07, 0x02, 0x80, 0xAD,
+  0xC0, 0xE6, 0x2A, 0x09, 0x13, 0x84, 0x35, 0x0D, 0x8F, 0x24, 0x24, 0x19, 0x05, 0x81, 0x45, 0x2A,
+  0x02, 0x11, 0x80, 0x1D, 0x0E, 0x04, 0x10, 0x01, 0x01, 0x17, 0x02, 0x06, 0x05, 0x0E, 0x07, 0x06,
+  0x10, 0x03, 0x80, 0x26, 0x07, 0x09, 0x80, 0x1E, 0x05, 0x12, 0x02, 0x0B, 0x80, 0x21, 0x13, 0x00,
+  0x02, 0x18, 0x80, 0x21, 0xC0, 0x17, 0xC7, 0xC0, 0xF0, 0x54, 0x82, 0x20, 0x56, 0x56, 0x06, 0x10,
+  0x82, 0x90, 0x52, 0x51, 0x09, 0x0F, 0x82, 0x4B, 0xF5, 0x1A, 0x0F, 0x07, 0x81, 0xA7, 0x13, 0xC0,
+  0xCA, 0x5B, 0xC0, 0x6B, 0xC6, 0x80, 0x46, 0x05, 0x1B, 0x82, 0x0A, 0x62, 0x3A, 0x02, 0x1F, 0x02,
+  0x16, 0x83, 0x78, 0x23, 0x1C, 0x1C, 0xC0, 0x27, 0x5C, 0xC0, 0x83, 0x32, 0xC0, 0x87, 0x74, 0x07,
+  0x02, 0x80, 0x71, 0xC0, 0x67, 0x3B, 0x80, 0x3E, 0x08, 0x13, 0x84, 0x35, 0x0D, 0x82, 0x45, 0x24,
+  0x19, 0x05, 0x81, 0x45, 0x37, 0x02, 0x11, 0x80, 0x1D, 0x0E, 0x04, 0x10, 0x01, 0x01, 0x17, 0x02,
+  0x06, 0x05, 0x0E, 0x07, 0x06, 0x10, 0x03, 0x80, 0x26, 0x07, 0x09, 0x80, 0x1E, 0x05, 0x12, 0x02,
+  0x0B, 0x80, 0x21, 0x13, 0x00, 0x03, 0x18, 0x80, 0x0B, 0xC0, 0x51, 0x6D, 0x80, 0x20, 0x09, 0x10,
+  0x81, 0x85, 0x51, 0x0A, 0x0F, 0x82, 0x67, 0x45, 0x1A, 0x0D, 0x07, 0x81, 0x1A, 0x2E, 0xC0, 0x6B,
+  0x0A, 0xC0, 0x49, 0x1A, 0xC0, 0x4A, 0x95, 0x80, 0x54, 0x05, 0x1B, 0x82, 0x0A, 0xE7, 0x3A, 0x02,
+  0x1F, 0x02, 0x16, 0x84, 0x4F, 0x31, 0x1C, 0x1C, 0xF8, 0xC0, 0x43, 0x43, 0xC0, 0xA7, 0x7C, 0x06,
+  0x02, 0x81, 0x2C, 0x71, 0xC0, 0xE8, 0x53, 0x80, 0x2A, 0x09, 0x13, 0x83, 0x35, 0x59, 0x45, 0x24,
+  0x19, 0x05, 0x81, 0x9F, 0x37, 0x02, 0x11, 0x80, 0x1D, 0x0E, 0x04, 0x10, 0x01, 0x01, 0x17, 0x02,
+  0x06, 0x05, 0x0E, 0x08, 0x06, 0x0F, 0x03, 0x80, 0x26, 0x07, 0x09, 0x80, 0x1E, 0x05, 0x12, 0x02,
+  0x0B, 0x80, 0x21, 0x13, 0x00, 0x04, 0x18, 0xC0, 0xD3, 0x85, 0x80, 0x20, 0x09, 0x10, 0xC0, 0xD4,
+  0x55, 0x80, 0x4B, 0x0A, 0x0F, 0x80, 0x3B, 0xC0, 0x90, 0x34, 0x80, 0x2E, 0x0D, 0x07, 0x81, 0x1A,
+  0x2E, 0xC0, 0xAB, 0x0A, 0x80, 0x2B, 0xC0, 0x28, 0x43, 0xC0, 0x2B, 0xB6, 0x80, 0x0A, 0x04, 0x1B,
+  0x82, 0x0A, 0x5C, 0xBE, 0x02, 0x1F, 0x02, 0x16, 0x86, 0xB8, 0x3D, 0x1C, 0x1C, 0x23, 0xB2, 0x4F,
+  0x06, 0x02, 0x01, 0x2C, 0xC0, 0x88, 0x6C, 0x80, 0xCC, 0x0A, 0x13, 0x81, 0x6E, 0xC2, 0x1A, 0x05,
+  0x80, 0x9F, 0xC0, 0x27, 0x0A, 0x02, 0x11, 0x80, 0x1D, 0x0E, 0x04, 0x10, 0x01, 0x01, 0x17, 0x02,
+  0x06, 0x05, 0x0E, 0x08, 0x06, 0x0F, 0x03, 0x80, 0x26, 0x07, 0x09, 0x80, 0x1E, 0x05, 0x12, 0x02,
+  0x0B, 0x80, 0x21, 0x13, 0x00, 0x03, 0x18, 0x80, 0x42, 0xC0, 0x75, 0xA6, 0x81, 0x10, 0x20, 0x07,
+  0x10, 0x83, 0x20, 0x9C, 0x4B, 0x3B, 0x0A, 0x0F, 0x82, 0x97, 0x92, 0x1A, 0x0E, 0x07, 0xC0, 0xEC,
+  0x12, 0x80, 0x15, 0xC0, 0x27, 0x0A, 0xC0, 0x69, 0x6C, 0x81, 0xAB, 0x46, 0x04, 0x1B, 0x81, 0x5A,
+  0x34, 0x02, 0x1F, 0x02, 0x16, 0x80, 0x6C, 0xC0, 0x85, 0x74, 0x01, 0x1C, 0x81, 0x23, 0xCD, 0x08,
+  0x02, 0x81, 0x39, 0xFC, 0xC0, 0xA6, 0x22, 0x80, 0x3E, 0x09, 0x13, 0x81, 0x48, 0x2E, 0x1A, 0x05,
+  0x81, 0x57, 0x6E, 0x02, 0x11, 0x80, 0x1D, 0x0E, 0x04, 0x10, 0x01, 0x01, 0x17, 0x02, 0x06, 0x05,
+  0x0E, 0x08, 0x06, 0x0F, 0x03, 0x80, 0x26, 0x07, 0x09, 0x80, 0x1E, 0x05, 0x12, 0x02, 0x0B, 0x80,
+  0x21, 0x13, 0x00, 0x04, 0x18, 0xC0, 0x17, 0xBF, 0xC0, 0x10, 0x4D, 0x01, 0x20, 0x06, 0x10, 0x83,
+  0x20, 0x97, 0x0F, 0x3B, 0x0A, 0x0F, 0x82, 0x85, 0x99, 0x1A, 0x0E, 0x07, 0xC0, 0x4D, 0x1B, 0xC0,
+  0x4A, 0x02, 0x80, 0x15, 0xC0, 0xA8, 0x22, 0xC0, 0xAA, 0x9D, 0x05, 0x1B, 0x80, 0x46, 0xC0, 0xE7,
+  0xAD, 0x82, 0x16, 0x1F, 0x1F, 0x02, 0x16, 0x83, 0xB9, 0x88, 0x1C, 0x1C, 0xC0, 0x84, 0x6C, 0xC0,
+  0x06, 0x7D, 0x08, 0x02, 0x81, 0x39, 0x4F, 0xC0, 0x26, 0x3B, 0x80, 0x3E, 0x09, 0x13, 0x80, 0x48,
+  0xC0, 0x2B, 0x13, 0x1A, 0x05, 0x81, 0x57, 0x59, 0x02, 0x11, 0x80, 0x1D, 0x0E, 0x04, 0x10, 0x01,
+  0x01, 0x17, 0x02, 0x06, 0x05, 0x0E, 0x08, 0x06, 0x0F, 0x03, 0x81, 0x26, 0x09, 0x02, 0x0B, 0x03,
+  0x09, 0x80, 0x1E, 0x05, 0x12, 0x02, 0x0B, 0x80, 0x21, 0x13, 0x00, 0x04, 0x18, 0x80, 0x5B, 0xC0,
+  0x72, 0x65, 0x81, 0x38, 0x20, 0x06, 0x10, 0x81, 0x20, 0xF5, 0x02, 0x3B, 0x09, 0x0F, 0x82, 0x3B,
+  0x10, 0x1A, 0x0F, 0x07, 0xC0, 0xAB, 0x0A, 0x81, 0x15, 0x29, 0xC0, 0x89, 0x4B, 0xC0, 0x6B, 0xBE,
+  0x04, 0x1B, 0x84, 0x0A, 0x81, 0x16, 0x1F, 0x1F, 0x03, 0x16, 0x82, 0xCD, 0x1C, 0x1C, 0xC0, 0xA4,
+  0x6C, 0xC0, 0x25, 0x85, 0x80, 0x39, 0x07, 0x02, 0x01, 0x39, 0xC0, 0xC7, 0x53, 0x80, 0x37, 0x08,
+  0x13, 0x01, 0x14, 0xC0, 0xCA, 0x0A, 0x80, 0x24, 0x19, 0x05, 0x85, 0x57, 0xD2, 0x44, 0x11, 0x11,
+  0x1D, 0x0E, 0x04, 0x10, 0x01, 0x01, 0x17, 0x02, 0x06, 0x05, 0x0E, 0x08, 0x06, 0x0D, 0x03, 0x01,
+  0x5B, 0x02, 0xE5, 0x01, 0x12, 0x80, 0x0B, 0x03, 0x09, 0x03, 0x12, 0x04, 0x0B, 0x80, 0x21, 0x13,
+  0x00, 0x03, 0x18, 0x81, 0x25, 0x21, 0xC0, 0x14, 0x86, 0x81, 0x38, 0x20, 0x07, 0x10, 0x83, 0x83,
+  0x52, 0x3B, 0x3B, 0x0A, 0x0F, 0xC0, 0x92, 0x55, 0x81, 0xDF, 0x1A, 0x0E, 0x07, 0x83, 0xDB, 0x15,
+  0x40, 0xD6, 0xC0, 0xA9, 0x74, 0x81, 0x8D, 0x1B, 0x02, 0x46, 0x80, 0x4D, 0xC0, 0x29, 0xBE, 0x82,
+  0x63, 0x16, 0x1F, 0x03, 0x16, 0x83, 0x4F, 0x1C, 0x1C, 0xD0, 0xC0, 0x25, 0x85, 0x08, 0x02, 0x81,
+  0x27, 0x2C, 0xC0, 0x67, 0x64, 0x80, 0xCC, 0x07, 0x13, 0x02, 0x14, 0x81, 0x82, 0x45, 0x19, 0x05,
+  0x80, 0x57, 0xC0, 0x68, 0x12, 0x83, 0x44, 0x11, 0x11, 0x1D, 0x0E, 0x04, 0x10, 0x01, 0x01, 0x17,
+  0x02, 0x06, 0x05, 0x0E, 0x0A, 0x06, 0x03, 0x03, 0x80, 0x26, 0x0A, 0x03, 0x01, 0x5B, 0x81, 0x26,
+  0x03, 0x03, 0x09, 0x83, 0x0B, 0x1E, 0x1E, 0x12, 0x04, 0x0B, 0x18, 0x00, 0x80, 0x47, 0xC0, 0xB8,
+  0xE7, 0xC0, 0xD6, 0x9E, 0x05, 0x20, 0x03, 0x10, 0x83, 0x53, 0x67, 0x3B, 0x3B, 0x0A, 0x0F, 0xC0,
+  0x34, 0x66, 0x81, 0x55, 0x1A, 0x0E, 0x07, 0x83, 0x3F, 0x7A, 0x15, 0x15, 0xC0, 0xA8, 0x22, 0xC0,
+  0xAA, 0x9D, 0x80, 0x1B, 0x02, 0x46, 0x80, 0x4D, 0xC0, 0x49, 0xC6, 0xC0, 0xA8, 0xAD, 0x05, 0x16,
+  0x84, 0x39, 0x23, 0x3D, 0xD0, 0x39, 0x09, 0x02, 0x81, 0x2C, 0xFC, 0xC0, 0xA6, 0x22, 0x81, 0x35,
+  0x13, 0x02, 0x37, 0x05, 0x13, 0x81, 0x59, 0x8B, 0x19, 0x05, 0x80, 0x57, 0xC0, 0x68, 0x12, 0x80,
+  0x44, 0x02, 0x1D, 0x0E, 0x04, 0x10, 0x01, 0x01, 0x17, 0x02, 0x06, 0x05, 0x0E, 0x0A, 0x06, 0x07,
+  0x03, 0x80, 0x09, 0xC0, 0x9A, 0xDF, 0xC2, 0xBB, 0xE7, 0xC2, 0xBA, 0xE7, 0x80, 0xE8, 0xC0, 0x7A,
+  0xDF, 0x02, 0x09, 0x83, 0x0B, 0x09, 0x09, 0x0B, 0x02, 0x1E, 0x04, 0x0B, 0x19, 0x00, 0xC0, 0x97,
+  0xE7, 0x82, 0x9E, 0x7C, 0x38, 0x03, 0x20, 0x03, 0x10, 0x81, 0x20, 0xB5, 0x0D, 0x0F, 0x81, 0x53,
+  0x1A, 0x0F, 0x07, 0x83, 0x70, 0x15, 0x15, 0x29, 0xC0, 0x47, 0x43, 0xC0, 0x2A, 0xB6, 0x01, 0x46,
+  0x02, 0x4D, 0xC0, 0xC8, 0xAD, 0x05, 0x16, 0x84, 0xB8, 0x3D, 0x23, 0xD0, 0x39, 0x09, 0x02, 0x81,
+  0x2C, 0x4F, 0xC0, 0x26, 0x3B, 0x81, 0x35, 0x13, 0x02, 0x37, 0x05, 0x13, 0x80, 0x48, 0xC0, 0x6B,
+  0x23, 0x19, 0x05, 0x80, 0x57, 0xC0, 0x68, 0x12, 0x83, 0x44, 0x1D, 0x1D, 0x4E, 0x0E, 0x04, 0x10,
+  0x01, 0x01, 0x17, 0x02, 0x06, 0x05, 0x0E, 0x0A, 0x06, 0x04, 0x03, 0xC0, 0x7A, 0xDF, 0xC0, 0x9B,
+  0xE7, 0xC0, 0xBB, 0xEF, 0xC0, 0xDC, 0xEF, 0x07, 0x28, 0xC1, 0xDC, 0xF7, 0xC0, 0xBB, 0xEF, 0x81,
+  0xE8, 0x09, 0x02, 0x0B, 0x02, 0x1E, 0x04, 0x0B, 0x19, 0x00, 0x80, 0x25, 0xC0, 0x77, 0xC7, 0xC0,
+  0xD3, 0x65, 0x80, 0x38, 0x03, 0x20, 0x03, 0x10, 0x81, 0x20, 0x97, 0x0C, 0x0F, 0x83, 0x87, 0xC9,
+  0x92, 0x1A, 0x0E, 0x07, 0x80, 0xF4, 0xC0, 0x6A, 0x02, 0x81, 0x15, 0xFD, 0xC0, 0x08, 0x12, 0xC0,
+  0x48, 0x6C, 0x81, 0xAB, 0x46, 0xC0, 0x4A, 0xC6, 0x01, 0x4D, 0xC0, 0xE8, 0xB5, 0x80, 0x34, 0x04,
+  0x16, 0x83, 0x6C, 0x3D, 0x23, 0xD0, 0x09, 0x02, 0x01, 0x2C, 0x80, 0x02, 0xC0, 0xE7, 0x53, 0x01,
+  0x13, 0x02, 0x37, 0x05, 0x13, 0x81, 0x37, 0xC0, 0x19, 0x05, 0x80, 0x57, 0xC0, 0x69, 0x12, 0x83,
+  0x44, 0x1D, 0x1D, 0x4E, 0x0E, 0x04, 0x10, 0x01, 0x01, 0x17, 0x02, 0x06, 0x05, 0x0E, 0x0A, 0x06,
+  0x02, 0x03, 0x80, 0xAE, 0xC0, 0x9B, 0xE7, 0xC0, 0xDC, 0xEF, 0xC0, 0xDC, 0xF7, 0x80, 0x30, 0xC0,
+  0xDC, 0xF7, 0x81, 0x28, 0x30, 0x08, 0x19, 0xC0, 0xDC, 0xF7, 0xC0, 0xBB, 0xF7, 0xC0, 0x9A, 0xEF,
+  0x83, 0x1E, 0x09, 0x1E, 0x1E, 0x05, 0x0B, 0x18, 0x00, 0x81, 0x18, 0x25, 0xC0, 0x77, 0xCF, 0xC0,
+  0x75, 0x7E, 0x81, 0x90, 0x38, 0x02, 0x20, 0x03, 0x10, 0x81, 0x38, 0xB4, 0x0C, 0x0F, 0x80, 0x87,
+  0xC0, 0x54, 0x66, 0xC0, 0x4E, 0x2C, 0x80, 0xB7, 0x0E, 0x07, 0x84, 0x3F, 0x7A, 0x15, 0x15, 0x29,
+  0xC0, 0x68, 0x1A, 0xC0, 0x2B, 0x8D, 0x01, 0x4D, 0x83, 0x46, 0x4D, 0x81, 0x63, 0x05, 0x16, 0x82,
+  0x88, 0x23, 0xD0, 0x09, 0x02, 0x01, 0x2C, 0x80, 0x02, 0xC0, 0x88, 0x6C, 0xC0, 0x47, 0x1A, 0x80,
+  0x13, 0x02, 0x37, 0x06, 0x13, 0x81, 0xF6, 0x24, 0x18, 0x05, 0x80, 0x57, 0xC0, 0x69, 0x12, 0x83,
+  0x44, 0x1D, 0x1D, 0x4E, 0x0E, 0x04, 0x10, 0x01, 0x01, 0x17, 0x02, 0x06, 0x05, 0x0E, 0x09, 0x06,
+  0x01, 0x03, 0x80, 0xAE, 0xC0, 0x9B, 0xDF, 0xC0, 0xDC, 0xEF, 0x01, 0x30, 0x01, 0x8C, 0xC1, 0xDC,
+  0xF7, 0x80, 0x30, 0x0A, 0x19, 0x83, 0x28, 0xDC, 0xE8, 0x09, 0x06, 0x0B, 0x18, 0x00, 0x82, 0x18,
+  0x25, 0x5B, 0xC0, 0xD6, 0x96, 0xC0, 0x52, 0x55, 0x80, 0x38, 0x02, 0x20, 0x03, 0x10, 0x82, 0x20,
+  0x83, 0x52, 0x0D, 0x0F, 0x81, 0x91, 0x1A, 0x0E, 0x07, 0x84, 0x3F, 0x70, 0x15, 0x15, 0x29, 0xC0,
+  0xEA, 0x09, 0xC0, 0x07, 0x3B, 0xC0, 0x2B, 0xB6, 0x82, 0x1B, 0x46, 0x54, 0xC0, 0x29, 0xBE, 0x80,
+  0x34, 0x04, 0x16, 0x80, 0x1F, 0xC0, 0xC5, 0x7C, 0x81, 0x31, 0xCD, 0x0A, 0x02, 0x81, 0x2C, 0x02,
+  0xC0, 0x08, 0x85, 0xC0, 0xC6, 0x2A, 0x83, 0x35, 0x13, 0x37, 0x37, 0x06, 0x13, 0x81, 0x59, 0x4A,
+  0x18, 0x05, 0x85, 0x57, 0xD3, 0x44, 0x1D, 0x1D, 0x4E, 0x0E, 0x04, 0x10, 0x01, 0x01, 0x17, 0x02,
+  0x06, 0x05, 0x0E, 0x09, 0x06, 0x81, 0x03, 0xAE, 0xC0, 0xBB, 0xE7, 0xC0, 0xDD, 0xEF, 0x03, 0x30,
+  0x80, 0x28, 0x02, 0x30, 0x0B, 0x19, 0x01, 0x28, 0xC0, 0xBA, 0xE7, 0x80, 0x09, 0x05, 0x0B, 0x19,
+  0x00, 0x84, 0x25, 0x12, 0xB6, 0xCB, 0x10, 0x02, 0x20, 0x05, 0x10, 0x80, 0x67, 0x0D, 0x0F, 0x81,
+  0x67, 0x45, 0x0F, 0x07, 0x80, 0x66, 0xC0, 0x49, 0x0A, 0x83, 0x33, 0x29, 0x40, 0xD6, 0xC0, 0x89,
+  0x74, 0x82, 0xF1, 0x1B, 0x54, 0xC0, 0x49, 0xC6, 0x80, 0x34, 0x04, 0x16, 0x80, 0x1F, 0xC0, 0x06,
+  0x7D, 0x81, 0x3D, 0x78, 0x0D, 0x02, 0xC0, 0x66, 0x43, 0x80, 0x35, 0x09, 0x13, 0x81, 0x68, 0x1A,
+  0x18, 0x05, 0x85, 0x57, 0xD3, 0x44, 0x1D, 0x1D, 0x4E, 0x0E, 0x04, 0x10, 0x01, 0x01, 0x17, 0x02,
+  0x06, 0x05, 0x0E, 0x09, 0x06, 0x80, 0xAE, 0xC0, 0xBB, 0xE7, 0xC0, 0xDD, 0xEF, 0x04, 0x30, 0x03,
+  0x28, 0x0C, 0x19, 0x01, 0x28, 0xC0, 0xBA, 0xEF, 0x80, 0x09, 0x04, 0x0B, 0x19, 0x00, 0x82, 0x25,
+  0x21, 0x8E, 0xC0, 0x75, 0x76, 0x80, 0x6A, 0x03, 0x20, 0x03, 0x10, 0x80, 0x38, 0xC0, 0xB3, 0x4D,
+  0x0D, 0x0F, 0x82, 0x3B, 0x38, 0x1A, 0x0E, 0x07, 0x80, 0x3F, 0xC0, 0xAB, 0x0A, 0x83, 0x15, 0x2B,
+  0x40, 0x5F, 0xC0, 0xC7, 0x32, 0xC0, 0x0B, 0xAE, 0x01, 0x4C, 0x80, 0x4D, 0xC0, 0xC8, 0xAD, 0x04,
+  0x16, 0x83, 0x1F, 0x39, 0x3D, 0x78, 0x0D, 0x02, 0x80, 0xFE, 0xC0, 0x07, 0x12, 0x09, 0x13, 0x81,
+  0x48, 0x77, 0x18, 0x05, 0x85, 0x5D, 0xA5, 0x44, 0x1D, 0x1D, 0x4E, 0x0E, 0x04, 0x10, 0x01, 0x01,
+  0x17, 0x02, 0x06, 0x05, 0x0E, 0x08, 0x06, 0xC0, 0x9A, 0xD7, 0xC0, 0xBC, 0xE7, 0x01, 0x2F, 0x04,
+  0x30, 0x03, 0x28, 0x0E, 0x19, 0x82, 0x28, 0xDC, 0xE9, 0x03, 0x0B, 0x19, 0x00, 0x82, 0x25, 0x21,
+  0x9E, 0xC0, 0xF6, 0x86, 0xC0, 0x92, 0x55, 0x04, 0x20, 0x02, 0x10, 0x82, 0x20, 0xB4, 0x3B, 0x0D,
+  0x0F, 0xC0, 0x93, 0x4D, 0x80, 0x6D, 0x0F, 0x07, 0x85, 0xA7, 0x6F, 0x29, 0x29, 0x40, 0xD6, 0xC0,
+  0xEA, 0x7C, 0x01, 0x1B, 0x80, 0x0A, 0xC0, 0xE8, 0xB5, 0x80, 0x63, 0x03, 0x16, 0x81, 0x1F, 0x6C,
+  0xC0, 0x84, 0x74, 0x80, 0x4F, 0x0B, 0x02, 0x81, 0x27, 0x2C, 0xC0, 0xE8, 0x7C, 0x81, 0xBA, 0x3E,
+  0x08, 0x13, 0x82, 0x7B, 0xF6, 0x45, 0x17, 0x05, 0x81, 0x5D, 0xA5, 0xC0, 0x67, 0x01, 0x01, 0x1D,
+  0x80, 0x4E, 0x0E, 0x04, 0x10, 0x01, 0x01, 0x17, 0x02, 0x06, 0x05, 0x0E, 0x06, 0x06, 0x80, 0x0E,
+  0xC0, 0x9A, 0xD7, 0x80, 0xDD, 0xC0, 0xFC, 0xEF, 0x80, 0x2F, 0xC0, 0xDD, 0xEF, 0x80, 0x8C, 0x03,
+  0x30, 0x03, 0x28, 0x0F, 0x19, 0x80, 0x28, 0xC0, 0xBA, 0xEF, 0x80, 0x09, 0x02, 0x0B, 0x19, 0x00,
+  0x85, 0x47, 0x32, 0xD9, 0x08, 0xAC, 0x53, 0x04, 0x20, 0x02, 0x10, 0x82, 0x53, 0x85, 0x87, 0x0C,
+  0x0F, 0xC0, 0x35, 0x5E, 0xC0, 0x4E, 0x2C, 0x80, 0x1A, 0x0E, 0x07, 0x85, 0x3F, 0x7A, 0x33, 0x2B,
+  0x40, 0x5F, 0xC0, 0x68, 0x4B, 0xC0, 0x4A, 0xBE, 0x01, 0x0A, 0x81, 0xC4, 0x34, 0x03, 0x16, 0x81,
+  0x1F, 0xE2, 0xC0, 0xA4, 0x74, 0x80, 0x4F, 0x0C, 0x02, 0x81, 0x27, 0x74, 0xC0, 0x26, 0x3B, 0x80,
+  0x3E, 0x08, 0x13, 0x82, 0x14, 0x59, 0x8B, 0x17, 0x05, 0x81, 0x5D, 0xA5, 0xC0, 0x67, 0x01, 0x01,
+  0x1D, 0x80, 0x4E, 0x0E, 0x04, 0x10, 0x01, 0x01, 0x17, 0x02, 0x06, 0x08, 0x0E, 0x03, 0x06, 0x81,
+  0xAE, 0xDD, 0x02, 0x2F, 0xC0, 0xDD, 0xEF, 0x80, 0x8C, 0x03, 0x30, 0x03, 0x28, 0x10, 0x19, 0x81,
+  0x28, 0xE8, 0x02, 0x09, 0x19, 0x00, 0x86, 0x47, 0x42, 0xD9, 0xA0, 0xA2, 0x91, 0x38, 0x03, 0x20,
+  0x02, 0x10, 0x81, 0x38, 0xB5, 0xC0, 0x96, 0x66, 0x0D, 0x0F, 0x81, 0x7C, 0x1A, 0x0F, 0x07, 0x84,
+  0x7F, 0x33, 0x40, 0x40, 0xA4, 0xC0, 0x66, 0x22, 0xC0, 0xCB, 0xA5, 0x01, 0x0A, 0x81, 0x5A, 0x34,
+  0x03, 0x16, 0x81, 0x1F, 0x16, 0xC0, 0xE5, 0x84, 0xC0, 0x05, 0x85, 0x0E, 0x02, 0xC0, 0xE7, 0x5B,
+  0x81, 0x37, 0x35, 0x07, 0x14, 0x82, 0x13, 0x14, 0xCA, 0x18, 0x05, 0x80, 0x8F, 0x02, 0x1D, 0x80,
+  0x4E, 0x0E, 0x04, 0x10, 0x01, 0x01, 0x17, 0x02, 0x06, 0x07, 0x0E, 0x03, 0x06, 0x80, 0x03, 0xC0,
+  0x9B, 0xDF, 0x80, 0x6B, 0x02, 0x2F, 0x01, 0x8C, 0x03, 0x30, 0x03, 0x28, 0x10, 0x19, 0x81, 0x28,
+  0xDC, 0xC0, 0x99, 0xE7, 0x01, 0x09, 0x19, 0x00, 0x81, 0x47, 0x32, 0xC0, 0x77, 0xCF, 0x83, 0xA0,
+  0x60, 0xCB, 0x38, 0x03, 0x20, 0x02, 0x10, 0x82, 0x20, 0xB4, 0x3B, 0x0C, 0x0F, 0x80, 0x87, 0xC0,
+  0x34, 0x5E, 0x81, 0xA1, 0x2E, 0x0E, 0x07, 0x80, 0x66, 0xC0, 0x6A, 0x0A, 0x02, 0x40, 0x80, 0x37,
+  0xC0, 0xCB, 0x7C, 0x82, 0x8D, 0x0A, 0x0A, 0xC0, 0xE7, 0xAD, 0x80, 0x3A, 0x03, 0x16, 0x82, 0x1F,
+  0x02, 0x4F, 0x0E, 0x02, 0xC0, 0x88, 0x74, 0xC0, 0x47, 0x1A, 0x80, 0x35, 0x06, 0x14, 0x01, 0x13,
+  0x81, 0x7B, 0xC0, 0x18, 0x05, 0x80, 0xBF, 0x03, 0x1D, 0x0E, 0x04, 0x10, 0x01, 0x01, 0x17, 0x02,
+  0x06, 0x07, 0x0E, 0x03, 0x06, 0x81, 0xAE, 0xDD, 0x03, 0x2F, 0x01, 0x8C, 0x03, 0x30, 0x03, 0x28,
+  0x11, 0x19, 0x80, 0x28, 0xC0, 0xBA, 0xEF, 0x81, 0xE9, 0x0B, 0x19, 0x00, 0x81, 0x47, 0x25, 0xC0,
+  0x77, 0xCF, 0x81, 0xA0, 0x08, 0xC0, 0xD7, 0x7E, 0x83, 0x7C, 0x38, 0x20, 0x20, 0x04, 0x10, 0x81,
+  0x53, 0x85, 0x0B, 0x0F, 0x02, 0x87, 0x81, 0x6A, 0xB7, 0x0F, 0x07, 0x83, 0xE1, 0xFD, 0xFD, 0x40,
+  0xC0, 0xE9, 0x01, 0xC0, 0xC9, 0x53, 0x84, 0x8D, 0x1B, 0x0A, 0x81, 0x3A, 0x04, 0x16, 0x81, 0x71,
+  0x39, 0x0D, 0x02, 0x80, 0x2C, 0xC0, 0xE8, 0x7C, 0xC0, 0xE7, 0x32, 0x80, 0x35, 0x05, 0x14, 0x02,
+  0x13, 0x82, 0x3E, 0x82, 0x24, 0x17, 0x05, 0x80, 0xF3, 0x03, 0x1D, 0x0E, 0x04, 0x10, 0x01, 0x01,
+  0x17, 0x02, 0x06, 0x07, 0x0E, 0x02, 0x06, 0x80, 0xAE, 0xC0, 0xBB, 0xDF, 0x80, 0x6B, 0x03, 0x2F,
+  0x01, 0x8C, 0x03, 0x30, 0x03, 0x28, 0x12, 0x19, 0x82, 0xFF, 0xE8, 0xE9, 0x19, 0x00, 0x81, 0x47,
+  0x25, 0xC0, 0x77, 0xCF, 0x82, 0x69, 0x08, 0x08, 0xC0, 0x34, 0x66, 0x01, 0x20, 0x03, 0x10, 0x01,
+  0x20, 0x80, 0x10, 0xC0, 0x92, 0x4D, 0x0C, 0x0F, 0x01, 0x87, 0xC0, 0xF4, 0x55, 0x82, 0x45, 0x2E,
+  0x3F, 0x0D, 0x07, 0x80, 0xA7, 0xC0, 0x4A, 0x02, 0x01, 0xFD, 0x80, 0xA4, 0xC0, 0x08, 0x33, 0xC0,
+  0x4B, 0xBE, 0x83, 0x1B, 0x0A, 0x5C, 0x34, 0x04, 0x16, 0x81, 0x71, 0x39, 0x0D, 0x02, 0x81, 0x50,
+  0xAD, 0xC0, 0xA7, 0x4B, 0x80, 0x37, 0x07, 0x14, 0x01, 0x13, 0x81, 0x6E, 0x98, 0x17, 0x05, 0x80,
+  0x84, 0xC0, 0xA7, 0x01, 0x02, 0x1D, 0x0E, 0x04, 0x10, 0x01, 0x01, 0x17, 0x02, 0x06, 0x06, 0x0E,
+  0x03, 0x06, 0x81, 0xAE, 0xDD, 0x04, 0x2F, 0x01, 0x8C, 0x03, 0x30, 0x03, 0x28, 0x12, 0x19, 0xC0,
+  0xDC, 0xFF, 0xC0, 0xBB, 0xF7, 0x80, 0xE9, 0x17, 0x00, 0x01, 0x18, 0x01, 0x25, 0x83, 0x5B, 0x69,
+  0x08, 0x08, 0xC0, 0xD6, 0x7E, 0x80, 0x7C, 0x02, 0x10, 0x01, 0x20, 0x02, 0x10, 0x82, 0x6A, 0x52,
+  0x4B, 0x0C, 0x0F, 0x82, 0x3B, 0x90, 0x1A, 0x0E, 0x07, 0x84, 0x3F, 0x7A, 0x15, 0xFD, 0xFD, 0xC0,
+  0xA7, 0x22, 0xC0, 0xCA, 0xA5, 0x89, 0x54, 0x0A, 0x4D, 0x62, 0x16, 0x16, 0x1F, 0x1F, 0x16, 0x71,
+  0x10, 0x02, 0x81, 0xFE, 0xB3, 0x05, 0x14, 0x03, 0x13, 0x81, 0x14, 0xCA, 0x17, 0x05, 0x80, 0x2E,
+  0xC0, 0xA7, 0x01, 0x82, 0x1D, 0x4E, 0x4E, 0x0E, 0x04, 0x10, 0x01, 0x01, 0x17, 0x02, 0x06, 0x06,
+  0x0E, 0x03, 0x06, 0xC0, 0x9B, 0xD7, 0x80, 0x6B, 0x04, 0x2F, 0x01, 0x8C, 0x03, 0x30, 0x03, 0x28,
+  0x13, 0x19, 0x80, 0xFF, 0xC0, 0x99, 0xE7, 0x17, 0x00, 0x01, 0x18, 0x01, 0x25, 0x81, 0x5B, 0x69,
+  0x02, 0x08, 0xC0, 0xD3, 0x5D, 0x84, 0x10, 0x53, 0x53, 0x20, 0x20, 0x03, 0x10, 0xC0, 0xD4, 0x55,
+  0x82, 0x4B, 0x0F, 0x51, 0x0B, 0x0F, 0x81, 0xAA, 0x45, 0x0F, 0x07, 0x84, 0xE1, 0x15, 0x15, 0x2B,
+  0xCC, 0xC0, 0x2A, 0x8D, 0x82, 0x72, 0x46, 0x4D, 0xC0, 0x09, 0xB6, 0x01, 0x16, 0x01, 0x1F, 0x82,
+  0x16, 0x02, 0x39, 0x0E, 0x02, 0x83, 0x2C, 0xFC, 0xBA, 0x48, 0x04, 0x14, 0x03, 0x13, 0x81, 0x7B,
+  0xC0, 0x17, 0x05, 0x84, 0x64, 0xED, 0x1D, 0x4E, 0x4E, 0x0E, 0x04, 0x10, 0x01, 0x01, 0x17, 0x02,
+  0x06, 0x06, 0x0E, 0x02, 0x06, 0x80, 0xAE, 0xC0, 0xBB, 0xDF, 0x80, 0x6B, 0x04, 0x2F, 0x01, 0x8C,
+  0x03, 0x30, 0x03, 0x28, 0x13, 0x19, 0x80, 0x28, 0xC0, 0x9A, 0xEF, 0x17, 0x00, 0x01, 0x18, 0x01,
+  0x25, 0x81, 0x5B, 0x69, 0x02, 0x08, 0xC0, 0x96, 0x76, 0xC0, 0x10, 0x45, 0x83, 0x10, 0x53, 0x10,
+  0x20, 0x02, 0x10, 0x84, 0x20, 0xB4, 0x3B, 0x0F, 0x51, 0x0B, 0x0F, 0x82, 0x3B, 0x38, 0x1A, 0x0E,
+  0x07, 0x80, 0xA7, 0xC0, 0x4A, 0x0A, 0x81, 0x33, 0x2B, 0xC0, 0xE6, 0x09, 0xC0, 0xAA, 0x74, 0x8A,
+  0x72, 0x46, 0x0A, 0xC4, 0x16, 0x16, 0x1F, 0x1F, 0xB9, 0x02, 0x39, 0x0E, 0x02, 0x81, 0x2C, 0xAD,
+  0xC0, 0x26, 0x3B, 0x80, 0x2A, 0x04, 0x14, 0x03, 0x13, 0x82, 0x3E, 0xA5, 0x24, 0x16, 0x05, 0x84,
+  0x4A, 0x0D, 0x1D, 0x4E, 0x4E, 0x0E, 0x04, 0x10, 0x01, 0x01, 0x17, 0x02, 0x06, 0x06, 0x0E, 0x02,
+  0x06, 0x82, 0xAE, 0xDD, 0x6B, 0x04, 0x2F, 0x01, 0x8C, 0x03, 0x30, 0x03, 0x28, 0x14, 0x19, 0xC0,
+  0xBA, 0xEF, 0x17, 0x00, 0x01, 0x18, 0x01, 0x25, 0x81, 0x5B, 0x69, 0x03, 0x08, 0x80, 0xC3, 0x06,
+  0x10, 0x84, 0x20, 0x90, 0x85, 0x4B, 0x51, 0x0B, 0x0F, 0xC0, 0x96, 0x6E, 0xC0, 0xB3, 0x4D, 0x80,
+  0xDF, 0x0E, 0x07, 0x84, 0x3F, 0xB1, 0x15, 0x2B, 0x13, 0xC0, 0x4B, 0x64, 0xC0, 0xAB, 0xC6, 0x81,
+  0x1B, 0x0A, 0xC0, 0x29, 0xBE, 0x84, 0x63, 0x16, 0x1F, 0x16, 0xF9, 0x10, 0x02, 0x81, 0x50, 0x02,
+  0xC0, 0xE6, 0x5B, 0x85, 0x2A, 0x29, 0x13, 0x13, 0x14, 0x14, 0x04, 0x13, 0x81, 0xC7, 0x45, 0x16,
+  0x05, 0x84, 0x9F, 0x2A, 0x11, 0x4E, 0x4E, 0x0E, 0x04, 0x10, 0x01, 0x01, 0x17, 0x02, 0x06, 0x05,
+  0x0E, 0x03, 0x06, 0xC0, 0x9A, 0xD7, 0x01, 0x6B, 0x04, 0x2F, 0x01, 0x8C, 0x03, 0x30, 0x03, 0x28,
+  0x14, 0x19, 0x81, 0xFF, 0xE9, 0x16, 0x00, 0x01, 0x18, 0x01, 0x25, 0x81, 0x5B, 0x69, 0x02, 0x08,
+  0x80, 0xA9, 0xC0, 0x35, 0x6E, 0x07, 0x10, 0x80, 0x38, 0xC0, 0xB3, 0x4D, 0x81, 0x4B, 0x51, 0x0C,
+  0x0F, 0x80, 0x3B, 0xC0, 0x4F, 0x2C, 0x80, 0x1A, 0x0E, 0x07, 0x83, 0xEA, 0x15, 0x2B, 0x29, 0xC0,
+  0xAA, 0x53, 0xC0, 0x8B, 0xC6, 0x89, 0x1B, 0x0A, 0x5C, 0x34, 0x16, 0x1F, 0x16, 0xA3, 0x27, 0x39,
+  0x0E, 0x02, 0x82, 0x27, 0x02, 0xDA, 0xC0, 0x67, 0x1A, 0x82, 0x35, 0x13, 0x13, 0x03, 0x14, 0x02,
+  0x13, 0x82, 0x59, 0x92, 0x24, 0x15, 0x05, 0x84, 0x9F, 0x37, 0x11, 0x4E, 0x4E, 0x0E, 0x04, 0x10,
+  0x01, 0x01, 0x17, 0x02, 0x06, 0x05, 0x0E, 0x03, 0x06, 0xC0, 0x9B, 0xDF, 0x02, 0x6B, 0x03, 0x2F,
+  0xC0, 0xDD, 0xEF, 0x80, 0x8C, 0x03, 0x30, 0x03, 0x28, 0x14, 0x19, 0x80, 0xFF, 0xC0, 0x99, 0xE7,
+  0x16, 0x00, 0x01, 0x18, 0x01, 0x25, 0x81, 0x5B, 0x69, 0x03, 0x08, 0x80, 0xD8, 0xC0, 0x11, 0x4D,
+  0x06, 0x10, 0x84, 0x20, 0x7C, 0x3B, 0x4B, 0x51, 0x0B, 0x0F, 0x80, 0x4B, 0xC0, 0x32, 0x4D, 0x80,
+  0x1A, 0x0E, 0x07, 0x83, 0x66, 0x6F, 0x2B, 0xA4, 0xC0, 0x4A, 0x43, 0x8A, 0xAB, 0x1B, 0x0A, 0x5C,
+  0x34, 0x16, 0x1F, 0x16, 0xA3, 0x27, 0x39, 0x10, 0x02, 0xC0, 0x08, 0x85, 0xC0, 0x07, 0x33, 0x83,
+  0x7B, 0x35, 0x13, 0x13, 0x03, 0x14, 0x01, 0x13, 0x82, 0x68, 0x2E, 0xA1, 0x15, 0x05, 0x80, 0x24,
+  0xC0, 0x27, 0x0A, 0x82, 0x11, 0x4E, 0x4E, 0x0E, 0x04, 0x10, 0x01, 0x01, 0x17, 0x02, 0x06, 0x05,
+  0x0E, 0x03, 0x06, 0xC0, 0x9B, 0xDF, 0x02, 0x6B, 0x03, 0x2F, 0xC0, 0xDD, 0xEF, 0x80, 0x8C, 0x03,
+  0x30, 0x03, 0x28, 0x14, 0x19, 0xC0, 0xFB, 0xF7, 0xC0, 0x99, 0xE7, 0x16, 0x00, 0x01, 0x18, 0x01,
+  0x25, 0x81, 0x5B, 0x69, 0x03, 0x08, 0x80, 0x49, 0xC0, 0xD3, 0x65, 0xC0, 0xAF, 0x3C, 0x06, 0x10,
+  0x80, 0x53, 0xC0, 0xF4, 0x55, 0xC0, 0x96, 0x6E, 0x0D, 0x0F, 0x81, 0x67, 0xA1, 0x0D, 0x07, 0x84,
+  0x1A, 0x2E, 0x7A, 0x33, 0x5F, 0xC0, 0x09, 0x3B, 0xC0, 0x4A, 0xBE, 0x83, 0x1B, 0x0A, 0x5C, 0x34,
+  0x02, 0x16, 0x82, 0xA3, 0x02, 0x39, 0x0F, 0x02, 0x81, 0x27, 0xD1, 0xC0, 0xC7, 0x53, 0xC0, 0xE6,
+  0x09, 0x83, 0x35, 0x13, 0x37, 0x37, 0x02, 0x14, 0x01, 0x13, 0x83, 0x14, 0xF3, 0xA1, 0x76, 0x14,
+  0x05, 0x84, 0x24, 0x59, 0x11, 0x4E, 0x4E, 0x0E, 0x04, 0x10, 0x01, 0x01, 0x17, 0x02, 0x06, 0x05,
+  0x0E, 0x03, 0x06, 0xC0, 0x9B, 0xDF, 0x02, 0x6B, 0x03, 0x2F, 0xC0, 0xDD, 0xEF, 0x80, 0x8C, 0x03,
+  0x30, 0x03, 0x28, 0x14, 0x19, 0xC0, 0xFB, 0xF7, 0xC0, 0x99, 0xE7, 0x16, 0x00, 0x01, 0x18, 0x01,
+  0x25, 0x81, 0xE5, 0x73, 0x04, 0x08, 0xC0, 0x76, 0x7E, 0x81, 0xE6, 0x56, 0x05, 0x10, 0x80, 0x20,
+  0xC0, 0x72, 0x45, 0x80, 0x51, 0x0D, 0x0F, 0x82, 0x3C, 0x10, 0x1A, 0x0C, 0x07, 0x84, 0x1A, 0x07,
+  0xB1, 0x33, 0x40, 0xC0, 0xC8, 0x32, 0xC0, 0x4A, 0xBE, 0x01, 0x0A, 0x81, 0x5C, 0x34, 0x02, 0x16,
+  0x82, 0xA3, 0x02, 0x39, 0x0F, 0x02, 0x81, 0x27, 0x02, 0xC0, 0x67, 0x6C, 0x84, 0xCC, 0x35, 0x13,
+  0x37, 0x37, 0x02, 0x14, 0x01, 0x13, 0x83, 0x7B, 0x8F, 0x24, 0xA1, 0x14, 0x05, 0x81, 0x57, 0x59,
+  0xC0, 0x67, 0x01, 0x01, 0x4E, 0x0E, 0x04, 0x10, 0x01, 0x01, 0x17, 0x02, 0x06, 0x05, 0x0E, 0x03,
+  0x06, 0xC0, 0x9B, 0xDF, 0x02, 0x6B, 0x04, 0x2F, 0x04, 0x30, 0x03, 0x28, 0x14, 0x19, 0x80, 0x28,
+  0xC0, 0x99, 0xE7, 0x16, 0x00, 0x01, 0x18, 0x01, 0x25, 0x81, 0x5B, 0x73, 0x04, 0x08, 0x81, 0x58,
+  0xFB, 0xC0, 0xAF, 0x3C, 0x05, 0x10, 0x81, 0x20, 0x83, 0xC0, 0x35, 0x5E, 0x0D, 0x0F, 0x82, 0x4B,
+  0xB5, 0x92, 0x0C, 0x07, 0x84, 0x1A, 0x07, 0x70, 0x33, 0x40, 0xC0, 0xC8, 0x32, 0xC0, 0x2A, 0xB6,
+  0x01, 0x0A, 0x86, 0x5C, 0x34, 0x16, 0x1F, 0x16, 0xA3, 0x39, 0x10, 0x02, 0x82, 0x27, 0x02, 0xFC,
+  0xC0, 0xC7, 0x2A, 0x80, 0x2A, 0x02, 0x13, 0x02, 0x14, 0x01, 0x13, 0x83, 0x14, 0x82, 0x45, 0x24,
+  0x14, 0x05, 0x84, 0x55, 0xC1, 0x44, 0x4E, 0x4E, 0x0E, 0x04, 0x10, 0x01, 0x01, 0x17, 0x02, 0x06,
+  0x05, 0x0E, 0x03, 0x06, 0xC0, 0x9B, 0xDF, 0x02, 0x6B, 0x04, 0x2F, 0x04, 0x30, 0x03, 0x28, 0x14,
+  0x19, 0xC0, 0xFB, 0xF7, 0xC0, 0x99, 0xE7, 0x16, 0x00, 0x01, 0x18, 0x01, 0x25, 0x81, 0x5B, 0x73,
+  0x05, 0x08, 0xC0, 0x55, 0x76, 0x82, 0xE6, 0x10, 0x20, 0x04, 0x10, 0x80, 0x20, 0xC0, 0xB3, 0x4D,
+  0x0E, 0x0F, 0x81, 0x52, 0x55, 0x03, 0x1A, 0x08, 0x07, 0x84, 0x1A, 0x07, 0x70, 0x33, 0x40, 0xC0,
+  0xC7, 0x32, 0x88, 0xC4, 0x0A, 0x0A, 0x5C, 0x34, 0x16, 0x1F, 0x16, 0x71, 0x12, 0x02, 0x81, 0x2C,
+  0x74, 0xC0, 0x87, 0x43, 0x83, 0x2A, 0x13, 0x37, 0x37, 0x02, 0x14, 0x02, 0x13, 0x82, 0x59, 0x4A,
+  0x24, 0x14, 0x05, 0x80, 0x5D, 0xC0, 0x88, 0x0A, 0x82, 0x44, 0x4E, 0x4E, 0x0E, 0x04, 0x10, 0x01,
+  0x01, 0x17, 0x02, 0x06, 0x05, 0x0E, 0x03, 0x06, 0xC0, 0x9B, 0xD7, 0x02, 0x6B, 0x04, 0x2F, 0x04,
+  0x30, 0x03, 0x28, 0x14, 0x19, 0x81, 0xFF, 0xE9, 0x16, 0x00, 0x01, 0x18, 0x01, 0x25, 0x81, 0x5B,
+  0x73, 0x05, 0x08, 0x82, 0x58, 0xC3, 0x56, 0x05, 0x10, 0x82, 0x20, 0x7C, 0x3B, 0x0E, 0x0F, 0x80,
+  0x10, 0x03, 0x1A, 0x08, 0x07, 0x84, 0x1A, 0x07, 0x70, 0x33, 0x40, 0xC0, 0xA7, 0x2A, 0xC0, 0x09,
+  0xB6, 0x87, 0x54, 0x0A, 0x5C, 0x34, 0x16, 0x1F, 0x16, 0x71, 0x12, 0x02, 0x86, 0x2C, 0x02, 0xFE,
+  0xCC, 0x13, 0x37, 0x48, 0x02, 0x14, 0x02, 0x13, 0x82, 0x68, 0x64, 0xA1, 0x14, 0x05, 0x84, 0x55,
+  0xF6, 0x44, 0x4E, 0x4E, 0x0E, 0x04, 0x10, 0x01, 0x01, 0x17, 0x02, 0x06, 0x05, 0x0E, 0x03, 0x06,
+  0xC0, 0x9A, 0xD7, 0x02, 0x6B, 0x04, 0x2F, 0x04, 0x30, 0x03, 0x28, 0x14, 0x19, 0x81, 0xFF, 0xE9,
+  0x18, 0x00, 0x01, 0x25, 0x81, 0x5B, 0x69, 0x04, 0x08, 0x84, 0x49, 0x08, 0xFA, 0x6A, 0x38, 0x04,
+  0x10, 0x82, 0x20, 0x53, 0x67, 0x0E, 0x0F, 0x81, 0x97, 0x92, 0x02, 0x1A, 0x08, 0x07, 0x84, 0x1A,
+  0x07, 0x70, 0x33, 0x40, 0xC0, 0xA7, 0x2A, 0x89, 0xC4, 0x4C, 0x0A, 0x5C, 0x34, 0x16, 0x1F, 0x16,
+  0x02, 0x39, 0x11, 0x02, 0x01, 0x2C, 0x83, 0xC8, 0xBA, 0x13, 0x48, 0x03, 0x14, 0x02, 0x13, 0x82,
+  0x14, 0x66, 0x55, 0x14, 0x05, 0xC0, 0x4E, 0x2C, 0xC0, 0xC9, 0x12, 0xC0, 0x46, 0x01, 0x01, 0x4E,
+  0x0E, 0x04, 0x10, 0x01, 0x01, 0x17, 0x02, 0x06, 0x05, 0x0E, 0x03, 0x06, 0x80, 0xAE, 0xC0, 0xFC,
+  0xE7, 0x01, 0x6B, 0x04, 0x2F, 0x04, 0x30, 0x03, 0x28, 0x14, 0x19, 0xC0, 0xBA, 0xEF, 0x80, 0xE9,
+  0x18, 0x00, 0x01, 0x25, 0x81, 0xD4, 0x69, 0x06, 0x08, 0x81, 0x60, 0x80, 0x06, 0x10, 0x80, 0x20,
+  0xC0, 0x72, 0x45, 0x80, 0x3B, 0x0D, 0x0F, 0x84, 0xAA, 0x45, 0x92, 0x1A, 0x1A, 0x08, 0x07, 0x84,
+  0x1A, 0x07, 0x70, 0x33, 0x40, 0xC0, 0xC8, 0x32, 0x89, 0xC4, 0x1B, 0x0A, 0x5C, 0x63, 0x16, 0x1F,
+  0x16, 0x02, 0x39, 0x11, 0x02, 0x01, 0x2C, 0x80, 0x4F, 0xC0, 0x06, 0x33, 0x80, 0x2A, 0x04, 0x14,
+  0x02, 0x13, 0x82, 0x7B, 0x7F, 0x55, 0x14, 0x05, 0xC0, 0x4E, 0x2C, 0xC0, 0xEA, 0x1A, 0xC0, 0x46,
+  0x01, 0x01, 0x4E, 0x0E, 0x04, 0x10, 0x01, 0x01, 0x17, 0x02, 0x06, 0x05, 0x0E, 0x03, 0x06, 0x80,
+  0xAE, 0xC0, 0xBC, 0xDF, 0x80, 0x6B, 0x06, 0x2F, 0x03, 0x30, 0x03, 0x28, 0x13, 0x19, 0x80, 0x28,
+  0xC0, 0xBA, 0xEF, 0x80, 0xE9, 0x18, 0x00, 0x83, 0x25, 0x18, 0xD9, 0x93, 0x07, 0x08, 0xC0, 0xB7,
+  0x7E, 0xC0, 0x32, 0x4D, 0x06, 0x10, 0x81, 0x90, 0x85, 0x0C, 0x0F, 0x82, 0x3C, 0x52, 0x76, 0x0B,
+  0x07, 0x84, 0x1A, 0x07, 0x70, 0x33, 0x40, 0xC0, 0xC8, 0x32, 0xC0, 0x4A, 0xB6, 0x88, 0x1B, 0x0A,
+  0x5C, 0xBE, 0x16, 0x1F, 0x16, 0x02, 0x39, 0x11, 0x02, 0x01, 0x2C, 0x80, 0x39, 0xC0, 0xA7, 0x4B,
+  0x80, 0x37, 0x07, 0x13, 0x80, 0x7B, 0xC0, 0xAA, 0x12, 0x80, 0x99, 0x15, 0x05, 0x83, 0x77, 0x44,
+  0x4E, 0x4E, 0x0E, 0x04, 0x10, 0x01, 0x01, 0x17, 0x02, 0x06, 0x05, 0x0E, 0x04, 0x06, 0xC0, 0x9B,
+  0xDF, 0x80, 0x6B, 0x06, 0x2F, 0x03, 0x30, 0x03, 0x28, 0x13, 0x19, 0x82, 0xFF, 0xE8, 0x09, 0x18,
+  0x00, 0x83, 0x47, 0x42, 0xD9, 0x36, 0x07, 0x08, 0xC0, 0xF8, 0x8E, 0x82, 0x80, 0x10, 0x20, 0x04,
+  0x10, 0x81, 0x20, 0x97, 0x0C, 0x0F, 0x81, 0x3C, 0xAC, 0xC0, 0x8F, 0x34, 0x80, 0xF7, 0x0A, 0x07,
+  0x84, 0x1A, 0x07, 0x7F, 0x15, 0x40, 0xC0, 0xE8, 0x32, 0xC0, 0x4A, 0xBE, 0x86, 0x1B, 0x0A, 0x5C,
+  0xBE, 0x1F, 0x16, 0xB9, 0x13, 0x02, 0x01, 0x2C, 0x80, 0x02, 0xC0, 0x67, 0x6C, 0x80, 0xCC, 0x07,
+  0x13, 0x80, 0x3E, 0xC0, 0x69, 0x12, 0x80, 0x45, 0x15, 0x05, 0x83, 0xCA, 0x11, 0x1D, 0x4E, 0x0E,
+  0x04, 0x10, 0x01, 0x01, 0x17, 0x02, 0x06, 0x05, 0x0E, 0x04, 0x06, 0x81, 0xAE, 0xDD, 0x06, 0x2F,
+  0x03, 0x30, 0x03, 0x28, 0x13, 0x19, 0x81, 0xDC, 0xE9, 0x19, 0x00, 0x81, 0x47, 0x42, 0xC0, 0x77,
+  0xC7, 0x08, 0x08, 0x80, 0x60, 0xC0, 0x97, 0x7E, 0x80, 0x6A, 0x05, 0x10, 0x81, 0x20, 0x53, 0xC0,
+  0x35, 0x5E, 0x0B, 0x0F, 0x83, 0xAC, 0x3C, 0x10, 0xF7, 0x0A, 0x07, 0x84, 0x1A, 0x07, 0x7F, 0x15,
+  0x40, 0xC0, 0x29, 0x3B, 0x87, 0xAB, 0x1B, 0x0A, 0x5C, 0x34, 0x1F, 0x16, 0x6C, 0x13, 0x02, 0x02,
+  0x2C, 0x80, 0xFC, 0xC0, 0xA7, 0x2A, 0x81, 0x35, 0x13, 0x05, 0x14, 0x83, 0x35, 0x2B, 0xC2, 0x55,
+  0x14, 0x05, 0x80, 0x64, 0xC0, 0xA7, 0x09, 0x81, 0x44, 0x4E, 0x0E, 0x04, 0x10, 0x01, 0x01, 0x17,
+  0x02, 0x06, 0x05, 0x0E, 0x04, 0x06, 0x81, 0xAE, 0xDD, 0x06, 0x2F, 0x03, 0x30, 0x03, 0x28, 0x12,
+  0x19, 0x80, 0x28, 0xC0, 0xBA, 0xEF, 0x81, 0x09, 0x0B, 0x18, 0x00, 0x81, 0x25, 0x42, 0xC0, 0x77,
+  0xC7, 0x09, 0x08, 0xC0, 0xF8, 0x8E, 0xC0, 0x73, 0x55, 0x06, 0x10, 0x80, 0x20, 0xC0, 0x93, 0x4D,
+  0x0B, 0x0F, 0x83, 0xAC, 0x3C, 0x6A, 0xF7, 0x0C, 0x07, 0x82, 0x7F, 0x15, 0x29, 0xC0, 0x69, 0x43,
+  0x8A, 0x4D, 0x1B, 0x0A, 0x5C, 0x63, 0x16, 0x16, 0xF9, 0x02, 0x39, 0x39, 0x10, 0x02, 0x02, 0x2C,
+  0x80, 0xD1, 0xC0, 0x67, 0x43, 0x81, 0x2A, 0x13, 0x05, 0x14, 0x01, 0x13, 0x81, 0xF0, 0x55, 0x14,
+  0x05, 0x83, 0x4A, 0x2A, 0x44, 0x4E, 0x0E, 0x04, 0x10, 0x01, 0x01, 0x17, 0x02, 0x06, 0x05, 0x0E,
+  0x05, 0x06, 0x81, 0xAE, 0xDD, 0x05, 0x2F, 0x03, 0x30, 0x03, 0x28, 0x11, 0x19, 0x84, 0x28, 0xFF,
+  0xE9, 0x0B, 0x0B, 0x18, 0x00, 0x81, 0x25, 0x42, 0xC0, 0x77, 0xC7, 0x09, 0x08, 0x81, 0x60, 0x80,
+  0x07, 0x10, 0x81, 0x6A, 0x52, 0x0A, 0x0F, 0x83, 0xAC, 0x3C, 0xF5, 0xF7, 0x0C, 0x07, 0x82, 0x7F,
+  0x15, 0x29, 0xC0, 0xA9, 0x4B, 0x8A, 0x0A, 0x1B, 0x0A, 0x4D, 0x34, 0x16, 0x16, 0xF9, 0x02, 0x39,
+  0x39, 0x12, 0x02, 0x81, 0x2C, 0x71, 0xC0, 0x07, 0x5C, 0xC0, 0x06, 0x0A, 0x06, 0x14, 0x01, 0x13,
+  0x81, 0x77, 0x99, 0x14, 0x05, 0x83, 0x9F, 0xD2, 0x44, 0x4E, 0x0E, 0x04, 0x10, 0x01, 0x01, 0x17,
+  0x02, 0x06, 0x05, 0x0E, 0x06, 0x06, 0xC0, 0xBB, 0xDF, 0x05, 0x2F, 0x03, 0x30, 0x03, 0x28, 0x10,
+  0x19, 0x80, 0x28, 0xC0, 0xDC, 0xF7, 0x81, 0xE8, 0x09, 0x02, 0x0B, 0x17, 0x00, 0x81, 0x25, 0x42,
+  0xC0, 0x77, 0xC7, 0x0A, 0x08, 0xC0, 0x76, 0x76, 0xC0, 0xF1, 0x44, 0x05, 0x10, 0x83, 0x56, 0x7E,
+  0xAA, 0x3C, 0x09, 0x0F, 0x83, 0xAC, 0x3C, 0xF5, 0xF7, 0x0C, 0x07, 0x82, 0x7F, 0x15, 0x29, 0xC0,
+  0xEA, 0x5B, 0x8A, 0x0A, 0x1B, 0x0A, 0x4D, 0x34, 0x16, 0x16, 0xF9, 0x02, 0x02, 0x39, 0x11, 0x02,
+  0x01, 0x2C, 0x81, 0x02, 0xCE, 0xC0, 0x66, 0x1A, 0x01, 0x14, 0x81, 0x3E, 0x48, 0x02, 0x14, 0x83,
+  0x13, 0x3E, 0x8F, 0x99, 0x14, 0x05, 0x83, 0x57, 0xD3, 0x11, 0x4E, 0x0E, 0x04, 0x10, 0x01, 0x01,
+  0x17, 0x02, 0x06, 0x05, 0x0E, 0x06, 0x06, 0x81, 0xAE, 0xDD, 0x04, 0x2F, 0x03, 0x30, 0x03, 0x28,
+  0x10, 0x19, 0x80, 0x28, 0xC0, 0xBA, 0xEF, 0x80, 0x09, 0x03, 0x0B, 0x17, 0x00, 0x82, 0x25, 0x42,
+  0xD9, 0x0A, 0x08, 0x82, 0xA2, 0x6A, 0x38, 0x04, 0x10, 0x83, 0x7E, 0x56, 0xF5, 0x3B, 0x09, 0x0F,
+  0x83, 0xAC, 0x3C, 0x6A, 0xF7, 0x0C, 0x07, 0x82, 0x7F, 0x15, 0x13, 0xC0, 0x2A, 0x64, 0x87, 0x72,
+  0x1B, 0x0A, 0x4D, 0x34, 0x16, 0x1F, 0x6C, 0x16, 0x02, 0x81, 0x50, 0x74, 0xC0, 0x07, 0x33, 0x8A,
+  0x3E, 0x14, 0x14, 0x48, 0x48, 0x14, 0x14, 0x13, 0x3E, 0xD3, 0x9F, 0x14, 0x05, 0x83, 0x57, 0xBF,
+  0x44, 0x4E, 0x0E, 0x04, 0x10, 0x01, 0x01, 0x17, 0x02, 0x06, 0x05, 0x0E, 0x06, 0x06, 0x82, 0x03,
+  0xAE, 0xDD, 0x03, 0x2F, 0x03, 0x30, 0x03, 0x28, 0x0E, 0x19, 0xC0, 0xDC, 0xFF, 0x87, 0x28, 0xDC,
+  0xE9, 0x09, 0x0B, 0x0B, 0x12, 0x0B, 0x17, 0x00, 0x83, 0x25, 0x42, 0x8A, 0x36, 0x0A, 0x08, 0x81,
+  0x96, 0x38, 0x04, 0x10, 0x83, 0x7E, 0x56, 0x53, 0x67, 0x09, 0x0F, 0x83, 0xAC, 0x3C, 0x10, 0xA8,
+  0x0C, 0x07, 0x82, 0xEA, 0x6F, 0x13, 0xC0, 0x4A, 0x6C, 0x87, 0x72, 0x1B, 0x0A, 0x4D, 0x9B, 0x16,
+  0x1F, 0xB9, 0x16, 0x02, 0x81, 0x50, 0xAD, 0xC0, 0x88, 0x4B, 0x84, 0x2A, 0x14, 0x14, 0x48, 0x48,
+  0x02, 0x14, 0x80, 0x3E, 0xC0, 0x49, 0x0A, 0x80, 0x4A, 0x14, 0x05, 0x83, 0x5D, 0x77, 0x11, 0x1D,
+  0x0E, 0x04, 0x10, 0x01, 0x01, 0x17, 0x82, 0x06, 0x17, 0x17, 0x05, 0x0E, 0x06, 0x06, 0x01, 0x03,
+  0xC0, 0x9A, 0xDF, 0x80, 0xDD, 0x03, 0x2F, 0x01, 0x30, 0x04, 0x28, 0x0E, 0x19, 0x88, 0x28, 0xFF,
+  0xE8, 0x09, 0x09, 0x0B, 0x0B, 0x12, 0x0B, 0x16, 0x00, 0x84, 0x47, 0x25, 0x21, 0x9E, 0x36, 0x09,
+  0x08, 0x80, 0x7D, 0xC0, 0x14, 0x6E, 0x80, 0x56, 0x06, 0x10, 0x80, 0x38, 0xC0, 0x93, 0x4D, 0x0A,
+  0x0F, 0x80, 0x3B, 0xC0, 0x6F, 0x34, 0x0D, 0x07, 0x82, 0xEA, 0x40, 0x13, 0xC0, 0x8B, 0x74, 0x84,
+  0x72, 0x1B, 0x0A, 0x0A, 0x9B, 0x02, 0x16, 0x81, 0x02, 0x39, 0x14, 0x02, 0x81, 0x2C, 0x39, 0xC0,
+  0x28, 0x5C, 0x82, 0xE0, 0x3E, 0x3E, 0x04, 0x14, 0x83, 0x13, 0x6E, 0x64, 0x76, 0x12, 0x05, 0x84,
+  0x24, 0x76, 0xF0, 0x86, 0x11, 0x0E, 0x04, 0x10, 0x01, 0x01, 0x17, 0x82, 0x06, 0x17, 0x17, 0x05,
+  0x0E, 0x07, 0x06, 0x81, 0x03, 0xAE, 0xC0, 0x9A, 0xDF, 0x80, 0xDD, 0x03, 0x2F, 0x80, 0x30, 0x04,
+  0x28, 0x0D, 0x19, 0x82, 0x28, 0xFF, 0xE8, 0x02, 0x09, 0x01, 0x0B, 0x81, 0x12, 0x0B, 0x16, 0x00,
+  0x83, 0x47, 0x25, 0x12, 0x8E, 0x0B, 0x08, 0xC0, 0x75, 0x7E, 0x80, 0xE6, 0x06, 0x10, 0x82, 0x20,
+  0xB4, 0x3B, 0x09, 0x0F, 0x82, 0x3B, 0x55, 0x1A, 0x0C, 0x07, 0x80, 0xEA, 0xC0, 0x2B, 0x0A, 0xC0,
+  0x08, 0x12, 0xC0, 0xEB, 0x7C, 0xC0, 0xCA, 0xCE, 0x82, 0x1B, 0x0A, 0x0A, 0xC0, 0xE7, 0xAD, 0x02,
+  0x16, 0x81, 0x02, 0x39, 0x15, 0x02, 0x80, 0x4F, 0xC0, 0x87, 0x6C, 0xC0, 0x47, 0x1A, 0xC0, 0xE9,
+  0x09, 0x01, 0x3E, 0x03, 0x14, 0x01, 0x13, 0x81, 0x84, 0x55, 0x12, 0x05, 0x84, 0x24, 0x76, 0xC2,
+  0x0D, 0x11, 0x0E, 0x04, 0x10, 0x01, 0x01, 0x17, 0x82, 0x06, 0x17, 0x17, 0x05, 0x0E, 0x06, 0x06,
+  0x03, 0x03, 0xC0, 0x9A, 0xDF, 0x83, 0xDD, 0x2F, 0x2F, 0x30, 0x05, 0x28, 0x0C, 0x19, 0x80, 0x28,
+  0xC0, 0xBB, 0xEF, 0xC0, 0x99, 0xE7, 0x03, 0x09, 0x01, 0x0B, 0x81, 0x12, 0x0B, 0x16, 0x00, 0x01,
+  0x25, 0x80, 0x12, 0xC0, 0x16, 0xA7, 0x0B, 0x08, 0xC0, 0xD6, 0x86, 0x80, 0x96, 0x07, 0x10, 0xC0,
+  0x10, 0x3D, 0xC0, 0x35, 0x5E, 0x09, 0x0F, 0xC0, 0x34, 0x5E, 0x81, 0xA1, 0x1A, 0x0C, 0x07, 0xC0,
+  0x0C, 0x1B, 0xC0, 0x2B, 0x0A, 0xC0, 0x28, 0x1A, 0xC0, 0x4A, 0x8D, 0xC0, 0xCA, 0xCE, 0x83, 0x1B,
+  0x0A, 0x0A, 0x62, 0x02, 0x16, 0x81, 0x02, 0x39, 0x16, 0x02, 0xC0, 0xC7, 0x7C, 0x80, 0xEF, 0xC0,
+  0xE9, 0x09, 0x81, 0x35, 0x3E, 0x03, 0x14, 0x01, 0x35, 0x81, 0xBF, 0x99, 0x12, 0x05, 0x84, 0x24,
+  0xA1, 0x4A, 0x2A, 0x75, 0x0E, 0x04, 0x10, 0x01, 0x01, 0x17, 0x82, 0x06, 0x17, 0x17, 0x05, 0x0E,
+  0x06, 0x06, 0x04, 0x03, 0xC0, 0x9A, 0xDF, 0xC0, 0xDB, 0xE7, 0xC0, 0xDC, 0xEF, 0x80, 0x30, 0x05,
+  0x28, 0x0A, 0x19, 0x01, 0x28, 0xC0, 0xBA, 0xEF, 0x05, 0x09, 0x01, 0x0B, 0x81, 0x12, 0x0B, 0x16,
+  0x00, 0x01, 0x25, 0x80, 0xE5, 0xC0, 0x16, 0x9F, 0x0B, 0x08, 0x81, 0x36, 0xCB, 0x08, 0x10, 0xC0,
+  0xF3, 0x55, 0x09, 0x0F, 0x82, 0x67, 0x45, 0x1A, 0x0C, 0x07, 0xC0, 0x0C, 0x1B, 0x80, 0x40, 0xC0,
+  0x67, 0x22, 0xC0, 0xCA, 0x9D, 0x89, 0xBB, 0x1B, 0x0A, 0x0A, 0x62, 0x16, 0x1F, 0x16, 0x02, 0x39,
+  0x15, 0x02, 0x81, 0x27, 0x4F, 0xC0, 0x07, 0x33, 0x82, 0x35, 0x13, 0x3E, 0x03, 0x14, 0x83, 0x13,
+  0x35, 0xD3, 0x45, 0x14, 0x05, 0xC0, 0xCD, 0x2B, 0x81, 0xD6, 0x75, 0x0E, 0x04, 0x10, 0x01, 0x01,
+  0x17, 0x82, 0x06, 0x17, 0x17, 0x05, 0x0E, 0x06, 0x06, 0x06, 0x03, 0xC0, 0x9A, 0xDF, 0xC0, 0xDB,
+  0xE7, 0xC0, 0xDC, 0xEF, 0x06, 0x28, 0x06, 0x19, 0x87, 0x28, 0xFF, 0xDC, 0xE8, 0x09, 0x09, 0x0B,
+  0x0B, 0x02, 0x09, 0x01, 0x0B, 0x81, 0x12, 0x0B, 0x16, 0x00, 0x83, 0x47, 0x25, 0xD4, 0xA0, 0x0C,
+  0x08, 0xC0, 0x95, 0x76, 0x80, 0xE6, 0x07, 0x10, 0xC0, 0x92, 0x4D, 0x08, 0x0F, 0x82, 0x87, 0xC9,
+  0xDF, 0x0C, 0x07, 0x80, 0x1A, 0xC0, 0x0C, 0x1B, 0x80, 0xA4, 0xC0, 0xC7, 0x2A, 0xC0, 0x4A, 0xB6,
+  0x01, 0x1B, 0x01, 0x0A, 0x85, 0x62, 0x16, 0x1F, 0x16, 0x02, 0x39, 0x15, 0x02, 0x81, 0x27, 0x02,
+  0xC0, 0x87, 0x4B, 0x82, 0x37, 0x13, 0x3E, 0x03, 0x14, 0x81, 0x13, 0x35, 0xC0, 0x49, 0x0A, 0x80,
+  0x4A, 0x14, 0x05, 0x80, 0x9F, 0xC0, 0x69, 0x12, 0x80, 0x11, 0x0E, 0x04, 0x10, 0x01, 0x01, 0x17,
+  0x82, 0x06, 0x17, 0x17, 0x05, 0x0E, 0x06, 0x06, 0x08, 0x03, 0xC0, 0x9A, 0xDF, 0x80, 0xDC, 0xC0,
+  0xDC, 0xF7, 0x04, 0x28, 0x80, 0x19, 0x04, 0x28, 0xC0, 0xDC, 0xF7, 0xC0, 0xBB, 0xEF, 0x80, 0xE8,
+  0x02, 0x09, 0x80, 0x12, 0x06, 0x0B, 0x81, 0x12, 0x0B, 0x16, 0x00, 0x82, 0x47, 0x18, 0xD4, 0x0D,
+  0x08, 0xC0, 0xD6, 0x86, 0xC0, 0x51, 0x4D, 0x06, 0x10, 0x82, 0x20, 0x7C, 0x3B, 0x07, 0x0F, 0x80,
+  0x87, 0xC0, 0x93, 0x4D, 0x80, 0x6D, 0x0C, 0x07, 0x80, 0x1A, 0xC0, 0x0C, 0x1B, 0xC0, 0xE9, 0x01,
+  0xC0, 0x48, 0x43, 0xC0, 0x8A, 0xBE, 0x01, 0x1B, 0x01, 0x0A, 0x85, 0xA6, 0x1F, 0x1F, 0x16, 0x02,
+  0x39, 0x17, 0x02, 0xC0, 0x28, 0x5C, 0x82, 0xB3, 0x13, 0x7B, 0x03, 0x14, 0x83, 0x13, 0x35, 0x13,
+  0x1A, 0x14, 0x05, 0x80, 0x24, 0xC0, 0xC9, 0x12, 0x80, 0x86, 0x0E, 0x04, 0x10, 0x01, 0x01, 0x17,
+  0x82, 0x06, 0x17, 0x17, 0x05, 0x0E, 0x06, 0x06, 0x0A, 0x03, 0xC1, 0x9A, 0xDF, 0xC0, 0xBB, 0xE7,
+  0x05, 0xDC, 0xC0, 0xBB, 0xEF, 0xC0, 0xBA, 0xEF, 0x80, 0xE8, 0xC0, 0x7A, 0xE7, 0x04, 0x09, 0x07,
+  0x0B, 0x81, 0x12, 0x0B, 0x17, 0x00, 0x83, 0x18, 0xCF, 0x08, 0x49, 0x0B, 0x08, 0x83, 0x58, 0xC3,
+  0x10, 0x20, 0x04, 0x10, 0x82, 0x20, 0x83, 0x52, 0x08, 0x0F, 0x81, 0xF5, 0x1A, 0x0D, 0x07, 0xC0,
+  0xEC, 0x1A, 0xC0, 0xE9, 0x01, 0xC0, 0x4A, 0x64, 0x81, 0x8D, 0x1B, 0x02, 0x0A, 0x85, 0xA6, 0x1F,
+  0x1F, 0x16, 0x02, 0x39, 0x17, 0x02, 0xC0, 0x87, 0x74, 0x82, 0xC5, 0x35, 0x48, 0x03, 0x14, 0x83,
+  0x13, 0x35, 0x3E, 0x2E, 0x14, 0x05, 0x82, 0xA1, 0xC0, 0x86, 0x0E, 0x04, 0x10, 0x01, 0x01, 0x17,
+  0x82, 0x06, 0x17, 0x17, 0x05, 0x0E, 0x06, 0x06, 0x0E, 0x03, 0x06, 0x09, 0x80, 0x03, 0x05, 0x09,
+  0x07, 0x0B, 0x81, 0x12, 0x0B, 0x17, 0x00, 0x81, 0x18, 0xE4, 0x0E, 0x08, 0x82, 0xAC, 0x10, 0x20,
+  0x06, 0x10, 0x81, 0x67, 0x3B, 0x07, 0x0F, 0x81, 0x56, 0x1A, 0x0C, 0x07, 0xC0, 0x6D, 0x23, 0xC0,
+  0xCC, 0x12, 0xC0, 0x08, 0x12, 0xC0, 0x2B, 0x85, 0x80, 0x8D, 0x03, 0x0A, 0x85, 0xA6, 0x16, 0x1F,
+  0x16, 0x02, 0x2C, 0x16, 0x02, 0x81, 0x2C, 0x78, 0xC0, 0xA6, 0x22, 0x81, 0x35, 0x37, 0x03, 0x14,
+  0x82, 0x13, 0x35, 0x3E, 0xC0, 0x2B, 0x13, 0x80, 0x55, 0x13, 0x05, 0x82, 0x76, 0x84, 0x86, 0x0E,
+  0x04, 0x10, 0x01, 0x01, 0x17, 0x82, 0x06, 0x17, 0x17, 0x05, 0x0E, 0x06, 0x06, 0x0D, 0x03, 0x83,
+  0x26, 0x03, 0x03, 0x26, 0x03, 0x09, 0x80, 0x1E, 0x05, 0x09, 0x07, 0x0B, 0x81, 0x12, 0x0B, 0x16,
+  0x00, 0x01, 0x18, 0x80, 0xE4, 0x0E, 0x08, 0x82, 0xD8, 0x6A, 0x20, 0x04, 0x10, 0x01, 0x20, 0x82,
+  0xB5, 0x3B, 0x3B, 0x05, 0x0F, 0xC0, 0x15, 0x5E, 0x81, 0xA1, 0x1A, 0x0B, 0x07, 0x80, 0x2E, 0xC0,
+  0x6D, 0x23, 0xC0, 0x6B, 0x12, 0xC0, 0xA8, 0x22, 0xC0, 0xEB, 0xA5, 0x81, 0x0A, 0x1B, 0x02, 0x0A,
+  0x85, 0x62, 0x16, 0x1F, 0x16, 0x2C, 0x2C, 0x16, 0x02, 0xC0, 0x05, 0x85, 0x80, 0x02, 0xC0, 0x26,
+  0x3B, 0x81, 0x35, 0x37, 0x03, 0x14, 0x01, 0x13, 0x82, 0x3E, 0x8F, 0xA1, 0x13, 0x05, 0x81, 0x76,
+  0x2E, 0xC0, 0xC6, 0x01, 0x0E, 0x04, 0x10, 0x01, 0x01, 0x17, 0x02, 0x06, 0x05, 0x0E, 0x07, 0x06,
+  0x10, 0x03, 0x08, 0x09, 0x81, 0x1E, 0x09, 0x07, 0x0B, 0x80, 0x12, 0x17, 0x00, 0x01, 0x18, 0x81,
+  0xE4, 0x36, 0x0D, 0x08, 0x82, 0x36, 0x96, 0x38, 0x05, 0x10, 0x83, 0x20, 0x97, 0x3B, 0x3B, 0x05,
+  0x0F, 0x82, 0x9C, 0x92, 0x1A, 0x0B, 0x07, 0x80, 0x1A, 0xC0, 0x2D, 0x1B, 0x80, 0x40, 0xC0, 0x88,
+  0x4B, 0x81, 0xAB, 0x1B, 0x03, 0x0A, 0xC0, 0xE7, 0xAD, 0x01, 0x1F, 0x82, 0x16, 0x2C, 0x2C, 0x16,
+  0x02, 0xC0, 0x05, 0x85, 0x80, 0x71, 0xC0, 0xC7, 0x53, 0x81, 0x2A, 0x13, 0x05, 0x14, 0x84, 0x3E,
+  0xC7, 0x45, 0x05, 0x57, 0x12, 0x05, 0x81, 0x4A, 0x2A, 0x0E, 0x04, 0x10, 0x01, 0x01, 0x17, 0x02,
+  0x06, 0x05, 0x0E, 0x07, 0x06, 0x11, 0x03, 0x07, 0x09, 0x81, 0x1E, 0x09, 0x07, 0x0B, 0x80, 0x21,
+  0x17, 0x00, 0x01, 0x18, 0x81, 0x8A, 0x36, 0x0D, 0x08, 0x82, 0xA9, 0x80, 0x20, 0x05, 0x10, 0x83,
+  0x20, 0x6A, 0x52, 0x3B, 0x05, 0x0F, 0x81, 0x38, 0x1A, 0x0C, 0x07, 0x80, 0x3F, 0xC0, 0xEC, 0x1A,
+  0x80, 0x6E, 0xC0, 0xAA, 0x74, 0x81, 0xF1, 0x1B, 0x03, 0x0A, 0x85, 0x9B, 0x16, 0x1F, 0x16, 0x2C,
+  0x2C, 0x16, 0x02, 0xC0, 0x05, 0x85, 0x80, 0x71, 0xC0, 0x88, 0x6C, 0x81, 0xCC, 0x13, 0x05, 0x14,
+  0x84, 0x3E, 0x59, 0x4A, 0x05, 0x57, 0x11, 0x05, 0x82, 0x24, 0x9F, 0x37, 0x0E, 0x04, 0x10, 0x01,
+  0x01, 0x17, 0x02, 0x06, 0x05, 0x0E, 0x07, 0x06, 0x11, 0x03, 0x07, 0x09, 0x81, 0x1E, 0x09, 0x07,
+  0x0B, 0x80, 0x21, 0x17, 0x00, 0x01, 0x18, 0xC0, 0x37, 0xBF, 0x80, 0x36, 0x0D, 0x08, 0x80, 0xA9,
+  0xC0, 0x96, 0x76, 0x81, 0x10, 0x20, 0x06, 0x10, 0x81, 0x85, 0x3C, 0x03, 0x0F, 0x81, 0x87, 0x85,
+  0xC0, 0xED, 0x1B, 0x80, 0x1A, 0x0C, 0x07, 0x80, 0x3F, 0xC0, 0xAA, 0x12, 0xC0, 0x67, 0x1A, 0xC0,
+  0xAA, 0x95, 0x81, 0xBB, 0x1B, 0x03, 0x0A, 0x85, 0x9B, 0x16, 0x1F, 0x16, 0x2C, 0x2C, 0x16, 0x02,
+  0x81, 0x50, 0x2C, 0xC0, 0x07, 0x7D, 0xC0, 0xA6, 0x2A, 0x80, 0x3E, 0x07, 0x14, 0x82, 0x1A, 0x76,
+  0x24, 0x11, 0x05, 0x82, 0x24, 0x45, 0xD2, 0x0E, 0x04, 0x10, 0x01, 0x01, 0x17, 0x02, 0x06, 0x05,
+  0x0E, 0x07, 0x06, 0x11, 0x03, 0x07, 0x09, 0x81, 0x1E, 0x09, 0x07, 0x0B, 0x80, 0x21, 0x17, 0x00,
+  0x01, 0x18, 0x81, 0x9E, 0x36, 0x0E, 0x08, 0x82, 0xA2, 0x7C, 0x38, 0x04, 0x10, 0x01, 0x20, 0x80,
+  0xB5, 0x04, 0x0F, 0x82, 0x87, 0xB4, 0xF7, 0x0D, 0x07, 0x80, 0xA7, 0xC0, 0x4A, 0x0A, 0xC0, 0x07,
+  0x33, 0xC0, 0x2A, 0xAE, 0x01, 0x1B, 0x02, 0x0A, 0x86, 0x4D, 0x9B, 0x16, 0x1F, 0x16, 0x02, 0x2C,
+  0x17, 0x02, 0xC0, 0x05, 0x85, 0x80, 0x02, 0xC0, 0x67, 0x43, 0x80, 0x3E, 0x06, 0x14, 0x80, 0x48,
+  0xC0, 0x2B, 0x13, 0x81, 0x55, 0x24, 0x11, 0x05, 0x82, 0x24, 0x99, 0xD3, 0x0E, 0x04, 0x10, 0x01,
+  0x01, 0x17, 0x02, 0x06, 0x05, 0x0E, 0x07, 0x06, 0x11, 0x03, 0x07, 0x09, 0x81, 0x1E, 0x09, 0x07,
+  0x0B, 0x80, 0x21, 0x17, 0x00, 0x81, 0x18, 0x00, 0xC0, 0x17, 0xAF, 0x80, 0x36, 0x0E, 0x08, 0x81,
+  0x58, 0xB5, 0xC0, 0xAF, 0x34, 0x04, 0x10, 0x01, 0x20, 0x81, 0xB4, 0x3B, 0x03, 0x0F, 0x80, 0x87,
+  0xC0, 0xAF, 0x34, 0x81, 0xF7, 0x6D, 0x0C, 0x07, 0x81, 0x8F, 0x40, 0xC0, 0xA8, 0x4B, 0xC0, 0x8A,
+  0xBE, 0x05, 0x0A, 0x83, 0x9B, 0x16, 0x1F, 0x16, 0x19, 0x02, 0x81, 0x50, 0x02, 0xC0, 0x08, 0x5C,
+  0xC0, 0xE6, 0x09, 0x82, 0x7B, 0x14, 0x48, 0x03, 0x14, 0x80, 0x48, 0xC0, 0xCA, 0x0A, 0x81, 0x55,
+  0x24, 0x11, 0x05, 0x81, 0x24, 0x99, 0xC0, 0xCA, 0x1A, 0x0E, 0x04, 0x10, 0x01, 0x01, 0x17, 0x02,
+  0x06, 0x05, 0x0E, 0x07, 0x06, 0x11, 0x03, 0x07, 0x09, 0x81, 0x1E, 0x09, 0x07, 0x0B, 0x80, 0x21,
+  0x17, 0x00, 0x83, 0x18, 0x0B, 0xB6, 0x36, 0x0F, 0x08, 0x82, 0xAC, 0x10, 0x20, 0x04, 0x10, 0x82,
+  0x20, 0x83, 0x52, 0x04, 0x0F, 0xC0, 0x4E, 0x2C, 0x01, 0x1A, 0x0B, 0x07, 0x82, 0x66, 0xC7, 0x2B,
+  0xC0, 0x69, 0x64, 0x80, 0x8D, 0x04, 0x0A, 0x84, 0x4D, 0x9B, 0x16, 0x1F, 0x16, 0x18, 0x02, 0x01,
+  0x27, 0x80, 0x02, 0xC0, 0x87, 0x74, 0xC0, 0x65, 0x1A, 0x80, 0x7B, 0x02, 0x48, 0x02, 0x14, 0x82,
+  0x48, 0x82, 0x57, 0x12, 0x05, 0x82, 0x24, 0x99, 0x77, 0x0E, 0x04, 0x10, 0x01, 0x01, 0x17, 0x02,
+  0x06, 0x05, 0x0E, 0x07, 0x06, 0x11, 0x03, 0x07, 0x09, 0x81, 0x1E, 0x09, 0x07, 0x0B, 0x80, 0x21,
+  0x17, 0x00, 0x81, 0x18, 0x5B, 0xC0, 0xF7, 0x9E, 0x10, 0x08, 0x82, 0xD8, 0x6A, 0x38, 0x05, 0x10,
+  0x82, 0x53, 0xC9, 0x3C, 0x02, 0x0F, 0xC0, 0x34, 0x5E, 0x82, 0x24, 0x1A, 0x1A, 0x0B, 0x07, 0x82,
+  0xE1, 0x2B, 0xD2, 0xC0, 0x4B, 0x8D, 0x80, 0xF1, 0x05, 0x0A, 0x83, 0x9B, 0x16, 0x1F, 0x16, 0x18,
+  0x02, 0x01, 0x27, 0x81, 0x2C, 0x74, 0xC0, 0x06, 0x3B, 0x81, 0x3E, 0x14, 0x02, 0x48, 0x02, 0x14,
+  0x81, 0x59, 0x4A, 0x12, 0x05, 0x82, 0x24, 0x76, 0x1A, 0x0E, 0x04, 0x10, 0x01, 0x01, 0x17, 0x02,
+  0x06, 0x05, 0x0E, 0x07, 0x06, 0x11, 0x03, 0x07, 0x09, 0x81, 0x1E, 0x09, 0x07, 0x0B, 0x80, 0x21,
+  0x17, 0x00, 0x82, 0x18, 0xD4, 0x69, 0x10, 0x08, 0x80, 0x58, 0xC0, 0x92, 0x55, 0x07, 0x10, 0x80,
+  0x97, 0x02, 0x0F, 0x84, 0x87, 0xC9, 0xDF, 0x07, 0x1A, 0x0A, 0x07, 0x80, 0x66, 0xC0, 0x4A, 0x0A,
+  0x81, 0x40, 0xEF, 0xC0, 0xEB, 0xA5, 0x80, 0xF1, 0x05, 0x0A, 0x83, 0x9B, 0x16, 0x1F, 0x16, 0x18,
+  0x02, 0x01, 0x27, 0x81, 0x2C, 0x02, 0xC0, 0xC7, 0x53, 0x01, 0x13, 0x82, 0x14, 0x48, 0x48, 0x02,
+  0x14, 0x81, 0x6E, 0x64, 0x12, 0x05, 0x82, 0x24, 0x05, 0x98, 0x0E, 0x04, 0x10, 0x01, 0x01, 0x17,
+  0x02, 0x06, 0x05, 0x0E, 0x07, 0x06, 0x11, 0x03, 0x07, 0x09, 0x81, 0x1E, 0x09, 0x07, 0x0B, 0x80,
+  0x21, 0x17, 0x00, 0x81, 0x18, 0xE4, 0x12, 0x08, 0x80, 0xCB, 0x07, 0x10, 0x88, 0x7C, 0x3B, 0x51,
+  0x0F, 0x0F, 0x97, 0x6D, 0x07, 0x1A, 0x08, 0x07, 0x01, 0x3F, 0x82, 0xE1, 0x15, 0x5F, 0xC0, 0xE7,
+  0x32, 0xC0, 0x4B, 0xB6, 0x80, 0x1B, 0x05, 0x0A, 0xC0, 0xE7, 0xAD, 0x83, 0x16, 0x1F, 0x16, 0x71,
+  0x17, 0x02, 0x01, 0x27, 0x01, 0x2C, 0xC0, 0x68, 0x6C, 0x80, 0xB3, 0xC0, 0xE9, 0x09, 0x01, 0x13,
+  0x03, 0x14, 0x82, 0x13, 0x77, 0x24, 0x11, 0x05, 0x82, 0x24, 0x05, 0x24, 0x0E, 0x04, 0x10, 0x01,
+  0x01, 0x17, 0x02, 0x06, 0x05, 0x0E, 0x07, 0x06, 0x11, 0x03, 0x07, 0x09, 0x81, 0x1E, 0x09, 0x07,
+  0x0B, 0x80, 0x21, 0x17, 0x00, 0x80, 0x18, 0xC0, 0x37, 0xBF, 0x12, 0x08, 0xC0, 0x75, 0x76, 0x82,
+  0xE6, 0x10, 0x20, 0x04, 0x10, 0x80, 0x83, 0xC0, 0x15, 0x66, 0x84, 0x4B, 0x3C, 0x3B, 0x10, 0x1A,
+  0x0A, 0x07, 0x81, 0x3F, 0xA7, 0xC0, 0x6A, 0x0A, 0x80, 0x29, 0xC0, 0xC9, 0x01, 0xC0, 0x68, 0x4B,
+  0xC0, 0x8B, 0xC6, 0x06, 0x0A, 0x84, 0x62, 0x16, 0x1F, 0x16, 0xA3, 0x18, 0x02, 0x82, 0x27, 0x02,
+  0x02, 0xC0, 0xC8, 0x7C, 0x80, 0xBA, 0xC0, 0xE9, 0x09, 0x80, 0x35, 0x04, 0x13, 0x80, 0x35, 0xC0,
+  0xC9, 0x12, 0x80, 0x24, 0x14, 0x05, 0x0E, 0x04, 0x10, 0x01, 0x01, 0x17, 0x02, 0x06, 0x05, 0x0E,
+  0x07, 0x06, 0x11, 0x03, 0x07, 0x09, 0x81, 0x1E, 0x09, 0x07, 0x0B, 0x80, 0x21, 0x17, 0x00, 0x81,
+  0x18, 0x9E, 0x12, 0x08, 0xC0, 0xD6, 0x7E, 0x82, 0x6A, 0x10, 0x20, 0x04, 0x10, 0x83, 0x53, 0x67,
+  0x4B, 0x0F, 0xC0, 0x34, 0x66, 0x81, 0x55, 0x2E, 0x0A, 0x07, 0x80, 0x3F, 0xC0, 0xAB, 0x0A, 0x81,
+  0x15, 0x2B, 0xC0, 0xE9, 0x01, 0xC0, 0x29, 0x64, 0xC0, 0x8B, 0xC6, 0x82, 0x4D, 0x0A, 0x1B, 0x03,
+  0x0A, 0x84, 0x62, 0x16, 0x1F, 0x16, 0xA3, 0x1A, 0x02, 0x81, 0x27, 0x74, 0xC0, 0x26, 0x3B, 0xC0,
+  0xE9, 0x09, 0x05, 0x13, 0x82, 0x35, 0xC1, 0x45, 0x14, 0x05, 0x0E, 0x04, 0x10, 0x01, 0x01, 0x17,
+  0x02, 0x06, 0x05, 0x0E, 0x07, 0x06, 0x11, 0x03, 0x07, 0x09, 0x81, 0x1E, 0x09, 0x07, 0x0B, 0x80,
+  0x21, 0x18, 0x00, 0x81, 0x8E, 0x36, 0x11, 0x08, 0x80, 0x58, 0xC0, 0x51, 0x55, 0x07, 0x10, 0x85,
+  0xC9, 0x4B, 0x0F, 0xC9, 0xC2, 0x1A, 0x0A, 0x07, 0x80, 0xEA, 0xC0, 0x4A, 0x0A, 0x82, 0x29, 0x2B,
+  0x13, 0xC0, 0x0A, 0x85, 0x83, 0x72, 0x0A, 0x0A, 0x1B, 0x03, 0x0A, 0x84, 0x62, 0x16, 0x1F, 0x16,
+  0xA3, 0x1C, 0x02, 0xC0, 0xE7, 0x5B, 0xC0, 0x08, 0x12, 0x06, 0x13, 0x81, 0x6E, 0x98, 0x14, 0x05,
+  0x0E, 0x04, 0x10, 0x01, 0x01, 0x17, 0x02, 0x06, 0x05, 0x0E, 0x07, 0x06, 0x11, 0x03, 0x07, 0x09,
+  0x80, 0x1E, 0x08, 0x0B, 0x80, 0x21, 0x17, 0x00, 0x81, 0x0B, 0xB6, 0x13, 0x08, 0x80, 0xFB, 0x06,
+  0x10, 0x85, 0x20, 0x9C, 0x3B, 0x0F, 0xF5, 0x2E, 0x0A, 0x07, 0x84, 0x66, 0x7A, 0x15, 0x29, 0x29,
+  0xC0, 0x47, 0x1A, 0xC0, 0xCB, 0x9D, 0x80, 0xBB, 0x06, 0x0A, 0x84, 0x62, 0x16, 0x1F, 0x16, 0xA3,
+  0x1C, 0x02, 0xC0, 0xA8, 0x74, 0xC0, 0x47, 0x1A, 0x01, 0x35, 0x03, 0x13, 0x84, 0x35, 0x14, 0x2E,
+  0x24, 0x24, 0x12, 0x05, 0x0E, 0x04, 0x10, 0x01, 0x01, 0x17, 0x02, 0x06, 0x05, 0x0E, 0x07, 0x06,
+  0x11, 0x03, 0x07, 0x09, 0x80, 0x1E, 0x08, 0x0B, 0x80, 0x21, 0x16, 0x00, 0x83, 0x21, 0xE5, 0x73,
+  0x36, 0x11, 0x08, 0x80, 0x60, 0xC0, 0xF3, 0x65, 0x07, 0x10, 0xC0, 0x73, 0x4D, 0x80, 0x3B, 0xC0,
+  0x15, 0x5E, 0xC0, 0x4F, 0x2C, 0x80, 0x2E, 0x09, 0x07, 0x84, 0x2E, 0xE1, 0x15, 0x29, 0x29, 0xC0,
+  0xE9, 0x01, 0xC0, 0xE8, 0x32, 0xC0, 0x2C, 0xAE, 0x82, 0x1B, 0x0A, 0x1B, 0x04, 0x0A, 0x84, 0x62,
+  0x16, 0x1F, 0x16, 0xA3, 0x1B, 0x02, 0x80, 0x2C, 0xC0, 0x08, 0x85, 0xC0, 0xE6, 0x32, 0x80, 0x35,
+  0x06, 0x13, 0x82, 0xC0, 0x24, 0x24, 0x12, 0x05, 0x0E, 0x04, 0x10, 0x01, 0x01, 0x17, 0x02, 0x06,
+  0x05, 0x0E, 0x07, 0x06, 0x11, 0x03, 0x07, 0x09, 0x80, 0x1E, 0x08, 0x0B, 0x80, 0x21, 0x16, 0x00,
+  0x80, 0x21, 0xC0, 0x98, 0xCF, 0x80, 0x69, 0x12, 0x08, 0x81, 0x60, 0x80, 0x07, 0x10, 0x85, 0x97,
+  0x51, 0x9C, 0x07, 0x2E, 0x1A, 0x08, 0x07, 0x85, 0xDB, 0x6F, 0x33, 0x29, 0x29, 0x5F, 0xC0, 0x88,
+  0x4B, 0xC0, 0x4B, 0xBE, 0x82, 0x46, 0x0A, 0x1B, 0x04, 0x0A, 0x84, 0x62, 0x16, 0x1F, 0x16, 0xA3,
+  0x1B, 0x02, 0x81, 0x2C, 0xB8, 0xC0, 0x87, 0x4B, 0x80, 0x35, 0x05, 0x13, 0x82, 0x35, 0x82, 0x45,
+  0x13, 0x05, 0x0E, 0x04, 0x10, 0x01, 0x01, 0x17, 0x02, 0x06, 0x05, 0x0E, 0x07, 0x06, 0x11, 0x03,
+  0x07, 0x09, 0x80, 0x1E, 0x08, 0x0B, 0x80, 0x21, 0x16, 0x00, 0x81, 0x21, 0x8A, 0x13, 0x08, 0x81,
+  0x60, 0x80, 0x07, 0x10, 0x86, 0x97, 0x51, 0x7E, 0xB7, 0x07, 0x1A, 0x1A, 0x05, 0x07, 0x83, 0x1A,
+  0x2E, 0xB1, 0x15, 0x02, 0x29, 0x80, 0x5F, 0xC0, 0x09, 0x64, 0xC0, 0x6B, 0xBE, 0x82, 0x1B, 0x0A,
+  0x1B, 0x04, 0x0A, 0x84, 0x62, 0x16, 0x1F, 0x1F, 0xF9, 0x1B, 0x02, 0x83, 0x50, 0x2C, 0xFE, 0x37,
+  0x06, 0x13, 0x81, 0x14, 0x64, 0x13, 0x05, 0x0E, 0x04, 0x10, 0x01, 0x01, 0x17, 0x02, 0x06, 0x05,
+  0x0E, 0x07, 0x06, 0x11, 0x03, 0x07, 0x09, 0x80, 0x1E, 0x08, 0x0B, 0x80, 0x21, 0x14, 0x00, 0x82,
+  0x47, 0x21, 0x21, 0xC0, 0x57, 0xAF, 0x81, 0x08, 0x49, 0x11, 0x08, 0x81, 0x60, 0x80, 0x06, 0x10,
+  0x82, 0x20, 0x97, 0x67, 0xC0, 0xEE, 0x23, 0x81, 0x3F, 0x07, 0x02, 0x1A, 0x04, 0x07, 0x83, 0x1A,
+  0x7F, 0x6F, 0x33, 0x03, 0x29, 0xC0, 0x69, 0x6C, 0x80, 0x0A, 0x02, 0x1B, 0x04, 0x0A, 0x84, 0x81,
+  0x16, 0x1F, 0x1F, 0xF9, 0x1C, 0x02, 0x80, 0x2C, 0xC0, 0xC8, 0x7C, 0xC0, 0x67, 0x22, 0x80, 0x2A,
+  0x05, 0x13, 0x81, 0x3E, 0x7F, 0x13, 0x05, 0x0E, 0x04, 0x10, 0x01, 0x01, 0x17, 0x02, 0x06, 0x05,
+  0x0E, 0x07, 0x06, 0x11, 0x03, 0x07, 0x09, 0x80, 0x1E, 0x08, 0x0B, 0x80, 0x21, 0x15, 0x00, 0x81,
+  0x18, 0x5B, 0xC0, 0x16, 0x9F, 0x81, 0x08, 0x49, 0x11, 0x08, 0x81, 0x60, 0x80, 0x06, 0x10, 0x81,
+  0x20, 0x91, 0xC0, 0xF1, 0x44, 0x82, 0x1A, 0x07, 0x07, 0x02, 0x1A, 0x04, 0x07, 0x83, 0x2E, 0x7A,
+  0x33, 0x33, 0x03, 0x29, 0xC0, 0xA9, 0x74, 0x01, 0x0A, 0x01, 0x1B, 0x04, 0x0A, 0x84, 0x81, 0x3A,
+  0x1F, 0x1F, 0xB9, 0x1C, 0x02, 0x81, 0x50, 0x74, 0xC0, 0x07, 0x3B, 0x80, 0x7B, 0x05, 0x13, 0x82,
+  0x35, 0x82, 0x9F, 0x12, 0x05, 0x0E, 0x04, 0x10, 0x01, 0x01, 0x17, 0x82, 0x06, 0x17, 0x06, 0x05,
+  0x0E, 0x07, 0x06, 0x11, 0x03, 0x07, 0x09, 0x80, 0x1E, 0x08, 0x0B, 0x80, 0x21, 0x14, 0x00, 0x81,
+  0x18, 0x42, 0xC0, 0x58, 0xBF, 0x80, 0x49, 0x13, 0x08, 0x81, 0x60, 0x80, 0x07, 0x10, 0x83, 0x6A,
+  0x45, 0x1A, 0x07, 0x04, 0x1A, 0x02, 0x07, 0x88, 0x1A, 0xDB, 0xFD, 0x33, 0x15, 0x15, 0x29, 0x33,
+  0x29, 0xC0, 0x09, 0x85, 0x83, 0x1B, 0x0A, 0x1B, 0x1B, 0x04, 0x0A, 0x84, 0x81, 0x3A, 0x1F, 0x1F,
+  0x16, 0x1C, 0x02, 0x81, 0x50, 0xD1, 0xC0, 0xC7, 0x53, 0x80, 0x35, 0x03, 0x14, 0x02, 0x13, 0x80,
+  0x6E, 0xC0, 0x8D, 0x2B, 0x80, 0x76, 0x11, 0x05, 0x0E, 0x04, 0x10, 0x01, 0x01, 0x17, 0x82, 0x06,
+  0x17, 0x06, 0x05, 0x0E, 0x07, 0x06, 0x11, 0x03, 0x07, 0x09, 0x80, 0x1E, 0x08, 0x0B, 0x80, 0x21,
+  0x13, 0x00, 0x84, 0x18, 0x00, 0x5B, 0x73, 0x36, 0x13, 0x08, 0x81, 0x60, 0x80, 0x03, 0x10, 0x01,
+  0x20, 0x01, 0x10, 0xC0, 0x4F, 0x2C, 0x01, 0x1A, 0x80, 0x07, 0x07, 0x1A, 0x83, 0x2E, 0xE1, 0x33,
+  0x33, 0x02, 0x15, 0x81, 0x29, 0xD2, 0xC0, 0x6A, 0x95, 0x83, 0x1B, 0x0A, 0x1B, 0x1B, 0x04, 0x0A,
+  0x84, 0x81, 0x3A, 0x1F, 0x1F, 0x16, 0x1C, 0x02, 0x83, 0x2C, 0x02, 0xFE, 0xD6, 0x03, 0x14, 0x03,
+  0x13, 0x81, 0x77, 0x76, 0x11, 0x05, 0x0E, 0x04, 0x10, 0x01, 0x01, 0x17, 0x82, 0x06, 0x17, 0x17,
+  0x05, 0x0E, 0x07, 0x06, 0x12, 0x03, 0x06, 0x09, 0x80, 0x1E, 0x06, 0x12, 0x01, 0x0B, 0x80, 0x21,
+  0x13, 0x00, 0x81, 0x18, 0x00, 0xC0, 0x58, 0xBF, 0x80, 0x69, 0x14, 0x08, 0x81, 0x60, 0x80, 0x03,
+  0x10, 0x01, 0x20, 0x81, 0x10, 0x38, 0xC0, 0xEE, 0x23, 0x0A, 0x1A, 0x80, 0x66, 0xC0, 0x6A, 0x0A,
+  0x80, 0x33, 0x02, 0x15, 0x81, 0x33, 0x29, 0xC0, 0x68, 0x1A, 0xC0, 0xAB, 0x9D, 0x83, 0x1B, 0x0A,
+  0x1B, 0x1B, 0x04, 0x0A, 0x80, 0x81, 0xC0, 0xA6, 0x9D, 0x01, 0x1F, 0x80, 0x16, 0x1E, 0x02, 0xC0,
+  0xC8, 0x74, 0xC0, 0x67, 0x1A, 0x03, 0x14, 0x03, 0x13, 0x81, 0xA5, 0x24, 0x11, 0x05, 0x0E, 0x04,
+  0x10, 0x01, 0x01, 0x17, 0x82, 0x06, 0x17, 0x17, 0x05, 0x0E, 0x07, 0x06, 0x12, 0x03, 0x06, 0x09,
+  0x80, 0x1E, 0x05, 0x12, 0x02, 0x0B, 0x80, 0x21, 0x12, 0x00, 0x83, 0x47, 0x18, 0x0B, 0xB6, 0x15,
+  0x08, 0x82, 0x60, 0x80, 0x10, 0x04, 0x20, 0x80, 0x10, 0xC0, 0x8F, 0x34, 0x80, 0x6D, 0x09, 0x1A,
+  0x83, 0x07, 0xEA, 0x15, 0x33, 0x02, 0x15, 0x82, 0x33, 0x29, 0xEF, 0xC0, 0x0B, 0xA6, 0x83, 0x1B,
+  0x0A, 0x1B, 0x1B, 0x04, 0x0A, 0x80, 0x81, 0x02, 0x1F, 0x80, 0x16, 0x1C, 0x02, 0x81, 0x27, 0x02,
+  0xC0, 0x08, 0x85, 0xC0, 0xE6, 0x2A, 0x83, 0x37, 0x13, 0x13, 0x14, 0x03, 0x13, 0x81, 0x59, 0x8B,
+  0x11, 0x05, 0x0E, 0x04, 0x10, 0x01, 0x01, 0x17, 0x82, 0x06, 0x17, 0x17, 0x05, 0x0E, 0x07, 0x06,
+  0x10, 0x03, 0x80, 0x26, 0x06, 0x09, 0x80, 0x0B, 0x06, 0x12, 0x02, 0x0B, 0x80, 0x21, 0x11, 0x00,
+  0x01, 0x47, 0x83, 0x00, 0x5B, 0x69, 0x36, 0x14, 0x08, 0x81, 0x60, 0x80, 0x05, 0x20, 0x81, 0x10,
+  0x55, 0x0A, 0x1A, 0x82, 0x3F, 0x7A, 0x33, 0x03, 0x15, 0x81, 0x33, 0x29, 0xC0, 0xE7, 0x32, 0xC0,
+  0x4B, 0xB6, 0x83, 0x1B, 0x0A, 0x1B, 0x1B, 0x02, 0x0A, 0x82, 0x1B, 0x0A, 0x81, 0x02, 0x1F, 0x81,
+  0x16, 0x71, 0x1B, 0x02, 0x01, 0x27, 0x80, 0x74, 0xC0, 0x66, 0x43, 0x80, 0x37, 0x06, 0x13, 0x81,
+  0x14, 0x84, 0x11, 0x05, 0x0E, 0x04, 0x10, 0x01, 0x01, 0x17, 0x82, 0x06, 0x17, 0x17, 0x05, 0x0E,
+  0x07, 0x06, 0x10, 0x03, 0x80, 0x26, 0x06, 0x09, 0x80, 0x0B, 0x06, 0x12, 0x02, 0x0B, 0x80, 0x21,
+  0x14, 0x00, 0x80, 0xE4, 0x16, 0x08, 0x81, 0x60, 0x80, 0x05, 0x20, 0x81, 0x38, 0x45, 0x0A, 0x1A,
+  0x80, 0xDB, 0xC0, 0x4A, 0x0A, 0x05, 0x15, 0x80, 0x2B, 0xC0, 0xA8, 0x53, 0xC0, 0x8A, 0xBE, 0x89,
+  0x1B, 0x0A, 0x1B, 0x1B, 0x0A, 0x0A, 0x1B, 0x1B, 0x0A, 0x81, 0x02, 0x1F, 0x81, 0x16, 0x71, 0x1A,
+  0x02, 0x02, 0x27, 0x80, 0x02, 0xC0, 0x06, 0x5C, 0xC0, 0x27, 0x0A, 0x06, 0x13, 0x83, 0x14, 0xBF,
+  0x24, 0x24, 0x0F, 0x05, 0x0E, 0x04, 0x10, 0x01, 0x01, 0x17, 0x82, 0x06, 0x17, 0x17, 0x05, 0x0E,
+  0x07, 0x06, 0x10, 0x03, 0x80, 0x26, 0x06, 0x09, 0x80, 0x0B, 0x06, 0x12, 0x02, 0x0B, 0x80, 0x21,
+  0x12, 0x00, 0x82, 0x25, 0x00, 0xBC, 0x16, 0x08, 0x81, 0x60, 0x80, 0x05, 0x20, 0xC0, 0x90, 0x34,
+  0x80, 0x6D, 0x0A, 0x1A, 0x81, 0xB1, 0x33, 0x04, 0x15, 0x81, 0x33, 0x29, 0xC0, 0x48, 0x6C, 0x84,
+  0x0A, 0x1B, 0x0A, 0x0A, 0x1B, 0x04, 0x0A, 0x80, 0x81, 0x02, 0x1F, 0x81, 0x16, 0x71, 0x1B, 0x02,
+  0x01, 0x27, 0x80, 0x2C, 0xC0, 0x86, 0x6C, 0xC0, 0x67, 0x1A, 0x07, 0x13, 0x82, 0x82, 0x4A, 0x24,
+  0x0F, 0x05, 0x0E, 0x04, 0x10, 0x01, 0x01, 0x17, 0x82, 0x06, 0x17, 0x17, 0x05, 0x0E, 0x07, 0x06,
+  0x10, 0x03, 0x80, 0x26, 0x06, 0x09, 0x80, 0x0B, 0x06, 0x12, 0x02, 0x0B, 0x80, 0x21, 0x14, 0x00,
+  0x81, 0x9A, 0x36, 0x15, 0x08, 0x81, 0x60, 0x80, 0x04, 0x20, 0x80, 0x10, 0xC0, 0x4F, 0x2C, 0x09,
+  0x1A, 0x81, 0x07, 0x2E, 0xC0, 0x6A, 0x0A, 0x80, 0x33, 0x03, 0x15, 0x81, 0x2B, 0x29, 0xC0, 0x29,
+  0x12, 0xC0, 0xE9, 0x84, 0x84, 0xBB, 0x1B, 0x0A, 0x0A, 0x1B, 0x04, 0x0A, 0x80, 0x81, 0x02, 0x1F,
+  0x81, 0x16, 0xA3, 0x1B, 0x02, 0x01, 0x27, 0x80, 0x50, 0xC0, 0x07, 0x7D, 0xC0, 0xC7, 0x2A, 0x80,
+  0x14, 0x06, 0x13, 0x81, 0x6E, 0x1A, 0x10, 0x05, 0x0E, 0x04, 0x10, 0x01, 0x01, 0x17, 0x82, 0x06,
+  0x17, 0x17, 0x05, 0x0E, 0x07, 0x06, 0x10, 0x03, 0x80, 0x26, 0x06, 0x09, 0x80, 0x0B, 0x06, 0x12,
+  0x02, 0x0B, 0x80, 0x21, 0x13, 0x00, 0x82, 0x0B, 0x73, 0x36, 0x15, 0x08, 0x80, 0x60, 0xC0, 0xF3,
+  0x5D, 0x04, 0x20, 0x82, 0x56, 0xA1, 0x1A, 0x09, 0x07, 0x80, 0xEA, 0x05, 0x15, 0x01, 0x29, 0xC0,
+  0x68, 0x1A, 0xC0, 0xAA, 0x9D, 0x81, 0xBB, 0x1B, 0x07, 0x0A, 0x80, 0xC4, 0x03, 0x1F, 0x80, 0xA3,
+  0x1B, 0x02, 0x01, 0x27, 0x81, 0x50, 0xAD, 0xC0, 0x46, 0x3B, 0x81, 0x7B, 0x2B, 0x05, 0x13, 0x81,
+  0x48, 0xC0, 0x10, 0x05, 0x0E, 0x04, 0x10, 0x01, 0x01, 0x17, 0x82, 0x06, 0x17, 0x17, 0x05, 0x0E,
+  0x07, 0x06, 0x10, 0x03, 0x80, 0x26, 0x06, 0x09, 0x80, 0x0B, 0x06, 0x12, 0x02, 0x0B, 0x80, 0x21,
+  0x13, 0x00, 0x80, 0x0B, 0xC0, 0xF7, 0x9E, 0x17, 0x08, 0xC0, 0xD3, 0x5D, 0x04, 0x20, 0xC0, 0x8F,
+  0x34, 0x80, 0xDF, 0x09, 0x07, 0x81, 0x2E, 0xB1, 0x05, 0x15, 0x01, 0x29, 0xC0, 0xA7, 0x2A, 0xC0,
+  0x2C, 0xB6, 0x80, 0x1B, 0x08, 0x0A, 0x85, 0xA6, 0x1F, 0x1F, 0x16, 0x1F, 0xF9, 0x1D, 0x02, 0x81,
+  0x27, 0xD1, 0xC0, 0xC6, 0x53, 0x81, 0x37, 0x29, 0x05, 0x13, 0x82, 0x35, 0xF6, 0x24, 0x0F, 0x05,
+  0x0E, 0x04, 0x10, 0x01, 0x01, 0x17, 0x82, 0x06, 0x17, 0x17, 0x05, 0x0E, 0x07, 0x06, 0x11, 0x03,
+  0x06, 0x09, 0x80, 0x0B, 0x06, 0x12, 0x02, 0x0B, 0x80, 0x21, 0x11, 0x00, 0x82, 0x47, 0x21, 0x5B,
+  0xC0, 0xF7, 0x96, 0x17, 0x08, 0x80, 0x9C, 0x03, 0x20, 0x82, 0x38, 0xA1, 0x1A, 0x09, 0x07, 0x81,
+  0xA7, 0x6F, 0x05, 0x15, 0x81, 0x2B, 0x29, 0xC0, 0x27, 0x3B, 0xC0, 0x8C, 0xBE, 0x80, 0x1B, 0x08,
+  0x0A, 0x85, 0xA6, 0x1F, 0x1F, 0x16, 0x1F, 0x6C, 0x1F, 0x02, 0xC0, 0x66, 0x6C, 0xC0, 0x27, 0x0A,
+  0x06, 0x13, 0x83, 0x35, 0x68, 0x8B, 0x5D, 0x0E, 0x05, 0x0E, 0x04, 0x10, 0x01, 0x01, 0x17, 0x82,
+  0x06, 0x17, 0x17, 0x05, 0x0E, 0x07, 0x06, 0x11, 0x03, 0x06, 0x09, 0x80, 0x0B, 0x06, 0x12, 0x02,
+  0x0B, 0x80, 0x21, 0x11, 0x00, 0x82, 0x47, 0x21, 0xE4, 0xC0, 0xF7, 0x96, 0x16, 0x08, 0x81, 0x49,
+  0x97, 0x02, 0x20, 0x80, 0x38, 0xC0, 0x8F, 0x34, 0x81, 0xDF, 0x1A, 0x09, 0x07, 0x80, 0x70, 0x05,
+  0x15, 0x82, 0x33, 0x40, 0x35, 0xC0, 0xE8, 0x5B, 0xC0, 0xAB, 0xC6, 0x80, 0x1B, 0x08, 0x0A, 0x87,
+  0xA6, 0x1F, 0x1F, 0x16, 0x16, 0x6C, 0x02, 0x4F, 0x1C, 0x02, 0x80, 0x2C, 0xC0, 0xC7, 0x74, 0xC0,
+  0x87, 0x1A, 0x80, 0x14, 0x06, 0x13, 0x82, 0x48, 0x77, 0x55, 0x0E, 0x05, 0x0E, 0x04, 0x10, 0x01,
+  0x01, 0x17, 0x82, 0x06, 0x17, 0x17, 0x05, 0x0E, 0x07, 0x06, 0x11, 0x03, 0x06, 0x09, 0x80, 0x0B,
+  0x06, 0x12, 0x02, 0x0B, 0x80, 0x21, 0x11, 0x00, 0x82, 0x47, 0x21, 0x8A, 0xC0, 0xF7, 0x96, 0x16,
+  0x08, 0x88, 0x58, 0x91, 0x20, 0x20, 0x38, 0x56, 0x55, 0x1A, 0x1A, 0x08, 0x07, 0x81, 0x3F, 0xB1,
+  0x05, 0x15, 0x82, 0x33, 0x40, 0x35, 0xC0, 0xA9, 0x74, 0xC0, 0xCB, 0xCE, 0x80, 0x1B, 0x08, 0x0A,
+  0x82, 0x62, 0x16, 0x1F, 0x02, 0x16, 0x81, 0x02, 0x4F, 0x1C, 0x02, 0x81, 0x2C, 0x74, 0xC0, 0x27,
+  0x33, 0x80, 0x7B, 0x07, 0x13, 0x81, 0xA5, 0x24, 0x0E, 0x05, 0x0E, 0x04, 0x10, 0x01, 0x01, 0x17,
+  0x82, 0x06, 0x17, 0x17, 0x05, 0x0E, 0x07, 0x06, 0x11, 0x03, 0x06, 0x09, 0x80, 0x0B, 0x06, 0x12,
+  0x02, 0x0B, 0x80, 0x21, 0x11, 0x00, 0x83, 0x47, 0x21, 0x9E, 0x49, 0x16, 0x08, 0x84, 0xA2, 0x7C,
+  0x20, 0x20, 0x56, 0xC0, 0x8F, 0x34, 0x81, 0xC2, 0x1A, 0x09, 0x07, 0x81, 0xA7, 0x6F, 0x05, 0x15,
+  0x82, 0x33, 0x40, 0x13, 0xC0, 0x2A, 0x8D, 0x81, 0x72, 0x1B, 0x08, 0x0A, 0x82, 0x62, 0x1F, 0x1F,
+  0x02, 0x16, 0x81, 0x02, 0x4F, 0x1C, 0x02, 0x81, 0x50, 0x39, 0xC0, 0xC6, 0x4B, 0x80, 0x2A, 0x07,
+  0x13, 0x81, 0xC7, 0x45, 0x0E, 0x05, 0x0E, 0x04, 0x10, 0x01, 0x01, 0x17, 0x82, 0x06, 0x17, 0x17,
+  0x05, 0x0E, 0x07, 0x06, 0x11, 0x03, 0x06, 0x09, 0x80, 0x0B, 0x06, 0x12, 0x02, 0x0B, 0x80, 0x21,
+  0x11, 0x00, 0x82, 0x47, 0x21, 0x8E, 0x17, 0x08, 0x86, 0xFA, 0x83, 0x20, 0x56, 0x10, 0x55, 0x1A,
+  0x0A, 0x07, 0x81, 0x70, 0x6F, 0x06, 0x15, 0x80, 0x5F, 0xC0, 0x69, 0x1A, 0xC0, 0xAA, 0x9D, 0x80,
+  0xBB, 0x09, 0x0A, 0x82, 0x62, 0x1F, 0x1F, 0x02, 0x16, 0x81, 0x71, 0x4F, 0x1C, 0x02, 0x81, 0x50,
+  0x02, 0xC0, 0x46, 0x64, 0x80, 0xB3, 0x07, 0x13, 0x81, 0x6E, 0x1A, 0x0E, 0x05, 0x0E, 0x04, 0x10,
+  0x01, 0x01, 0x17, 0x82, 0x06, 0x17, 0x17, 0x05, 0x0E, 0x07, 0x06, 0x11, 0x03, 0x06, 0x09, 0x80,
+  0x0B, 0x06, 0x12, 0x02, 0x0B, 0x80, 0x21, 0x11, 0x00, 0x82, 0x47, 0x12, 0x8E, 0x17, 0x08, 0xC0,
+  0x75, 0x76, 0x85, 0x53, 0x20, 0x56, 0x56, 0x45, 0x1A, 0x09, 0x07, 0x81, 0x3F, 0xB1, 0x07, 0x15,
+  0x80, 0x29, 0xC0, 0xC9, 0x2A, 0xC0, 0x0B, 0xAE, 0x80, 0xBB, 0x09, 0x0A, 0x82, 0x9B, 0x16, 0x1F,
+  0x02, 0x16, 0x81, 0xA3, 0x27, 0x1D, 0x02, 0x81, 0x2C, 0xC8, 0xC0, 0xA7, 0x22, 0x07, 0x13, 0x82,
+  0x48, 0xC0, 0x24, 0x0D, 0x05, 0x0E, 0x04, 0x10, 0x01, 0x01, 0x17, 0x82, 0x06, 0x17, 0x17, 0x05,
+  0x0E, 0x07, 0x06, 0x11, 0x03, 0x06, 0x09, 0x80, 0x0B, 0x06, 0x12, 0x02, 0x0B, 0x80, 0x21, 0x11,
+  0x00, 0x82, 0x47, 0x12, 0x9A, 0x17, 0x08, 0xC0, 0x55, 0x76, 0x82, 0x53, 0x20, 0x10, 0xC0, 0x90,
+  0x3C, 0x81, 0x4A, 0x1A, 0x09, 0x07, 0x80, 0x66, 0xC0, 0x6A, 0x02, 0x07, 0x15, 0x80, 0x29, 0xC0,
+  0x29, 0x3B, 0xC0, 0x4C, 0xB6, 0x80, 0x4C, 0x08, 0x0A, 0x81, 0x46, 0x9B, 0x04, 0x16, 0x82, 0x6C,
+  0x27, 0x27, 0x1C, 0x02, 0x81, 0x2C, 0x4F, 0xC0, 0x27, 0x3B, 0x07, 0x13, 0x83, 0x7B, 0xA5, 0x45,
+  0x24, 0x0C, 0x05, 0x0E, 0x04, 0x10, 0x01, 0x01, 0x17, 0x02, 0x06, 0x05, 0x0E, 0x07, 0x06, 0x11,
+  0x03, 0x06, 0x09, 0x80, 0x0B, 0x06, 0x12, 0x02, 0x0B, 0x80, 0x21, 0x11, 0x00, 0x82, 0x47, 0x12,
+  0x9A, 0x17, 0x08, 0xC0, 0x14, 0x6E, 0x82, 0x10, 0x20, 0x10, 0xC0, 0x6F, 0x34, 0x81, 0x92, 0x1A,
+  0x09, 0x07, 0x81, 0x70, 0x6F, 0x06, 0x15, 0x81, 0x40, 0x13, 0xC0, 0xA8, 0x4B, 0xC0, 0x8B, 0xBE,
+  0x80, 0x1B, 0x08, 0x0A, 0x81, 0x5A, 0x34, 0x04, 0x16, 0x82, 0xB9, 0x50, 0x27, 0x1C, 0x02, 0x81,
+  0x2C, 0x27, 0xC0, 0xC7, 0x53, 0x81, 0x37, 0x13, 0x02, 0x14, 0x03, 0x13, 0x81, 0x59, 0x4A, 0x0D,
+  0x05, 0x0E, 0x04, 0x10, 0x01, 0x01, 0x17, 0x02, 0x06, 0x05, 0x0E, 0x07, 0x06, 0x11, 0x03, 0x06,
+  0x09, 0x80, 0x0B, 0x06, 0x12, 0x02, 0x0B, 0x80, 0x21, 0x11, 0x00, 0x81, 0x47, 0x21, 0xC0, 0x57,
+  0xAF, 0x17, 0x08, 0x86, 0x80, 0x20, 0x20, 0x10, 0x55, 0x1A, 0x1A, 0x08, 0x07, 0x81, 0x2E, 0x7A,
+  0x07, 0x15, 0x81, 0x40, 0x13, 0xC0, 0x68, 0x6C, 0xC0, 0x8B, 0xC6, 0x80, 0x1B, 0x08, 0x0A, 0x81,
+  0x5A, 0x34, 0x04, 0x16, 0x82, 0xB9, 0x50, 0x27, 0x1E, 0x02, 0xC0, 0x67, 0x6C, 0xC0, 0x27, 0x1A,
+  0x80, 0x13, 0x03, 0x14, 0x01, 0x13, 0x82, 0x35, 0x68, 0x2E, 0x0D, 0x05, 0x0E, 0x04, 0x10, 0x01,
+  0x01, 0x17, 0x02, 0x06, 0x05, 0x0E, 0x07, 0x06, 0x11, 0x03, 0x06, 0x09, 0x80, 0x0B, 0x06, 0x12,
+  0x02, 0x0B, 0x80, 0x21, 0x11, 0x00, 0x82, 0x47, 0x21, 0xBC, 0x17, 0x08, 0x86, 0xC3, 0x20, 0x20,
+  0x56, 0x4A, 0x1A, 0x1A, 0x08, 0x07, 0x81, 0x66, 0x6F, 0x07, 0x15, 0x81, 0xFD, 0x13, 0xC0, 0x09,
+  0x85, 0x81, 0x8D, 0x1B, 0x08, 0x0A, 0x81, 0x5A, 0x34, 0x05, 0x16, 0x81, 0x50, 0x27, 0x1C, 0x02,
+  0x01, 0x2C, 0x82, 0xFC, 0xEF, 0x13, 0x03, 0x14, 0x02, 0x13, 0x81, 0x14, 0xC0, 0x0D, 0x05, 0x0E,
+  0x04, 0x10, 0x01, 0x01, 0x17, 0x02, 0x06, 0x05, 0x0E, 0x07, 0x06, 0x11, 0x03, 0x06, 0x09, 0x80,
+  0x0B, 0x06, 0x12, 0x02, 0x0B, 0x80, 0x21, 0x11, 0x00, 0x81, 0x47, 0x21, 0xC0, 0x77, 0xC7, 0x81,
+  0x69, 0x36, 0x14, 0x08, 0x80, 0x49, 0xC0, 0x93, 0x5D, 0x81, 0x38, 0x20, 0xC0, 0x8F, 0x34, 0x81,
+  0x92, 0x1A, 0x09, 0x07, 0x80, 0x7F, 0x08, 0x15, 0x81, 0xA4, 0xD2, 0xC0, 0x89, 0x9D, 0x01, 0x1B,
+  0x08, 0x0A, 0x83, 0x5A, 0x34, 0x16, 0x1F, 0x03, 0x16, 0x82, 0x02, 0x50, 0x27, 0x1C, 0x02, 0x81,
+  0x50, 0xD1, 0xC0, 0x48, 0x3B, 0x80, 0x37, 0x03, 0x14, 0x02, 0x13, 0x82, 0x3E, 0x82, 0x24, 0x0C,
+  0x05, 0x0E, 0x04, 0x10, 0x01, 0x01, 0x17, 0x02, 0x06, 0x05, 0x0E, 0x07, 0x06, 0x11, 0x03, 0x06,
+  0x09, 0x80, 0x0B, 0x06, 0x12, 0x02, 0x0B, 0x80, 0x21, 0x13, 0x00, 0x82, 0x5B, 0x69, 0x36, 0x14,
+  0x08, 0x84, 0x58, 0x9C, 0x56, 0x56, 0x99, 0x02, 0x1A, 0x07, 0x07, 0x81, 0x3F, 0xE1, 0x07, 0x15,
+  0x01, 0x29, 0xC0, 0xC9, 0x2A, 0xC0, 0x0A, 0xAE, 0x80, 0x1B, 0x09, 0x0A, 0x83, 0x5A, 0x34, 0x16,
+  0x1F, 0x03, 0x16, 0x83, 0xA3, 0x50, 0x27, 0x27, 0x1B, 0x02, 0x81, 0x2C, 0x02, 0xC0, 0x07, 0x5C,
+  0x82, 0xCC, 0x13, 0x14, 0x05, 0x13, 0x81, 0x68, 0x92, 0x0C, 0x05, 0x0E, 0x04, 0x10, 0x01, 0x01,
+  0x17, 0x02, 0x06, 0x05, 0x0E, 0x07, 0x06, 0x11, 0x03, 0x06, 0x09, 0x80, 0x0B, 0x06, 0x12, 0x02,
+  0x0B, 0x80, 0x21, 0x14, 0x00, 0x81, 0x9A, 0x36, 0x14, 0x08, 0x80, 0x58, 0xC0, 0x93, 0x5D, 0x80,
+  0x56, 0xC0, 0xAF, 0x34, 0x82, 0x4A, 0x1A, 0x1A, 0x08, 0x07, 0x82, 0x66, 0x7A, 0x33, 0x06, 0x15,
+  0x81, 0x29, 0x13, 0xC0, 0x69, 0x43, 0xC0, 0x4B, 0xBE, 0x80, 0x1B, 0x09, 0x0A, 0x82, 0x5A, 0x34,
+  0x16, 0x03, 0x1F, 0x84, 0x16, 0xA3, 0x02, 0x27, 0x27, 0x1B, 0x02, 0x82, 0x2C, 0x02, 0xDA, 0xC0,
+  0x66, 0x1A, 0x81, 0x13, 0x35, 0x05, 0x13, 0x81, 0x48, 0x84, 0xC0, 0x4E, 0x24, 0x0B, 0x05, 0x0E,
+  0x04, 0x10, 0x01, 0x01, 0x17, 0x02, 0x06, 0x05, 0x0E, 0x07, 0x06, 0x11, 0x03, 0x06, 0x09, 0x80,
+  0x0B, 0x06, 0x12, 0x02, 0x0B, 0x80, 0x21, 0x12, 0x00, 0x82, 0x47, 0x00, 0x9E, 0x15, 0x08, 0x82,
+  0x49, 0xFB, 0x56, 0xC0, 0x6F, 0x34, 0x82, 0x92, 0x1A, 0x1A, 0x08, 0x07, 0x80, 0xA7, 0xC0, 0x49,
+  0x0A, 0x80, 0x33, 0x05, 0x15, 0x82, 0x33, 0x29, 0xD6, 0xC0, 0x29, 0x64, 0xC0, 0x6B, 0xC6, 0x01,
+  0x1B, 0x08, 0x0A, 0x82, 0x5A, 0x34, 0x16, 0x04, 0x1F, 0x83, 0xF9, 0x02, 0x27, 0x27, 0x1B, 0x02,
+  0x01, 0x2C, 0x80, 0x74, 0xC0, 0x08, 0x33, 0x80, 0x3E, 0x06, 0x13, 0x81, 0x7B, 0xBF, 0xC0, 0x4E,
+  0x24, 0x0B, 0x05, 0x0E, 0x04, 0x10, 0x01, 0x01, 0x17, 0x02, 0x06, 0x05, 0x0E, 0x07, 0x06, 0x11,
+  0x03, 0x06, 0x09, 0x80, 0x0B, 0x06, 0x12, 0x02, 0x0B, 0x80, 0x21, 0x12, 0x00, 0x83, 0x47, 0x18,
+  0xD9, 0x69, 0x14, 0x08, 0x85, 0x49, 0xFB, 0x56, 0x55, 0x1A, 0x1A, 0x09, 0x07, 0x82, 0x70, 0x15,
+  0x33, 0x05, 0x15, 0x82, 0x33, 0x2B, 0xB3, 0xC0, 0xE9, 0x84, 0x82, 0x0A, 0x1B, 0x1B, 0x08, 0x0A,
+  0x82, 0x5A, 0x34, 0x16, 0x03, 0x1F, 0x85, 0x16, 0xF9, 0x02, 0x02, 0x27, 0x27, 0x1A, 0x02, 0x01,
+  0x2C, 0x80, 0x02, 0xC0, 0xE8, 0x53, 0x82, 0x2A, 0x13, 0x35, 0x04, 0x13, 0x82, 0x3E, 0xF6, 0x24,
+  0x0B, 0x05, 0x0E, 0x04, 0x10, 0x01, 0x01, 0x17, 0x02, 0x06, 0x05, 0x0E, 0x07, 0x06, 0x11, 0x03,
+  0x07, 0x09, 0x01, 0x1E, 0x01, 0x12, 0x05, 0x0B, 0x80, 0x21, 0x11, 0x00, 0x01, 0x47, 0x82, 0x18,
+  0x5B, 0x73, 0x14, 0x08, 0x81, 0x49, 0xFB, 0xC0, 0x90, 0x3C, 0xC0, 0xEE, 0x23, 0x0A, 0x07, 0x82,
+  0x3F, 0x7A, 0x33, 0x05, 0x15, 0x01, 0x29, 0x81, 0x2B, 0xEF, 0xC0, 0xC9, 0xA5, 0x81, 0x4C, 0x1B,
+  0x09, 0x0A, 0x82, 0x5A, 0x34, 0x16, 0x04, 0x1F, 0x80, 0x16, 0xC0, 0x26, 0x95, 0x80, 0x02, 0x02,
+  0x27, 0x1A, 0x02, 0x85, 0x2C, 0x02, 0xDA, 0xC5, 0x35, 0x35, 0x05, 0x13, 0x81, 0x59, 0x98, 0x0B,
+  0x05, 0x0E, 0x04, 0x10, 0x01, 0x01, 0x17, 0x02, 0x06, 0x05, 0x0E, 0x07, 0x06, 0x11, 0x03, 0x07,
+  0x09, 0x01, 0x1E, 0x01, 0x12, 0x05, 0x0B, 0x80, 0x21, 0x11, 0x00, 0x01, 0x47, 0x81, 0x18, 0x0B,
+  0xC0, 0x16, 0x9F, 0x80, 0x36, 0x13, 0x08, 0x80, 0x49, 0xC0, 0xB2, 0x5D, 0xC0, 0x6F, 0x34, 0x80,
+  0x6D, 0x0A, 0x07, 0x80, 0x66, 0xC0, 0x4A, 0x0A, 0x80, 0x33, 0x04, 0x15, 0x83, 0x2B, 0x29, 0x2B,
+  0x13, 0xC0, 0x28, 0x3B, 0xC0, 0x4A, 0xB6, 0x01, 0x1B, 0x09, 0x0A, 0x82, 0x5A, 0x34, 0x16, 0x04,
+  0x1F, 0x81, 0x16, 0xA3, 0x03, 0x27, 0x1C, 0x02, 0x80, 0xEE, 0xC0, 0x07, 0x33, 0x01, 0x35, 0x05,
+  0x13, 0x81, 0x14, 0xCA, 0x0B, 0x05, 0x0E, 0x04, 0x10, 0x01, 0x01, 0x17, 0x02, 0x06, 0x05, 0x0E,
+  0x07, 0x06, 0x11, 0x03, 0x07, 0x09, 0x01, 0x1E, 0x01, 0x12, 0x05, 0x0B, 0x80, 0x21, 0x13, 0x00,
+  0x82, 0x47, 0x00, 0x9A, 0x14, 0x08, 0x80, 0x49, 0xC0, 0xB3, 0x65, 0xC0, 0x2F, 0x34, 0x0A, 0x07,
+  0x81, 0x3F, 0x70, 0x06, 0x15, 0x83, 0x2B, 0x29, 0x40, 0x37, 0xC0, 0x08, 0x5C, 0xC0, 0x8B, 0xC6,
+  0x80, 0x1B, 0x0A, 0x0A, 0x82, 0x5A, 0x34, 0x16, 0x03, 0x1F, 0x82, 0x16, 0x1F, 0xA3, 0x02, 0x27,
+  0x1C, 0x02, 0x81, 0x50, 0x02, 0xC0, 0xE8, 0x53, 0xC0, 0x06, 0x0A, 0x81, 0x13, 0x35, 0x04, 0x13,
+  0x81, 0x14, 0xC0, 0x0B, 0x05, 0x0E, 0x04, 0x10, 0x01, 0x01, 0x17, 0x02, 0x06, 0x05, 0x0E, 0x07,
+  0x06, 0x11, 0x03, 0x07, 0x09, 0x01, 0x1E, 0x01, 0x12, 0x05, 0x0B, 0x80, 0x21, 0x13, 0x00, 0x83,
+  0x47, 0x00, 0xBC, 0x93, 0x13, 0x08, 0x80, 0x49, 0xC0, 0xD3, 0x65, 0x80, 0x99, 0x0A, 0x07, 0x81,
+  0x2E, 0x7A, 0x06, 0x15, 0x83, 0x2B, 0x29, 0x40, 0xB3, 0xC0, 0x09, 0x85, 0x81, 0x72, 0x46, 0x0A,
+  0x0A, 0x82, 0x5A, 0x34, 0x16, 0x03, 0x1F, 0x82, 0x16, 0x34, 0xA3, 0xC0, 0x05, 0x85, 0x01, 0x27,
+  0x1E, 0x02, 0x83, 0xDA, 0xC5, 0x35, 0x35, 0x04, 0x13, 0x82, 0x14, 0xA5, 0x24, 0x0A, 0x05, 0x0E,
+  0x04, 0x10, 0x01, 0x01, 0x17, 0x02, 0x06, 0x05, 0x0E, 0x07, 0x06, 0x11, 0x03, 0x07, 0x09, 0x01,
+  0x1E, 0x01, 0x12, 0x05, 0x0B, 0x80, 0x21, 0x12, 0x00, 0x01, 0x47, 0x80, 0x42, 0xC0, 0x77, 0xCF,
+  0x81, 0xA0, 0x36, 0x12, 0x08, 0x80, 0x49, 0xC0, 0xD3, 0x65, 0x80, 0x4A, 0x0A, 0x07, 0x80, 0x66,
+  0xC0, 0x49, 0x0A, 0x80, 0x33, 0x05, 0x15, 0x01, 0x29, 0x80, 0xA4, 0xC0, 0x47, 0x1A, 0xC0, 0xA9,
+  0xA5, 0x81, 0x54, 0x1B, 0x0A, 0x0A, 0x82, 0x5A, 0x34, 0x16, 0x03, 0x1F, 0x82, 0x16, 0x34, 0x50,
+  0xC0, 0xE5, 0x84, 0x81, 0x02, 0x27, 0x1E, 0x02, 0x80, 0x74, 0xC0, 0xE7, 0x32, 0x07, 0x13, 0x81,
+  0xC7, 0x45, 0x0A, 0x05, 0x0E, 0x04, 0x10, 0x01, 0x01, 0x17, 0x02, 0x06, 0x05, 0x0E, 0x07, 0x06,
+  0x11, 0x03, 0x07, 0x09, 0x01, 0x1E, 0x01, 0x12, 0x05, 0x0B, 0x80, 0x21, 0x12, 0x00, 0x01, 0x47,
+  0x83, 0x18, 0x12, 0xB6, 0x36, 0x13, 0x08, 0xC0, 0xB3, 0x65, 0x80, 0xC2, 0x03, 0x07, 0x03, 0x1A,
+  0x02, 0x07, 0x82, 0x70, 0x15, 0x33, 0x03, 0x15, 0x80, 0x33, 0x02, 0x29, 0x80, 0xA4, 0xC0, 0xA9,
+  0x2A, 0xC0, 0x2A, 0xB6, 0x80, 0x1B, 0x0B, 0x0A, 0x82, 0x5A, 0x34, 0x16, 0x03, 0x1F, 0x81, 0x16,
+  0x9B, 0xC0, 0xA4, 0x74, 0xC0, 0xA5, 0x6C, 0x82, 0x71, 0x27, 0x27, 0x1C, 0x02, 0x81, 0x27, 0x02,
+  0xC0, 0xC7, 0x53, 0x80, 0x37, 0x06, 0x13, 0x81, 0x6E, 0x92, 0x0A, 0x05, 0x0E, 0x04, 0x10, 0x01,
+  0x01, 0x17, 0x02, 0x06, 0x05, 0x0E, 0x07, 0x06, 0x11, 0x03, 0x07, 0x09, 0x01, 0x1E, 0x01, 0x12,
+  0x05, 0x0B, 0x80, 0x21, 0x12, 0x00, 0x01, 0x47, 0x82, 0x25, 0x42, 0x9E, 0x14, 0x08, 0x81, 0xFB,
+  0x6D, 0x03, 0x07, 0x03, 0x1A, 0x01, 0x07, 0x81, 0x3F, 0x7A, 0x05, 0x15, 0x80, 0x33, 0x02, 0x29,
+  0xC0, 0xE9, 0x01, 0xC0, 0x29, 0x3B, 0x81, 0xAB, 0x1B, 0x0B, 0x0A, 0x82, 0x5A, 0x34, 0x16, 0x03,
+  0x1F, 0x86, 0x16, 0x1F, 0xE3, 0x23, 0x71, 0x27, 0x27, 0x1E, 0x02, 0xC0, 0x88, 0x6C, 0x80, 0xC5,
+  0x06, 0x13, 0x80, 0x14, 0xC0, 0x2B, 0x13, 0x80, 0x24, 0x09, 0x05, 0x0E, 0x04, 0x10, 0x01, 0x01,
+  0x17, 0x02, 0x06, 0x05, 0x0E, 0x07, 0x06, 0x11, 0x03, 0x07, 0x09, 0x01, 0x1E, 0x01, 0x12, 0x05,
+  0x0B, 0x80, 0x21, 0x13, 0x00, 0x84, 0x47, 0x25, 0x42, 0xCF, 0x69, 0x13, 0x08, 0xC0, 0xF1, 0x4C,
+  0x80, 0x2E, 0x07, 0x1A, 0x01, 0x07, 0x80, 0x66, 0xC0, 0x49, 0x0A, 0x80, 0x33, 0x04, 0x15, 0x83,
+  0x33, 0x29, 0x29, 0x5F, 0xC0, 0xC8, 0x01, 0xC0, 0xAA, 0x53, 0x81, 0x0A, 0x1B, 0x0B, 0x0A, 0x82,
+  0x5A, 0x34, 0x16, 0x04, 0x1F, 0x80, 0x16, 0xC0, 0x24, 0x5C, 0xC0, 0x24, 0x54, 0x80, 0x39, 0x1E,
+  0x02, 0x82, 0x27, 0x02, 0x74, 0xC0, 0xC6, 0x2A, 0x80, 0x3E, 0x05, 0x13, 0x82, 0x14, 0xF6, 0x45,
+  0x09, 0x05, 0x0E, 0x04, 0x10, 0x01, 0x01, 0x17, 0x02, 0x06, 0x05, 0x0E, 0x07, 0x06, 0x11, 0x03,
+  0x07, 0x09, 0x01, 0x1E, 0x01, 0x12, 0x05, 0x0B, 0x80, 0x21, 0x13, 0x00, 0x84, 0x47, 0x25, 0x25,
+  0x0B, 0xB6, 0x12, 0x08, 0xC0, 0xD6, 0x86, 0x81, 0xEB, 0x2E, 0x07, 0x1A, 0x01, 0x07, 0x82, 0x70,
+  0x33, 0x33, 0x04, 0x15, 0x83, 0x33, 0x29, 0x29, 0x5F, 0xC0, 0xC8, 0x01, 0xC0, 0x2A, 0x64, 0x81,
+  0x8D, 0x46, 0x0B, 0x0A, 0x87, 0x5A, 0x34, 0x16, 0x1F, 0x1F, 0x16, 0x16, 0x1F, 0xC0, 0x67, 0x8D,
+  0x01, 0x9D, 0x81, 0x4F, 0x02, 0x02, 0x27, 0x1A, 0x02, 0x01, 0x27, 0x80, 0x71, 0xC0, 0x87, 0x4B,
+  0x80, 0xED, 0x05, 0x13, 0x82, 0x3E, 0x59, 0x98, 0x09, 0x05, 0x0E, 0x04, 0x10, 0x01, 0x01, 0x17,
+  0x02, 0x06, 0x05, 0x0E, 0x07, 0x06, 0x11, 0x03, 0x07, 0x09, 0x01, 0x1E, 0x01, 0x12, 0x05, 0x0B,
+  0x80, 0x21, 0x14, 0x00, 0x83, 0x47, 0x25, 0x21, 0xBC, 0x12, 0x08, 0xC0, 0x34, 0x6E, 0x80, 0x8B,
+  0x08, 0x1A, 0x01, 0x07, 0x82, 0xB1, 0x15, 0x33, 0x04, 0x15, 0x01, 0x33, 0x82, 0x29, 0x5F, 0xED,
+  0xC0, 0x8A, 0x6C, 0xC0, 0xAB, 0xC6, 0x80, 0x46, 0x0B, 0x0A, 0x83, 0x5C, 0x34, 0x16, 0x1F, 0x02,
+  0x16, 0x84, 0x1F, 0xAD, 0x89, 0x89, 0xC8, 0x05, 0x27, 0x18, 0x02, 0x01, 0x27, 0x80, 0x02, 0xC0,
+  0x48, 0x64, 0xC0, 0x05, 0x0A, 0x01, 0x13, 0x80, 0x37, 0x02, 0x13, 0x83, 0x35, 0x14, 0xCA, 0x76,
+  0x02, 0x05, 0x80, 0x24, 0x04, 0x05, 0x0E, 0x04, 0x10, 0x01, 0x01, 0x17, 0x82, 0x06, 0x17, 0x06,
+  0x05, 0x0E, 0x07, 0x06, 0x11, 0x03, 0x07, 0x09, 0x01, 0x1E, 0x01, 0x12, 0x05, 0x0B, 0x80, 0x21,
+  0x16, 0x00, 0x82, 0x21, 0xCF, 0x69, 0x11, 0x08, 0xC0, 0x51, 0x55, 0xC0, 0x6B, 0x13, 0x08, 0x1A,
+  0x81, 0x07, 0xF4, 0xC0, 0x69, 0x02, 0x08, 0x15, 0x82, 0x29, 0x5F, 0x2A, 0xC0, 0xEA, 0x7C, 0xC0,
+  0xAB, 0xCE, 0x80, 0x46, 0x0B, 0x0A, 0x8A, 0x5C, 0x34, 0x16, 0x1F, 0x16, 0x3A, 0x16, 0x34, 0xCD,
+  0x0C, 0x0C, 0xC0, 0x86, 0x6C, 0x80, 0x02, 0x04, 0x27, 0x16, 0x02, 0x03, 0x27, 0x80, 0x2C, 0xC0,
+  0xA7, 0x7C, 0xC0, 0x85, 0x22, 0x82, 0x35, 0x13, 0x37, 0x03, 0x13, 0x82, 0x3E, 0xBF, 0x55, 0x02,
+  0x05, 0x80, 0x24, 0x04, 0x05, 0x0E, 0x04, 0x10, 0x01, 0x01, 0x17, 0x82, 0x06, 0x17, 0x06, 0x05,
+  0x0E, 0x07, 0x06, 0x11, 0x03, 0x07, 0x09, 0x01, 0x1E, 0x01, 0x12, 0x05, 0x0B, 0x80, 0x21, 0x16,
+  0x00, 0xC0, 0x97, 0xE7, 0x81, 0x5B, 0xB6, 0x10, 0x08, 0x82, 0xD8, 0x57, 0x2E, 0x08, 0x1A, 0x81,
+  0x07, 0xEA, 0x09, 0x15, 0x81, 0x29, 0x5F, 0xC0, 0x08, 0x12, 0xC0, 0x4A, 0x8D, 0x81, 0x72, 0x1B,
+  0x0B, 0x0A, 0xC0, 0x29, 0xBE, 0x01, 0x16, 0x88, 0x1F, 0x16, 0x3A, 0x3A, 0x16, 0x23, 0x0C, 0x0C,
+  0x95, 0x05, 0x27, 0x18, 0x02, 0x01, 0x27, 0x81, 0x50, 0x4F, 0xC0, 0x06, 0x3B, 0xC0, 0xC8, 0x09,
+  0x05, 0x13, 0x81, 0x3E, 0x82, 0xC0, 0xEE, 0x2B, 0x02, 0x76, 0x80, 0x24, 0x04, 0x05, 0x0E, 0x04,
+  0x10, 0x01, 0x01, 0x17, 0x82, 0x06, 0x17, 0x17, 0x05, 0x0E, 0x07, 0x06, 0x11, 0x03, 0x07, 0x09,
+  0x01, 0x1E, 0x01, 0x12, 0x05, 0x0B, 0x80, 0x21, 0x16, 0x00, 0xC0, 0x97, 0xE7, 0x81, 0x00, 0x8A,
+  0x0F, 0x08, 0x80, 0x7D, 0xC0, 0x34, 0x6E, 0x0A, 0x1A, 0x80, 0x07, 0xC0, 0xCB, 0x0A, 0x09, 0x15,
+  0x81, 0x29, 0xA4, 0xC0, 0x48, 0x1A, 0xC0, 0x8A, 0x9D, 0x81, 0x72, 0x1B, 0x0B, 0x0A, 0x8D, 0xE7,
+  0x16, 0x1F, 0x1F, 0x16, 0x3A, 0x16, 0xE2, 0x95, 0x22, 0x22, 0x9D, 0xEE, 0x02, 0x03, 0x27, 0x18,
+  0x02, 0x01, 0x27, 0x81, 0x50, 0x2C, 0xC0, 0xA7, 0x53, 0x80, 0x35, 0x05, 0x13, 0x82, 0x35, 0x6E,
+  0xC2, 0x02, 0x76, 0x80, 0x24, 0x04, 0x05, 0x0E, 0x04, 0x10, 0x01, 0x01, 0x17, 0x82, 0x06, 0x17,
+  0x17, 0x05, 0x0E, 0x07, 0x06, 0x11, 0x03, 0x07, 0x09, 0x01, 0x1E, 0x01, 0x12, 0x05, 0x0B, 0x80,
+  0x21, 0x16, 0x00, 0x82, 0x25, 0x18, 0x5B, 0xC0, 0x37, 0x9F, 0x80, 0x36, 0x0D, 0x08, 0x80, 0x7D,
+  0xC0, 0xF3, 0x65, 0x82, 0xCA, 0x1A, 0x1A, 0x08, 0x07, 0x80, 0xB1, 0x09, 0x15, 0x81, 0x2B, 0xA4,
+  0xC0, 0x68, 0x22, 0xC0, 0xCA, 0xA5, 0x81, 0x72, 0x1B, 0x0B, 0x0A, 0x86, 0x81, 0x3A, 0x1F, 0x1F,
+  0x16, 0x3A, 0x16, 0xC0, 0x67, 0x8D, 0x81, 0x9D, 0x0C, 0xC0, 0x85, 0x33, 0x84, 0x0C, 0xCE, 0x02,
+  0x50, 0x2C, 0x1A, 0x02, 0x01, 0x27, 0x81, 0x50, 0x2C, 0xC0, 0x48, 0x64, 0xC0, 0x07, 0x12, 0x80,
+  0x35, 0x05, 0x13, 0x85, 0x14, 0x66, 0x55, 0x05, 0x05, 0x24, 0x04, 0x05, 0x0E, 0x04, 0x10, 0x01,
+  0x01, 0x17, 0x82, 0x06, 0x17, 0x17, 0x05, 0x0E, 0x07, 0x06, 0x11, 0x03, 0x07, 0x09, 0x01, 0x1E,
+  0x01, 0x12, 0x05, 0x0B, 0x80, 0x21, 0x16, 0x00, 0x83, 0x47, 0x25, 0x00, 0x8E, 0x0E, 0x08, 0xC0,
+  0x57, 0x8F, 0xC0, 0xF3, 0x65, 0xC0, 0x6B, 0x13, 0x01, 0x1A, 0x07, 0x07, 0x80, 0x3F, 0xC0, 0x6A,
+  0x0A, 0x09, 0x15, 0x80, 0x33, 0xC0, 0xEA, 0x01, 0xC0, 0x88, 0x22, 0xC0, 0x0A, 0xAE, 0x81, 0x54,
+  0x1B, 0x0A, 0x0A, 0x87, 0x4D, 0x62, 0x3A, 0x1F, 0x1F, 0x16, 0x3A, 0x34, 0xC0, 0x47, 0x85, 0x80,
+  0x89, 0x02, 0x0C, 0x83, 0xEC, 0x27, 0x50, 0x2C, 0x1A, 0x02, 0x02, 0x27, 0x80, 0x02, 0xC0, 0xA8,
+  0x74, 0xC0, 0x66, 0x1A, 0x80, 0x3E, 0x05, 0x13, 0x85, 0x3E, 0x8F, 0x55, 0x05, 0x05, 0x24, 0x04,
+  0x05, 0x0E, 0x04, 0x10, 0x01, 0x01, 0x17, 0x82, 0x06, 0x17, 0x17, 0x05, 0x0E, 0x07, 0x06, 0x11,
+  0x03, 0x07, 0x09, 0x01, 0x1E, 0x01, 0x12, 0x05, 0x0B, 0x80, 0x21, 0x16, 0x00, 0x01, 0x25, 0x80,
+  0x18, 0xC0, 0x58, 0xCF, 0x80, 0x69, 0x0D, 0x08, 0xC0, 0x57, 0x8F, 0xC0, 0xF3, 0x65, 0xC0, 0x6B,
+  0x13, 0x01, 0x1A, 0x07, 0x07, 0x81, 0xF4, 0x6F, 0x08, 0x15, 0x81, 0x33, 0x29, 0xC0, 0xEA, 0x01,
+  0xC0, 0xA8, 0x2A, 0xC0, 0x2A, 0xB6, 0x82, 0x4C, 0x1B, 0x1B, 0x09, 0x0A, 0x87, 0x4D, 0xC6, 0x3A,
+  0x1F, 0x1F, 0x16, 0x3A, 0x34, 0xC0, 0x07, 0x7D, 0x02, 0x0C, 0x84, 0x43, 0xF2, 0xEE, 0x2C, 0x2C,
+  0x1A, 0x02, 0x03, 0x27, 0x80, 0x74, 0xC0, 0xE6, 0x2A, 0x80, 0x3E, 0x05, 0x13, 0x82, 0x3E, 0x82,
+  0x99, 0x07, 0x05, 0x0E, 0x04, 0x10, 0x01, 0x01, 0x17, 0x82, 0x06, 0x17, 0x17, 0x05, 0x0E, 0x07,
+  0x06, 0x11, 0x03, 0x07, 0x09, 0x01, 0x1E, 0x01, 0x12, 0x05, 0x0B, 0x80, 0x21, 0x16, 0x00, 0x83,
+  0x32, 0x25, 0x25, 0x0B, 0xC0, 0x17, 0xAF, 0x0D, 0x08, 0xC0, 0x58, 0x8F, 0xC0, 0xB2, 0x5D, 0xC0,
+  0x6B, 0x13, 0x01, 0x1A, 0x07, 0x07, 0x80, 0x7F, 0x09, 0x15, 0x01, 0x29, 0x80, 0x5F, 0xC0, 0x09,
+  0x33, 0xC0, 0x4A, 0xBE, 0x80, 0x4C, 0x0B, 0x0A, 0x87, 0x4D, 0x9B, 0x3A, 0x1F, 0x1F, 0x16, 0x3A,
+  0x16, 0xC0, 0xA6, 0x6C, 0x80, 0x22, 0x02, 0x0C, 0x83, 0x89, 0xD0, 0x02, 0x50, 0x1E, 0x02, 0x80,
+  0x4F, 0xC0, 0x66, 0x43, 0x80, 0x2A, 0x04, 0x13, 0x84, 0x35, 0x13, 0x59, 0x4A, 0x76, 0x06, 0x05,
+  0x0E, 0x04, 0x10, 0x01, 0x01, 0x17, 0x82, 0x06, 0x17, 0x17, 0x05, 0x0E, 0x07, 0x06, 0x11, 0x03,
+  0x07, 0x09, 0x01, 0x1E, 0x01, 0x12, 0x05, 0x0B, 0x80, 0x21, 0x16, 0x00, 0x84, 0x32, 0x25, 0x25,
+  0x18, 0xD9, 0x0D, 0x08, 0x82, 0xA9, 0xE6, 0xB7, 0x02, 0x1A, 0x06, 0x07, 0xC0, 0xCB, 0x0A, 0x09,
+  0x15, 0x82, 0x2B, 0x29, 0x29, 0xC0, 0x69, 0x43, 0x81, 0xAB, 0x4C, 0x0B, 0x0A, 0x88, 0x46, 0x34,
+  0x3A, 0x1F, 0x1F, 0x16, 0x63, 0xE2, 0x95, 0x04, 0x0C, 0x82, 0xB2, 0x02, 0x2C, 0x1F, 0x02, 0xC0,
+  0xE7, 0x53, 0x80, 0x37, 0x04, 0x13, 0x84, 0x35, 0x13, 0x68, 0x64, 0x76, 0x06, 0x05, 0x0E, 0x04,
+  0x10, 0x01, 0x01, 0x17, 0x82, 0x06, 0x17, 0x17, 0x05, 0x0E, 0x07, 0x06, 0x0E, 0x03, 0x82, 0x26,
+  0x03, 0x03, 0x07, 0x09, 0x01, 0x1E, 0x01, 0x12, 0x05, 0x0B, 0x80, 0x21, 0x16, 0x00, 0x01, 0x32,
+  0x01, 0x25, 0x80, 0x5B, 0xC0, 0x16, 0x9F, 0x0C, 0x08, 0xC0, 0xB7, 0x86, 0xC0, 0x2E, 0x34, 0x82,
+  0x2E, 0x1A, 0x1A, 0x06, 0x07, 0x80, 0x3F, 0xC0, 0xAB, 0x12, 0x80, 0x33, 0x09, 0x15, 0x01, 0x29,
+  0xC0, 0xC9, 0x53, 0x81, 0x4D, 0x4C, 0x0B, 0x0A, 0x80, 0x5A, 0xC0, 0xA6, 0xA5, 0x86, 0x3A, 0x1F,
+  0x16, 0x16, 0x34, 0xAD, 0x89, 0x04, 0x0C, 0xC0, 0xE4, 0x53, 0x80, 0x4F, 0x20, 0x02, 0xC0, 0x68,
+  0x6C, 0x80, 0xCC, 0x06, 0x13, 0x85, 0x14, 0x84, 0x76, 0x05, 0x24, 0x24, 0x03, 0x05, 0x0E, 0x04,
+  0x10, 0x01, 0x01, 0x17, 0x82, 0x06, 0x17, 0x17, 0x05, 0x0E, 0x07, 0x06, 0x0E, 0x03, 0x82, 0x26,
+  0x03, 0x03, 0x07, 0x09, 0x01, 0x1E, 0x01, 0x12, 0x05, 0x0B, 0x80, 0x21, 0x16, 0x00, 0x01, 0x32,
+  0x01, 0x25, 0x80, 0x00, 0xC0, 0x37, 0xC7, 0x80, 0xA0, 0x0A, 0x08, 0x80, 0xA9, 0xC0, 0x14, 0x6E,
+  0x82, 0x07, 0x1A, 0x1A, 0x07, 0x07, 0x82, 0x3F, 0x7A, 0x33, 0x09, 0x15, 0x01, 0x29, 0xC0, 0x0A,
+  0x64, 0x81, 0x0A, 0x4C, 0x0B, 0x0A, 0x80, 0x5C, 0xC0, 0xA6, 0xA5, 0x86, 0x3A, 0x1F, 0x16, 0x16,
+  0x34, 0xCE, 0x43, 0x04, 0x0C, 0x81, 0x89, 0xD0, 0x20, 0x02, 0xC0, 0xC8, 0x7C, 0x81, 0xBA, 0x35,
+  0x05, 0x13, 0x85, 0x14, 0xF3, 0x76, 0x05, 0x24, 0x24, 0x03, 0x05, 0x0E, 0x04, 0x10, 0x01, 0x01,
+  0x17, 0x82, 0x06, 0x17, 0x17, 0x05, 0x0E, 0x07, 0x06, 0x0E, 0x03, 0x82, 0x26, 0x03, 0x03, 0x07,
+  0x09, 0x01, 0x1E, 0x01, 0x12, 0x05, 0x0B, 0x80, 0x21, 0x16, 0x00, 0xC1, 0x97, 0xE7, 0x02, 0x25,
+  0x81, 0x0B, 0x73, 0x0A, 0x08, 0x80, 0xA9, 0xC0, 0xD3, 0x65, 0x82, 0x2E, 0x07, 0x1A, 0x07, 0x07,
+  0x80, 0x66, 0xC0, 0x4A, 0x0A, 0x80, 0x33, 0x09, 0x15, 0x81, 0x29, 0x13, 0xC0, 0x6A, 0x6C, 0x81,
+  0x54, 0x4C, 0x0B, 0x0A, 0xC0, 0x49, 0xB6, 0x86, 0xBE, 0x3A, 0x1F, 0x16, 0x16, 0x1F, 0x95, 0xC0,
+  0x44, 0x33, 0x05, 0x0C, 0x82, 0xB2, 0x39, 0x2C, 0x1E, 0x02, 0x80, 0x74, 0xC0, 0x06, 0x33, 0x80,
+  0x35, 0x04, 0x13, 0x86, 0x35, 0x14, 0x8F, 0x99, 0x05, 0x24, 0x24, 0x03, 0x05, 0x0E, 0x04, 0x10,
+  0x01, 0x01, 0x17, 0x82, 0x06, 0x17, 0x17, 0x05, 0x0E, 0x07, 0x06, 0x0E, 0x03, 0x82, 0x26, 0x03,
+  0x03, 0x07, 0x09, 0x01, 0x1E, 0x01, 0x12, 0x05, 0x0B, 0x80, 0x21, 0x16, 0x00, 0xC1, 0x97, 0xE7,
+  0x02, 0x25, 0x82, 0x00, 0x8A, 0xA0, 0x09, 0x08, 0x84, 0xA9, 0xC3, 0x1A, 0x07, 0x1A, 0x07, 0x07,
+  0x82, 0xA7, 0x15, 0x33, 0x09, 0x15, 0x80, 0x40, 0xC0, 0x08, 0x12, 0xC0, 0xCA, 0x7C, 0x81, 0x54,
+  0x4C, 0x0B, 0x0A, 0x82, 0x81, 0x3A, 0x3A, 0x02, 0x1F, 0x80, 0x16, 0xC0, 0xE4, 0x53, 0x80, 0x94,
+  0x05, 0x0C, 0x81, 0xF2, 0x78, 0x20, 0x02, 0xC0, 0xA6, 0x4B, 0x80, 0x37, 0x04, 0x13, 0x86, 0x35,
+  0x14, 0x82, 0x24, 0x05, 0x24, 0x24, 0x03, 0x05, 0x0E, 0x04, 0x10, 0x01, 0x01, 0x17, 0x82, 0x06,
+  0x17, 0x17, 0x05, 0x0E, 0x07, 0x06, 0x0E, 0x03, 0x82, 0x26, 0x03, 0x03, 0x07, 0x09, 0x01, 0x1E,
+  0x01, 0x12, 0x05, 0x0B, 0x80, 0x21, 0x16, 0x00, 0x01, 0x32, 0x02, 0x25, 0x81, 0x18, 0x5B, 0xC0,
+  0x37, 0x9F, 0x0A, 0x08, 0xC0, 0x52, 0x55, 0x82, 0x2E, 0x07, 0x1A, 0x07, 0x07, 0x80, 0xEA, 0x0A,
+  0x15, 0x81, 0x33, 0x40, 0xC0, 0x48, 0x1A, 0xC0, 0x6A, 0x95, 0x82, 0x72, 0x4C, 0x1B, 0x07, 0x0A,
+  0x01, 0x1B, 0x83, 0x0A, 0x62, 0x3A, 0x16, 0x02, 0x1F, 0x82, 0xE2, 0x9D, 0x43, 0x05, 0x0C, 0xC0,
+  0xA4, 0x3B, 0x80, 0xD0, 0x1E, 0x02, 0x83, 0x27, 0x02, 0xFE, 0xB3, 0x05, 0x13, 0x85, 0x3E, 0xC1,
+  0x45, 0x05, 0x24, 0x24, 0x03, 0x05, 0x0E, 0x04, 0x10, 0x01, 0x01, 0x17, 0x82, 0x06, 0x17, 0x17,
+  0x05, 0x0E, 0x07, 0x06, 0x0E, 0x03, 0x82, 0x26, 0x03, 0x03, 0x07, 0x09, 0x01, 0x1E, 0x01, 0x12,
+  0x05, 0x0B, 0x80, 0x21, 0x16, 0x00, 0x01, 0x32, 0x03, 0x18, 0x81, 0x00, 0x8A, 0x09, 0x08, 0x80,
+  0x49, 0xC0, 0xD0, 0x44, 0x82, 0x2E, 0x1A, 0x1A, 0x07, 0x07, 0x80, 0x70, 0x0A, 0x15, 0x81, 0x33,
+  0x40, 0xC0, 0x67, 0x22, 0xC0, 0xCA, 0xA5, 0x83, 0x72, 0x4C, 0x1B, 0x1B, 0x06, 0x0A, 0x01, 0x1B,
+  0x82, 0x0A, 0x62, 0x3A, 0x02, 0x1F, 0x80, 0x34, 0xC0, 0x67, 0x8D, 0xC0, 0xA3, 0x4B, 0x80, 0x43,
+  0x04, 0x0C, 0x84, 0xBD, 0x0C, 0x23, 0x39, 0x50, 0x1D, 0x02, 0x81, 0x2C, 0xDA, 0xC0, 0x66, 0x1A,
+  0x80, 0x37, 0x04, 0x13, 0x85, 0x35, 0x59, 0x4A, 0x05, 0x24, 0x24, 0x03, 0x05, 0x0E, 0x04, 0x10,
+  0x01, 0x01, 0x17, 0x82, 0x06, 0x17, 0x17, 0x05, 0x0E, 0x07, 0x06, 0x0E, 0x03, 0x82, 0x26, 0x03,
+  0x03, 0x07, 0x09, 0x01, 0x1E, 0x01, 0x12, 0x05, 0x0B, 0x80, 0x21, 0x16, 0x00, 0x01, 0x32, 0x04,
+  0x18, 0xC0, 0x58, 0xD7, 0x81, 0x73, 0x36, 0x07, 0x08, 0x81, 0xD8, 0xEB, 0x02, 0x1A, 0x07, 0x07,
+  0x80, 0xE1, 0x0A, 0x15, 0x81, 0x33, 0x40, 0xC0, 0xA7, 0x2A, 0x84, 0xC4, 0x72, 0x4C, 0x1B, 0x1B,
+  0x06, 0x0A, 0x01, 0x1B, 0x80, 0x0A, 0xC0, 0xE7, 0xAD, 0x80, 0x3A, 0x02, 0x1F, 0x81, 0x34, 0xAD,
+  0xC0, 0x83, 0x43, 0x05, 0x0C, 0x01, 0xBD, 0xC0, 0x25, 0x54, 0x81, 0x4F, 0x50, 0x1D, 0x02, 0x80,
+  0x2C, 0xC0, 0x07, 0x7D, 0xC0, 0xE6, 0x32, 0x80, 0x2A, 0x05, 0x13, 0x84, 0x68, 0x1A, 0x05, 0x24,
+  0x24, 0x03, 0x05, 0x0E, 0x04, 0x10, 0x01, 0x01, 0x17, 0x82, 0x06, 0x17, 0x17, 0x05, 0x0E, 0x07,
+  0x06, 0x0E, 0x03, 0x82, 0x26, 0x03, 0x03, 0x07, 0x09, 0x01, 0x1E, 0x01, 0x12, 0x05, 0x0B, 0x80,
+  0x21, 0x16, 0x00, 0x01, 0x32, 0x03, 0x18, 0x82, 0x25, 0x00, 0x8E, 0x08, 0x08, 0xC0, 0x76, 0x76,
+  0x80, 0x4A, 0x02, 0x1A, 0x06, 0x07, 0x81, 0x2E, 0x7A, 0x09, 0x15, 0x82, 0x33, 0x15, 0x40, 0xC0,
+  0x08, 0x3B, 0x84, 0x5A, 0x4C, 0x4C, 0x1B, 0x1B, 0x06, 0x0A, 0x01, 0x1B, 0x82, 0x0A, 0xC6, 0x3A,
+  0x02, 0x1F, 0x82, 0x34, 0xCD, 0x43, 0x06, 0x0C, 0x83, 0xBD, 0x9D, 0x78, 0x2C, 0x1D, 0x02, 0x81,
+  0x2C, 0xAD, 0xC0, 0x86, 0x4B, 0x80, 0x7B, 0x04, 0x13, 0x85, 0x35, 0x14, 0x2E, 0x76, 0x24, 0x24,
+  0x03, 0x05, 0x0E, 0x04, 0x10, 0x01, 0x01, 0x17, 0x82, 0x06, 0x17, 0x17, 0x05, 0x0E, 0x07, 0x06,
+  0x0E, 0x03, 0x82, 0x26, 0x03, 0x03, 0x07, 0x09, 0x01, 0x1E, 0x01, 0x12, 0x05, 0x0B, 0x80, 0x21,
+  0x16, 0x00, 0x01, 0x32, 0x03, 0x18, 0x82, 0x25, 0x18, 0xD4, 0x08, 0x08, 0xC0, 0x35, 0x6E, 0x81,
+  0xC2, 0x1A, 0x08, 0x07, 0x82, 0x66, 0x6F, 0x33, 0x08, 0x15, 0x82, 0x33, 0x2B, 0x29, 0xC0, 0xA9,
+  0x53, 0x81, 0x1B, 0x4C, 0xC0, 0x6A, 0xCE, 0x08, 0x0A, 0x01, 0x1B, 0x81, 0x0A, 0xC6, 0x03, 0x16,
+  0x82, 0x34, 0x31, 0x43, 0x08, 0x0C, 0x80, 0xD0, 0x1D, 0x02, 0x01, 0x27, 0x80, 0x02, 0xC0, 0x27,
+  0x64, 0x80, 0x37, 0x05, 0x13, 0x83, 0x3E, 0xF3, 0x99, 0x24, 0x03, 0x05, 0x80, 0x24, 0x0E, 0x04,
+  0x10, 0x01, 0x01, 0x17, 0x02, 0x06, 0x05, 0x0E, 0x07, 0x06, 0x0E, 0x03, 0x82, 0x26, 0x03, 0x03,
+  0x07, 0x09, 0x01, 0x1E, 0x01, 0x12, 0x05, 0x0B, 0x80, 0x21, 0x16, 0x00, 0x01, 0x32, 0x03, 0x18,
+  0x82, 0x25, 0x18, 0x0B, 0xC0, 0x16, 0x9F, 0x06, 0x08, 0x80, 0x36, 0xC0, 0xD3, 0x65, 0x80, 0x1A,
+  0x09, 0x07, 0x80, 0xA7, 0x0A, 0x15, 0x81, 0x33, 0x40, 0xC0, 0x08, 0x12, 0xC0, 0x0A, 0x64, 0x82,
+  0x72, 0x4C, 0x4D, 0x08, 0x0A, 0x01, 0x1B, 0x81, 0x5A, 0x34, 0x03, 0x16, 0x80, 0xB9, 0xC0, 0xE4,
+  0x53, 0x80, 0x43, 0x02, 0x0C, 0x04, 0x22, 0x81, 0x0C, 0x3D, 0x1D, 0x02, 0x01, 0x27, 0x81, 0x50,
+  0xDA, 0xC0, 0x67, 0x1A, 0x80, 0x2A, 0x04, 0x13, 0x81, 0x35, 0x8F, 0xC0, 0xEE, 0x2B, 0x80, 0x24,
+  0x03, 0x05, 0x80, 0x24, 0x0E, 0x04, 0x10, 0x01, 0x01, 0x17, 0x02, 0x06, 0x05, 0x0E, 0x07, 0x06,
+  0x0E, 0x03, 0x82, 0x26, 0x03, 0x03, 0x07, 0x09, 0x01, 0x1E, 0x01, 0x12, 0x05, 0x0B, 0x80, 0x21,
+  0x16, 0x00, 0x01, 0x32, 0x03, 0x18, 0x01, 0x25, 0x82, 0x21, 0x8E, 0x93, 0x05, 0x08, 0x82, 0x58,
+  0x96, 0x2E, 0x09, 0x07, 0x80, 0x7F, 0x0A, 0x15, 0x81, 0x33, 0x40, 0xC0, 0x07, 0x12, 0xC0, 0x6A,
+  0x74, 0x82, 0x72, 0x4C, 0x4D, 0x0A, 0x0A, 0xC0, 0x49, 0xB6, 0x80, 0x34, 0x03, 0x16, 0x80, 0x02,
+  0xC0, 0xA3, 0x4B, 0x02, 0x0C, 0x05, 0x22, 0x81, 0x43, 0xB2, 0x1D, 0x02, 0x01, 0x27, 0x80, 0x50,
+  0xC0, 0xE7, 0x84, 0xC0, 0x06, 0x33, 0x80, 0x2A, 0x04, 0x13, 0x80, 0x35, 0xC0, 0xAA, 0x12, 0xC0,
+  0xEE, 0x2B, 0x80, 0x24, 0x03, 0x05, 0x80, 0x24, 0x0E, 0x04, 0x10, 0x01, 0x01, 0x17, 0x02, 0x06,
+  0x05, 0x0E, 0x07, 0x06, 0x0E, 0x03, 0x82, 0x26, 0x03, 0x03, 0x07, 0x09, 0x01, 0x1E, 0x01, 0x12,
+  0x05, 0x0B, 0x80, 0x21, 0x16, 0x00, 0x01, 0x32, 0x03, 0x18, 0x01, 0x25, 0x82, 0x21, 0x8A, 0x93,
+  0x02, 0x08, 0x01, 0x7D, 0x81, 0x36, 0x58, 0xC0, 0xD0, 0x44, 0x80, 0x2E, 0x09, 0x07, 0x81, 0x70,
+  0x33, 0x09, 0x15, 0x82, 0x33, 0x2B, 0xB3, 0xC0, 0xCA, 0x84, 0x80, 0x72, 0xC0, 0x69, 0xCE, 0x80,
+  0x4D, 0x08, 0x0A, 0x83, 0x1B, 0x0A, 0x81, 0x63, 0x03, 0x16, 0x80, 0x78, 0xC0, 0x83, 0x43, 0x02,
+  0x0C, 0x05, 0x22, 0x80, 0x43, 0xC0, 0xE4, 0x53, 0x80, 0x39, 0x1C, 0x02, 0x02, 0x27, 0x80, 0x4F,
+  0xC0, 0xA6, 0x53, 0xC0, 0x06, 0x0A, 0x04, 0x13, 0x83, 0x35, 0x82, 0x9F, 0x24, 0x03, 0x05, 0x80,
+  0x24, 0x0E, 0x04, 0x10, 0x01, 0x01, 0x17, 0x02, 0x06, 0x05, 0x0E, 0x07, 0x06, 0x0E, 0x03, 0x82,
+  0x26, 0x03, 0x03, 0x07, 0x09, 0x01, 0x1E, 0x01, 0x12, 0x05, 0x0B, 0x80, 0x21, 0x16, 0x00, 0x01,
+  0x32, 0x03, 0x18, 0x01, 0x25, 0x80, 0x18, 0xC0, 0x77, 0xCF, 0xC0, 0x36, 0x97, 0x85, 0x7D, 0x08,
+  0x08, 0x7D, 0x7D, 0x36, 0xC0, 0xB7, 0x7E, 0x81, 0xEB, 0x1A, 0x09, 0x07, 0x81, 0xB1, 0x33, 0x09,
+  0x15, 0x81, 0x33, 0x40, 0xC0, 0x47, 0x1A, 0xC0, 0x2A, 0x95, 0x82, 0x72, 0x46, 0x4D, 0x07, 0x0A,
+  0x01, 0x1B, 0x81, 0x0A, 0xC6, 0x04, 0x16, 0x80, 0xCE, 0x03, 0x0C, 0x05, 0x22, 0x82, 0x43, 0x9D,
+  0x74, 0x1C, 0x02, 0x01, 0x27, 0x81, 0x50, 0x02, 0xC0, 0x66, 0x6C, 0x80, 0xB3, 0x05, 0x13, 0x82,
+  0x59, 0x4A, 0x24, 0x03, 0x05, 0x80, 0x24, 0x0E, 0x04, 0x10, 0x01, 0x01, 0x17, 0x02, 0x06, 0x05,
+  0x0E, 0x07, 0x06, 0x0E, 0x03, 0x82, 0x26, 0x03, 0x03, 0x07, 0x09, 0x01, 0x1E, 0x01, 0x12, 0x05,
+  0x0B, 0x80, 0x21, 0x16, 0x00, 0x01, 0x32, 0x06, 0x18, 0x80, 0x12, 0xC0, 0x37, 0x9F, 0x02, 0x08,
+  0x82, 0x7D, 0x08, 0x08, 0xC0, 0x76, 0x76, 0x81, 0x4A, 0x2E, 0x08, 0x07, 0x82, 0x3F, 0x7A, 0x33,
+  0x08, 0x15, 0x01, 0x33, 0x80, 0xA4, 0xC0, 0x68, 0x22, 0xC0, 0x6A, 0x9D, 0x81, 0x54, 0x4D, 0x08,
+  0x0A, 0x02, 0x1B, 0x80, 0x34, 0x04, 0x16, 0xC0, 0x86, 0x6C, 0x09, 0x22, 0x82, 0x43, 0x89, 0x78,
+  0x1E, 0x02, 0x01, 0x2C, 0x80, 0xFC, 0xC0, 0xA7, 0x22, 0x80, 0x35, 0x03, 0x13, 0x83, 0x35, 0x68,
+  0x64, 0x76, 0x03, 0x05, 0x80, 0x24, 0x0E, 0x04, 0x10, 0x01, 0x01, 0x17, 0x02, 0x06, 0x05, 0x0E,
+  0x07, 0x06, 0x0E, 0x03, 0x82, 0x26, 0x03, 0x03, 0x07, 0x09, 0x01, 0x1E, 0x01, 0x12, 0x05, 0x0B,
+  0x80, 0x21, 0x16, 0x00, 0x01, 0x32, 0x06, 0x18, 0x81, 0x21, 0x9A, 0x02, 0x08, 0x85, 0x7D, 0x36,
+  0xA9, 0xCB, 0x1A, 0x1A, 0x08, 0x07, 0x80, 0x2E, 0xC0, 0x6A, 0x0A, 0x80, 0x33, 0x08, 0x15, 0x01,
+  0x33, 0x80, 0xA4, 0xC0, 0x88, 0x22, 0xC0, 0x8A, 0xA5, 0x81, 0x54, 0x4D, 0x08, 0x0A, 0x01, 0x1B,
+  0x81, 0x5A, 0x34, 0x02, 0x16, 0x83, 0x63, 0xB9, 0x95, 0x43, 0x08, 0x22, 0x82, 0x0C, 0xDE, 0xCD,
+  0x1D, 0x02, 0x02, 0x2C, 0x80, 0xAD, 0xC0, 0x26, 0x3B, 0x80, 0x2A, 0x04, 0x13, 0x82, 0x14, 0x2E,
+  0x55, 0x03, 0x05, 0x80, 0x24, 0x0E, 0x04, 0x10, 0x01, 0x01, 0x17, 0x02, 0x06, 0x05, 0x0E, 0x07,
+  0x06, 0x0E, 0x03, 0x82, 0x26, 0x03, 0x03, 0x07, 0x09, 0x01, 0x1E, 0x01, 0x12, 0x05, 0x0B, 0x80,
+  0x21, 0x16, 0x00, 0x01, 0x32, 0x06, 0x18, 0x81, 0x21, 0x8E, 0x04, 0x08, 0xC0, 0x58, 0x8F, 0x81,
+  0x96, 0xF4, 0x09, 0x07, 0x80, 0x2E, 0xC0, 0x69, 0x02, 0x09, 0x15, 0x01, 0x33, 0x80, 0xA4, 0xC0,
+  0x88, 0x2A, 0xC0, 0xAA, 0xA5, 0x81, 0x54, 0x4D, 0x08, 0x0A, 0x01, 0x1B, 0x81, 0x5A, 0x34, 0x02,
+  0x16, 0x81, 0x63, 0xB8, 0xC0, 0xA4, 0x4B, 0x80, 0x43, 0x09, 0x22, 0x81, 0x0C, 0xCE, 0x1D, 0x02,
+  0x02, 0x2C, 0x80, 0x71, 0xC0, 0xE6, 0x5B, 0x80, 0x37, 0x04, 0x13, 0x82, 0x14, 0x84, 0x55, 0x03,
+  0x05, 0x80, 0x24, 0x0E, 0x04, 0x10, 0x01, 0x01, 0x17, 0x02, 0x06, 0x05, 0x0E, 0x07, 0x06, 0x0E,
+  0x03, 0x82, 0x26, 0x03, 0x03, 0x07, 0x09, 0x01, 0x1E, 0x01, 0x12, 0x05, 0x0B, 0x80, 0x21, 0x16,
+  0x00, 0x01, 0x32, 0x06, 0x18, 0x83, 0x21, 0x8A, 0x93, 0x36, 0x02, 0x08, 0x80, 0xA9, 0xC0, 0xD0,
+  0x44, 0x80, 0xF4, 0x09, 0x07, 0x83, 0x66, 0x6F, 0x15, 0x2B, 0x07, 0x15, 0x01, 0x33, 0x80, 0xA4,
+  0xC0, 0xA7, 0x2A, 0xC0, 0xEA, 0xAD, 0x82, 0x54, 0x4D, 0x4D, 0x07, 0x0A, 0x01, 0x1B, 0x80, 0x5C,
+  0x02, 0x16, 0x81, 0x63, 0x16, 0xC0, 0xC7, 0x74, 0x01, 0x43, 0x09, 0x22, 0x81, 0x0C, 0x3D, 0x1E,
+  0x02, 0x82, 0x2C, 0x50, 0x02, 0xC0, 0x46, 0x64, 0x80, 0xB3, 0x04, 0x13, 0x87, 0x14, 0x77, 0x55,
+  0x05, 0x24, 0x05, 0x05, 0x24, 0x0E, 0x04, 0x10, 0x01, 0x01, 0x17, 0x02, 0x06, 0x05, 0x0E, 0x07,
+  0x06, 0x0E, 0x03, 0x82, 0x26, 0x03, 0x03, 0x07, 0x09, 0x01, 0x1E, 0x01, 0x12, 0x05, 0x0B, 0x80,
+  0x21, 0x16, 0x00, 0x01, 0x32, 0x06, 0x18, 0x80, 0x21, 0xC0, 0x57, 0xCF, 0x80, 0xA0, 0xC0, 0x37,
+  0x87, 0x01, 0x08, 0x83, 0x7D, 0x58, 0x55, 0x2E, 0x09, 0x07, 0x81, 0x66, 0x6F, 0x09, 0x15, 0x82,
+  0xA4, 0x15, 0xA4, 0xC0, 0xA7, 0x2A, 0xC0, 0x0A, 0xB6, 0x82, 0x4C, 0x4D, 0x4D, 0x06, 0x0A, 0x02,
+  0x1B, 0x80, 0xE7, 0x02, 0x16, 0x81, 0x63, 0x6C, 0xC0, 0x05, 0x54, 0x80, 0x79, 0x0A, 0x22, 0x81,
+  0x0C, 0x31, 0x1F, 0x02, 0x82, 0x27, 0x02, 0xDA, 0xC0, 0x47, 0x1A, 0x80, 0x3E, 0x04, 0x13, 0x86,
+  0x8F, 0x99, 0x24, 0x57, 0x24, 0x05, 0x05, 0x0E, 0x04, 0x10, 0x01, 0x01, 0x17, 0x02, 0x06, 0x05,
+  0x0E, 0x07, 0x06, 0x0E, 0x03, 0x82, 0x26, 0x03, 0x03, 0x07, 0x09, 0x01, 0x1E, 0x01, 0x12, 0x05,
+  0x0B, 0x80, 0x21, 0x16, 0x00, 0x01, 0x32, 0x06, 0x18, 0x81, 0x42, 0x5B, 0xC0, 0x16, 0x9F, 0x83,
+  0x36, 0x08, 0x08, 0xA9, 0xC0, 0x56, 0x76, 0x80, 0x4A, 0x0A, 0x07, 0x83, 0x66, 0x6F, 0x15, 0x29,
+  0x07, 0x15, 0x82, 0xA4, 0x33, 0xA4, 0xC0, 0xA7, 0x2A, 0xC0, 0xEA, 0xAD, 0x82, 0x4C, 0x4D, 0x4D,
+  0x06, 0x0A, 0x02, 0x1B, 0x86, 0x81, 0x16, 0x16, 0x63, 0x34, 0xAD, 0x89, 0xC0, 0x85, 0x33, 0x0A,
+  0x22, 0x81, 0x0C, 0xB2, 0x20, 0x02, 0x81, 0x2C, 0xAD, 0xC0, 0xA7, 0x22, 0x80, 0x3E, 0x04, 0x13,
+  0x86, 0xA5, 0x57, 0x05, 0x57, 0x24, 0x05, 0x05, 0x0E, 0x04, 0x10, 0x01, 0x01, 0x17, 0x02, 0x06,
+  0x05, 0x0E, 0x07, 0x06, 0x0E, 0x03, 0x82, 0x26, 0x03, 0x03, 0x07, 0x09, 0x01, 0x1E, 0x01, 0x12,
+  0x05, 0x0B, 0x80, 0x21, 0x16, 0x00, 0x01, 0x32, 0x07, 0x18, 0x81, 0x0B, 0x9A, 0x02, 0x08, 0x82,
+  0xA9, 0xC3, 0x1A, 0x0A, 0x07, 0x83, 0x66, 0x15, 0x15, 0x29, 0x07, 0x15, 0x01, 0x33, 0x81, 0xA4,
+  0xEF, 0xC0, 0xCA, 0xAD, 0x80, 0x4C, 0xC0, 0x6A, 0xCE, 0x07, 0x0A, 0x02, 0x1B, 0x80, 0x62, 0x02,
+  0x16, 0x82, 0x34, 0xCD, 0x0C, 0x0B, 0x22, 0x82, 0x0C, 0x95, 0x4F, 0x1F, 0x02, 0x81, 0x2C, 0xB8,
+  0xC0, 0x07, 0x33, 0x80, 0x7B, 0x04, 0x13, 0x82, 0xC7, 0x45, 0x05, 0x02, 0x24, 0x80, 0x05, 0x0E,
+  0x04, 0x10, 0x01, 0x01, 0x17, 0x02, 0x06, 0x05, 0x0E, 0x07, 0x06, 0x0E, 0x03, 0x82, 0x26, 0x03,
+  0x03, 0x07, 0x09, 0x01, 0x1E, 0x01, 0x12, 0x05, 0x0B, 0x80, 0x21, 0x16, 0x00, 0x01, 0x32, 0x07,
+  0x18, 0x81, 0x21, 0x8E, 0x02, 0x08, 0x80, 0x60, 0xC0, 0xF1, 0x4C, 0x80, 0x2E, 0x0A, 0x07, 0x80,
+  0xDB, 0x0A, 0x15, 0x01, 0x33, 0x81, 0x40, 0xEF, 0xC0, 0xAA, 0xA5, 0x80, 0x4C, 0xC0, 0x69, 0xCE,
+  0x07, 0x0A, 0x02, 0x1B, 0x86, 0x62, 0x16, 0x16, 0x63, 0x34, 0xF8, 0xBD, 0xC0, 0x85, 0x33, 0x0A,
+  0x22, 0x80, 0x0C, 0xC0, 0x04, 0x5C, 0x80, 0x4F, 0x1F, 0x02, 0x81, 0x2C, 0xB8, 0xC0, 0x67, 0x43,
+  0xC0, 0xC6, 0x01, 0x04, 0x13, 0x82, 0x59, 0xC2, 0x05, 0x02, 0x24, 0x80, 0x05, 0x0E, 0x04, 0x10,
+  0x01, 0x01, 0x17, 0x02, 0x06, 0x05, 0x0E, 0x07, 0x06, 0x0E, 0x03, 0x82, 0x26, 0x03, 0x03, 0x07,
+  0x09, 0x01, 0x1E, 0x01, 0x12, 0x05, 0x0B, 0x80, 0x21, 0x16, 0x00, 0x01, 0x32, 0x07, 0x18, 0x82,
+  0x21, 0xBC, 0x08, 0xC0, 0x37, 0x87, 0x81, 0x7D, 0x58, 0xC0, 0x6F, 0x3C, 0x80, 0x2E, 0x0A, 0x07,
+  0x80, 0xDB, 0x0B, 0x15, 0x81, 0x33, 0x40, 0xC0, 0x67, 0x22, 0xC0, 0x8A, 0x9D, 0x80, 0x4C, 0xC0,
+  0x69, 0xCE, 0x07, 0x0A, 0x02, 0x1B, 0x80, 0x9B, 0x02, 0x16, 0xC0, 0x88, 0x9D, 0xC0, 0x05, 0x54,
+  0xC1, 0x85, 0x33, 0x80, 0x22, 0x0A, 0x0C, 0xC0, 0xE4, 0x53, 0x80, 0x4F, 0x1F, 0x02, 0x81, 0x50,
+  0x71, 0xC0, 0xE7, 0x53, 0xC0, 0xE6, 0x09, 0x04, 0x13, 0x86, 0x68, 0x64, 0x5D, 0x05, 0x24, 0x24,
+  0x05, 0x0E, 0x04, 0x10, 0x01, 0x01, 0x17, 0x02, 0x06, 0x05, 0x0E, 0x07, 0x06, 0x0E, 0x03, 0x82,
+  0x26, 0x03, 0x03, 0x07, 0x09, 0x01, 0x1E, 0x01, 0x12, 0x05, 0x0B, 0x80, 0x21, 0x16, 0x00, 0x01,
+  0x32, 0x07, 0x18, 0x82, 0x21, 0xCF, 0x08, 0xC0, 0x37, 0x87, 0x83, 0x7D, 0x58, 0xEB, 0x1A, 0x0A,
+  0x07, 0x80, 0xDB, 0x0A, 0x15, 0x82, 0x33, 0x15, 0x40, 0xC0, 0x67, 0x1A, 0xC0, 0x4A, 0x95, 0x81,
+  0x4C, 0x1B, 0x08, 0x0A, 0x82, 0x1B, 0x5A, 0x34, 0x02, 0x16, 0xC0, 0x47, 0x95, 0x80, 0x9D, 0xC0,
+  0x85, 0x33, 0x80, 0xBD, 0x0B, 0x0C, 0x81, 0x9D, 0x78, 0x1F, 0x02, 0x81, 0x2C, 0x02, 0xC0, 0x67,
+  0x6C, 0x80, 0x37, 0x04, 0x13, 0x86, 0x14, 0x84, 0x5D, 0x05, 0x24, 0x24, 0x05, 0x0E, 0x04, 0x10,
+  0x01, 0x01, 0x17, 0x02, 0x06, 0x05, 0x0E, 0x07, 0x06, 0x0E, 0x03, 0x82, 0x26, 0x03, 0x03, 0x07,
+  0x09, 0x01, 0x1E, 0x01, 0x12, 0x05, 0x0B, 0x80, 0x21, 0x16, 0x00, 0x01, 0x32, 0x08, 0x18, 0x81,
+  0x5B, 0x69, 0xC0, 0x37, 0x87, 0x83, 0x08, 0xA2, 0xEB, 0x1A, 0x0A, 0x07, 0x80, 0xDB, 0x0C, 0x15,
+  0x80, 0x40, 0xC0, 0x47, 0x12, 0xC0, 0x0A, 0x85, 0x81, 0xBB, 0x1B, 0x09, 0x0A, 0x81, 0x5A, 0x34,
+  0x02, 0x16, 0x83, 0x74, 0x89, 0xBD, 0xBD, 0x0B, 0x0C, 0xC0, 0xA4, 0x4B, 0x80, 0x78, 0x20, 0x02,
+  0x81, 0x2C, 0xCD, 0xC0, 0x67, 0x1A, 0x80, 0x2A, 0x03, 0x13, 0x86, 0x14, 0xC0, 0x5D, 0x05, 0x24,
+  0x24, 0x05, 0x0E, 0x04, 0x10, 0x01, 0x01, 0x17, 0x02, 0x06, 0x05, 0x0E, 0x07, 0x06, 0x0E, 0x03,
+  0x82, 0x26, 0x03, 0x03, 0x07, 0x09, 0x01, 0x1E, 0x01, 0x12, 0x05, 0x0B, 0x80, 0x21, 0x16, 0x00,
+  0x01, 0x32, 0x08, 0x18, 0x80, 0x00, 0xC0, 0x37, 0x9F, 0xC0, 0x37, 0x87, 0x83, 0x08, 0xA2, 0xEB,
+  0x1A, 0x0A, 0x07, 0x80, 0x7F, 0x0C, 0x15, 0x81, 0x40, 0xB3, 0xC0, 0xAA, 0x7C, 0x81, 0xBB, 0x1B,
+  0x08, 0x0A, 0x84, 0x1B, 0x5C, 0x34, 0x16, 0x16, 0xC0, 0x88, 0x9D, 0xC0, 0x86, 0x6C, 0x81, 0x0C,
+  0xBD, 0x0C, 0x0C, 0x81, 0xDE, 0xCD, 0x20, 0x02, 0x81, 0x2C, 0x74, 0xC0, 0x07, 0x33, 0x80, 0x2A,
+  0x03, 0x13, 0x80, 0x14, 0xC0, 0xC9, 0x12, 0x01, 0x24, 0x82, 0x57, 0x24, 0x05, 0x0E, 0x04, 0x10,
+  0x01, 0x01, 0x17, 0x02, 0x06, 0x05, 0x0E, 0x07, 0x06, 0x0E, 0x03, 0x82, 0x26, 0x03, 0x03, 0x07,
+  0x09, 0x01, 0x1E, 0x01, 0x12, 0x05, 0x0B, 0x80, 0x21, 0x16, 0x00, 0x01, 0x32, 0x08, 0x18, 0x80,
+  0x00, 0xC0, 0x57, 0xAF, 0x84, 0x93, 0x7D, 0xA2, 0xEB, 0x1A, 0x0A, 0x07, 0x80, 0x7F, 0x0C, 0x15,
+  0x81, 0x40, 0x37, 0xC0, 0x6A, 0x74, 0x81, 0xBB, 0x1B, 0x07, 0x0A, 0x01, 0x1B, 0x83, 0x5C, 0x34,
+  0x16, 0x1F, 0xC0, 0x68, 0x95, 0xC0, 0xE5, 0x4B, 0x0F, 0x0C, 0x83, 0xCE, 0x02, 0x02, 0x27, 0x1D,
+  0x02, 0x81, 0x2C, 0x39, 0xC0, 0xA8, 0x4B, 0xC0, 0x06, 0x0A, 0x04, 0x13, 0x85, 0x82, 0x24, 0x05,
+  0x57, 0x57, 0x24, 0x0E, 0x04, 0x10, 0x01, 0x01, 0x17, 0x02, 0x06, 0x05, 0x0E, 0x07, 0x06, 0x0E,
+  0x03, 0x82, 0x26, 0x03, 0x03, 0x07, 0x09, 0x01, 0x1E, 0x01, 0x12, 0x05, 0x0B, 0x80, 0x21, 0x16,
+  0x00, 0x01, 0x32, 0x06, 0x18, 0x88, 0x25, 0x18, 0x42, 0x8A, 0x93, 0x7D, 0xA2, 0xEB, 0x1A, 0x0A,
+  0x07, 0x80, 0x7F, 0x0C, 0x15, 0x81, 0x2B, 0x13, 0xC0, 0x2A, 0x64, 0x81, 0xF1, 0x1B, 0x07, 0x0A,
+  0x01, 0x1B, 0x84, 0xE7, 0x3A, 0x3A, 0x1F, 0xCD, 0x10, 0x0C, 0xC0, 0xA6, 0x6C, 0x82, 0x02, 0x27,
+  0x27, 0x1D, 0x02, 0x84, 0x2C, 0x39, 0xFE, 0xB3, 0x13, 0x02, 0x14, 0x86, 0x13, 0xC1, 0x45, 0x05,
+  0x57, 0x57, 0x24, 0x0E, 0x04, 0x10, 0x01, 0x01, 0x17, 0x82, 0x06, 0x17, 0x06, 0x05, 0x0E, 0x07,
+  0x06, 0x0E, 0x03, 0x82, 0x26, 0x03, 0x03, 0x07, 0x09, 0x01, 0x1E, 0x01, 0x12, 0x05, 0x0B, 0x80,
+  0x21, 0x16, 0x00, 0x01, 0x32, 0x06, 0x18, 0x01, 0x25, 0x80, 0x42, 0xC0, 0x77, 0xC7, 0x80, 0xA0,
+  0xC0, 0x37, 0x87, 0xC0, 0xD7, 0x7E, 0x80, 0xEB, 0x0B, 0x07, 0x80, 0xEA, 0x0C, 0x15, 0x81, 0x2B,
+  0x13, 0xC0, 0xA9, 0x53, 0x01, 0x1B, 0x08, 0x0A, 0x80, 0x1B, 0xC0, 0xE7, 0xAD, 0x01, 0x3A, 0x80,
+  0xE2, 0xC0, 0x25, 0x54, 0x81, 0x43, 0x22, 0x0E, 0x0C, 0x82, 0x23, 0x02, 0x27, 0x20, 0x02, 0x82,
+  0xDA, 0xEF, 0x13, 0x02, 0x14, 0x80, 0x13, 0xC0, 0x48, 0x02, 0x84, 0x98, 0x05, 0x24, 0x57, 0x24,
+  0x0E, 0x04, 0x10, 0x01, 0x01, 0x17, 0x82, 0x06, 0x17, 0x06, 0x05, 0x0E, 0x07, 0x06, 0x0E, 0x03,
+  0x82, 0x26, 0x03, 0x03, 0x07, 0x09, 0x01, 0x1E, 0x01, 0x12, 0x05, 0x0B, 0x80, 0x21, 0x16, 0x00,
+  0x01, 0x32, 0x06, 0x18, 0x01, 0x25, 0x80, 0x42, 0xC0, 0x77, 0xCF, 0x80, 0xA0, 0xC0, 0x37, 0x87,
+  0xC0, 0xD7, 0x7E, 0x80, 0x55, 0x0B, 0x07, 0x80, 0xEA, 0x0D, 0x15, 0x80, 0x2B, 0xC0, 0x49, 0x43,
+  0x82, 0x5A, 0x1B, 0x1B, 0x07, 0x0A, 0x84, 0x5A, 0x34, 0x3A, 0x3A, 0x6C, 0xC0, 0xE5, 0x4B, 0x81,
+  0x94, 0x22, 0x0E, 0x0C, 0x83, 0x95, 0x02, 0x27, 0x27, 0x1E, 0x02, 0x81, 0x2C, 0x74, 0xC0, 0x07,
+  0x33, 0x80, 0x37, 0x02, 0x14, 0x86, 0x13, 0x68, 0x8B, 0x05, 0x24, 0x57, 0x24, 0x0E, 0x04, 0x10,
+  0x01, 0x01, 0x17, 0x82, 0x06, 0x17, 0x17, 0x05, 0x0E, 0x07, 0x06, 0x0E, 0x03, 0x82, 0x26, 0x03,
+  0x03, 0x07, 0x09, 0x01, 0x1E, 0x01, 0x12, 0x05, 0x0B, 0x80, 0x21, 0x16, 0x00, 0x01, 0x32, 0x06,
+  0x18, 0x02, 0x25, 0x80, 0x12, 0xC0, 0x16, 0x9F, 0xC0, 0x37, 0x87, 0xC0, 0xD6, 0x7E, 0x80, 0x55,
+  0x0B, 0x07, 0x81, 0xDB, 0x6F, 0x0B, 0x15, 0x81, 0x33, 0x40, 0xC0, 0xC8, 0x32, 0xC0, 0x4A, 0xBE,
+  0x81, 0x1B, 0x46, 0x07, 0x0A, 0x84, 0x5C, 0xBE, 0x3A, 0x3A, 0x6C, 0xC0, 0xC5, 0x4B, 0x80, 0x79,
+  0x0E, 0x0C, 0x80, 0x22, 0xC0, 0x05, 0x54, 0x81, 0x74, 0x27, 0x1F, 0x02, 0x81, 0x2C, 0xD1, 0xC0,
+  0x87, 0x43, 0x84, 0x37, 0x13, 0x13, 0x14, 0x13, 0xC0, 0x27, 0x02, 0x81, 0x1A, 0x05, 0x02, 0x24,
+  0x0E, 0x04, 0x10, 0x01, 0x01, 0x17, 0x82, 0x06, 0x17, 0x17, 0x05, 0x0E, 0x07, 0x06, 0x0E, 0x03,
+  0x82, 0x26, 0x03, 0x03, 0x07, 0x09, 0x01, 0x1E, 0x01, 0x12, 0x05, 0x0B, 0x80, 0x21, 0x16, 0x00,
+  0x01, 0x32, 0x06, 0x18, 0x02, 0x25, 0x85, 0x21, 0x9A, 0x7D, 0xD8, 0x55, 0x1A, 0x0A, 0x07, 0x81,
+  0xDB, 0x6F, 0x0B, 0x15, 0x81, 0x33, 0x40, 0xC0, 0xA8, 0x2A, 0xC0, 0x0A, 0xAE, 0x81, 0x1B, 0x46,
+  0x07, 0x0A, 0x86, 0x81, 0xBE, 0x63, 0x63, 0xD1, 0xDE, 0x43, 0x0D, 0x0C, 0x01, 0x22, 0x82, 0x9D,
+  0x74, 0x27, 0x1F, 0x02, 0x81, 0x2C, 0x02, 0xC0, 0x07, 0x5C, 0x80, 0xCC, 0x03, 0x13, 0x82, 0x48,
+  0xCA, 0x05, 0x02, 0x24, 0x0E, 0x04, 0x10, 0x01, 0x01, 0x17, 0x82, 0x06, 0x17, 0x17, 0x05, 0x0E,
+  0x07, 0x06, 0x0E, 0x03, 0x82, 0x26, 0x03, 0x03, 0x07, 0x09, 0x01, 0x1E, 0x01, 0x12, 0x05, 0x0B,
+  0x80, 0x21, 0x16, 0x00, 0x01, 0x32, 0x06, 0x18, 0x02, 0x25, 0x85, 0x21, 0x8E, 0x08, 0xD8, 0x55,
+  0x1A, 0x0A, 0x07, 0x81, 0xDB, 0x6F, 0x0B, 0x15, 0x81, 0x33, 0x40, 0xC0, 0x68, 0x22, 0xC0, 0xAA,
+  0x9D, 0x81, 0x0A, 0x46, 0x07, 0x0A, 0x86, 0x62, 0xBE, 0xBE, 0x34, 0xCE, 0x43, 0x22, 0x0D, 0x0C,
+  0x01, 0x22, 0x84, 0x89, 0xFC, 0x02, 0x27, 0x27, 0x1D, 0x02, 0x83, 0x2C, 0x02, 0xDA, 0xC5, 0x03,
+  0x13, 0x82, 0x48, 0x84, 0x05, 0x02, 0x24, 0x0E, 0x04, 0x10, 0x01, 0x01, 0x17, 0x82, 0x06, 0x17,
+  0x17, 0x05, 0x0E, 0x07, 0x06, 0x0E, 0x03, 0x82, 0x26, 0x03, 0x03, 0x07, 0x09, 0x01, 0x1E, 0x01,
+  0x12, 0x05, 0x0B, 0x80, 0x21, 0x16, 0x00, 0x01, 0x32, 0x07, 0x18, 0x01, 0x25, 0x80, 0x21, 0xC0,
+  0x57, 0xAF, 0x82, 0x08, 0xD8, 0x55, 0x0B, 0x07, 0x81, 0x66, 0x6F, 0x0C, 0x15, 0x80, 0x40, 0xC0,
+  0x48, 0x1A, 0xC0, 0x4A, 0x8D, 0x81, 0x0A, 0x46, 0x06, 0x0A, 0x87, 0x5A, 0xC6, 0x3A, 0xBE, 0x16,
+  0x95, 0x94, 0x22, 0x0D, 0x0C, 0x01, 0x22, 0x84, 0x89, 0xCD, 0x02, 0x27, 0x27, 0x1D, 0x02, 0x01,
+  0x2C, 0x80, 0x74, 0xC0, 0xE7, 0x32, 0x80, 0x35, 0x02, 0x13, 0x80, 0x48, 0xC0, 0x2B, 0x13, 0x01,
+  0x05, 0x01, 0x24, 0x0E, 0x04, 0x10, 0x01, 0x01, 0x17, 0x82, 0x06, 0x17, 0x17, 0x05, 0x0E, 0x07,
+  0x06, 0x0E, 0x03, 0x82, 0x26, 0x03, 0x03, 0x07, 0x09, 0x01, 0x1E, 0x01, 0x12, 0x05, 0x0B, 0x80,
+  0x21, 0x16, 0x00, 0x01, 0x32, 0x07, 0x18, 0x01, 0x25, 0x82, 0x42, 0xBC, 0x08, 0xC0, 0xB6, 0x86,
+  0xC0, 0x2E, 0x34, 0x80, 0x3F, 0x0A, 0x07, 0x80, 0x66, 0xC0, 0x69, 0x02, 0x0C, 0x15, 0x81, 0x29,
+  0xD6, 0xC0, 0xCA, 0x7C, 0x81, 0x0A, 0x46, 0x06, 0x0A, 0x84, 0x5C, 0x34, 0x3A, 0x63, 0xB8, 0xC0,
+  0xC5, 0x4B, 0x0F, 0x0C, 0x01, 0x22, 0x80, 0x0C, 0xC0, 0x86, 0x6C, 0x20, 0x02, 0x82, 0x2C, 0x50,
+  0xD1, 0xC0, 0xA7, 0x53, 0x89, 0x2A, 0x29, 0x13, 0x13, 0x14, 0xBF, 0x24, 0x05, 0x05, 0x24, 0x0E,
+  0x04, 0x10, 0x01, 0x01, 0x17, 0x82, 0x06, 0x17, 0x17, 0x05, 0x0E, 0x07, 0x06, 0x0E, 0x03, 0x82,
+  0x26, 0x03, 0x03, 0x07, 0x09, 0x01, 0x1E, 0x01, 0x12, 0x05, 0x0B, 0x80, 0x21, 0x16, 0x00, 0x01,
+  0x32, 0x07, 0x18, 0x01, 0x25, 0x83, 0x42, 0xCF, 0x69, 0xA2, 0xC0, 0x2E, 0x34, 0x80, 0x2E, 0x0A,
+  0x07, 0x80, 0x2E, 0xC0, 0x69, 0x02, 0x0C, 0x15, 0x81, 0x29, 0x13, 0xC0, 0x6B, 0x6C, 0x81, 0x0A,
+  0x46, 0x06, 0x0A, 0x86, 0xE7, 0x34, 0x3A, 0x34, 0x4F, 0xDE, 0x22, 0x0F, 0x0C, 0x82, 0x22, 0x43,
+  0x23, 0x21, 0x02, 0x81, 0x50, 0x02, 0xC0, 0x67, 0x6C, 0x89, 0xCC, 0x29, 0x13, 0x13, 0x14, 0x8F,
+  0x24, 0x24, 0x05, 0x24, 0x0E, 0x04, 0x10, 0x01, 0x01, 0x17, 0x82, 0x06, 0x17, 0x17, 0x05, 0x0E,
+  0x07, 0x06, 0x0E, 0x03, 0x82, 0x26, 0x03, 0x03, 0x07, 0x09, 0x01, 0x1E, 0x01, 0x12, 0x05, 0x0B,
+  0x80, 0x21, 0x16, 0x00, 0x01, 0x32, 0x07, 0x18, 0x01, 0x25, 0x81, 0x42, 0xE4, 0xC0, 0xF7, 0x96,
+  0x80, 0xA2, 0xC0, 0x2E, 0x34, 0x80, 0x2E, 0x0B, 0x07, 0x80, 0x7A, 0x0C, 0x15, 0x81, 0x2B, 0x29,
+  0xC0, 0xEA, 0x5B, 0x81, 0x0A, 0x46, 0x06, 0x0A, 0x83, 0x62, 0x3A, 0x16, 0x1F, 0xC0, 0x86, 0x74,
+  0xC0, 0x65, 0x43, 0x80, 0x22, 0x0F, 0x0C, 0x85, 0x22, 0x94, 0x95, 0x02, 0x02, 0x27, 0x20, 0x02,
+  0x80, 0xFC, 0xC0, 0xA7, 0x2A, 0x80, 0x35, 0x02, 0x13, 0x81, 0xF6, 0x24, 0x02, 0x05, 0x0E, 0x04,
+  0x10, 0x01, 0x01, 0x17, 0x82, 0x06, 0x17, 0x17, 0x05, 0x0E, 0x07, 0x06, 0x0E, 0x03, 0x82, 0x26,
+  0x03, 0x03, 0x07, 0x09, 0x01, 0x1E, 0x01, 0x12, 0x05, 0x0B, 0x80, 0x21, 0x16, 0x00, 0x01, 0x32,
+  0x07, 0x18, 0x01, 0x25, 0x81, 0x42, 0x8A, 0xC0, 0xF7, 0x96, 0x80, 0x49, 0xC0, 0x6F, 0x3C, 0x80,
+  0x2E, 0x0B, 0x07, 0x80, 0xB1, 0x0C, 0x15, 0x01, 0x29, 0xC0, 0x49, 0x43, 0x81, 0xAB, 0x46, 0x05,
+  0x0A, 0x83, 0x46, 0xC6, 0x16, 0x16, 0xC0, 0x88, 0x9D, 0xC0, 0x25, 0x64, 0x81, 0x79, 0x22, 0x0F,
+  0x0C, 0x81, 0x22, 0xBD, 0xC0, 0xE4, 0x53, 0x82, 0x39, 0x02, 0x27, 0x1F, 0x02, 0x81, 0x50, 0x39,
+  0xC0, 0x68, 0x43, 0x80, 0x2A, 0x02, 0x13, 0xC0, 0x48, 0x02, 0x80, 0x45, 0x02, 0x05, 0x0E, 0x04,
+  0x10, 0x01, 0x01, 0x17, 0x82, 0x06, 0x17, 0x17, 0x05, 0x0E, 0x07, 0x06, 0x0E, 0x03, 0x82, 0x26,
+  0x03, 0x03, 0x07, 0x09, 0x01, 0x1E, 0x01, 0x12, 0x05, 0x0B, 0x80, 0x21, 0x16, 0x00, 0x01, 0x32,
+  0x07, 0x18, 0x01, 0x25, 0x83, 0x42, 0x8A, 0x49, 0x49, 0xC0, 0xAF, 0x44, 0x80, 0x2E, 0x0B, 0x07,
+  0x80, 0x8F, 0x0B, 0x15, 0x82, 0x33, 0x29, 0x5F, 0xC0, 0xC8, 0x2A, 0xC0, 0x2A, 0xB6, 0x80, 0x1B,
+  0x05, 0x0A, 0x84, 0x5C, 0x34, 0x16, 0x16, 0x6C, 0xC0, 0xC5, 0x53, 0x80, 0x79, 0x10, 0x0C, 0x83,
+  0x22, 0x0C, 0x9D, 0x4F, 0x21, 0x02, 0x81, 0x50, 0x02, 0xC0, 0x08, 0x5C, 0xC0, 0xE6, 0x09, 0x02,
+  0x13, 0x81, 0x68, 0x92, 0x02, 0x05, 0x0E, 0x04, 0x10, 0x01, 0x01, 0x17, 0x82, 0x06, 0x17, 0x17,
+  0x05, 0x0E, 0x07, 0x06, 0x0E, 0x03, 0x82, 0x26, 0x03, 0x03, 0x07, 0x09, 0x01, 0x1E, 0x01, 0x12,
+  0x05, 0x0B, 0x80, 0x21, 0x16, 0x00, 0x01, 0x32, 0x07, 0x18, 0x01, 0x25, 0x83, 0x42, 0x8A, 0x49,
+  0x08, 0xC0, 0xF0, 0x4C, 0x80, 0x2E, 0x0B, 0x07, 0x80, 0x70, 0x0B, 0x15, 0x82, 0x33, 0x29, 0x5F,
+  0xC0, 0x67, 0x22, 0xC0, 0xEA, 0xA5, 0x81, 0x1B, 0x46, 0x04, 0x0A, 0x84, 0xC4, 0x63, 0x16, 0x16,
+  0xB8, 0xC0, 0xA5, 0x4B, 0x80, 0x22, 0x11, 0x0C, 0x82, 0x22, 0x89, 0xC8, 0x20, 0x02, 0x01, 0x27,
+  0x80, 0x39, 0xC0, 0x87, 0x6C, 0x80, 0xC5, 0x02, 0x13, 0x81, 0x48, 0xCA, 0x02, 0x05, 0x0E, 0x04,
+  0x10, 0x01, 0x01, 0x17, 0x82, 0x06, 0x17, 0x17, 0x05, 0x0E, 0x07, 0x06, 0x0E, 0x03, 0x82, 0x26,
+  0x03, 0x03, 0x07, 0x09, 0x01, 0x1E, 0x01, 0x12, 0x05, 0x0B, 0x80, 0x21, 0x16, 0x00, 0x01, 0x32,
+  0x07, 0x18, 0x01, 0x25, 0x85, 0x42, 0xBC, 0xD7, 0x7D, 0xFB, 0x1A, 0x0B, 0x07, 0x80, 0xA7, 0x0B,
+  0x15, 0x83, 0x33, 0x29, 0x5F, 0xB3, 0xC0, 0x6A, 0x95, 0x81, 0x0A, 0x1B, 0x04, 0x0A, 0x85, 0x81,
+  0x16, 0x16, 0x1F, 0xAD, 0x89, 0x12, 0x0C, 0x80, 0x22, 0xC0, 0xA4, 0x3B, 0x80, 0xCE, 0x23, 0x02,
+  0x80, 0x78, 0xC0, 0xA6, 0x2A, 0x84, 0x35, 0x13, 0x13, 0x14, 0xBF, 0x02, 0x05, 0x0E, 0x04, 0x10,
+  0x01, 0x01, 0x17, 0x82, 0x06, 0x17, 0x17, 0x05, 0x0E, 0x07, 0x06, 0x0E, 0x03, 0x82, 0x26, 0x03,
+  0x03, 0x07, 0x09, 0x01, 0x1E, 0x01, 0x12, 0x05, 0x0B, 0x80, 0x21, 0x16, 0x00, 0x01, 0x32, 0x07,
+  0x18, 0x01, 0x25, 0x83, 0x42, 0xBC, 0xD7, 0x7D, 0xC0, 0x14, 0x6E, 0x80, 0x64, 0x0B, 0x07, 0x80,
+  0x66, 0xC0, 0x69, 0x02, 0x0B, 0x15, 0x82, 0x33, 0x29, 0x2A, 0xC0, 0xA9, 0x74, 0x81, 0x8D, 0x46,
+  0x03, 0x0A, 0x85, 0x5A, 0xC6, 0x16, 0x16, 0x1F, 0x78, 0x12, 0x0C, 0x01, 0x22, 0x81, 0x0C, 0x23,
+  0x22, 0x02, 0x81, 0x2C, 0x39, 0xC0, 0x27, 0x3B, 0x87, 0x35, 0x13, 0x13, 0x14, 0x82, 0x24, 0x05,
+  0x05, 0x0E, 0x04, 0x10, 0x01, 0x01, 0x17, 0x82, 0x06, 0x17, 0x17, 0x05, 0x0E, 0x07, 0x06, 0x0E,
+  0x03, 0x82, 0x26, 0x03, 0x03, 0x07, 0x09, 0x01, 0x1E, 0x01, 0x12, 0x05, 0x0B, 0x80, 0x21, 0x16,
+  0x00, 0x01, 0x32, 0x07, 0x18, 0x01, 0x25, 0x86, 0x42, 0xBC, 0xD7, 0x08, 0xFA, 0x4A, 0x2E, 0x0A,
+  0x07, 0x81, 0x3F, 0x7A, 0x0B, 0x15, 0x01, 0x29, 0x80, 0x2A, 0xC0, 0x09, 0x5C, 0x81, 0x8D, 0x1B,
+  0x03, 0x0A, 0x83, 0x5C, 0x34, 0x16, 0x16, 0xC0, 0xA8, 0x9D, 0xC0, 0xA6, 0x6C, 0x13, 0x0C, 0x82,
+  0x22, 0xBD, 0x95, 0x22, 0x02, 0x81, 0x50, 0x2C, 0xC0, 0xC7, 0x53, 0x80, 0x2A, 0x02, 0x13, 0x83,
+  0x68, 0x92, 0x05, 0x05, 0x0E, 0x04, 0x10, 0x01, 0x01, 0x17, 0x82, 0x06, 0x17, 0x17, 0x05, 0x0E,
+  0x07, 0x06, 0x0E, 0x03, 0x82, 0x26, 0x03, 0x03, 0x07, 0x09, 0x01, 0x1E, 0x01, 0x12, 0x05, 0x0B,
+  0x80, 0x21, 0x16, 0x00, 0x01, 0x32, 0x07, 0x18, 0x01, 0x25, 0x86, 0x42, 0xBC, 0xD7, 0x08, 0x58,
+  0xEB, 0xF4, 0x0B, 0x07, 0x80, 0x70, 0x0B, 0x15, 0x82, 0x29, 0x2B, 0x35, 0xC0, 0xA9, 0x4B, 0xC0,
+  0x8A, 0xBE, 0x80, 0x1B, 0x03, 0x0A, 0x80, 0x81, 0x02, 0x16, 0xC0, 0xA8, 0x9D, 0x80, 0x23, 0x13,
+  0x0C, 0x81, 0x22, 0xBD, 0xC0, 0x04, 0x54, 0x80, 0x39, 0x21, 0x02, 0x01, 0x2C, 0x81, 0xFE, 0xE0,
+  0x02, 0x13, 0x83, 0x14, 0x84, 0x5D, 0x24, 0x0E, 0x04, 0x10, 0x01, 0x01, 0x17, 0x02, 0x06, 0x05,
+  0x0E, 0x07, 0x06, 0x0E, 0x03, 0x82, 0x26, 0x03, 0x03, 0x07, 0x09, 0x01, 0x1E, 0x01, 0x12, 0x05,
+  0x0B, 0x80, 0x21, 0x16, 0x00, 0x01, 0x32, 0x07, 0x18, 0x01, 0x25, 0x84, 0x42, 0xBC, 0x08, 0x08,
+  0xA9, 0xC0, 0xF0, 0x4C, 0xC0, 0x4B, 0x13, 0x0B, 0x07, 0x80, 0xEA, 0x09, 0x15, 0x80, 0x33, 0x03,
+  0x29, 0xC0, 0x09, 0x33, 0xC0, 0x4A, 0xB6, 0x80, 0x1B, 0x03, 0x0A, 0xC0, 0xC8, 0xAD, 0x03, 0x16,
+  0x80, 0x95, 0x13, 0x0C, 0x83, 0x22, 0x0C, 0x9D, 0x4F, 0x21, 0x02, 0x87, 0x2C, 0x02, 0xDA, 0xC5,
+  0x14, 0x13, 0x13, 0x3E, 0xC0, 0xEA, 0x1A, 0x81, 0x5D, 0x24, 0x0E, 0x04, 0x10, 0x01, 0x01, 0x17,
+  0x02, 0x06, 0x05, 0x0E, 0x07, 0x06, 0x0E, 0x03, 0x82, 0x26, 0x03, 0x03, 0x07, 0x09, 0x01, 0x1E,
+  0x01, 0x12, 0x05, 0x0B, 0x80, 0x21, 0x16, 0x00, 0x01, 0x32, 0x07, 0x18, 0x01, 0x25, 0x86, 0x42,
+  0xBC, 0x49, 0x08, 0xA9, 0xFB, 0xF4, 0x0B, 0x07, 0x81, 0xA7, 0x6F, 0x08, 0x15, 0x80, 0x33, 0x02,
+  0x29, 0xC0, 0x0B, 0x0A, 0xC0, 0x68, 0x22, 0xC0, 0xEA, 0xAD, 0x01, 0x1B, 0x01, 0x0A, 0x81, 0x5C,
+  0x34, 0x02, 0x16, 0x80, 0x6C, 0xC0, 0xE5, 0x53, 0x80, 0x43, 0x12, 0x0C, 0x81, 0x22, 0x0C, 0xC0,
+  0xA3, 0x43, 0x80, 0x78, 0x21, 0x02, 0x82, 0x2C, 0x02, 0xFC, 0xC0, 0xA7, 0x22, 0x85, 0x3E, 0x13,
+  0x13, 0x14, 0x8F, 0x5D, 0xC0, 0x2C, 0x24, 0x0E, 0x04, 0x10, 0x01, 0x01, 0x17, 0x02, 0x06, 0x05,
+  0x0E, 0x07, 0x06, 0x0E, 0x03, 0x82, 0x26, 0x03, 0x03, 0x07, 0x09, 0x01, 0x1E, 0x01, 0x12, 0x05,
+  0x0B, 0x80, 0x21, 0x16, 0x00, 0x01, 0x32, 0x07, 0x18, 0x01, 0x25, 0x81, 0x21, 0x9E, 0x02, 0x08,
+  0xC0, 0x35, 0x6E, 0x81, 0x1A, 0x2E, 0x0A, 0x07, 0x81, 0x2E, 0x7A, 0x09, 0x15, 0x82, 0x33, 0x29,
+  0x29, 0xC0, 0x0B, 0x0A, 0x80, 0xD6, 0xC0, 0x69, 0x95, 0x8B, 0x8D, 0x1B, 0x0A, 0x0A, 0xC4, 0x63,
+  0x16, 0x16, 0x63, 0xB8, 0x9D, 0x43, 0x12, 0x0C, 0x82, 0x22, 0x0C, 0x0C, 0xC0, 0xA6, 0x6C, 0x81,
+  0x02, 0x39, 0x20, 0x02, 0x81, 0x2C, 0x39, 0xC0, 0x27, 0x33, 0x86, 0x3E, 0x13, 0x14, 0x14, 0x82,
+  0x24, 0x05, 0x0E, 0x04, 0x10, 0x01, 0x01, 0x17, 0x02, 0x06, 0x05, 0x0E, 0x07, 0x06, 0x0E, 0x03,
+  0x82, 0x26, 0x03, 0x03, 0x07, 0x09, 0x01, 0x1E, 0x01, 0x12, 0x05, 0x0B, 0x80, 0x21, 0x16, 0x00,
+  0x01, 0x32, 0x07, 0x18, 0x01, 0x25, 0x81, 0x21, 0x8E, 0x02, 0x08, 0x80, 0xD8, 0xC0, 0x2E, 0x34,
+  0x80, 0x2E, 0x0A, 0x07, 0x81, 0x3F, 0x70, 0x0B, 0x15, 0x80, 0x33, 0xC0, 0x0B, 0x0A, 0x80, 0xD6,
+  0xC0, 0xC9, 0x7C, 0xC0, 0xAB, 0xCE, 0x01, 0x1B, 0x81, 0x0A, 0x62, 0x02, 0x16, 0x83, 0x34, 0xAD,
+  0xDE, 0x43, 0x12, 0x0C, 0x85, 0x22, 0x0C, 0x43, 0x23, 0x39, 0x39, 0x20, 0x02, 0x81, 0x2C, 0x02,
+  0xC0, 0xC8, 0x53, 0x84, 0x37, 0x13, 0x14, 0x14, 0xC1, 0xC0, 0xEC, 0x23, 0x80, 0x05, 0x0E, 0x04,
+  0x10, 0x01, 0x01, 0x17, 0x02, 0x06, 0x05, 0x0E, 0x07, 0x06, 0x0E, 0x03, 0x82, 0x26, 0x03, 0x03,
+  0x07, 0x09, 0x01, 0x1E, 0x01, 0x12, 0x05, 0x0B, 0x80, 0x21, 0x16, 0x00, 0x01, 0x32, 0x07, 0x18,
+  0x01, 0x25, 0x85, 0x00, 0x8E, 0x36, 0x08, 0x08, 0x58, 0xC0, 0x31, 0x4D, 0x80, 0x2E, 0x06, 0x1A,
+  0x04, 0x07, 0x81, 0xA7, 0x6F, 0x0B, 0x15, 0x80, 0xA4, 0xC0, 0x08, 0x12, 0xC0, 0x09, 0x64, 0xC0,
+  0x8B, 0xC6, 0x01, 0x1B, 0x81, 0x5A, 0x34, 0x03, 0x16, 0x82, 0x78, 0x43, 0x79, 0x15, 0x0C, 0x82,
+  0x95, 0x39, 0x39, 0x20, 0x02, 0x81, 0x2C, 0x02, 0xC0, 0x48, 0x64, 0x83, 0xE0, 0x29, 0x14, 0x14,
+  0xC0, 0x48, 0x02, 0x81, 0x98, 0x05, 0x0E, 0x04, 0x10, 0x01, 0x01, 0x17, 0x02, 0x06, 0x05, 0x0E,
+  0x07, 0x06, 0x0E, 0x03, 0x82, 0x26, 0x03, 0x03, 0x07, 0x09, 0x01, 0x1E, 0x01, 0x12, 0x05, 0x0B,
+  0x80, 0x21, 0x16, 0x00, 0x01, 0x32, 0x07, 0x18, 0x01, 0x25, 0x82, 0x00, 0xB6, 0x36, 0x02, 0x08,
+  0xC0, 0xD3, 0x65, 0x81, 0x1A, 0x2E, 0x05, 0x1A, 0x04, 0x07, 0x81, 0x3F, 0x7A, 0x0B, 0x15, 0x81,
+  0xFD, 0x29, 0xC0, 0x89, 0x53, 0xC0, 0x6B, 0xC6, 0x01, 0x1B, 0x80, 0x81, 0x03, 0x16, 0x83, 0x1F,
+  0xCE, 0x43, 0x22, 0x15, 0x0C, 0xC0, 0xE4, 0x53, 0x81, 0x4F, 0x39, 0x1F, 0x02, 0x01, 0x27, 0x80,
+  0x2C, 0xC0, 0xC7, 0x7C, 0xC0, 0x66, 0x22, 0x85, 0x29, 0x13, 0x14, 0x68, 0x1A, 0x05, 0x0E, 0x04,
+  0x10, 0x01, 0x01, 0x17, 0x02, 0x06, 0x05, 0x0E, 0x07, 0x06, 0x0E, 0x03, 0x82, 0x26, 0x03, 0x03,
+  0x07, 0x09, 0x01, 0x1E, 0x01, 0x12, 0x05, 0x0B, 0x80, 0x21, 0x16, 0x00, 0x01, 0x32, 0x07, 0x18,
+  0x01, 0x25, 0x82, 0x00, 0xB6, 0x36, 0x02, 0x08, 0xC0, 0x55, 0x76, 0x81, 0x4A, 0x2E, 0x05, 0x1A,
+  0x03, 0x07, 0x82, 0x1A, 0x07, 0xE1, 0x0B, 0x15, 0x81, 0xFD, 0x2B, 0xC0, 0x29, 0x43, 0xC0, 0x4A,
+  0xBE, 0x82, 0x1B, 0x46, 0xC6, 0x02, 0x16, 0xC0, 0xA6, 0x9D, 0x83, 0x1F, 0x31, 0x94, 0x22, 0x15,
+  0x0C, 0xC0, 0xC4, 0x43, 0x82, 0x78, 0x02, 0x39, 0x1E, 0x02, 0x01, 0x27, 0x81, 0x50, 0x74, 0xC0,
+  0x06, 0x33, 0xC0, 0xE9, 0x01, 0x84, 0x13, 0x14, 0x14, 0x84, 0x05, 0x0E, 0x04, 0x10, 0x01, 0x01,
+  0x17, 0x02, 0x06, 0x05, 0x0E, 0x07, 0x06, 0x0E, 0x03, 0x82, 0x26, 0x03, 0x03, 0x07, 0x09, 0x01,
+  0x1E, 0x01, 0x12, 0x05, 0x0B, 0x80, 0x21, 0x16, 0x00, 0x01, 0x32, 0x07, 0x18, 0x01, 0x25, 0x82,
+  0x00, 0xB6, 0x36, 0x02, 0x08, 0x82, 0xA2, 0xEB, 0x2E, 0x05, 0x1A, 0x03, 0x07, 0x83, 0x1A, 0x07,
+  0xDB, 0x6F, 0x0B, 0x15, 0x80, 0x40, 0xC0, 0xC9, 0x2A, 0xC0, 0xEA, 0xAD, 0x82, 0xF1, 0x5A, 0x9B,
+  0x02, 0x16, 0xC0, 0xA6, 0x9D, 0x83, 0x1F, 0xB2, 0x94, 0x22, 0x15, 0x0C, 0xC0, 0x83, 0x3B, 0x82,
+  0xCD, 0x02, 0x39, 0x1E, 0x02, 0x01, 0x27, 0x81, 0x50, 0x02, 0xC0, 0xA7, 0x4B, 0x85, 0x35, 0x6E,
+  0x14, 0x14, 0xC0, 0x24, 0x0E, 0x04, 0x10, 0x01, 0x01, 0x17, 0x02, 0x06, 0x05, 0x0E, 0x07, 0x06,
+  0x11, 0x03, 0x07, 0x09, 0x01, 0x1E, 0x01, 0x12, 0x05, 0x0B, 0x80, 0x21, 0x16, 0x00, 0x01, 0x32,
+  0x07, 0x18, 0x01, 0x25, 0x80, 0x00, 0xC0, 0x16, 0xA7, 0x80, 0x36, 0x03, 0x08, 0xC0, 0x11, 0x4D,
+  0x01, 0x2E, 0x05, 0x1A, 0x03, 0x07, 0x81, 0x1A, 0x2E, 0xC0, 0x6A, 0x0A, 0x0A, 0x15, 0x81, 0x33,
+  0x40, 0xC0, 0x89, 0x1A, 0xC0, 0xA9, 0x9D, 0x85, 0xF1, 0x5A, 0x34, 0x16, 0x16, 0x3A, 0xC0, 0xA6,
+  0x9D, 0x80, 0xE2, 0xC0, 0x04, 0x54, 0x80, 0x43, 0x16, 0x0C, 0x83, 0x43, 0x23, 0x02, 0x27, 0x1E,
+  0x02, 0x02, 0x27, 0x80, 0x50, 0xC0, 0x48, 0x64, 0x85, 0xB3, 0x13, 0x13, 0x14, 0x8F, 0x24, 0x0E,
+  0x04, 0x10, 0x01, 0x01, 0x17, 0x02, 0x06, 0x05, 0x0E, 0x07, 0x06, 0x11, 0x03, 0x07, 0x09, 0x01,
+  0x1E, 0x01, 0x12, 0x05, 0x0B, 0x80, 0x21, 0x16, 0x00, 0x01, 0x32, 0x07, 0x18, 0x01, 0x25, 0x82,
+  0x00, 0x8E, 0x36, 0x02, 0x08, 0x80, 0x7D, 0xC0, 0xD4, 0x65, 0x81, 0x1A, 0x2E, 0x05, 0x1A, 0x03,
+  0x07, 0x81, 0x1A, 0x07, 0xC0, 0xCA, 0x0A, 0x80, 0x68, 0x08, 0x15, 0x01, 0x33, 0x81, 0x40, 0xD2,
+  0xC0, 0x49, 0x8D, 0x81, 0xF1, 0xE7, 0x02, 0x16, 0xC1, 0xA6, 0x9D, 0xC0, 0x67, 0x8D, 0x81, 0x9D,
+  0x43, 0x16, 0x0C, 0x81, 0x43, 0x95, 0x02, 0x27, 0x20, 0x02, 0x80, 0x27, 0xC0, 0xC8, 0x74, 0x85,
+  0xBA, 0x13, 0x13, 0x14, 0xF6, 0x24, 0x0E, 0x04, 0x10, 0x01, 0x01, 0x17, 0x02, 0x06, 0x05, 0x0E,
+  0x07, 0x06, 0x11, 0x03, 0x07, 0x09, 0x01, 0x1E, 0x01, 0x12, 0x05, 0x0B, 0x80, 0x21, 0x16, 0x00,
+  0x01, 0x32, 0x07, 0x18, 0x01, 0x25, 0x81, 0x18, 0x8E, 0x03, 0x08, 0x83, 0x7D, 0xFA, 0x9F, 0x2E,
+  0x05, 0x1A, 0x03, 0x07, 0x81, 0x1A, 0x07, 0xC0, 0x2B, 0x13, 0x80, 0x68, 0x08, 0x15, 0x82, 0x29,
+  0x33, 0x40, 0xC0, 0x29, 0x12, 0xC0, 0x09, 0x7D, 0xC0, 0xA9, 0xBE, 0xC0, 0xE7, 0xAD, 0x02, 0x16,
+  0x80, 0x3A, 0xC0, 0xA6, 0x9D, 0x82, 0xB8, 0x89, 0x43, 0x16, 0x0C, 0x82, 0xBD, 0xF2, 0x4F, 0x02,
+  0x27, 0x20, 0x02, 0xC0, 0xE7, 0x84, 0xC0, 0x06, 0x33, 0x84, 0x35, 0x13, 0x14, 0x82, 0x45, 0x0E,
+  0x04, 0x10, 0x01, 0x01, 0x17, 0x02, 0x06, 0x05, 0x0E, 0x07, 0x06, 0x11, 0x03, 0x07, 0x09, 0x01,
+  0x1E, 0x01, 0x12, 0x05, 0x0B, 0x80, 0x21, 0x16, 0x00, 0x01, 0x32, 0x07, 0x18, 0x01, 0x25, 0x82,
+  0x42, 0xBC, 0x93, 0x03, 0x08, 0x80, 0x60, 0xC0, 0x8F, 0x3C, 0x80, 0xB7, 0x05, 0x1A, 0x03, 0x07,
+  0x01, 0x1A, 0x80, 0x2E, 0xC0, 0x69, 0x02, 0x07, 0x15, 0x83, 0x2B, 0x29, 0x29, 0x40, 0xC0, 0x29,
+  0x12, 0xC0, 0x89, 0x6C, 0x81, 0xAB, 0x34, 0x03, 0x16, 0xC0, 0xA6, 0xA5, 0x81, 0xAD, 0xDE, 0x17,
+  0x0C, 0x85, 0xBD, 0x89, 0xC8, 0x02, 0x27, 0x27, 0x20, 0x02, 0x80, 0x4F, 0xC0, 0x87, 0x4B, 0x84,
+  0x3E, 0x13, 0x14, 0xC1, 0x98, 0x0E, 0x04, 0x10, 0x01, 0x01, 0x17, 0x02, 0x06, 0x05, 0x0E, 0x07,
+  0x06, 0x11, 0x03, 0x07, 0x09, 0x01, 0x1E, 0x01, 0x12, 0x05, 0x0B, 0x80, 0x21, 0x16, 0x00, 0x01,
+  0x32, 0x07, 0x18, 0x01, 0x25, 0x82, 0x18, 0x8A, 0x93, 0x03, 0x08, 0x80, 0xA9, 0xC0, 0x52, 0x55,
+  0x82, 0xF4, 0x2E, 0x2E, 0x03, 0x1A, 0x03, 0x07, 0x01, 0x1A, 0x80, 0x07, 0xC0, 0xCA, 0x0A, 0x07,
+  0x15, 0x84, 0x2B, 0x29, 0x29, 0x40, 0x29, 0xC0, 0x29, 0x64, 0xC0, 0x2A, 0xAE, 0x80, 0x63, 0x03,
+  0x16, 0x82, 0x34, 0x78, 0x43, 0x17, 0x0C, 0x85, 0x22, 0x0C, 0xCE, 0x02, 0x27, 0x27, 0x21, 0x02,
+  0xC0, 0x27, 0x5C, 0x84, 0x37, 0x13, 0x13, 0x59, 0x8B, 0x0E, 0x04, 0x10, 0x01, 0x01, 0x17, 0x02,
+  0x06, 0x05, 0x0E, 0x07, 0x06, 0x11, 0x03, 0x07, 0x09, 0x01, 0x1E, 0x01, 0x12, 0x05, 0x0B, 0x80,
+  0x21, 0x16, 0x00, 0x01, 0x32, 0x07, 0x18, 0x01, 0x25, 0x82, 0x18, 0xD9, 0xA0, 0x03, 0x08, 0x80,
+  0x60, 0xC0, 0x35, 0x6E, 0x81, 0x8B, 0x2E, 0x04, 0x1A, 0x06, 0x07, 0x84, 0x7F, 0x15, 0x15, 0x2B,
+  0x15, 0x02, 0x2B, 0x04, 0x29, 0x80, 0x13, 0xC0, 0xA8, 0x53, 0xC0, 0xC9, 0xA5, 0x04, 0x16, 0x82,
+  0x34, 0xCD, 0x94, 0x17, 0x0C, 0x82, 0x22, 0x43, 0xB2, 0x02, 0x27, 0x21, 0x02, 0xC0, 0x88, 0x6C,
+  0x84, 0xCC, 0x13, 0x13, 0x68, 0x64, 0x0E, 0x04, 0x10, 0x01, 0x01, 0x17, 0x02, 0x06, 0x05, 0x0E,
+  0x07, 0x06, 0x11, 0x03, 0x07, 0x09, 0x01, 0x1E, 0x01, 0x12, 0x05, 0x0B, 0x80, 0x21, 0x16, 0x00,
+  0x01, 0x32, 0x07, 0x18, 0x01, 0x25, 0x80, 0x18, 0xC0, 0x77, 0xC7, 0x80, 0xA0, 0x04, 0x08, 0x80,
+  0xA2, 0xC0, 0x6F, 0x3C, 0x81, 0x2E, 0x07, 0x03, 0x1A, 0x06, 0x07, 0x80, 0x66, 0xC0, 0x49, 0x0A,
+  0x05, 0x2B, 0x04, 0x29, 0x80, 0x6E, 0xC0, 0x48, 0x43, 0xC0, 0x89, 0x9D, 0x04, 0x16, 0x81, 0x34,
+  0xCE, 0xC0, 0x65, 0x33, 0x80, 0x22, 0x16, 0x0C, 0x81, 0x22, 0x94, 0xC0, 0x05, 0x54, 0x81, 0x4F,
+  0x27, 0x22, 0x02, 0xC0, 0xC7, 0x7C, 0x83, 0xBA, 0x35, 0x13, 0x68, 0xC0, 0x4B, 0x23, 0x0E, 0x04,
+  0x10, 0x01, 0x01, 0x17, 0x02, 0x06, 0x05, 0x0E, 0x07, 0x06, 0x11, 0x03, 0x07, 0x09, 0x01, 0x1E,
+  0x01, 0x12, 0x05, 0x0B, 0x80, 0x21, 0x16, 0x00, 0x01, 0x32, 0x07, 0x18, 0x01, 0x25, 0x83, 0x18,
+  0xD4, 0xA0, 0x36, 0x04, 0x08, 0x82, 0xFB, 0x2E, 0x2E, 0x03, 0x1A, 0x06, 0x07, 0x82, 0x3F, 0x7A,
+  0x15, 0x04, 0x2B, 0x05, 0x29, 0xC0, 0x08, 0x3B, 0xC0, 0x68, 0x95, 0x04, 0x16, 0x80, 0x34, 0xC0,
+  0x86, 0x6C, 0x81, 0x94, 0x22, 0x16, 0x0C, 0x85, 0x22, 0x0C, 0x9D, 0x78, 0x02, 0x27, 0x21, 0x02,
+  0x80, 0x74, 0xC0, 0xE6, 0x32, 0x83, 0x3E, 0x13, 0x48, 0x77, 0x0E, 0x04, 0x10, 0x01, 0x01, 0x17,
+  0x02, 0x06, 0x05, 0x0E, 0x07, 0x06, 0x11, 0x03, 0x07, 0x09, 0x01, 0x1E, 0x01, 0x12, 0x05, 0x0B,
+  0x80, 0x21, 0x16, 0x00, 0x01, 0x32, 0x07, 0x18, 0x01, 0x25, 0x81, 0x18, 0x5B, 0xC0, 0x16, 0x9F,
+  0x80, 0x36, 0x04, 0x08, 0xC0, 0x75, 0x76, 0xC0, 0xEC, 0x23, 0x80, 0x2E, 0x03, 0x1A, 0x07, 0x07,
+  0x81, 0x70, 0x15, 0x06, 0x2B, 0x01, 0x29, 0x81, 0x2B, 0x29, 0xC0, 0x08, 0x3B, 0xC0, 0x68, 0x95,
+  0x04, 0x16, 0x83, 0x34, 0x23, 0x94, 0x22, 0x14, 0x0C, 0x03, 0x22, 0x83, 0x89, 0xCE, 0x02, 0x27,
+  0x21, 0x02, 0x80, 0x39, 0xC0, 0x66, 0x43, 0x83, 0x2A, 0x13, 0x48, 0xF3, 0x0E, 0x04, 0x10, 0x01,
+  0x01, 0x17, 0x02, 0x06, 0x05, 0x0E, 0x07, 0x06, 0x11, 0x03, 0x07, 0x09, 0x01, 0x1E, 0x01, 0x12,
+  0x05, 0x0B, 0x80, 0x21, 0x16, 0x00, 0x01, 0x32, 0x07, 0x18, 0x01, 0x25, 0x83, 0x18, 0x0B, 0xB6,
+  0x36, 0x04, 0x08, 0xC0, 0xF6, 0x86, 0xC0, 0xAF, 0x3C, 0x80, 0x2E, 0x03, 0x1A, 0x07, 0x07, 0x80,
+  0x66, 0xC0, 0x4A, 0x0A, 0x08, 0x2B, 0x01, 0x29, 0xC0, 0x67, 0x43, 0xC0, 0x88, 0x9D, 0x80, 0x3A,
+  0x03, 0x16, 0x83, 0x1F, 0x23, 0x94, 0x22, 0x17, 0x0C, 0x83, 0x22, 0x0C, 0x23, 0x27, 0x21, 0x02,
+  0x81, 0x27, 0x02, 0xC0, 0xE6, 0x53, 0x01, 0x13, 0x80, 0x14, 0xC0, 0xEB, 0x1A, 0x0E, 0x04, 0x10,
+  0x01, 0x01, 0x17, 0x02, 0x06, 0x05, 0x0E, 0x07, 0x06, 0x11, 0x03, 0x07, 0x09, 0x01, 0x1E, 0x01,
+  0x12, 0x05, 0x0B, 0x80, 0x21, 0x16, 0x00, 0x01, 0x32, 0x03, 0x18, 0x80, 0x25, 0x02, 0x18, 0x02,
+  0x25, 0x82, 0x00, 0xB6, 0x36, 0x05, 0x08, 0xC0, 0xB2, 0x5D, 0x04, 0x1A, 0x07, 0x07, 0x81, 0x3F,
+  0x7A, 0x07, 0x2B, 0x01, 0x29, 0xC0, 0x29, 0x12, 0xC0, 0xC7, 0x53, 0xC0, 0x88, 0x9D, 0x01, 0x3A,
+  0x02, 0x16, 0x83, 0x1F, 0xB2, 0x94, 0x22, 0x17, 0x0C, 0x81, 0x22, 0x0C, 0xC0, 0x05, 0x5C, 0x80,
+  0x4F, 0x22, 0x02, 0x84, 0x2C, 0xFE, 0xB3, 0x13, 0x14, 0xC0, 0xCB, 0x1A, 0x0A, 0x04, 0x02, 0x01,
+  0x80, 0x04, 0x10, 0x01, 0x01, 0x17, 0x02, 0x06, 0x05, 0x0E, 0x07, 0x06, 0x11, 0x03, 0x07, 0x09,
+  0x01, 0x1E, 0x01, 0x12, 0x05, 0x0B, 0x80, 0x21, 0x16, 0x00, 0x81, 0x32, 0x42, 0x03, 0x18, 0x80,
+  0x25, 0x02, 0x18, 0x02, 0x25, 0x84, 0x21, 0x9A, 0x36, 0x08, 0x49, 0x03, 0x08, 0x81, 0xFA, 0x99,
+  0x03, 0x1A, 0x08, 0x07, 0x80, 0xE1, 0x06, 0x2B, 0x01, 0x29, 0x80, 0x5F, 0xC0, 0x29, 0x12, 0xC0,
+  0x28, 0x64, 0xC0, 0xA8, 0x9D, 0x01, 0x3A, 0x02, 0x16, 0x83, 0x1F, 0xB2, 0x94, 0x22, 0x17, 0x0C,
+  0x01, 0x22, 0x81, 0x9D, 0xEE, 0x02, 0x02, 0x80, 0x39, 0x1E, 0x02, 0x80, 0x2C, 0xC0, 0xC8, 0x74,
+  0xC0, 0x47, 0x1A, 0x81, 0x13, 0x14, 0xC0, 0xCA, 0x1A, 0x0A, 0x04, 0x14, 0x01, 0x01, 0x17, 0x02,
+  0x06, 0x05, 0x0E, 0x07, 0x06, 0x11, 0x03, 0x07, 0x09, 0x01, 0x1E, 0x01, 0x12, 0x05, 0x0B, 0x80,
+  0x21, 0x16, 0x00, 0x81, 0x18, 0x42, 0x03, 0x18, 0x80, 0x25, 0x03, 0x18, 0x01, 0x25, 0x84, 0x21,
+  0x9A, 0x36, 0x08, 0x49, 0x03, 0x08, 0x80, 0x58, 0xC0, 0xB1, 0x44, 0x80, 0x2E, 0x02, 0x1A, 0x08,
+  0x07, 0x80, 0xA7, 0xC0, 0x49, 0x0A, 0x80, 0x29, 0x04, 0x2B, 0x01, 0x29, 0x81, 0x5F, 0xD6, 0xC0,
+  0x68, 0x6C, 0xC0, 0xA8, 0x9D, 0x04, 0x16, 0x83, 0x1F, 0xEC, 0x94, 0x22, 0x17, 0x0C, 0x01, 0x22,
+  0x81, 0xDE, 0xCE, 0x02, 0x02, 0x80, 0x39, 0x1E, 0x02, 0x81, 0x2C, 0x74, 0xC0, 0xA6, 0x2A, 0x81,
+  0x13, 0x14, 0xC0, 0xAA, 0x12, 0x0A, 0x04, 0x14, 0x01, 0x02, 0x17, 0x01, 0x06, 0x05, 0x0E, 0x08,
+  0x06, 0x10, 0x03, 0x07, 0x09, 0x01, 0x1E, 0x01, 0x12, 0x05, 0x0B, 0x80, 0x21, 0x16, 0x00, 0x81,
+  0x18, 0x42, 0x03, 0x18, 0x01, 0x25, 0x01, 0x18, 0x02, 0x25, 0x84, 0x21, 0x8E, 0x36, 0x08, 0x49,
+  0x03, 0x08, 0x80, 0xA9, 0xC0, 0xB4, 0x65, 0x82, 0x1A, 0x07, 0x1A, 0x09, 0x07, 0xC0, 0x4D, 0x1B,
+  0xC0, 0x6A, 0x0A, 0x05, 0x2B, 0x01, 0x29, 0x80, 0x40, 0xC0, 0x49, 0x12, 0xC0, 0xA8, 0x74, 0x80,
+  0x34, 0x04, 0x16, 0x83, 0x1F, 0xEC, 0x94, 0x22, 0x17, 0x0C, 0x01, 0x22, 0x85, 0x0C, 0xF8, 0x39,
+  0x02, 0x39, 0x39, 0x1E, 0x02, 0x81, 0x2C, 0xAD, 0xC0, 0x26, 0x3B, 0x81, 0x35, 0x14, 0xC0, 0x69,
+  0x12, 0x0A, 0x04, 0x14, 0x01, 0x02, 0x17, 0x01, 0x06, 0x05, 0x0E, 0x08, 0x06, 0x0C, 0x03, 0x02,
+  0x26, 0x01, 0x03, 0x06, 0x09, 0x01, 0x1E, 0x01, 0x12, 0x05, 0x0B, 0x80, 0x21, 0x16, 0x00, 0x81,
+  0x18, 0x42, 0x03, 0x18, 0x06, 0x25, 0x82, 0x21, 0xB6, 0x36, 0x04, 0x08, 0x84, 0x36, 0x7D, 0xFA,
+  0x4A, 0x2E, 0x0A, 0x07, 0x81, 0x3F, 0xE1, 0x05, 0x2B, 0x01, 0x29, 0x80, 0x40, 0xC0, 0x49, 0x1A,
+  0xC0, 0xC8, 0x7C, 0x80, 0x34, 0x04, 0x16, 0x83, 0x1F, 0xEC, 0x94, 0x22, 0x17, 0x0C, 0x01, 0x22,
+  0x80, 0x43, 0xC0, 0x05, 0x54, 0x80, 0x4F, 0x02, 0x39, 0x1E, 0x02, 0x81, 0x2C, 0x71, 0xC0, 0x86,
+  0x4B, 0xC0, 0xC8, 0x01, 0x81, 0x14, 0x59, 0x0A, 0x04, 0x14, 0x01, 0x02, 0x17, 0x01, 0x06, 0x05,
+  0x0E, 0x08, 0x06, 0x0C, 0x03, 0x02, 0x26, 0x01, 0x03, 0x06, 0x09, 0x01, 0x1E, 0x01, 0x12, 0x05,
+  0x0B, 0x80, 0x21, 0x16, 0x00, 0x81, 0x18, 0x42, 0x03, 0x18, 0x05, 0x25, 0x86, 0x18, 0x0B, 0xB6,
+  0x36, 0x08, 0x08, 0x36, 0x03, 0x08, 0x80, 0x58, 0xC0, 0x90, 0x3C, 0x81, 0xF4, 0x1A, 0x0A, 0x07,
+  0x82, 0xA7, 0x2B, 0x29, 0x03, 0x2B, 0x01, 0x29, 0x80, 0x40, 0xC0, 0x48, 0x1A, 0xC0, 0xC8, 0x7C,
+  0x80, 0x34, 0x04, 0x16, 0x83, 0x1F, 0xB2, 0x94, 0x22, 0x17, 0x0C, 0x01, 0x22, 0x81, 0x79, 0x89,
+  0xC0, 0xC5, 0x7C, 0x82, 0x02, 0x39, 0x39, 0x1E, 0x02, 0x81, 0x2C, 0x71, 0xC0, 0xE6, 0x5B, 0xC0,
+  0xC8, 0x09, 0x81, 0x3E, 0x6E, 0x0A, 0x04, 0x14, 0x01, 0x02, 0x17, 0x01, 0x06, 0x05, 0x0E, 0x08,
+  0x06, 0x0C, 0x03, 0x02, 0x26, 0x01, 0x03, 0x06, 0x09, 0x01, 0x1E, 0x01, 0x12, 0x05, 0x0B, 0x80,
+  0x21, 0x16, 0x00, 0x81, 0x18, 0x42, 0x03, 0x18, 0x05, 0x25, 0x81, 0x18, 0x5B, 0xC0, 0x16, 0x9F,
+  0x03, 0x36, 0x02, 0x08, 0x82, 0x36, 0xA9, 0x96, 0xC0, 0x4B, 0x13, 0x01, 0x1A, 0x09, 0x07, 0x81,
+  0x3F, 0x7A, 0x04, 0x2B, 0x01, 0x29, 0x80, 0x5F, 0xC0, 0x48, 0x1A, 0xC0, 0xC7, 0x7C, 0x80, 0x34,
+  0x04, 0x16, 0x83, 0x1F, 0xB2, 0x94, 0x22, 0x17, 0x0C, 0x02, 0x22, 0xC0, 0x63, 0x3B, 0x82, 0x31,
+  0x02, 0x50, 0x02, 0x39, 0x1C, 0x02, 0x80, 0x50, 0xC0, 0x45, 0x8D, 0x83, 0xFE, 0x13, 0x3E, 0x48,
+  0x0A, 0x04, 0x14, 0x01, 0x02, 0x17, 0x01, 0x06, 0x05, 0x0E, 0x08, 0x06, 0x0C, 0x03, 0x02, 0x26,
+  0x01, 0x03, 0x06, 0x09, 0x01, 0x1E, 0x01, 0x12, 0x05, 0x0B, 0x80, 0x21, 0x16, 0x00, 0x81, 0x18,
+  0x42, 0x03, 0x18, 0x05, 0x25, 0x80, 0x18, 0xC0, 0x58, 0xD7, 0xC0, 0xF6, 0x9E, 0x03, 0x36, 0x02,
+  0x08, 0x81, 0x36, 0x08, 0xC0, 0x35, 0x6E, 0x83, 0x1A, 0x2E, 0x1A, 0x1A, 0x09, 0x07, 0x81, 0x70,
+  0x15, 0x03, 0x2B, 0x82, 0x5F, 0x29, 0x5F, 0xC0, 0x48, 0x1A, 0xC0, 0xC7, 0x7C, 0x80, 0x34, 0x04,
+  0x16, 0x83, 0x1F, 0x23, 0x94, 0x22, 0x17, 0x0C, 0x02, 0x22, 0x80, 0x43, 0xC0, 0x05, 0x5C, 0x81,
+  0x4F, 0x2C, 0x1F, 0x02, 0x81, 0x50, 0x2C, 0xC0, 0x87, 0x74, 0xC0, 0x47, 0x1A, 0x81, 0x35, 0x37,
+  0x0A, 0x04, 0x14, 0x01, 0x02, 0x17, 0x01, 0x06, 0x05, 0x0E, 0x08, 0x06, 0x0C, 0x03, 0x02, 0x26,
+  0x01, 0x03, 0x06, 0x09, 0x01, 0x1E, 0x01, 0x12, 0x05, 0x0B, 0x80, 0x21, 0x16, 0x00, 0x81, 0x18,
+  0x42, 0x03, 0x18, 0x05, 0x25, 0x80, 0x18, 0xC0, 0x57, 0xCF, 0xC0, 0xF6, 0x96, 0x03, 0x36, 0x04,
+  0x08, 0x84, 0xD8, 0x55, 0x2E, 0x1A, 0x1A, 0x09, 0x07, 0x81, 0xDB, 0x6F, 0x03, 0x2B, 0x82, 0x5F,
+  0x29, 0x5F, 0xC0, 0x48, 0x1A, 0xC0, 0xA7, 0x7C, 0x80, 0x34, 0x04, 0x16, 0x83, 0x34, 0x23, 0x94,
+  0x22, 0x19, 0x0C, 0x81, 0x22, 0x43, 0xC0, 0xC4, 0x43, 0x82, 0x78, 0x27, 0x27, 0x1E, 0x02, 0x81,
+  0x27, 0x2C, 0xC0, 0xC8, 0x7C, 0x82, 0xEF, 0x35, 0x37, 0x0A, 0x04, 0x14, 0x01, 0x02, 0x17, 0x07,
+  0x0E, 0x08, 0x06, 0x0C, 0x03, 0x02, 0x26, 0x01, 0x03, 0x06, 0x09, 0x01, 0x1E, 0x01, 0x12, 0x05,
+  0x0B, 0x80, 0x21, 0x16, 0x00, 0x81, 0x18, 0x42, 0x03, 0x18, 0x05, 0x25, 0x82, 0x18, 0xD9, 0xD7,
+  0x03, 0x36, 0x04, 0x08, 0x80, 0x58, 0xC0, 0xF0, 0x4C, 0x81, 0xCA, 0x1A, 0x0A, 0x07, 0x81, 0x3F,
+  0x7A, 0x03, 0x2B, 0x85, 0x5F, 0x29, 0x40, 0xD2, 0xDA, 0x34, 0x04, 0x16, 0x83, 0x34, 0x31, 0x94,
+  0x22, 0x1A, 0x0C, 0x84, 0x22, 0x0C, 0x3D, 0x27, 0x27, 0x1F, 0x02, 0x80, 0x2C, 0xC0, 0xE8, 0x7C,
+  0xC0, 0xC7, 0x2A, 0x81, 0x35, 0x13, 0x0A, 0x04, 0x14, 0x01, 0x02, 0x17, 0x07, 0x0E, 0x08, 0x06,
+  0x0C, 0x03, 0x02, 0x26, 0x01, 0x03, 0x06, 0x09, 0x01, 0x1E, 0x01, 0x12, 0x05, 0x0B, 0x80, 0x21,
+  0x16, 0x00, 0x81, 0x18, 0x42, 0x03, 0x18, 0x03, 0x25, 0x84, 0x32, 0x25, 0x18, 0xD9, 0xD7, 0x03,
+  0x36, 0x05, 0x08, 0xC0, 0xD3, 0x65, 0x01, 0x1A, 0x0B, 0x07, 0x81, 0x70, 0x15, 0x02, 0x2B, 0x83,
+  0x5F, 0x29, 0x40, 0xD2, 0xC0, 0x87, 0x74, 0x80, 0x34, 0x04, 0x16, 0x83, 0x34, 0x3D, 0x94, 0x22,
+  0x1A, 0x0C, 0x84, 0x22, 0x0C, 0x95, 0x4F, 0x27, 0x1F, 0x02, 0x81, 0x50, 0x74, 0xC0, 0x27, 0x3B,
+  0x81, 0x2A, 0x13, 0x0A, 0x04, 0x14, 0x01, 0x02, 0x17, 0x07, 0x0E, 0x08, 0x06, 0x0C, 0x03, 0x02,
+  0x26, 0x01, 0x03, 0x06, 0x09, 0x01, 0x1E, 0x01, 0x12, 0x05, 0x0B, 0x80, 0x21, 0x16, 0x00, 0x81,
+  0x18, 0x42, 0x03, 0x18, 0x03, 0x25, 0x84, 0x32, 0x25, 0x18, 0x8A, 0xD7, 0x03, 0x36, 0x05, 0x08,
+  0x82, 0xFA, 0x98, 0x1A, 0x0B, 0x07, 0x88, 0xA7, 0x6F, 0x15, 0x2B, 0x2B, 0x5F, 0x33, 0x40, 0xD6,
+  0xC0, 0x67, 0x6C, 0x80, 0x63, 0x04, 0x16, 0x83, 0x34, 0x3D, 0xBD, 0x22, 0x1A, 0x0C, 0x84, 0x22,
+  0x0C, 0x9D, 0xEE, 0x27, 0x1F, 0x02, 0x81, 0x50, 0xD1, 0xC0, 0xA7, 0x4B, 0x81, 0x2A, 0x13, 0x0A,
+  0x04, 0x14, 0x01, 0x02, 0x17, 0x07, 0x0E, 0x08, 0x06, 0x0C, 0x03, 0x02, 0x26, 0x01, 0x03, 0x06,
+  0x09, 0x01, 0x1E, 0x01, 0x12, 0x05, 0x0B, 0x80, 0x21, 0x16, 0x00, 0x81, 0x18, 0x42, 0x03, 0x18,
+  0x03, 0x25, 0x84, 0x32, 0x25, 0x42, 0x8A, 0x93, 0x03, 0x36, 0x05, 0x08, 0x80, 0x58, 0xC0, 0xD0,
+  0x44, 0x80, 0x1A, 0x0B, 0x07, 0x81, 0x2E, 0x7A, 0x02, 0x15, 0x82, 0xA4, 0x33, 0x5F, 0xC0, 0x29,
+  0x12, 0xC0, 0x47, 0x6C, 0x80, 0x1F, 0x04, 0x16, 0x81, 0x34, 0xCD, 0x1D, 0x0C, 0x84, 0x22, 0x0C,
+  0xCE, 0x27, 0x27, 0x1E, 0x02, 0x81, 0x2C, 0x02, 0xC0, 0x07, 0x5C, 0x81, 0x2A, 0x13, 0x0A, 0x04,
+  0x14, 0x01, 0x02, 0x17, 0x07, 0x0E, 0x08, 0x06, 0x0C, 0x03, 0x02, 0x26, 0x01, 0x03, 0x06, 0x09,
+  0x01, 0x1E, 0x01, 0x12, 0x05, 0x0B, 0x80, 0x21, 0x16, 0x00, 0x81, 0x18, 0x42, 0x03, 0x18, 0x03,
+  0x25, 0x84, 0x32, 0x25, 0x42, 0x8A, 0x93, 0x03, 0x36, 0x06, 0x08, 0x81, 0x80, 0x92, 0x0C, 0x07,
+  0x80, 0x70, 0x02, 0x15, 0x01, 0x33, 0x80, 0x5F, 0xC0, 0x29, 0x12, 0xC0, 0x28, 0x6C, 0x05, 0x16,
+  0x81, 0x34, 0xFC, 0x1D, 0x0C, 0x84, 0x22, 0x43, 0x31, 0x27, 0x50, 0x1E, 0x02, 0x01, 0x2C, 0x80,
+  0xFE, 0xC0, 0x07, 0x12, 0x80, 0x13, 0x0A, 0x04, 0x14, 0x01, 0x02, 0x17, 0x07, 0x0E, 0x08, 0x06,
+  0x0C, 0x03, 0x02, 0x26, 0x01, 0x03, 0x06, 0x09, 0x01, 0x1E, 0x01, 0x12, 0x05, 0x0B, 0x80, 0x21,
+  0x16, 0x00, 0x81, 0x18, 0x42, 0x03, 0x18, 0x05, 0x25, 0x82, 0x42, 0x8A, 0x93, 0x03, 0x36, 0x06,
+  0x08, 0x82, 0x58, 0xEB, 0x1A, 0x0B, 0x07, 0x80, 0x66, 0xC0, 0x69, 0x02, 0x01, 0x15, 0x01, 0x33,
+  0x81, 0x40, 0xD6, 0xC0, 0x27, 0x64, 0x81, 0x1F, 0x3A, 0x03, 0x16, 0x80, 0x34, 0xC0, 0x07, 0x7D,
+  0x1C, 0x0C, 0x01, 0x22, 0x80, 0x43, 0xC0, 0x05, 0x54, 0x81, 0x4F, 0x50, 0x1E, 0x02, 0x01, 0x2C,
+  0x80, 0xDA, 0xC0, 0x47, 0x12, 0x80, 0x37, 0x0A, 0x04, 0x14, 0x01, 0x02, 0x17, 0x07, 0x0E, 0x08,
+  0x06, 0x0C, 0x03, 0x02, 0x26, 0x01, 0x03, 0x06, 0x09, 0x01, 0x1E, 0x01, 0x12, 0x05, 0x0B, 0x80,
+  0x21, 0x16, 0x00, 0x81, 0x18, 0x42, 0x03, 0x18, 0x05, 0x25, 0x82, 0x18, 0x8A, 0xD7, 0x0A, 0x08,
+  0x82, 0x7D, 0xFB, 0x2E, 0x0B, 0x07, 0x80, 0x3F, 0xC0, 0xCB, 0x0A, 0x03, 0x15, 0x81, 0x40, 0x6E,
+  0xC0, 0x07, 0x64, 0x80, 0x1F, 0x04, 0x16, 0x81, 0x34, 0xAD, 0xC0, 0xA5, 0x43, 0x1A, 0x0C, 0x02,
+  0x22, 0x80, 0xBD, 0xC0, 0xA4, 0x4B, 0x81, 0xC8, 0x27, 0x1E, 0x02, 0x01, 0x2C, 0xC0, 0xC7, 0x7C,
+  0xC0, 0x67, 0x1A, 0x80, 0x37,
+};
+
+#endif // TESTIMAGERLE_H
@@ -0,0 +1,104 @@
+#!/usr/bin/env python3
+"""Compare benchmark output against a stored baseline.
+
+  .pio/build/native/program graphics | tools/bench_compare.py bench/baseline/graphics_native.txt
+  tools/bench_compare.py bench/baseline/graphics_native.txt run.txt --update
+
+Reads "<suite>.<case> key=value ..." lines, from the native runner or a
+serial capture of env:graphics_bench; anything else is ignored. Counters
+that describe the work (checksum, wire_bytes, windows, ...) must match
+exactly. Timings (median_us, host_us, ns_per_*) may be slower than the
+baseline by --tolerance before they count as a regression. Other fields
+are shown but not checked. Exits 1 on any regression or missing case.
+"""
+
+import argparse
+import re
+import sys
+
+LINE = re.compile(r"^([\w]+\.[\w]+)((?:\s+[\w]+=\S+)+)\s*$")
+
+EXACT = {"checksum", "pixels", "windows", "wire_bytes", "segments", "protocol_errors", "mismatches"}
+
+
+def is_timing(key):
+    return key in ("median_us", "host_us") or key.startswith("ns_per_")
+
+
+def parse(lines):
+    cases = {}
+    for line in lines:
+        match = LINE.match(line.strip())
+        if not match:
+            continue
+        fields = dict(pair.split("=", 1) for pair in match.group(2).split())
+        cases[match.group(1)] = fields
+    return cases
+
+
+def number(value):
+    try:
+        return float(value)
+    except ValueError:
+        return None
+
+
+def compare(baseline, current, tolerance, out):
+    failures = 0
+    for name, base in baseline.items():
+        now = current.get(name)
+        if now is None:
+            out.write("MISSING  %s\n" % name)
+            failures += 1
+            continue
+        for key, expected in base.items():
+            actual = now.get(key)
+            if key in EXACT:
+                if actual != expected:
+                    out.write("CHANGED  %s %s: %s -> %s\n" % (name, key, expected, actual))
+                    failures += 1
+            elif is_timing(key):
+                old, new = number(expected), number(actual) if actual is not None else None
+                if old is None or new is None:
+                    continue
+                change = (new - old) / old if old else 0.0
+                slower = change > tolerance
+                out.write("%-8s %s %s: %s -> %s (%+.1f%%)\n"
+                          % ("SLOWER" if slower else "ok", name, key, expected, actual, change * 100))
+                failures += slower
+    for name in sorted(set(current) - set(baseline)):
+        out.write("NEW      %s\n" % name)
+    return failures
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__.split("\n")[0])
+    parser.add_argument("baseline", help="baseline file, benchmark output format")
+    parser.add_argument("input", nargs="?", help="benchmark output (default: stdin)")
+    parser.add_argument("--tolerance", type=float, default=0.10,
+                        help="allowed slowdown of timing fields, as a fraction (default 0.10)")
+    parser.add_argument("--update", action="store_true", help="write the input as the new baseline")
+    args = parser.parse_args()
+
+    lines = open(args.input).read().splitlines() if args.input else sys.stdin.read().splitlines()
+    current = parse(lines)
+    if not current:
+        sys.exit("no benchmark lines in the input")
+
+    if args.update:
+        with open(args.baseline, "w") as f:
+            for line in lines:
+                if LINE.match(line.strip()):
+                    f.write(line.strip() + "\n")
+        print("%s: %d cases" % (args.baseline, len(current)))
+        return
+
+    with open(args.baseline) as f:
+        baseline = parse(f)
+    failures = compare(baseline, current, args.tolerance, sys.stdout)
+    print("%d cases, %d regressions" % (len(baseline), failures))
+    sys.exit(1 if failures else 0)
+
+
+if __name__ == "__main__":
+    main()
@@ -0,0 +1,153 @@
+#!/usr/bin/env python3
+"""Convert an RGB565 C array (ImageConverter 565 style) to the RLE image
+format read by lib/Display/RleImage.
+
+  tools/rgb565_to_rle.py src/test/testImage.h -W 240 -H 320 -o src/test/testImageRle.h
+
+Format (little-endian header, then one independent stream per row):
+  "RI" version(1) reserved(0) width:u16 height:u16 palette_count:u16
+  palette_count x RGB565:u16
+  row ops:
+    0LLLLLLL idx          run of L+1 (1..128) pixels of palette[idx]
+    10LLLLLL idx...       L+1 (1..64) pixels, one palette index each
+    11LLLLLL color:u16    run of L+1 (1..64) pixels of a color not in the palette
+The palette holds the 256 most frequent colors; the rest are stored raw.
+"""
+
+import argparse
+import collections
+import os
+import re
+import struct
+import sys
+
+MAX_RUN = 128
+MAX_LITERAL = 64
+MAX_RAW_RUN = 64
+
+
+def read_array(path):
+    text = open(path).read()
+    body = text.split("{", 1)[1].rsplit("}", 1)[0]
+    body = re.sub(r"//[^\n]*", "", body)
+    body = re.sub(r"/\*.*?\*/", "", body, flags=re.S)
+    values = [v.strip() for v in body.split(",") if v.strip()]
+    return [int(v, 0) & 0xFFFF for v in values]
+
+
+def runs(row):
+    start = 0
+    while start < len(row):
+        end = start + 1
+        while end < len(row) and row[end] == row[start]:
+            end += 1
+        yield row[start], end - start
+        start = end
+
+
+def encode_row(row, index):
+    out = bytearray()
+    literal = []
+
+    def flush_literal():
+        while literal:
+            chunk = literal[:MAX_LITERAL]
+            del literal[:MAX_LITERAL]
+            out.append(0x80 | (len(chunk) - 1))
+            out.extend(chunk)
+
+    for color, count in runs(row):
+        if color not in index:
+            flush_literal()
+            while count:
+                n = min(count, MAX_RAW_RUN)
+                out.append(0xC0 | (n - 1))
+                out.extend(struct.pack("<H", color))
+                count -= n
+        elif count >= 3 or (count == 2 and not literal):
+            # A run op is 2 bytes; two pixels already in a literal cost 2
+            flush_literal()
+            while count:
+                n = min(count, MAX_RUN)
+                out.append(n - 1)
+                out.append(index[color])
+                count -= n
+        else:
+            literal.extend([index[color]] * count)
+    flush_literal()
+    return out
+
+
+def encode(pixels, width, height):
+    if len(pixels) != width * height:
+        sys.exit("expected %d pixels, found %d" % (width * height, len(pixels)))
+    counts = collections.Counter(pixels)
+    palette = [color for color, _ in counts.most_common(256)]
+    index = {color: i for i, color in enumerate(palette)}
+
+    out = bytearray(b"RI")
+    out.extend(struct.pack("<BBHHH", 1, 0, width, height, len(palette)))
+    for color in palette:
+        out.extend(struct.pack("<H", color))
+    for y in range(height):
+        out.extend(encode_row(pixels[y * width:(y + 1) * width], index))
+    return bytes(out)
+
+
+def decode(data):
+    width, height, count = struct.unpack_from("<HHH", data, 4)
+    palette = struct.unpack_from("<%dH" % count, data, 10)
+    pos = 10 + 2 * count
+    pixels = []
+    for _ in range(height):
+        row = []
+        while len(row) < width:
+            op = data[pos]
+            pos += 1
+            if op < 0x80:
+                row.extend([palette[data[pos]]] * (op + 1))
+                pos += 1
+            elif op < 0xC0:
+                n = (op & 0x3F) + 1
+                row.extend(palette[i] for i in data[pos:pos + n])
+                pos += n
+            else:
+                row.extend([struct.unpack_from("<H", data, pos)[0]] * ((op & 0x3F) + 1))
+                pos += 2
+        pixels.extend(row)
+    return pixels
+
+
+def write_header(path, name, data, width, height, source):
+    with open(path, "w") as f:
+        guard = re.sub(r"\W", "_", os.path.basename(path)).upper()
+        f.write("// Generated by tools/rgb565_to_rle.py from %s\n" % os.path.basename(source))
+        f.write("// %dx%d, %d bytes (raw RGB565: %d bytes)\n\n" % (width, height, len(data), width * height * 2))
+        f.write("#ifndef %s\n#define %s\n\n#include <Arduino.h>\n\n" % (guard, guard))
+        f.write("const uint8_t %s[%d] PROGMEM = {\n" % (name, len(data)))
+        for i in range(0, len(data), 16):
+            f.write("  " + ", ".join("0x%02X" % b for b in data[i:i + 16]) + ",\n")
+        f.write("};\n\n#endif // %s\n" % guard)
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__.split("\n")[0])
+    parser.add_argument("input", help="C header with an RGB565 array")
+    parser.add_argument("-W", "--width", type=int, required=True)
+    parser.add_argument("-H", "--height", type=int, required=True)
+    parser.add_argument("-o", "--output", required=True, help="header to write")
+    parser.add_argument("-n", "--name", help="array name (default: output file name)")
+    args = parser.parse_args()
+
+    pixels = read_array(args.input)
+    data = encode(pixels, args.width, args.height)
+    if decode(data) != pixels:
+        sys.exit("round trip failed")
+
+    name = args.name or re.sub(r"\W", "_", os.path.splitext(os.path.basename(args.output))[0])
+    write_header(args.output, name, data, args.width, args.height, args.input)
+    print("%s: %d -> %d bytes (%.1fx)" % (name, len(pixels) * 2, len(data), len(pixels) * 2.0 / len(data)))
+
+
+if __name__ == "__main__":
+    main()
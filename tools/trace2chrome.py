@@ -0,0 +1,148 @@
+#!/usr/bin/env python3
+"""Convert a render trace dump (lib/Trace/RenderTrace) to Chrome trace_event
+JSON, for chrome://tracing or https://ui.perfetto.dev.
+
+  tools/trace2chrome.py render.trace -o render.json
+  tools/trace2chrome.py --port /dev/ttyUSB0 -o render.json   # asks the board
+
+The input may be a raw serial capture: everything before the "RTRC" magic
+is skipped. Dump format, little-endian:
+  "RTRC" version:u8 name_count:u8 event_count:u16 overwritten:u32
+  name_count x (length:u8 chars)
+  event_count x (start_us:u32 duration_us:u32 name:u8 track:u8), oldest first
+A per-probe summary (count, total, max) goes to stderr.
+"""
+
+import argparse
+import collections
+import json
+import struct
+import sys
+
+MAGIC = b"RTRC"
+VERSION = 1
+HEADER = struct.Struct("<4sBBHI")
+EVENT = struct.Struct("<IIBB")
+
+
+def parse(data):
+    start = data.find(MAGIC)
+    if start < 0:
+        sys.exit("no trace dump found (missing RTRC magic)")
+    magic, version, name_count, event_count, overwritten = HEADER.unpack_from(data, start)
+    if version != VERSION:
+        sys.exit("unsupported trace version %d" % version)
+
+    offset = start + HEADER.size
+    names = []
+    for _ in range(name_count):
+        length = data[offset]
+        names.append(data[offset + 1:offset + 1 + length].decode("ascii", "replace"))
+        offset += 1 + length
+
+    if offset + event_count * EVENT.size > len(data):
+        sys.exit("trace dump truncated: %d of %d events"
+                 % ((len(data) - offset) // EVENT.size, event_count))
+
+    events = []
+    for i in range(event_count):
+        start_us, duration_us, name, track = EVENT.unpack_from(data, offset + i * EVENT.size)
+        label = names[name] if name < len(names) else "#%d" % name
+        events.append((start_us, duration_us, label, track))
+    return events, overwritten
+
+
+def unwrap(events):
+    """micros() wraps every 71 minutes; keep the timeline monotonic."""
+    out = []
+    base = 0
+    last = None
+    for start_us, duration_us, name, track in events:
+        if last is not None and start_us + base < last - (1 << 31):
+            base += 1 << 32
+        last = start_us + base
+        out.append((start_us + base, duration_us, name, track))
+    return out
+
+
+def to_chrome(events):
+    origin = min(e[0] for e in events) if events else 0
+    trace = [{"name": name, "ph": "X", "ts": start - origin, "dur": duration, "pid": 0, "tid": track}
+             for start, duration, name, track in events]
+    # Events are recorded as scopes close; sort so parents come first
+    trace.sort(key=lambda e: (e["tid"], e["ts"], -e["dur"]))
+    for track in sorted({e[3] for e in events}):
+        trace.append({"name": "thread_name", "ph": "M", "pid": 0, "tid": track,
+                      "args": {"name": "core %d" % track}})
+    return {"traceEvents": trace, "displayTimeUnit": "ms"}
+
+
+def summarize(events, out):
+    totals = collections.OrderedDict()
+    for _, duration, name, _ in events:
+        count, total, longest = totals.get(name, (0, 0, 0))
+        totals[name] = (count + 1, total + duration, max(longest, duration))
+    out.write("%-28s %8s %10s %8s\n" % ("probe", "count", "total_us", "max_us"))
+    for name, (count, total, longest) in sorted(totals.items(), key=lambda kv: -kv[1][1]):
+        out.write("%-28s %8d %10d %8d\n" % (name, count, total, longest))
+
+
+def read_port(port, baud, timeout):
+    """Asks for a dump and reads exactly one: the firmware keeps printing
+    before and after it, so the end is found from the header, not from
+    the line going quiet."""
+    import serial  # pyserial, only needed to talk to the board
+
+    with serial.Serial(port, baud, timeout=timeout) as link:
+        link.reset_input_buffer()
+        link.write(b"t")
+
+        def read(count):
+            chunk = link.read(count)
+            if len(chunk) < count:
+                sys.exit("trace dump timed out after %d of %d bytes" % (len(chunk), count))
+            return chunk
+
+        # Skip text up to the magic
+        window = b""
+        while window != MAGIC:
+            window = (window + read(1))[-len(MAGIC):]
+
+        header = MAGIC + read(HEADER.size - len(MAGIC))
+        _, _, name_count, event_count, _ = HEADER.unpack(header)
+        data = bytearray(header)
+        for _ in range(name_count):
+            length = read(1)
+            data += length + read(length[0])
+        data += read(event_count * EVENT.size)
+        return bytes(data)
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__.split("\n")[0])
+    parser.add_argument("input", nargs="?", help="dump or serial capture (default: read --port)")
+    parser.add_argument("-o", "--output", required=True, help="JSON file to write")
+    parser.add_argument("--port", help="serial port to request a dump from")
+    parser.add_argument("--baud", type=int, default=921600)
+    parser.add_argument("--timeout", type=float, default=2.0,
+                        help="seconds to wait for the dump before giving up")
+    args = parser.parse_args()
+
+    if args.input:
+        data = open(args.input, "rb").read()
+    elif args.port:
+        data = read_port(args.port, args.baud, args.timeout)
+    else:
+        parser.error("give a dump file or --port")
+
+    events, overwritten = parse(data)
+    events = unwrap(events)
+    with open(args.output, "w") as f:
+        json.dump(to_chrome(events), f)
+
+    summarize(events, sys.stderr)
+    print("%s: %d events (%d overwritten before the dump)" % (args.output, len(events), overwritten))
+
+
+if __name__ == "__main__":
+    main()